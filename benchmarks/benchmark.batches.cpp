@@ -0,0 +1,91 @@
+#include "benchmark.batches.hpp"
+
+#include "benchmark.timer.hpp"
+#include "../vulkan/render/render.batches.hpp"
+#include "../vulkan/render/render.indirect.hpp"
+#include "../vulkan/render/render.statistics.hpp"
+#include "../vulkan/vertex/vertex.instances.hpp"
+#include "../vulkan/vertex/models/models.geometry.hpp"
+#include "../vulkan/uniform/uniform.camera.hpp"
+#include "../config/engine.config.hpp"
+#include "../logs/logs.handler.hpp"
+
+#include <vulkan/vulkan.h>
+#include <glm/glm.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <vector>
+
+// Measure the cost per object of grouping the visible objects into instanced draws, then of writing their indirect draws.
+// The objects share a few small meshes (single level of detail, single cluster) and two textures, like a field of cubes.
+void run_batching_benchmark
+(
+    const size_t &objects_count
+)
+{
+    constexpr int frames_count = 10;
+    constexpr uint32_t meshes_count = 4;
+    const VkExtent2D extent { 1920, 1080 };
+
+    log("Running the batching benchmark with " + std::to_string(objects_count) + " objects..");
+
+    const CameraData camera = get_default_camera();
+
+    MeshRange mesh {};
+    mesh.bounds_center = glm::vec3(0.0f);
+    mesh.bounds_radius = 0.5f;
+    mesh.index_type = VK_INDEX_TYPE_UINT16;
+    mesh.lods.push_back({ 0, 36, 0.0f });
+
+    const std::vector<MeshRange> meshes(meshes_count, mesh);
+    std::vector<RenderObject> objects(objects_count);
+
+    for (size_t i = 0; i < objects_count; i++)
+    {
+        objects[i].mesh = static_cast<uint32_t>(i % meshes_count);
+        objects[i].texture = static_cast<int32_t>(i / meshes_count % 2);
+        objects[i].transform = static_cast<uint32_t>(i);
+        objects[i].model = glm::mat4(1.0f);
+        objects[i].model[3] = glm::vec4(static_cast<float>(i % 1000), static_cast<float>(i / 1000), 0.0f, 1.0f);
+    }
+
+    std::vector<uint32_t> visible(objects_count);
+    std::iota(visible.begin(), visible.end(), 0);
+
+    std::vector<InstanceData> instances(EngineConfig::MAX_SCENE_INSTANCES);
+    std::vector<DrawBatch> batches;
+    DrawStatistics statistics {};
+
+    const auto start = std::chrono::high_resolution_clock::now();
+
+    for (int frame = 0; frame < frames_count; frame++)
+    {
+        statistics = {};
+        build_draw_batches(objects, visible, meshes, camera, extent, 2, instances.data(), batches, statistics);
+    }
+
+    log_benchmark_result("Draw batching (average of " + std::to_string(frames_count) + " frames)", get_elapsed_nanoseconds(start) / frames_count, objects_count, "object");
+
+    std::vector<VkDrawIndexedIndirectCommand> commands;
+    std::vector<IndirectDrawRun> runs;
+    const auto indirect_start = std::chrono::high_resolution_clock::now();
+
+    for (int frame = 0; frame < frames_count; frame++)
+    {
+        write_indirect_draws(batches, objects, meshes, camera, extent, commands, runs, statistics);
+    }
+
+    log_benchmark_result("Indirect draws writing (average of " + std::to_string(frames_count) + " frames)", get_elapsed_nanoseconds(indirect_start) / frames_count, batches.size(), "batch");
+
+    uint32_t instances_count = 0;
+
+    for (const DrawBatch &batch : batches)
+    {
+        instances_count += batch.instance_count;
+    }
+
+    log("Batching benchmark done! " + std::to_string(instances_count) + " instances in " + std::to_string(batches.size()) + " batches, " + std::to_string(commands.size()) + " indirect draws in " + std::to_string(runs.size()) + " runs.");
+}
@@ -0,0 +1,15 @@
+#include <cstddef>
+
+#ifndef BENCHMARK_BATCHES_HPP
+#define BENCHMARK_BATCHES_HPP
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+void run_batching_benchmark
+(
+    const size_t &objects_count
+);
+
+#endif
@@ -0,0 +1,144 @@
+#include "benchmark.culling.hpp"
+
+#include "benchmark.timer.hpp"
+#include "../vulkan/render/render.visibility.hpp"
+#include "../vulkan/uniform/uniform.camera.hpp"
+#include "../vulkan/uniform/uniform.frustum.hpp"
+#include "../vulkan/vertex/models/models.geometry.hpp"
+#include "../logs/logs.handler.hpp"
+
+#include <vulkan/vulkan.h>
+#include <glm/glm.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+// Measure the frustum culling cost per object, with the scalar test, the SIMD test, the threaded visibility stage and the BVH.
+// The objects are spread randomly around the origin, most of them outside of the default camera view.
+void run_culling_benchmark
+(
+    const size_t &objects_count
+)
+{
+    constexpr int frames_count = 10;
+    const VkExtent2D extent { 1920, 1080 };
+
+    log("Running the culling benchmark with " + std::to_string(objects_count) + " objects..");
+
+    const CameraData camera = get_default_camera();
+    const Frustum frustum = extract_frustum(get_camera_projection_matrix(camera, extent) * get_camera_view_matrix(camera));
+
+    MeshRange mesh {};
+    mesh.bounds_center = glm::vec3(0.0f);
+    mesh.bounds_radius = 0.5f;
+
+    const std::vector<MeshRange> meshes = { mesh };
+    std::vector<RenderObject> objects(objects_count);
+
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(-20.0f, 20.0f);
+
+    for (RenderObject &object : objects)
+    {
+        object.mesh = 0;
+        object.texture = 0;
+        object.transform = 0;
+        object.model = glm::mat4(1.0f);
+        object.model[3] = glm::vec4(distribution(generator), distribution(generator), distribution(generator), 1.0f);
+    }
+
+    VisibilityBounds bounds {};
+    std::vector<uint32_t> visible;
+    visible.reserve(objects_count);
+
+    // Bounds update (world spheres in structure of arrays).
+    auto start = std::chrono::high_resolution_clock::now();
+
+    for (int frame = 0; frame < frames_count; frame++)
+    {
+        update_visibility_bounds(objects, meshes, bounds);
+    }
+
+    log_benchmark_result("Bounds update (average of " + std::to_string(frames_count) + " frames)", get_elapsed_nanoseconds(start) / frames_count, objects_count, "object");
+
+    // Scalar test, one sphere at a time.
+    start = std::chrono::high_resolution_clock::now();
+
+    for (int frame = 0; frame < frames_count; frame++)
+    {
+        visible.clear();
+        cull_spheres_scalar(frustum, bounds, 0, bounds.radii.size(), visible);
+    }
+
+    const size_t scalar_count = visible.size();
+    log_benchmark_result("Scalar culling (average of " + std::to_string(frames_count) + " frames)", get_elapsed_nanoseconds(start) / frames_count, objects_count, "object");
+
+    // SIMD test on the rendering thread only.
+    start = std::chrono::high_resolution_clock::now();
+
+    for (int frame = 0; frame < frames_count; frame++)
+    {
+        visible.clear();
+        cull_spheres_simd(frustum, bounds, 0, bounds.radii.size(), visible);
+    }
+
+    const size_t simd_count = visible.size();
+    log_benchmark_result("SIMD culling (average of " + std::to_string(frames_count) + " frames)", get_elapsed_nanoseconds(start) / frames_count, objects_count, "object");
+
+    // Full visibility stage, threaded above the configured amount of objects per thread.
+    start = std::chrono::high_resolution_clock::now();
+
+    for (int frame = 0; frame < frames_count; frame++)
+    {
+        cull_visibility_bounds(frustum, bounds, visible);
+    }
+
+    log_benchmark_result("Threaded culling (average of " + std::to_string(frames_count) + " frames)", get_elapsed_nanoseconds(start) / frames_count, objects_count, "object");
+
+    if (scalar_count != simd_count || simd_count != visible.size())
+    {
+        error_log("The culling methods disagree! Scalar: " + std::to_string(scalar_count) + ", SIMD: " + std::to_string(simd_count) + ", threaded: " + std::to_string(visible.size()) + " visible objects.");
+    }
+
+    // Scene hierarchy: build, frustum query, then refit with a tenth of the objects moving each frame.
+    start = std::chrono::high_resolution_clock::now();
+    update_visibility_bvh(bounds);
+    log_benchmark_result("BVH build (" + std::to_string(bounds.bvh.get_nodes_count()) + " nodes)", get_elapsed_nanoseconds(start), objects_count, "object");
+
+    std::vector<uint32_t> bvh_visible;
+    bvh_visible.reserve(objects_count);
+    start = std::chrono::high_resolution_clock::now();
+
+    for (int frame = 0; frame < frames_count; frame++)
+    {
+        bvh_visible.clear();
+        bounds.bvh.query_frustum(frustum, bvh_visible);
+    }
+
+    log_benchmark_result("BVH culling (average of " + std::to_string(frames_count) + " frames)", get_elapsed_nanoseconds(start) / frames_count, objects_count, "object");
+
+    // The boxes around the spheres are larger than the spheres, so the BVH keeps a few more objects.
+    if (bvh_visible.size() < visible.size())
+    {
+        error_log("The BVH culling missed objects! Spheres: " + std::to_string(visible.size()) + ", BVH: " + std::to_string(bvh_visible.size()) + " visible objects.");
+    }
+
+    start = std::chrono::high_resolution_clock::now();
+
+    for (int frame = 0; frame < frames_count; frame++)
+    {
+        for (size_t i = frame; i < objects_count; i += 10)
+        {
+            bounds.centers_x[i] += 0.1f;
+        }
+
+        update_visibility_bvh(bounds);
+    }
+
+    log_benchmark_result("BVH refit (average of " + std::to_string(frames_count) + " frames)", get_elapsed_nanoseconds(start) / frames_count, objects_count, "object");
+
+    log("Culling benchmark done! " + std::to_string(visible.size()) + "/" + std::to_string(objects_count) + " objects visible.");
+}
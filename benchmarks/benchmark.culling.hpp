@@ -0,0 +1,15 @@
+#include <cstddef>
+
+#ifndef BENCHMARK_CULLING_HPP
+#define BENCHMARK_CULLING_HPP
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+void run_culling_benchmark
+(
+    const size_t &objects_count
+);
+
+#endif
@@ -0,0 +1,135 @@
+#include "benchmark.ecs.hpp"
+
+#include "benchmark.timer.hpp"
+#include "../scene/scene.world.hpp"
+#include "../scene/scene.components.hpp"
+#include "../scene/scene.systems.hpp"
+#include "../scene/scene.hierarchy.hpp"
+#include "../vulkan/vertex/models/models.geometry.hpp"
+#include "../logs/logs.handler.hpp"
+
+#include <glm/glm.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Measure the entity-component system throughput with the scene systems.
+// Every entity has a transform and a scene node, grouped by 8 under a parent node.
+// Three out of four entities also have a velocity and one out of four a mesh renderer (several archetypes).
+void run_ecs_benchmark
+(
+    const size_t &entities_count
+)
+{
+    constexpr int frames_count = 10;
+    constexpr float delta_time = 1.0f / 60.0f;
+
+    log("Running the ECS benchmark with " + std::to_string(entities_count) + " entities..");
+
+    EntityWorld world;
+    TransformHierarchy hierarchy(1);
+    std::vector<Entity> entities;
+    entities.reserve(entities_count);
+
+    // Creation.
+    auto start = std::chrono::high_resolution_clock::now();
+
+    for (size_t i = 0; i < entities_count; i++)
+    {
+        const Entity entity = world.create_entity();
+        const float offset = static_cast<float>(i % 1000);
+
+        const Transform transform { .position = glm::vec3(offset, 0.0f, 0.0f), .rotation = glm::vec3(0.0f), .scale = glm::vec3(1.0f) };
+        const uint32_t parent = i % 8 == 0 ? NO_PARENT_NODE : world.get_component<SceneNode>(entities[i - i % 8])->node;
+
+        world.add_component(entity, transform);
+        world.add_component(entity, SceneNode { .node = hierarchy.create_node(parent, get_transform_matrix(transform)) });
+
+        if (i % 4 != 0)
+        {
+            world.add_component(entity, Velocity { .linear = glm::vec3(0.0f, 1.0f, 0.0f), .angular = glm::vec3(0.0f, 0.0f, 1.0f) });
+        }
+
+        if (i % 4 == 0)
+        {
+            world.add_component(entity, MeshRenderer { .mesh = 0, .texture = 0 });
+        }
+
+        entities.push_back(entity);
+    }
+
+    log_benchmark_result("Creation", get_elapsed_nanoseconds(start), entities_count, "entity");
+
+    // First update of the hierarchy: every node is dirty and the nodes are sorted.
+    start = std::chrono::high_resolution_clock::now();
+    hierarchy.update_transforms();
+    log_benchmark_result("Transform hierarchy sorting and full update", get_elapsed_nanoseconds(start), entities_count, "node");
+
+    hierarchy.clear_frame_changes(0);
+
+    // Movement system iteration.
+    const size_t moving_count = entities_count - (entities_count + 3) / 4;
+    start = std::chrono::high_resolution_clock::now();
+
+    for (int frame = 0; frame < frames_count; frame++)
+    {
+        update_movement_system(world, hierarchy, delta_time);
+    }
+
+    log_benchmark_result("Movement system (average of " + std::to_string(frames_count) + " frames)", get_elapsed_nanoseconds(start) / frames_count, moving_count, "entity");
+
+    // Dirty subtrees update, then an update without any change (static scene).
+    start = std::chrono::high_resolution_clock::now();
+    hierarchy.update_transforms();
+    log_benchmark_result("Transform hierarchy update (" + std::to_string(hierarchy.get_frame_changes(0).size()) + " changed nodes)", get_elapsed_nanoseconds(start), hierarchy.get_frame_changes(0).size(), "node");
+
+    hierarchy.clear_frame_changes(0);
+
+    start = std::chrono::high_resolution_clock::now();
+    hierarchy.update_transforms();
+    log_benchmark_result("Transform hierarchy update (static)", get_elapsed_nanoseconds(start), entities_count, "node");
+
+    // Render objects collection.
+    std::vector<RenderObject> objects;
+    objects.reserve(entities_count);
+    start = std::chrono::high_resolution_clock::now();
+
+    for (int frame = 0; frame < frames_count; frame++)
+    {
+        collect_render_objects(world, hierarchy, objects);
+    }
+
+    log_benchmark_result("Render objects collection (average of " + std::to_string(frames_count) + " frames)", get_elapsed_nanoseconds(start) / frames_count, objects.size(), "entity");
+
+    // Deferred structural changes: destroy half of the entities while iterating over them.
+    size_t destroyed_count = 0;
+    start = std::chrono::high_resolution_clock::now();
+
+    world.for_each<Transform>([&](const Entity &entity, const Transform &)
+    {
+        if (entity.index % 2 == 0)
+        {
+            world.destroy_entity(entity);
+            destroyed_count++;
+        }
+    });
+
+    log_benchmark_result("Deferred destruction", get_elapsed_nanoseconds(start), destroyed_count, "entity");
+
+    // Immediate destruction of the remaining entities.
+    start = std::chrono::high_resolution_clock::now();
+    const size_t remaining_count = world.get_entities_count();
+
+    for (const Entity &entity : entities)
+    {
+        if (world.is_alive(entity))
+        {
+            world.destroy_entity(entity);
+        }
+    }
+
+    log_benchmark_result("Destruction", get_elapsed_nanoseconds(start), remaining_count, "entity");
+    log("ECS benchmark done! " + std::to_string(world.get_entities_count()) + " entities left.");
+}
@@ -0,0 +1,15 @@
+#include <cstddef>
+
+#ifndef BENCHMARK_ECS_HPP
+#define BENCHMARK_ECS_HPP
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+void run_ecs_benchmark
+(
+    const size_t &entities_count
+);
+
+#endif
@@ -0,0 +1,163 @@
+#include "benchmark.jobs.hpp"
+
+#include "benchmark.timer.hpp"
+#include "../jobs/jobs.system.hpp"
+#include "../environment/env.system.hpp"
+#include "../logs/logs.handler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Small computation repeated on each item, heavy enough for the scheduling cost to stay low.
+float compute_benchmark_item
+(
+    const size_t &index
+)
+{
+    float value = static_cast<float>(index);
+
+    for (int i = 0; i < 32; i++)
+    {
+        value = std::sqrt(value * 1.0001f + 1.0f);
+    }
+
+    return value;
+}
+
+// Measure how the job system scales from a single thread to every hardware thread.
+// - Parallel for: a computation split over all the items.
+// - Small jobs: one job per thousand items, to measure the scheduling overhead.
+// - Continuations: a chain of dependent jobs, each one starting once the previous one is done.
+void run_jobs_benchmark
+(
+    const size_t &items_count
+)
+{
+    constexpr int frames_count = 10;
+    const size_t configured_threads = get_job_threads_count();
+    const size_t hardware_threads = get_hardware_threads_count();
+
+    log("Running the jobs benchmark with " + std::to_string(items_count) + " items on up to " + std::to_string(hardware_threads) + " threads..");
+
+    // The reference results come from a single thread.
+    std::vector<float> expected(items_count);
+    std::vector<float> output(items_count);
+
+    for (size_t i = 0; i < items_count; i++)
+    {
+        expected[i] = compute_benchmark_item(i);
+    }
+
+    // Double the threads at each step, the last step using every hardware thread.
+    std::vector<size_t> threads_counts;
+
+    for (size_t threads = 1; threads < hardware_threads; threads *= 2)
+    {
+        threads_counts.push_back(threads);
+    }
+
+    threads_counts.push_back(hardware_threads);
+
+    double single_thread_nanoseconds = 0.0;
+    stop_job_system();
+
+    for (const size_t &threads : threads_counts)
+    {
+        start_job_system(threads);
+        log("Jobs benchmark with " + std::to_string(threads) + " threads:");
+
+        // Parallel for.
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for (int frame = 0; frame < frames_count; frame++)
+        {
+            parallel_for(items_count, 1024, [&output](const size_t &first, const size_t &last)
+            {
+                for (size_t i = first; i < last; i++)
+                {
+                    output[i] = compute_benchmark_item(i);
+                }
+            });
+        }
+
+        const double parallel_nanoseconds = get_elapsed_nanoseconds(start) / frames_count;
+
+        if (threads == 1)
+        {
+            single_thread_nanoseconds = parallel_nanoseconds;
+        }
+
+        log_benchmark_result("Parallel for (average of " + std::to_string(frames_count) + " frames, " + std::to_string(single_thread_nanoseconds / std::max(parallel_nanoseconds, 1.0)) + "x speedup)", parallel_nanoseconds, items_count, "item");
+
+        if (output != expected)
+        {
+            error_log("The parallel for results don't match the single thread ones with " + std::to_string(threads) + " threads!");
+        }
+
+        // Small jobs.
+        const size_t jobs_count = std::max<size_t>(1, items_count / 1000);
+        std::atomic<size_t> done_jobs { 0 };
+        start = std::chrono::high_resolution_clock::now();
+
+        for (int frame = 0; frame < frames_count; frame++)
+        {
+            JobCounter counter;
+
+            for (size_t i = 0; i < jobs_count; i++)
+            {
+                submit_job([&done_jobs]() { done_jobs.fetch_add(1, std::memory_order_relaxed); }, &counter);
+            }
+
+            wait_for_jobs(counter);
+        }
+
+        log_benchmark_result("Small jobs (average of " + std::to_string(frames_count) + " frames)", get_elapsed_nanoseconds(start) / frames_count, jobs_count, "job");
+
+        if (done_jobs.load() != jobs_count * frames_count)
+        {
+            error_log("Some small jobs were lost! " + std::to_string(done_jobs.load()) + "/" + std::to_string(jobs_count * frames_count) + " jobs ran.");
+        }
+
+        // Continuations.
+        constexpr size_t chain_length = 1000;
+        std::vector<JobCounter> chain(chain_length);
+        std::atomic<size_t> chain_position { 0 };
+        bool chain_ordered = true;
+        start = std::chrono::high_resolution_clock::now();
+
+        submit_job([&chain_position]() { chain_position.fetch_add(1); }, &chain[0]);
+
+        for (size_t i = 1; i < chain_length; i++)
+        {
+            submit_job_after(chain[i - 1], [&chain_position, &chain_ordered, i]()
+            {
+                chain_ordered = chain_ordered && chain_position.fetch_add(1) == i;
+            }, &chain[i]);
+        }
+
+        wait_for_jobs(chain[chain_length - 1]);
+        log_benchmark_result("Continuations chain", get_elapsed_nanoseconds(start), chain_length, "job");
+
+        // Every counter must be released before the chain is destroyed.
+        for (JobCounter &counter : chain)
+        {
+            wait_for_jobs(counter);
+        }
+
+        if (!chain_ordered || chain_position.load() != chain_length)
+        {
+            error_log("The continuations chain ran out of order! " + std::to_string(chain_position.load()) + "/" + std::to_string(chain_length) + " jobs ran.");
+        }
+
+        stop_job_system();
+    }
+
+    start_job_system(configured_threads);
+    log("Jobs benchmark done!");
+}
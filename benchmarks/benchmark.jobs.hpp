@@ -0,0 +1,15 @@
+#include <cstddef>
+
+#ifndef BENCHMARK_JOBS_HPP
+#define BENCHMARK_JOBS_HPP
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+void run_jobs_benchmark
+(
+    const size_t &items_count
+);
+
+#endif
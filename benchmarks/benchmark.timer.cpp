@@ -0,0 +1,31 @@
+#include "benchmark.timer.hpp"
+
+#include "../logs/logs.handler.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+// Return the nanoseconds elapsed since a time point.
+double get_elapsed_nanoseconds
+(
+    const std::chrono::high_resolution_clock::time_point &start
+)
+{
+    return std::chrono::duration<double, std::nano>(std::chrono::high_resolution_clock::now() - start).count();
+}
+
+// Log the total and per operation duration of a benchmark step.
+void log_benchmark_result
+(
+    const std::string &name,
+    const double &nanoseconds,
+    const size_t &operations_count,
+    const std::string &operation_name
+)
+{
+    const double milliseconds = nanoseconds / 1000000.0;
+    const double per_operation = operations_count > 0 ? nanoseconds / static_cast<double>(operations_count) : 0.0;
+
+    log("- " + name + ": " + std::to_string(milliseconds) + " ms (" + std::to_string(per_operation) + " ns per " + operation_name + ").");
+}
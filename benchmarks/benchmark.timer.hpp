@@ -0,0 +1,25 @@
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+#ifndef BENCHMARK_TIMER_HPP
+#define BENCHMARK_TIMER_HPP
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+double get_elapsed_nanoseconds
+(
+    const std::chrono::high_resolution_clock::time_point &start
+);
+
+void log_benchmark_result
+(
+    const std::string &name,
+    const double &nanoseconds,
+    const size_t &operations_count,
+    const std::string &operation_name
+);
+
+#endif
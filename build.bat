@@ -14,6 +14,10 @@ if not exist "shaders" (mkdir "shaders")
 
 glslc ../../../game/assets/shaders/default.vert -o ./shaders/default.vert
 glslc ../../../game/assets/shaders/default.frag -o ./shaders/default.frag
+glslc ../../../game/assets/shaders/culling.comp -o ./shaders/culling.comp
+glslc -DOCCLUSION_CULLING ../../../game/assets/shaders/culling.comp -o ./shaders/culling.occlusion.comp
+glslc ../../../game/assets/shaders/depth.pyramid.comp -o ./shaders/depth.pyramid.comp
+glslc -DMULTISAMPLED ../../../game/assets/shaders/depth.pyramid.comp -o ./shaders/depth.pyramid.multisampled.comp
 
 if not exist "textures" (mkdir "textures")
 xcopy "../../../game/assets/textures" "./textures" /E /I /H /Y
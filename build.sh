@@ -13,6 +13,10 @@ mkdir -p shaders
 
 glslc ../../../game/assets/shaders/default.vert -o ./shaders/default.vert
 glslc ../../../game/assets/shaders/default.frag -o ./shaders/default.frag
+glslc ../../../game/assets/shaders/culling.comp -o ./shaders/culling.comp
+glslc -DOCCLUSION_CULLING ../../../game/assets/shaders/culling.comp -o ./shaders/culling.occlusion.comp
+glslc ../../../game/assets/shaders/depth.pyramid.comp -o ./shaders/depth.pyramid.comp
+glslc -DMULTISAMPLED ../../../game/assets/shaders/depth.pyramid.comp -o ./shaders/depth.pyramid.multisampled.comp
 
 cp -r ../../../game/assets/textures ./
 
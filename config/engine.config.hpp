@@ -28,6 +28,173 @@ constexpr const char* LOGS_FILE_NAME = "osge.logs";
 constexpr const bool HANDLE_LINUX_SYSTEMS = true;
 constexpr const bool HANDLE_WINDOWS_SYSTEMS = true;
 
+// Amount of threads running the engine and game jobs, the main thread included.
+// Set to 0 that value to use every hardware thread of the CPU, or to 1 to run everything on the main thread.
+constexpr const unsigned int JOB_THREADS_COUNT = 0;
+
+// Amount of frames the CPU can record while the GPU still renders the previous ones.
+// Each frame in flight has its own command buffers, uniform, transform, instance and indirect buffers, whatever the amount of swap chain images.
+// Note: 2 frames keep the CPU and the GPU busy, more frames add latency and memory for little gain.
+constexpr const unsigned int MAX_FRAMES_IN_FLIGHT = 2;
+
+// Time (in microseconds) spent spinning before each frame deadline when the frame rate is capped ("FPS_CAP" in the game.config file).
+// The frame pacer sleeps until then, as the sleeps can wake up a millisecond or more too late.
+constexpr const unsigned int FRAME_PACER_SPIN_TIME = 1500;
+
+// Set to true that flag to start each frame once the previous one is done, as late as it can still be displayed on time.
+// The inputs are then sampled right before they move the camera used by the culling and the draws, which lowers the latency at the cost of some frame rate.
+// Note: the frames are timed from their presentation on the devices supporting VK_KHR_present_wait, from the GPU otherwise.
+constexpr const bool USE_LOW_LATENCY_MODE = false;
+
+// Time (in microseconds) kept between the expected end of a frame and the next refresh in low latency mode.
+// It absorbs the frames slower than the average, a frame missing the refresh waits for the next one.
+constexpr const unsigned int LOW_LATENCY_MARGIN = 1000;
+
+// Speeds of the camera moved by the arrow keys: its orbit around the target (in degrees per second) and its zoom (in world units per second).
+// Note: the headless runs keep the default camera, so their captures don't depend on the keyboard.
+constexpr const float CAMERA_ORBIT_SPEED = 90.0f;
+constexpr const float CAMERA_ZOOM_SPEED = 2.0f;
+
+// Resolution of the offscreen images rendered in headless mode (started with the "--headless" argument).
+// Note: it doesn't follow the game.config file, so the benchmarks and the regression tests draw the same frames on every machine.
+constexpr const unsigned int HEADLESS_WIDTH = 1280;
+constexpr const unsigned int HEADLESS_HEIGHT = 720;
+
+// Amount of frames rendered in headless mode when the "--frames" argument is missing or not valid.
+constexpr const unsigned int HEADLESS_FRAMES_COUNT = 100;
+
+// Time (in seconds) the game advances at each frame in headless mode, instead of the time really elapsed.
+// Note: that way, a capture only depends on its frames count, not on the speed of the machine, and its golden image stays valid.
+constexpr const float HEADLESS_FRAME_TIME = 1.0f / 60.0f;
+
+// Amount of frames drawn between two window resizes in resize stress mode (started with the "--resize-stress" argument).
+constexpr const unsigned int RESIZE_STRESS_INTERVAL = 5;
+
+// Longest CPU time (in microseconds) of a frame in resize stress mode, the swap chain recreation it waits for included.
+// Note: above it, the program exits with code 1, as the recreations stall the rendering.
+constexpr const unsigned int RESIZE_STRESS_MAX_FRAME_TIME = 50000;
+
+// Largest difference of a channel (from 0 to 255) between a headless capture and its golden image, for a pixel to still match.
+// Note: the drivers don't rasterize and filter exactly the same way, so a tolerance of 0 only suits captures from the same driver.
+constexpr const unsigned int GOLDEN_IMAGE_TOLERANCE = 8;
+
+// Share of the pixels allowed to differ from the golden image by more than the tolerance (0.001 = 0.1%), mostly the edges of the triangles.
+constexpr const float GOLDEN_IMAGE_MAX_DIFFERING_RATIO = 0.001f;
+
+// Set to true that flag to upload the vertices in a compact format to the GPU.
+// When it is enabled, we use:
+// - Half floats for the texture coordinates.
+// - Signed normalized 8 bits integers for the normals.
+// - Unsigned normalized 8 bits integers for the colors (if they are enabled).
+// Note: The positions always stay in full precision floats.
+constexpr const bool USE_COMPACT_VERTEX_FORMAT = true;
+
+// Set to true that flag if your shaders need the vertices colors (input location 3).
+// The 3D models loaders currently set every color to white, so we don't upload them by default.
+constexpr const bool USE_VERTEX_COLORS = false;
+
+// Number of levels of detail generated for each mesh when the 3D models are loaded (the full resolution mesh included).
+// Set to 1 that value to disable the generation of the levels of detail.
+// Note: Each level targets LOD_REDUCTION_RATIO times the triangles of the previous one.
+constexpr const int LOD_LEVELS_COUNT = 4;
+constexpr const float LOD_REDUCTION_RATIO = 0.5f;
+
+// Weight of the normals, colors and texture coordinates differences in the cost ordering the simplification collapses.
+// Increase that value to preserve the shading and the texturing of the meshes at the cost of their shape.
+constexpr const float LOD_ATTRIBUTE_WEIGHT = 0.05f;
+
+// Maximum simplification error (in pixels on the screen) allowed when we choose the level of detail to draw.
+// Lower that value for a better quality, raise it for better performances.
+constexpr const float LOD_PIXEL_ERROR_THRESHOLD = 1.0f;
+
+// Maximum size of the clusters (meshlets) the meshes are split into.
+// Note: 64 vertices and 124 triangles fit the mesh shaders limits of most GPUs.
+constexpr const int MESHLET_MAX_VERTICES = 64;
+constexpr const int MESHLET_MAX_TRIANGLES = 124;
+
+// Set to false that flag to draw every object, even the ones outside of the camera view.
+// When it is enabled, the bounding spheres of the objects are tested against the camera frustum before the draw calls are recorded.
+constexpr const bool USE_FRUSTUM_CULLING = true;
+
+// Minimum amount of objects per job thread for the frustum culling.
+// Below twice that amount, the culling runs on the rendering thread only.
+constexpr const unsigned int VISIBILITY_OBJECTS_PER_THREAD = 32768;
+
+// Set to true that flag to cull the objects through the scene bounding volume hierarchy instead of testing them one by one.
+// It is faster for large scenes with mostly static objects, as whole groups of objects are accepted or rejected at once.
+constexpr const bool USE_BVH_CULLING = false;
+
+// Amount of refits of the scene bounding volume hierarchy before it is rebuilt from scratch.
+// The refitted boxes grow as the objects move, which slowly makes the queries slower.
+constexpr const unsigned int BVH_REBUILD_INTERVAL = 120;
+
+// Set to false that flag to draw every visible mesh entirely.
+// When it is enabled, we skip the clusters outside of the camera view and the clusters facing away from it.
+constexpr const bool USE_CLUSTER_CULLING = true;
+
+// Maximum amount of nodes in the scene transform hierarchy.
+// Each node takes a 64 bytes matrix in the transform buffer of each frame in flight.
+constexpr const unsigned int MAX_SCENE_TRANSFORMS = 131072;
+
+// Set to false that flag to draw each object with its own draw call.
+// When it is enabled, the visible objects sharing a mesh, a level of detail and a texture are drawn with a single instanced draw call.
+constexpr const bool USE_GPU_INSTANCING = true;
+
+// Maximum amount of instances drawn per frame.
+// Each instance takes 8 bytes in the instance buffer of each frame in flight.
+constexpr const unsigned int MAX_SCENE_INSTANCES = 131072;
+
+// Set to false that flag to record each draw of the frame with its own draw call.
+// When it is enabled, the draws are written into an indirect buffer and submitted with a few indirect draw calls.
+// Note: the direct draw calls are still used on the devices without multi draw indirect or indirect first instance support.
+constexpr const bool USE_INDIRECT_DRAWS = true;
+
+// Maximum amount of indirect draws per frame.
+// Each draw takes 20 bytes in the indirect buffer of each frame in flight.
+constexpr const unsigned int MAX_INDIRECT_DRAWS = 65536;
+
+// Set to true that flag to cull the objects and select their levels of detail with a compute shader.
+// The CPU then only writes a small record per object, the GPU fills the indirect draws with the visible instances.
+// Note: the clusters aren't culled in that mode, the visible objects are drawn whole.
+constexpr const bool USE_GPU_CULLING = false;
+
+// Set to true that flag to compare the objects kept by the GPU culling with the CPU culling, at each frame.
+// The rendering waits for the GPU after each frame in that mode, only enable it to check the culling shader.
+constexpr const bool VALIDATE_GPU_CULLING = false;
+
+// Set to true that flag to also cull the objects hidden behind others with the GPU culling, using a depth pyramid.
+// The objects visible during the previous frame are drawn first, then the others are tested against their depth and drawn in a second pass.
+// Note: the depth attachment is kept after the first pass and sampled, which costs some bandwidth on tiled GPUs.
+constexpr const bool USE_OCCLUSION_CULLING = false;
+
+// Set to true that flag to record the draws of each render pass from several job threads, into secondary command buffers.
+// Each thread records a slice of the draws, then the primary command buffer executes the slices inside the render pass.
+// Note: only used when the draws are recorded one by one, the indirect draws take a handful of commands.
+constexpr const bool USE_SECONDARY_COMMAND_BUFFERS = true;
+
+// Minimum amount of draws recorded by each thread into a secondary command buffer.
+// Fewer draws are recorded into the primary command buffer, as splitting them would cost more than it saves.
+constexpr const unsigned int SECONDARY_DRAWS_PER_THREAD = 1024;
+
+// Set to false that flag to draw with render passes and framebuffers instead of the dynamic rendering.
+// The dynamic rendering begins the drawing directly with the attachments, so nothing has to be recreated with them on a resize.
+// Note: the render passes are still used on the devices without Vulkan 1.3 dynamic rendering support.
+constexpr const bool USE_DYNAMIC_RENDERING = true;
+
+// Set to true that flag to log the render graph of the first frame: its passes, the culled ones, its barriers and its transient images.
+// Note: the frames drawn with the render passes go through the render graph as well, their render passes changing the attachments layouts themselves.
+constexpr const bool DUMP_RENDER_GRAPH = false;
+
+// Set to false that flag to compile the pipelines at each launch instead of loading them from the pipeline cache file.
+// The pipeline cache is saved when the engine stops, the file written by another device or driver version being discarded.
+constexpr const bool USE_PIPELINE_CACHE = true;
+constexpr const char* PIPELINE_CACHE_FILE_NAME = "osge.pipelines.cache";
+
+// Size (in bytes) of the chunks storing the components of the scene entities.
+// Each chunk holds the entities of a single archetype, one contiguous array per component.
+// Note: 16 KB chunks fit in the L1 cache of most CPUs while holding hundreds of entities.
+constexpr const unsigned int ECS_CHUNK_SIZE = 16 * 1024;
+
 }
 
 #endif
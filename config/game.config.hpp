@@ -12,6 +12,10 @@ constexpr const int GAME_VERSION_MAJOR = 0;
 constexpr const int GAME_VERSION_MINOR = 0;
 constexpr const int GAME_VERSION_PATCH = 0;
 
+// Amount of static copies of the first mesh laid on a grid under the default scene.
+// Raise it (e.g. 100000) to test the rendering of many objects, the copies are drawn with instancing.
+constexpr const int SCENE_MESH_COPIES = 0;
+
 }
 
 #endif
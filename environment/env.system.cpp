@@ -6,7 +6,9 @@
 #include "../logs/logs.handler.hpp"
 #include "../utils/tool.versioning.hpp"
 
+#include <cstddef>
 #include <string>
+#include <thread>
 
 // Verify we are running on a supported and allowed operating system.
 // We will automatically exit if we are running on a not supported or unauthorized one.
@@ -45,3 +47,18 @@ void check_operating_system_support()
         fatal_error_log("Your operating system is not supported by this program! Visit https://github.com/ArchorByte/osge to check if a support is planned, or ask for one.\nEngine version: " + engine_version + ".\nGame version: " + game_version + ".");
     #endif
 }
+
+// Return the amount of threads the CPU runs at once, used to size the job system.
+// The standard library may not know it, we then fall back to a single thread.
+size_t get_hardware_threads_count()
+{
+    static const size_t hardware_threads = std::thread::hardware_concurrency(); // Queried once, it can be a system call.
+
+    if (hardware_threads < 1)
+    {
+        error_log("Failed to detect the amount of hardware threads! Defaulted to a single thread.");
+        return 1;
+    }
+
+    return hardware_threads;
+}
@@ -1,6 +1,9 @@
+#include <cstddef>
+
 #ifndef ENVIRONMENT_SYSTEM_HPP
 #define ENVIRONMENT_SYSTEM_HPP
 
 void check_operating_system_support();
+size_t get_hardware_threads_count();
 
 #endif
@@ -1,20 +1,34 @@
 #version 450
 
 layout(binding = 0) uniform UniformBufferObject {
-    mat4 model;
     mat4 view;
     mat4 projection;
 } object;
 
+// World matrices of the scene nodes (see uniform.transforms.cpp).
+layout(std430, binding = 2) readonly buffer TransformBuffer {
+    mat4 matrices[];
+} transforms;
+
+// Inputs generated from the engine vertex layout (see vertex.layout.cpp).
+// Compact formats (snorm normals, half float coordinates) are converted to floats by the vertex fetch.
 layout(location = 0) in vec3 position_input;
-layout(location = 1) in vec3 color_input;
+layout(location = 1) in vec3 normal_input;
 layout(location = 2) in vec2 texture_coordinates_input;
 
-layout(location = 0) out vec3 frag_color;
+// Inputs of the instance being drawn (see InstanceData in vertex.instances.hpp).
+layout(location = 4) in uint transform_index_input;
+layout(location = 5) in int texture_index_input;
+
+layout(location = 0) out vec3 frag_normal;
 layout(location = 1) out vec2 frag_texture_coordinates;
+layout(location = 2) flat out int frag_texture_index;
 
 void main() {
-    gl_Position = object.projection * object.view * object.model * vec4(position_input, 1.0);
-    frag_color = color_input;
+    const mat4 model = transforms.matrices[transform_index_input];
+
+    gl_Position = object.projection * object.view * model * vec4(position_input, 1.0);
+    frag_normal = mat3(model) * normal_input;
     frag_texture_coordinates = texture_coordinates_input;
+    frag_texture_index = texture_index_input;
 }
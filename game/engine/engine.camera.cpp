@@ -0,0 +1,61 @@
+#include "engine.camera.hpp"
+
+#include "../../config/engine.config.hpp"
+#include "../../vulkan/uniform/uniform.camera.hpp"
+
+#include <SDL3/SDL.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <chrono>
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+// Create the controller of a camera, it starts moving from its current position.
+CameraController create_camera_controller
+(
+    const CameraData &camera
+)
+{
+    CameraController controller {};
+    controller.camera = camera;
+    controller.previous_update = std::chrono::steady_clock::now();
+
+    return controller;
+}
+
+// Move the camera with the keyboard state, which must have been updated by the events just before.
+// The left and right arrows orbit around the target, the up and down arrows move closer to it or farther from it.
+void update_camera_controller
+(
+    CameraController &controller
+)
+{
+    const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    const float elapsed_time = std::chrono::duration<float>(now - controller.previous_update).count();
+    controller.previous_update = now;
+
+    const bool* keys = SDL_GetKeyboardState(nullptr);
+
+    if (keys == nullptr)
+    {
+        return;
+    }
+
+    CameraData &camera = controller.camera;
+    const float orbit = static_cast<float>(keys[SDL_SCANCODE_RIGHT] - keys[SDL_SCANCODE_LEFT]) * EngineConfig::CAMERA_ORBIT_SPEED * elapsed_time;
+    const float zoom = static_cast<float>(keys[SDL_SCANCODE_DOWN] - keys[SDL_SCANCODE_UP]) * EngineConfig::CAMERA_ZOOM_SPEED * elapsed_time;
+
+    if (orbit == 0.0f && zoom == 0.0f)
+    {
+        return;
+    }
+
+    // The camera stays between the near plane and the middle of the view range, so the scene never leaves it.
+    const glm::vec3 offset = glm::vec3(glm::rotate(glm::mat4(1.0f), glm::radians(orbit), camera.up) * glm::vec4(camera.position - camera.target, 0.0f));
+    const float distance = std::clamp(glm::length(offset) + zoom, camera.near_plane * 10.0f, camera.far_plane * 0.5f);
+
+    camera.position = camera.target + glm::normalize(offset) * distance;
+}
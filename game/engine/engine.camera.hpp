@@ -0,0 +1,33 @@
+#include "../../vulkan/uniform/uniform.camera.hpp"
+
+#include <chrono>
+
+#ifndef GAME_CAMERA_HPP
+#define GAME_CAMERA_HPP
+
+////////////////////////////////////////////////////
+//////////////////// Structures ////////////////////
+////////////////////////////////////////////////////
+
+// Camera moved by the keyboard, orbiting around its target.
+struct CameraController
+{
+    CameraData camera;
+    std::chrono::steady_clock::time_point previous_update;
+};
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+CameraController create_camera_controller
+(
+    const CameraData &camera
+);
+
+void update_camera_controller
+(
+    CameraController &controller
+);
+
+#endif
@@ -0,0 +1,116 @@
+#include "engine.frame.pacer.hpp"
+
+#include "../../config/engine.config.hpp"
+#include "../../logs/logs.handler.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+// Create a frame pacer targeting a frame rate, no frame rate (0) leaves the frames uncapped.
+FramePacer create_frame_pacer
+(
+    const int &fps_cap
+)
+{
+    const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    FramePacer pacer {};
+
+    if (fps_cap > 0)
+    {
+        pacer.target_frame_time = std::chrono::nanoseconds(1000000000 / fps_cap);
+        log("Frame rate capped at " + std::to_string(fps_cap) + " FPS.");
+    }
+    else log("Frame rate uncapped.");
+
+    pacer.next_deadline = now;
+    pacer.previous_frame = now;
+    pacer.previous_report = now;
+    pacer.frame_time_min = INFINITY;
+    return pacer;
+}
+
+// Log the frame times measured since the last report, their standard deviation being the jitter.
+void report_frame_pacing
+(
+    FramePacer &pacer,
+    const std::chrono::steady_clock::time_point &now
+)
+{
+    const double frames = static_cast<double>(pacer.frames_count);
+    const double average = pacer.frame_time_sum / frames;
+    const double jitter = std::sqrt(std::max(0.0, pacer.frame_time_squares_sum / frames - average * average));
+
+    log("Frame pacing (" + std::to_string(pacer.frames_count) + " frames): "
+        + std::to_string(average) + " ms average, "
+        + std::to_string(pacer.frame_time_min) + " ms min, "
+        + std::to_string(pacer.frame_time_max) + " ms max, "
+        + std::to_string(jitter) + " ms jitter, "
+        + std::to_string(pacer.missed_deadlines) + " missed deadlines.");
+
+    pacer.frames_count = 0;
+    pacer.missed_deadlines = 0;
+    pacer.frame_time_sum = 0.0;
+    pacer.frame_time_squares_sum = 0.0;
+    pacer.frame_time_min = INFINITY;
+    pacer.frame_time_max = 0.0;
+    pacer.previous_report = now;
+}
+
+// Wait for the deadline of the next frame, then measure the time of the previous one.
+// The thread sleeps until the deadline is close, then spins the last moments as the sleeps often wake up late.
+void pace_frame
+(
+    FramePacer &pacer
+)
+{
+    if (pacer.target_frame_time.count() > 0)
+    {
+        const std::chrono::microseconds spin_time(EngineConfig::FRAME_PACER_SPIN_TIME);
+        const std::chrono::steady_clock::time_point sleep_end = pacer.next_deadline - spin_time;
+
+        if (std::chrono::steady_clock::now() < sleep_end)
+        {
+            std::this_thread::sleep_until(sleep_end);
+        }
+
+        while (std::chrono::steady_clock::now() < pacer.next_deadline)
+        {
+            std::this_thread::yield();
+        }
+
+        // The deadlines follow each other, so a frame a bit late is caught up by the next ones.
+        // A frame later than a whole frame would make the next ones rush, so we start again from now.
+        const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        pacer.next_deadline += pacer.target_frame_time;
+
+        if (pacer.next_deadline < now)
+        {
+            pacer.next_deadline = now + pacer.target_frame_time;
+            pacer.missed_deadlines++;
+        }
+    }
+
+    const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    const double frame_time = std::chrono::duration<double, std::milli>(now - pacer.previous_frame).count();
+    pacer.previous_frame = now;
+
+    pacer.frames_count++;
+    pacer.frame_time_sum += frame_time;
+    pacer.frame_time_squares_sum += frame_time * frame_time;
+    pacer.frame_time_min = std::min(pacer.frame_time_min, frame_time);
+    pacer.frame_time_max = std::max(pacer.frame_time_max, frame_time);
+
+    // If one second passed, we log the frame times and reset them.
+    if (now - pacer.previous_report >= std::chrono::seconds(1))
+    {
+        report_frame_pacing(pacer, now);
+    }
+}
@@ -0,0 +1,40 @@
+#include <chrono>
+#include <cstdint>
+
+#ifndef GAME_FRAME_PACER_HPP
+#define GAME_FRAME_PACER_HPP
+
+////////////////////////////////////////////////////
+//////////////////// Structures ////////////////////
+////////////////////////////////////////////////////
+
+// Deadline of the next frame and the frame times measured since the last report.
+struct FramePacer
+{
+    std::chrono::nanoseconds target_frame_time;          // 0 when the frame rate isn't capped.
+    std::chrono::steady_clock::time_point next_deadline; // Time at which the next frame may start.
+    std::chrono::steady_clock::time_point previous_frame;
+    std::chrono::steady_clock::time_point previous_report;
+    uint64_t frames_count;
+    uint64_t missed_deadlines;                           // Frames started more than a whole frame late, the deadlines are then reset.
+    double frame_time_sum;                               // Milliseconds.
+    double frame_time_squares_sum;
+    double frame_time_min;
+    double frame_time_max;
+};
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+FramePacer create_frame_pacer
+(
+    const int &fps_cap
+);
+
+void pace_frame
+(
+    FramePacer &pacer
+);
+
+#endif
@@ -2,8 +2,141 @@
 
 #include "engine/engine.framerate.hpp"
 #include "../logs/logs.handler.hpp"
+#include "../config/game.config.hpp"
+#include "../scene/scene.world.hpp"
+#include "../scene/scene.components.hpp"
+#include "../scene/scene.systems.hpp"
+#include "../scene/scene.hierarchy.hpp"
+#include "../vulkan/vertex/models/models.scene.hpp"
 
-void run_game_loop()
+#include <glm/glm.hpp>
+#include <functional>
+#include <cstdint>
+#include <chrono>
+#include <string>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// Create the default scene.
+// - The nodes described by the models files keep their hierarchy, they don't move.
+// - The meshes without any node (OBJ files) spin around their origin.
+// - The copies of the first mesh (see SCENE_MESH_COPIES) are laid on a square grid, they don't move.
+void create_game_scene
+(
+    EntityWorld &world,
+    TransformHierarchy &hierarchy,
+    const ModelScene &scene,
+    const size_t &meshes_count
+)
+{
+    world.add_system("movement", [&hierarchy](EntityWorld &world, const float &delta_time)
+    {
+        update_movement_system(world, hierarchy, delta_time);
+    });
+
+    std::vector<bool> placed_meshes(meshes_count, false);
+    std::vector<uint32_t> scene_nodes(scene.nodes.size(), NO_PARENT_NODE);
+    std::vector<bool> visited_nodes(scene.nodes.size(), false);
+
+    // The parents of the models nodes can follow their children, so the nodes are created from the roots.
+    // A node met twice on the way up (broken file with a cycle) becomes a root node.
+    std::function<uint32_t(const size_t &)> create_scene_node = [&](const size_t &index) -> uint32_t
+    {
+        if (visited_nodes[index])
+        {
+            return scene_nodes[index];
+        }
+
+        visited_nodes[index] = true;
+
+        const ModelNode &model_node = scene.nodes[index];
+        const bool has_parent = model_node.parent >= 0 && static_cast<size_t>(model_node.parent) < scene.nodes.size();
+        const uint32_t parent = has_parent ? create_scene_node(model_node.parent) : NO_PARENT_NODE;
+
+        scene_nodes[index] = hierarchy.create_node(parent, model_node.local_transform);
+        return scene_nodes[index];
+    };
+
+    for (size_t i = 0; i < scene.nodes.size(); i++)
+    {
+        const uint32_t node = create_scene_node(i);
+
+        for (const uint32_t &mesh : scene.nodes[i].meshes)
+        {
+            if (mesh >= meshes_count)
+            {
+                continue;
+            }
+
+            const Entity entity = world.create_entity();
+            world.add_component(entity, SceneNode { .node = node });
+            world.add_component(entity, MeshRenderer { .mesh = mesh, .texture = 0 });
+
+            placed_meshes[mesh] = true;
+        }
+    }
+
+    for (size_t i = 0; i < meshes_count; i++)
+    {
+        if (placed_meshes[i])
+        {
+            continue;
+        }
+
+        const Transform transform
+        {
+            .position = glm::vec3(0.0f),
+            .rotation = glm::vec3(0.0f),
+            .scale = glm::vec3(1.0f)
+        };
+
+        const Entity entity = world.create_entity();
+        world.add_component(entity, transform);
+
+        world.add_component(entity, Velocity
+        {
+            .linear = glm::vec3(0.0f),
+            .angular = glm::vec3(0.0f, 0.0f, glm::radians(90.0f)) // Rotate around the up axis.
+        });
+
+        world.add_component(entity, SceneNode { .node = hierarchy.create_node(NO_PARENT_NODE, get_transform_matrix(transform)) });
+        world.add_component(entity, MeshRenderer { .mesh = static_cast<uint32_t>(i), .texture = 0 });
+    }
+
+    const int grid_size = std::max(1, static_cast<int>(std::ceil(std::sqrt(static_cast<float>(GameConfig::SCENE_MESH_COPIES)))));
+
+    for (int i = 0; i < GameConfig::SCENE_MESH_COPIES && meshes_count > 0; i++)
+    {
+        const Transform transform
+        {
+            .position = glm::vec3((i % grid_size - grid_size / 2) * 0.1f, (i / grid_size - grid_size / 2) * 0.1f, -1.0f),
+            .rotation = glm::vec3(0.0f),
+            .scale = glm::vec3(0.05f)
+        };
+
+        const Entity entity = world.create_entity();
+        world.add_component(entity, SceneNode { .node = hierarchy.create_node(NO_PARENT_NODE, get_transform_matrix(transform)) });
+        world.add_component(entity, MeshRenderer { .mesh = 0, .texture = 0 });
+    }
+
+    log("Default scene created with " + std::to_string(world.get_entities_count()) + " entities and " + std::to_string(hierarchy.get_nodes_capacity()) + " transform nodes.");
+}
+
+// Running the game main code at each frame.
+// The game advances by the time elapsed since the last frame, or by the fixed frame time given (0 for none).
+void run_game_loop
+(
+    EntityWorld &world,
+    const float &fixed_frame_time
+)
 {
+    static auto previous_time = std::chrono::high_resolution_clock::now();
+
+    const auto current_time = std::chrono::high_resolution_clock::now();
+    const float delta_time = fixed_frame_time > 0.0f ? fixed_frame_time : std::chrono::duration<float, std::chrono::seconds::period>(current_time - previous_time).count();
+    previous_time = current_time;
+
+    world.run_systems(delta_time);
     framerate_counter();
 }
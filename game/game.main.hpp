@@ -1,6 +1,24 @@
+#include "../scene/scene.world.hpp"
+#include "../scene/scene.hierarchy.hpp"
+#include "../vulkan/vertex/models/models.scene.hpp"
+
+#include <cstddef>
+
 #ifndef GAME_MAIN_HPP
 #define GAME_MAIN_HPP
 
-void run_game_loop();
+void create_game_scene
+(
+    EntityWorld &world,
+    TransformHierarchy &hierarchy,
+    const ModelScene &scene,
+    const size_t &meshes_count
+);
+
+void run_game_loop
+(
+    EntityWorld &world,
+    const float &fixed_frame_time
+);
 
 #endif
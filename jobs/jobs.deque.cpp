@@ -0,0 +1,113 @@
+#include "jobs.deque.hpp"
+
+#include "../logs/logs.handler.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+///////////////////////////////////////////////
+//////////////////// Class ////////////////////
+///////////////////////////////////////////////
+
+// Constructor.
+// The capacity is rounded up to a power of two, so the indexes wrap with a mask.
+JobDeque::JobDeque
+(
+    const size_t &capacity
+)
+{
+    size_t rounded_capacity = 1;
+
+    while (rounded_capacity < capacity)
+    {
+        rounded_capacity *= 2;
+    }
+
+    if (rounded_capacity < 2)
+    {
+        fatal_error_log("Job deque creation failed! The capacity provided (" + std::to_string(capacity) + ") is not valid!");
+    }
+
+    buffer = std::make_unique<std::atomic<Job*>[]>(rounded_capacity);
+    mask = static_cast<int64_t>(rounded_capacity) - 1;
+}
+
+// Push a job at the bottom of the deque, only called by its worker.
+// Return false when the deque is full.
+bool JobDeque::push
+(
+    Job* job
+)
+{
+    const int64_t current_bottom = bottom.load(std::memory_order_relaxed);
+    const int64_t current_top = top.load(std::memory_order_acquire);
+
+    if (current_bottom - current_top > mask)
+    {
+        return false;
+    }
+
+    buffer[current_bottom & mask].store(job, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release); // Publish the job before the new bottom.
+    bottom.store(current_bottom + 1, std::memory_order_relaxed);
+
+    return true;
+}
+
+// Pop the last pushed job, only called by its worker.
+// Return nullptr when the deque is empty, or when a thief took its last job first.
+Job* JobDeque::pop()
+{
+    const int64_t current_bottom = bottom.load(std::memory_order_relaxed) - 1;
+    bottom.store(current_bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst); // The thieves must see the reserved bottom before we read the top.
+
+    int64_t current_top = top.load(std::memory_order_relaxed);
+
+    if (current_top > current_bottom)
+    {
+        bottom.store(current_bottom + 1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    Job* job = buffer[current_bottom & mask].load(std::memory_order_relaxed);
+
+    // The last job is raced with the thieves, whoever moves the top first takes it.
+    if (current_top == current_bottom)
+    {
+        if (!top.compare_exchange_strong(current_top, current_top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            job = nullptr;
+        }
+
+        bottom.store(current_bottom + 1, std::memory_order_relaxed);
+    }
+
+    return job;
+}
+
+// Steal the oldest job of the deque, called by the other workers.
+// Return nullptr when the deque is empty, or when another thread took that job first.
+Job* JobDeque::steal()
+{
+    int64_t current_top = top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst); // Read the top before the bottom, like pop() writes them in the other order.
+    const int64_t current_bottom = bottom.load(std::memory_order_acquire);
+
+    if (current_top >= current_bottom)
+    {
+        return nullptr;
+    }
+
+    Job* job = buffer[current_top & mask].load(std::memory_order_relaxed);
+
+    if (!top.compare_exchange_strong(current_top, current_top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+    {
+        return nullptr;
+    }
+
+    return job;
+}
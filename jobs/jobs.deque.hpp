@@ -0,0 +1,49 @@
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#ifndef JOBS_DEQUE_HPP
+#define JOBS_DEQUE_HPP
+
+struct Job;
+
+///////////////////////////////////////////////
+//////////////////// Class ////////////////////
+///////////////////////////////////////////////
+
+// Chase-Lev work stealing deque of a worker.
+// Only its worker pushes and pops jobs at the bottom, the other workers steal them from the top.
+// The capacity is fixed, a full deque refuses the job and the caller runs it itself.
+class JobDeque
+{
+
+public:
+    // Constructor.
+    explicit JobDeque
+    (
+        const size_t &capacity
+    );
+
+    bool push
+    (
+        Job* job
+    );
+
+    Job* pop();
+    Job* steal();
+
+    // Prevent data duplication.
+    JobDeque(const JobDeque&) = delete;
+    JobDeque &operator = (const JobDeque&) = delete;
+
+private:
+    // Each index has its own cache line, as the owner and the thieves write them separately.
+    alignas(64) std::atomic<int64_t> top { 0 };
+    alignas(64) std::atomic<int64_t> bottom { 0 };
+    alignas(64) std::unique_ptr<std::atomic<Job*>[]> buffer;
+    int64_t mask = 0;
+
+};
+
+#endif
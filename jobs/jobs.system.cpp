@@ -0,0 +1,526 @@
+#include "jobs.system.hpp"
+
+#include "jobs.deque.hpp"
+#include "../environment/env.system.hpp"
+#include "../logs/logs.handler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// The deques only change while the workers are stopped, index 0 belongs to the main thread.
+std::vector<std::unique_ptr<JobDeque>> jobs_deques;
+std::vector<std::thread> jobs_workers;
+std::atomic<bool> jobs_running { false };
+
+// Jobs queued in the deques or the injection queue, the sleeping workers wake up when it's above zero.
+std::atomic<int64_t> jobs_queued { 0 };
+std::atomic<uint32_t> jobs_sleeping { 0 };
+std::mutex jobs_sleep_mutex;
+std::condition_variable jobs_wake;
+
+// Jobs submitted by the threads without a deque.
+std::mutex jobs_injection_mutex;
+std::deque<Job*> jobs_injected;
+std::atomic<size_t> jobs_injected_count { 0 };
+
+// Jobs that must run on the main thread, like the SDL calls.
+std::mutex jobs_main_thread_mutex;
+std::deque<Job*> jobs_main_thread;
+
+// Static objects are initialized by the main thread, before main() starts.
+const std::thread::id jobs_main_thread_id = std::this_thread::get_id();
+thread_local int jobs_worker_index = -1;
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+// Decrement the counter of a finished job, then schedule the jobs waiting for it to reach zero.
+// The counter is decremented under its lock, so wait_for_jobs() can't return while we still use it.
+void finish_job
+(
+    JobCounter* counter
+);
+
+// Run a job, then release it.
+// The exception of a failing job is kept by its counter for wait_for_jobs() instead of terminating its worker thread.
+// A job without counter has no one to rethrow it, so it is only logged.
+void execute_job
+(
+    Job* job
+)
+{
+    try
+    {
+        job->function();
+    }
+    catch (...)
+    {
+        if (job->counter != nullptr)
+        {
+            std::lock_guard<std::mutex> lock(job->counter->continuations_mutex);
+
+            if (!job->counter->error)
+            {
+                job->counter->error = std::current_exception();
+            }
+        }
+        else
+        {
+            try
+            {
+                throw;
+            }
+            catch (const std::exception &error)
+            {
+                error_log("A job failed! " + std::string(error.what()));
+            }
+            catch (...)
+            {
+                error_log("A job failed with an unknown exception!");
+            }
+        }
+    }
+
+    finish_job(job->counter);
+    delete job;
+}
+
+// Queue a job on the deque of the current thread, or on the injection queue for the threads without a deque.
+// The job runs right away when the job system is stopped or the deque is full.
+void schedule_job
+(
+    Job* job
+)
+{
+    if (!jobs_running.load(std::memory_order_acquire))
+    {
+        execute_job(job);
+        return;
+    }
+
+    jobs_queued.fetch_add(1);
+
+    if (jobs_worker_index >= 0)
+    {
+        if (!jobs_deques[jobs_worker_index]->push(job))
+        {
+            jobs_queued.fetch_sub(1);
+            execute_job(job);
+            return;
+        }
+    }
+    else
+    {
+        std::lock_guard<std::mutex> lock(jobs_injection_mutex);
+        jobs_injected.push_back(job);
+        jobs_injected_count.fetch_add(1);
+    }
+
+    // The sleeping counter is raised before the sleeping workers check the queued jobs, so none of them misses this one.
+    if (jobs_sleeping.load() > 0)
+    {
+        std::lock_guard<std::mutex> lock(jobs_sleep_mutex);
+        jobs_wake.notify_one();
+    }
+}
+
+void finish_job
+(
+    JobCounter* counter
+)
+{
+    if (counter == nullptr)
+    {
+        return;
+    }
+
+    std::vector<Job*> ready_jobs;
+
+    {
+        std::lock_guard<std::mutex> lock(counter->continuations_mutex);
+
+        if (counter->pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            ready_jobs.swap(counter->continuations);
+        }
+    }
+
+    for (Job* job : ready_jobs)
+    {
+        schedule_job(job);
+    }
+}
+
+// Find a job to run: the last one pushed by this thread first, then the injected ones, then the oldest ones of the other threads.
+// Return nullptr when every queue is empty.
+Job* take_job
+(
+    const int &worker_index
+)
+{
+    Job* job = nullptr;
+
+    if (worker_index >= 0)
+    {
+        job = jobs_deques[worker_index]->pop();
+    }
+
+    if (job == nullptr && jobs_injected_count.load() > 0)
+    {
+        std::lock_guard<std::mutex> lock(jobs_injection_mutex);
+
+        if (!jobs_injected.empty())
+        {
+            job = jobs_injected.front();
+            jobs_injected.pop_front();
+            jobs_injected_count.fetch_sub(1);
+        }
+    }
+
+    // Each thread starts stealing from its neighbour, so the thieves spread over the deques.
+    const size_t deques_count = jobs_deques.size();
+
+    for (size_t i = 1; job == nullptr && i <= deques_count; i++)
+    {
+        const size_t victim = (static_cast<size_t>(worker_index + 1) + i - 1) % deques_count;
+
+        if (static_cast<int>(victim) != worker_index)
+        {
+            job = jobs_deques[victim]->steal();
+        }
+    }
+
+    if (job != nullptr)
+    {
+        jobs_queued.fetch_sub(1);
+    }
+
+    return job;
+}
+
+// Main loop of a worker thread: run the jobs found, then sleep once there are none left for a while.
+void run_job_worker
+(
+    const int &worker_index
+)
+{
+    jobs_worker_index = worker_index;
+    uint32_t idle_spins = 0;
+
+    while (jobs_running.load(std::memory_order_acquire))
+    {
+        Job* job = take_job(worker_index);
+
+        if (job != nullptr)
+        {
+            execute_job(job);
+            idle_spins = 0;
+            continue;
+        }
+
+        if (++idle_spins < JOB_IDLE_SPINS)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(jobs_sleep_mutex);
+        jobs_sleeping.fetch_add(1);
+        jobs_wake.wait(lock, [] { return !jobs_running.load() || jobs_queued.load() > 0; });
+        jobs_sleeping.fetch_sub(1);
+        idle_spins = 0;
+    }
+}
+
+// Start the worker threads, the main thread being the first of the threads count.
+// The main thread only runs jobs while it waits for some of them.
+void start_job_system
+(
+    const size_t &threads_count
+)
+{
+    if (jobs_running.load())
+    {
+        error_log("Failed to start the job system! It is already running.");
+        return;
+    }
+
+    if (!is_main_thread())
+    {
+        fatal_error_log("Failed to start the job system! It must be started by the main thread.");
+    }
+
+    const size_t count = std::max<size_t>(1, threads_count);
+    log("Starting the job system with " + std::to_string(count) + " threads..");
+
+    jobs_deques.clear();
+
+    for (size_t i = 0; i < count; i++)
+    {
+        jobs_deques.push_back(std::make_unique<JobDeque>(JOB_DEQUE_CAPACITY));
+    }
+
+    jobs_worker_index = 0;
+    jobs_running.store(true, std::memory_order_release);
+    jobs_workers.reserve(count - 1);
+
+    for (size_t i = 1; i < count; i++)
+    {
+        jobs_workers.emplace_back(run_job_worker, static_cast<int>(i));
+    }
+
+    log("Job system started successfully!");
+}
+
+// Run the jobs still queued, then stop and join the worker threads.
+void stop_job_system()
+{
+    if (!jobs_running.load())
+    {
+        return;
+    }
+
+    log("Stopping the job system..");
+
+    while (Job* job = take_job(jobs_worker_index))
+    {
+        execute_job(job);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(jobs_sleep_mutex);
+        jobs_running.store(false, std::memory_order_release);
+        jobs_wake.notify_all();
+    }
+
+    for (std::thread &worker : jobs_workers)
+    {
+        worker.join();
+    }
+
+    jobs_workers.clear();
+    jobs_deques.clear();
+    jobs_worker_index = -1;
+
+    log("Job system stopped successfully!");
+}
+
+// Return the amount of threads running jobs, the main thread included.
+size_t get_job_threads_count()
+{
+    return jobs_running.load() ? jobs_deques.size() : 1;
+}
+
+bool is_main_thread()
+{
+    return std::this_thread::get_id() == jobs_main_thread_id;
+}
+
+// Schedule a job on any thread.
+// The counter, if any, is incremented right away and decremented once the job is done.
+void submit_job
+(
+    const std::function<void()> &function,
+    JobCounter* counter
+)
+{
+    if (counter != nullptr)
+    {
+        counter->pending.fetch_add(1);
+    }
+
+    schedule_job(new Job { function, counter });
+}
+
+// Schedule a job once all the jobs of a dependency counter are done.
+void submit_job_after
+(
+    JobCounter &dependency,
+    const std::function<void()> &function,
+    JobCounter* counter
+)
+{
+    if (counter != nullptr)
+    {
+        counter->pending.fetch_add(1);
+    }
+
+    Job* job = new Job { function, counter };
+
+    {
+        std::lock_guard<std::mutex> lock(dependency.continuations_mutex);
+
+        if (dependency.pending.load() > 0)
+        {
+            dependency.continuations.push_back(job);
+            return;
+        }
+    }
+
+    schedule_job(job);
+}
+
+// Queue a job for the main thread, run by run_main_thread_jobs() or while the main thread waits for some jobs.
+void submit_main_thread_job
+(
+    const std::function<void()> &function,
+    JobCounter* counter
+)
+{
+    if (counter != nullptr)
+    {
+        counter->pending.fetch_add(1);
+    }
+
+    std::lock_guard<std::mutex> lock(jobs_main_thread_mutex);
+    jobs_main_thread.push_back(new Job { function, counter });
+}
+
+// Run the jobs queued for the main thread so far.
+void run_main_thread_jobs()
+{
+    if (!is_main_thread())
+    {
+        error_log("Failed to run the main thread jobs! They can't run on another thread.");
+        return;
+    }
+
+    std::deque<Job*> jobs;
+
+    {
+        std::lock_guard<std::mutex> lock(jobs_main_thread_mutex);
+        jobs.swap(jobs_main_thread);
+    }
+
+    for (Job* job : jobs)
+    {
+        execute_job(job);
+    }
+}
+
+// Wait for all the jobs of a counter, running the queued jobs meanwhile instead of blocking the thread.
+// Rethrow the first exception thrown by its jobs, once all of them are done.
+void wait_for_jobs
+(
+    JobCounter &counter
+)
+{
+    const bool main_thread = is_main_thread();
+
+    while (counter.pending.load(std::memory_order_acquire) > 0)
+    {
+        if (main_thread)
+        {
+            run_main_thread_jobs();
+        }
+
+        Job* job = take_job(jobs_worker_index);
+
+        if (job != nullptr)
+        {
+            execute_job(job);
+        }
+        else std::this_thread::yield();
+    }
+
+    std::exception_ptr error;
+
+    {
+        // The last job may still be releasing the counter lock.
+        std::lock_guard<std::mutex> lock(counter.continuations_mutex);
+        error = counter.error;
+        counter.error = nullptr;
+    }
+
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+// Split a range of indexes between the threads, then wait for all of them.
+// The function receives a [first, last) range of at least grain_size indexes, the calling thread takes the last one.
+void parallel_for
+(
+    const size_t &count,
+    const size_t &grain_size,
+    const std::function<void(const size_t&, const size_t&)> &function
+)
+{
+    if (count < 1)
+    {
+        return;
+    }
+
+    const size_t grain = std::max<size_t>(1, grain_size);
+    const size_t ranges_count = std::min(count / grain, get_job_threads_count() * JOB_RANGES_PER_THREAD);
+
+    if (ranges_count < 2)
+    {
+        function(0, count);
+        return;
+    }
+
+    JobCounter counter;
+
+    for (size_t i = 0; i + 1 < ranges_count; i++)
+    {
+        const size_t first = count * i / ranges_count;
+        const size_t last = count * (i + 1) / ranges_count;
+
+        submit_job([&function, first, last]() { function(first, last); }, &counter);
+    }
+
+    // The queued ranges point to the counter and the function of this frame, so they must be done before an exception leaves it.
+    try
+    {
+        function(count * (ranges_count - 1) / ranges_count, count);
+    }
+    catch (...)
+    {
+        try
+        {
+            wait_for_jobs(counter);
+        }
+        catch (...)
+        {
+            // The exception of the calling thread is the one rethrown, the ones of the queued ranges are dropped.
+        }
+
+        throw;
+    }
+
+    wait_for_jobs(counter);
+}
+
+///////////////////////////////////////////////
+//////////////////// Class ////////////////////
+///////////////////////////////////////////////
+
+// Constructor.
+// No threads count means one thread per hardware thread.
+JobSystem::JobSystem
+(
+    const size_t &threads_count
+)
+{
+    start_job_system(threads_count > 0 ? threads_count : get_hardware_threads_count());
+}
+
+// Destructor.
+JobSystem::~JobSystem()
+{
+    stop_job_system();
+}
@@ -0,0 +1,113 @@
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#ifndef JOBS_SYSTEM_HPP
+#define JOBS_SYSTEM_HPP
+
+// Maximum amount of jobs queued by a thread, it runs the next ones itself once its deque is full.
+constexpr const size_t JOB_DEQUE_CAPACITY = 4096;
+
+// Amount of ranges per thread made by parallel_for(), so the threads done early steal the remaining ones.
+constexpr const size_t JOB_RANGES_PER_THREAD = 4;
+
+// Amount of failed attempts to find a job before an idle worker goes to sleep.
+constexpr const uint32_t JOB_IDLE_SPINS = 64;
+
+////////////////////////////////////////////////////
+//////////////////// Structures ////////////////////
+////////////////////////////////////////////////////
+
+struct JobCounter;
+
+// Work scheduled on the job system.
+struct Job
+{
+    std::function<void()> function;
+    JobCounter* counter;            // Decremented once the job is done, can be nullptr.
+};
+
+// Amount of unfinished jobs of a group, the jobs waiting for that group start once it reaches zero.
+// A counter must outlive its jobs and their continuations, which wait_for_jobs() guarantees.
+struct JobCounter
+{
+    std::atomic<uint32_t> pending { 0 };
+    std::mutex continuations_mutex;
+    std::vector<Job*> continuations;     // Jobs depending on this counter, scheduled when it reaches zero.
+    std::exception_ptr error;            // First exception thrown by its jobs, rethrown by wait_for_jobs().
+};
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+void start_job_system
+(
+    const size_t &threads_count
+);
+
+void stop_job_system();
+size_t get_job_threads_count();
+bool is_main_thread();
+
+void submit_job
+(
+    const std::function<void()> &function,
+    JobCounter* counter
+);
+
+void submit_job_after
+(
+    JobCounter &dependency,
+    const std::function<void()> &function,
+    JobCounter* counter
+);
+
+void submit_main_thread_job
+(
+    const std::function<void()> &function,
+    JobCounter* counter
+);
+
+void run_main_thread_jobs();
+
+void wait_for_jobs
+(
+    JobCounter &counter
+);
+
+void parallel_for
+(
+    const size_t &count,
+    const size_t &grain_size,
+    const std::function<void(const size_t&, const size_t&)> &function
+);
+
+///////////////////////////////////////////////
+//////////////////// Class ////////////////////
+///////////////////////////////////////////////
+
+class JobSystem
+{
+
+public:
+    // Constructor.
+    explicit JobSystem
+    (
+        const size_t &threads_count
+    );
+
+    // Destructor.
+    ~JobSystem();
+
+    // Prevent data duplication.
+    JobSystem(const JobSystem&) = delete;
+    JobSystem &operator = (const JobSystem&) = delete;
+
+};
+
+#endif
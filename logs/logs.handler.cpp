@@ -4,9 +4,14 @@
 #include "../config/engine.config.hpp"
 
 #include <iostream>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 
+// The logs are sent from the job workers too, so one log is written at a time.
+// Recursive, as writing the logs file can itself send an error log.
+std::recursive_mutex logs_mutex;
+
 // Sends an info log only if debug mode enabled.
 // Writes an info log in the logs file if the logs file is allowed.
 void log
@@ -14,6 +19,8 @@ void log
     const std::string &log
 )
 {
+    std::lock_guard<std::recursive_mutex> lock(logs_mutex);
+
     if constexpr (EngineConfig::DEBUG_MODE)
     {
         std::cout << "[log] " << log << "\n";
@@ -30,6 +37,8 @@ void error_log
     const std::string &log
 )
 {
+    std::lock_guard<std::recursive_mutex> lock(logs_mutex);
+
     if constexpr (EngineConfig::DEBUG_MODE)
     {
         std::cout << "[error] " << log << "\n";
@@ -46,6 +55,8 @@ void fatal_error_log
     const std::string &log
 )
 {
+    std::lock_guard<std::recursive_mutex> lock(logs_mutex);
+
     if constexpr (EngineConfig::DEBUG_MODE)
     {
         std::cout << "[fatal_error] " << log << "\n";
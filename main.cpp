@@ -9,16 +9,23 @@
 #include "environment/env.displays.hpp"
 #include "environment/env.resolutions.hpp"
 #include "environment/env.system.hpp"
+#include "jobs/jobs.system.hpp"
 #include "utils/tool.parser.hpp"
 #include "utils/tool.integer.hpp"
 #include "utils/tool.files.hpp"
+#include "utils/tool.images.hpp"
 #include "utils/tool.versioning.hpp"
 #include "vulkan/vulkan.run.hpp"
 #include "opengl/opengl.run.hpp"
+#include "benchmarks/benchmark.ecs.hpp"
+#include "benchmarks/benchmark.culling.hpp"
+#include "benchmarks/benchmark.batches.hpp"
+#include "benchmarks/benchmark.jobs.hpp"
 
 #include <vulkan/vulkan.h>
 #include <SDL3/SDL.h>
 #include <unistd.h>
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <map>
@@ -43,7 +50,11 @@ void crash_handler
 }
 
 // Code executed on start.
-int main()
+// Note: Run the program with the "--benchmark" argument to measure the engine performances instead of starting the game.
+// Note: Run the program with the "--headless --frames N" arguments to render N frames without any window, then print their timings.
+// Note: Add the "--capture image.ppm" argument to save the last headless frame, and "--golden image.png" to compare it with a golden image (exit code 1 when they differ or the capture failed).
+// Note: Run the program with the "--resize-stress --frames N" arguments to draw N frames in a window resized every few frames (exit code 1 when a frame stalls).
+int main(int argc, char* argv[])
 {
     try
     {
@@ -75,6 +86,91 @@ int main()
         const std::string engine_version = create_version(engine_version_variant, engine_version_major, engine_version_minor, engine_version_patch);
         log("Running on OSGE v" + engine_version + "!");
 
+        // Worker threads shared by the engine and the game, sized from the hardware threads by default.
+        const JobSystem job_system(EngineConfig::JOB_THREADS_COUNT);
+
+        bool headless = false;
+        bool resize_stress = false;
+        uint64_t frames_count = EngineConfig::HEADLESS_FRAMES_COUNT;
+        std::string capture_path;
+        std::string golden_path;
+
+        for (int i = 1; i < argc; i++)
+        {
+            if (std::string(argv[i]) == "--benchmark")
+            {
+                run_ecs_benchmark(1000000);
+                run_culling_benchmark(1000000);
+                run_batching_benchmark(100000);
+                run_jobs_benchmark(1000000);
+                return 0;
+            }
+
+            if (std::string(argv[i]) == "--headless")
+            {
+                headless = true;
+            }
+
+            if (std::string(argv[i]) == "--resize-stress")
+            {
+                resize_stress = true;
+            }
+
+            if (std::string(argv[i]) == "--frames" && i + 1 < argc)
+            {
+                const std::string frames = argv[++i];
+
+                if (!is_an_integer(frames) || stoll(frames) < 1)
+                {
+                    error_log("The frames count provided (" + frames + ") is not valid! Defaulted to " + std::to_string(EngineConfig::HEADLESS_FRAMES_COUNT) + " frames!");
+                }
+                else frames_count = stoull(frames);
+            }
+
+            if (std::string(argv[i]) == "--capture" && i + 1 < argc)
+            {
+                capture_path = argv[++i];
+            }
+
+            if (std::string(argv[i]) == "--golden" && i + 1 < argc)
+            {
+                golden_path = argv[++i];
+            }
+        }
+
+        // Render the scene into offscreen images, without SDL3 nor window, for the benchmarks and the regression tests on the machines without display.
+        // The first GPU is used, the software one (lavapipe) on the machines without any other.
+        if (headless)
+        {
+            // The golden image is compared with a capture of the last frame.
+            if (!golden_path.empty() && capture_path.empty())
+            {
+                capture_path = "capture.ppm";
+            }
+
+            // A capture left by a previous run must not be compared in place of this one.
+            if (!capture_path.empty() && std::filesystem::exists(capture_path))
+            {
+                std::filesystem::remove(capture_path);
+            }
+
+            int gpu_index = 1;
+
+            // The run logs the cause of its failure: the frames it couldn't draw, or the capture it couldn't write.
+            if (!run_using_vulkan(nullptr, gpu_index, 0, 0, frames_count, capture_path, false))
+            {
+                error_log("The headless run failed!");
+                return 1;
+            }
+
+            if (!golden_path.empty())
+            {
+                return compare_with_golden_image(capture_path, golden_path) ? 0 : 1;
+            }
+
+            return 0;
+        }
+
         start_sdl3_instance();
         check_operating_system_support(); // Check if we are running on a supported operating system.
 
@@ -85,7 +181,7 @@ int main()
         if (!std::filesystem::exists("game.config"))
         {
             create_new_empty_file("game.config");
-            write_file("game.config", "WINDOW_WIDTH=1920\nWINDOW_HEIGHT=1080\nWINDOW_MODE=2\nGRAPHICS_API=0\nMONITOR=1\nGPU=1", false);
+            write_file("game.config", "WINDOW_WIDTH=1920\nWINDOW_HEIGHT=1080\nWINDOW_MODE=2\nGRAPHICS_API=0\nMONITOR=1\nGPU=1\nVSYNC_MODE=0\nFPS_CAP=0", false);
         }
 
         // Read the data in the game.config file and parse its data into a map.
@@ -96,6 +192,8 @@ int main()
         std::string graphics_api = config["GRAPHICS_API"];
         std::string monitor = config["MONITOR"];
         std::string gpu = config["GPU"];
+        std::string vsync_mode = config["VSYNC_MODE"];
+        std::string fps_cap = config["FPS_CAP"];
 
         if (!is_an_integer(window_mode))
         {
@@ -103,6 +201,12 @@ int main()
             window_mode = "2";
         }
 
+        // Only a window can be resized.
+        if (resize_stress)
+        {
+            window_mode = "0";
+        }
+
         if (!is_an_integer(graphics_api))
         {
             error_log("The graphics API configured (" + graphics_api + ") is not valid! Defaulted to Vulkan!");
@@ -137,6 +241,19 @@ int main()
             gpu = 1;
         }
 
+        // Present modes: 0 = v-sync, 1 = relaxed v-sync, 2 = mailbox, 3 = immediate.
+        if (!is_an_integer(vsync_mode) || stoi(vsync_mode) < 0 || stoi(vsync_mode) > 3)
+        {
+            error_log("The v-sync mode configured (" + vsync_mode + ") is not valid! Defaulted to v-sync!");
+            vsync_mode = "0";
+        }
+
+        if (!is_an_integer(fps_cap) || stoi(fps_cap) < 0)
+        {
+            error_log("The FPS cap configured (" + fps_cap + ") is not valid! Defaulted to uncapped!");
+            fps_cap = "0";
+        }
+
         // Get the screen resolution.
         // Screen resolution stored as <width, height>.
         const std::pair<int, int> screen_resolution = get_display_resolution(display_indexes[monitor_index - 1]);
@@ -156,11 +273,15 @@ int main()
         // We create the SDL3 window of the game.
         const SDL3_Window window(window_width, window_height, stoi(window_mode), window_title, stoi(graphics_api));
 
+        // The resize stress stops after the frames count, the game runs until its window is closed.
+        const uint64_t window_frames_count = resize_stress ? frames_count : 0;
+        bool run_succeeded = true;
+
         // Select the graphics API that we are going to use.
         switch (stoi(graphics_api))
         {
             case VULKAN:
-                run_using_vulkan(window.get(), gpu_index);
+                run_succeeded = run_using_vulkan(window.get(), gpu_index, stoi(vsync_mode), stoi(fps_cap), window_frames_count, "", resize_stress);
                 break;
 
             case OPENGL:
@@ -169,11 +290,11 @@ int main()
 
             // If the graphics API provided by the game.config file is not handled, we default to Vulkan.
             default:
-                run_using_vulkan(window.get(), gpu_index);
+                run_succeeded = run_using_vulkan(window.get(), gpu_index, stoi(vsync_mode), stoi(fps_cap), window_frames_count, "", resize_stress);
                 break;
         }
 
-        return 0;
+        return run_succeeded ? 0 : 1;
     }
     catch (const std::exception &error)
     {
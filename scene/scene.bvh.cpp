@@ -0,0 +1,834 @@
+#include "scene.bvh.hpp"
+
+#include "../vulkan/uniform/uniform.frustum.hpp"
+#include "../config/engine.config.hpp"
+#include "../logs/logs.handler.hpp"
+
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <cfloat>
+#include <utility>
+
+#if defined(__SSE__) || defined(_M_X64)
+    #include <xmmintrin.h>
+#endif
+
+// Amount of bins used to evaluate the SAH splits.
+constexpr const uint32_t BVH_SAH_BINS = 16;
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+// Return a box that contains nothing, merging it with another box gives that box.
+BoundingBox get_empty_box()
+{
+    return { glm::vec3(FLT_MAX), glm::vec3(-FLT_MAX) };
+}
+
+BoundingBox merge_boxes
+(
+    const BoundingBox &first,
+    const BoundingBox &second
+)
+{
+    return { glm::min(first.minimum, second.minimum), glm::max(first.maximum, second.maximum) };
+}
+
+float get_box_surface_area
+(
+    const BoundingBox &box
+)
+{
+    const glm::vec3 size = glm::max(box.maximum - box.minimum, glm::vec3(0.0f));
+    return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+}
+
+void set_bvh_node_child
+(
+    BvhNode &node,
+    const uint32_t &slot,
+    const uint32_t &child,
+    const BoundingBox &box
+)
+{
+    node.children[slot] = child;
+    node.minimum_x[slot] = box.minimum.x;
+    node.minimum_y[slot] = box.minimum.y;
+    node.minimum_z[slot] = box.minimum.z;
+    node.maximum_x[slot] = box.maximum.x;
+    node.maximum_y[slot] = box.maximum.y;
+    node.maximum_z[slot] = box.maximum.z;
+}
+
+// Return the box around every child of a node.
+BoundingBox get_bvh_node_box
+(
+    const BvhNode &node
+)
+{
+    BoundingBox box = get_empty_box();
+
+    for (uint32_t slot = 0; slot < BVH_WIDTH; slot++)
+    {
+        if (node.children[slot] != BVH_EMPTY_CHILD)
+        {
+            box.minimum = glm::min(box.minimum, glm::vec3(node.minimum_x[slot], node.minimum_y[slot], node.minimum_z[slot]));
+            box.maximum = glm::max(box.maximum, glm::vec3(node.maximum_x[slot], node.maximum_y[slot], node.maximum_z[slot]));
+        }
+    }
+
+    return box;
+}
+
+// Return the mask of the children boxes overlapping a box (bit i for the child i).
+int intersect_bvh_node_box
+(
+    const BvhNode &node,
+    const BoundingBox &box
+)
+{
+    #if defined(__SSE__) || defined(_M_X64)
+        __m128 overlap = _mm_cmple_ps(_mm_load_ps(node.minimum_x), _mm_set1_ps(box.maximum.x));
+        overlap = _mm_and_ps(overlap, _mm_cmple_ps(_mm_load_ps(node.minimum_y), _mm_set1_ps(box.maximum.y)));
+        overlap = _mm_and_ps(overlap, _mm_cmple_ps(_mm_load_ps(node.minimum_z), _mm_set1_ps(box.maximum.z)));
+        overlap = _mm_and_ps(overlap, _mm_cmpge_ps(_mm_load_ps(node.maximum_x), _mm_set1_ps(box.minimum.x)));
+        overlap = _mm_and_ps(overlap, _mm_cmpge_ps(_mm_load_ps(node.maximum_y), _mm_set1_ps(box.minimum.y)));
+        overlap = _mm_and_ps(overlap, _mm_cmpge_ps(_mm_load_ps(node.maximum_z), _mm_set1_ps(box.minimum.z)));
+
+        return _mm_movemask_ps(overlap);
+    #else
+        int mask = 0;
+
+        for (uint32_t slot = 0; slot < BVH_WIDTH; slot++)
+        {
+            const bool overlap = node.minimum_x[slot] <= box.maximum.x && node.minimum_y[slot] <= box.maximum.y && node.minimum_z[slot] <= box.maximum.z
+                && node.maximum_x[slot] >= box.minimum.x && node.maximum_y[slot] >= box.minimum.y && node.maximum_z[slot] >= box.minimum.z;
+
+            mask |= overlap ? 1 << slot : 0;
+        }
+
+        return mask;
+    #endif
+}
+
+// Return the mask of the children boxes hit by a ray (slab test), with the entry distance of each one.
+int intersect_bvh_node_ray
+(
+    const BvhNode &node,
+    const glm::vec3 &origin,
+    const glm::vec3 &inverse_direction,
+    const float &max_distance,
+    float distances[BVH_WIDTH]
+)
+{
+    #if defined(__SSE__) || defined(_M_X64)
+        const __m128 origin_x = _mm_set1_ps(origin.x);
+        const __m128 origin_y = _mm_set1_ps(origin.y);
+        const __m128 origin_z = _mm_set1_ps(origin.z);
+        const __m128 inverse_x = _mm_set1_ps(inverse_direction.x);
+        const __m128 inverse_y = _mm_set1_ps(inverse_direction.y);
+        const __m128 inverse_z = _mm_set1_ps(inverse_direction.z);
+
+        const __m128 near_x = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(node.minimum_x), origin_x), inverse_x);
+        const __m128 near_y = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(node.minimum_y), origin_y), inverse_y);
+        const __m128 near_z = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(node.minimum_z), origin_z), inverse_z);
+        const __m128 far_x = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(node.maximum_x), origin_x), inverse_x);
+        const __m128 far_y = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(node.maximum_y), origin_y), inverse_y);
+        const __m128 far_z = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(node.maximum_z), origin_z), inverse_z);
+
+        __m128 entry = _mm_max_ps(_mm_min_ps(near_x, far_x), _mm_min_ps(near_y, far_y));
+        entry = _mm_max_ps(entry, _mm_min_ps(near_z, far_z));
+        entry = _mm_max_ps(entry, _mm_setzero_ps());
+
+        __m128 exit = _mm_min_ps(_mm_max_ps(near_x, far_x), _mm_max_ps(near_y, far_y));
+        exit = _mm_min_ps(exit, _mm_max_ps(near_z, far_z));
+        exit = _mm_min_ps(exit, _mm_set1_ps(max_distance));
+
+        _mm_storeu_ps(distances, entry);
+        return _mm_movemask_ps(_mm_cmple_ps(entry, exit));
+    #else
+        int mask = 0;
+
+        for (uint32_t slot = 0; slot < BVH_WIDTH; slot++)
+        {
+            const glm::vec3 near_distances = (glm::vec3(node.minimum_x[slot], node.minimum_y[slot], node.minimum_z[slot]) - origin) * inverse_direction;
+            const glm::vec3 far_distances = (glm::vec3(node.maximum_x[slot], node.maximum_y[slot], node.maximum_z[slot]) - origin) * inverse_direction;
+            const glm::vec3 entries = glm::min(near_distances, far_distances);
+            const glm::vec3 exits = glm::max(near_distances, far_distances);
+
+            const float entry = std::max({ entries.x, entries.y, entries.z, 0.0f });
+            const float exit = std::min({ exits.x, exits.y, exits.z, max_distance });
+
+            distances[slot] = entry;
+            mask |= entry <= exit ? 1 << slot : 0;
+        }
+
+        return mask;
+    #endif
+}
+
+// Classify the children boxes of a node against a frustum.
+// - The intersect mask holds the boxes at least partially inside (nearest corner of each plane in front of it).
+// - The inside mask holds the boxes entirely inside (farthest corner of each plane in front of it).
+void classify_bvh_node_frustum
+(
+    const BvhNode &node,
+    const Frustum &frustum,
+    int &intersect_mask,
+    int &inside_mask
+)
+{
+    intersect_mask = (1 << BVH_WIDTH) - 1;
+    inside_mask = (1 << BVH_WIDTH) - 1;
+
+    for (const glm::vec4 &plane : frustum.planes)
+    {
+        // The corner the farthest along the plane normal is the same for every box, only the arrays differ.
+        const float* positive_x = plane.x >= 0.0f ? node.maximum_x : node.minimum_x;
+        const float* positive_y = plane.y >= 0.0f ? node.maximum_y : node.minimum_y;
+        const float* positive_z = plane.z >= 0.0f ? node.maximum_z : node.minimum_z;
+        const float* negative_x = plane.x >= 0.0f ? node.minimum_x : node.maximum_x;
+        const float* negative_y = plane.y >= 0.0f ? node.minimum_y : node.maximum_y;
+        const float* negative_z = plane.z >= 0.0f ? node.minimum_z : node.maximum_z;
+
+        #if defined(__SSE__) || defined(_M_X64)
+            const __m128 normal_x = _mm_set1_ps(plane.x);
+            const __m128 normal_y = _mm_set1_ps(plane.y);
+            const __m128 normal_z = _mm_set1_ps(plane.z);
+            const __m128 distance = _mm_set1_ps(plane.w);
+
+            __m128 positive = _mm_add_ps(_mm_mul_ps(_mm_load_ps(positive_x), normal_x), distance);
+            positive = _mm_add_ps(positive, _mm_mul_ps(_mm_load_ps(positive_y), normal_y));
+            positive = _mm_add_ps(positive, _mm_mul_ps(_mm_load_ps(positive_z), normal_z));
+
+            __m128 negative = _mm_add_ps(_mm_mul_ps(_mm_load_ps(negative_x), normal_x), distance);
+            negative = _mm_add_ps(negative, _mm_mul_ps(_mm_load_ps(negative_y), normal_y));
+            negative = _mm_add_ps(negative, _mm_mul_ps(_mm_load_ps(negative_z), normal_z));
+
+            intersect_mask &= _mm_movemask_ps(_mm_cmpge_ps(positive, _mm_setzero_ps()));
+            inside_mask &= _mm_movemask_ps(_mm_cmpge_ps(negative, _mm_setzero_ps()));
+        #else
+            for (uint32_t slot = 0; slot < BVH_WIDTH; slot++)
+            {
+                const float positive = positive_x[slot] * plane.x + positive_y[slot] * plane.y + positive_z[slot] * plane.z + plane.w;
+                const float negative = negative_x[slot] * plane.x + negative_y[slot] * plane.y + negative_z[slot] * plane.z + plane.w;
+
+                intersect_mask &= positive >= 0.0f ? ~0 : ~(1 << slot);
+                inside_mask &= negative >= 0.0f ? ~0 : ~(1 << slot);
+            }
+        #endif
+
+        if (intersect_mask == 0)
+        {
+            break;
+        }
+    }
+
+    inside_mask &= intersect_mask;
+}
+
+///////////////////////////////////////////////
+//////////////////// Class ////////////////////
+///////////////////////////////////////////////
+
+// Create an empty hierarchy.
+SceneBvh::SceneBvh()
+{
+}
+
+// Destroy the hierarchy and its objects.
+SceneBvh::~SceneBvh()
+{
+    nodes.clear();
+    proxies.clear();
+}
+
+// Add an object, it is placed in the hierarchy at the next update.
+uint32_t SceneBvh::insert_object
+(
+    const BoundingBox &box,
+    const uint32_t &user_data
+)
+{
+    uint32_t proxy = 0;
+
+    if (free_proxies.size() > 0)
+    {
+        proxy = free_proxies.back();
+        free_proxies.pop_back();
+    }
+    else
+    {
+        proxy = static_cast<uint32_t>(proxies.size());
+        proxies.emplace_back();
+    }
+
+    proxies[proxy] = { box, user_data, BVH_EMPTY_CHILD, 0, true };
+    objects_count++;
+    needs_rebuild = true;
+
+    return proxy;
+}
+
+void SceneBvh::remove_object
+(
+    const uint32_t &proxy
+)
+{
+    if (proxy >= proxies.size() || !proxies[proxy].alive)
+    {
+        error_log("Failed to remove the object #" + std::to_string(proxy) + " from the BVH! It doesn't exist.");
+        return;
+    }
+
+    proxies[proxy].alive = false;
+    free_proxies.push_back(proxy);
+    objects_count--;
+    needs_rebuild = true;
+}
+
+// Change the box of an object, the boxes of its ancestors are refitted at the next update.
+void SceneBvh::move_object
+(
+    const uint32_t &proxy,
+    const BoundingBox &box
+)
+{
+    if (proxy >= proxies.size() || !proxies[proxy].alive)
+    {
+        error_log("Failed to move the object #" + std::to_string(proxy) + " in the BVH! It doesn't exist.");
+        return;
+    }
+
+    BvhProxy &object = proxies[proxy];
+
+    if (object.box.minimum == box.minimum && object.box.maximum == box.maximum)
+    {
+        return;
+    }
+
+    object.box = box;
+
+    if (!needs_rebuild && object.node != BVH_EMPTY_CHILD)
+    {
+        moved_proxies.push_back(proxy);
+    }
+}
+
+size_t SceneBvh::get_objects_count() const
+{
+    return objects_count;
+}
+
+size_t SceneBvh::get_nodes_count() const
+{
+    return nodes.size();
+}
+
+// Apply the changes since the last update: a refit for the moved objects, or a full rebuild.
+// The hierarchy is rebuilt after BVH_REBUILD_INTERVAL refits, as the refitted boxes slowly lose their quality.
+void SceneBvh::update()
+{
+    if (needs_rebuild)
+    {
+        rebuild();
+        return;
+    }
+
+    if (moved_proxies.size() < 1)
+    {
+        return;
+    }
+
+    refits_count++;
+
+    if (refits_count >= EngineConfig::BVH_REBUILD_INTERVAL)
+    {
+        rebuild();
+        return;
+    }
+
+    refit();
+}
+
+// Build the hierarchy from scratch with a binned SAH, then collapse the binary tree into 4-wide nodes.
+void SceneBvh::rebuild()
+{
+    nodes.clear();
+    moved_proxies.clear();
+    refits_count = 0;
+    needs_rebuild = false;
+
+    std::vector<BvhBuildObject> objects;
+    objects.reserve(objects_count);
+
+    for (uint32_t proxy = 0; proxy < proxies.size(); proxy++)
+    {
+        const BoundingBox &box = proxies[proxy].box;
+        proxies[proxy].node = BVH_EMPTY_CHILD;
+
+        if (proxies[proxy].alive)
+        {
+            objects.push_back({ box, (box.minimum + box.maximum) * 0.5f, proxy });
+        }
+    }
+
+    if (objects.size() < 1)
+    {
+        dirty_nodes.clear();
+        return;
+    }
+
+    std::vector<BvhBuildNode> build_nodes;
+    build_nodes.reserve(objects.size() * 2);
+
+    const uint32_t root = build_binary_node(build_nodes, objects, 0, objects.size());
+
+    nodes.reserve(objects.size() / 2 + 1);
+    collapse_build_node(build_nodes, root, BVH_EMPTY_CHILD, 0);
+
+    dirty_nodes.assign(nodes.size(), 0);
+}
+
+// Append the objects whose box overlaps a box.
+void SceneBvh::query_box
+(
+    const BoundingBox &box,
+    std::vector<uint32_t> &results
+) const
+{
+    if (nodes.size() < 1)
+    {
+        return;
+    }
+
+    // The traversal stack only grows with the depth, which is logarithmic after a SAH build.
+    std::vector<uint32_t> stack;
+    stack.reserve(64);
+    stack.push_back(0);
+
+    while (stack.size() > 0)
+    {
+        const BvhNode &node = nodes[stack.back()];
+        stack.pop_back();
+        const int mask = intersect_bvh_node_box(node, box);
+
+        for (uint32_t slot = 0; slot < BVH_WIDTH; slot++)
+        {
+            const uint32_t child = node.children[slot];
+
+            if ((mask & (1 << slot)) == 0 || child == BVH_EMPTY_CHILD)
+            {
+                continue;
+            }
+
+            if ((child & BVH_LEAF_FLAG) != 0)
+            {
+                results.push_back(proxies[child & ~BVH_LEAF_FLAG].user_data);
+            }
+            else stack.push_back(child);
+        }
+    }
+}
+
+void SceneBvh::query_boxes
+(
+    const std::vector<BoundingBox> &boxes,
+    std::vector<std::vector<uint32_t>> &results
+) const
+{
+    results.resize(boxes.size());
+
+    for (size_t i = 0; i < boxes.size(); i++)
+    {
+        results[i].clear();
+        query_box(boxes[i], results[i]);
+    }
+}
+
+// Append the objects whose box is at least partially inside a frustum.
+// The subtrees entirely inside are collected without any further test.
+void SceneBvh::query_frustum
+(
+    const Frustum &frustum,
+    std::vector<uint32_t> &results
+) const
+{
+    if (nodes.size() < 1)
+    {
+        return;
+    }
+
+    std::vector<uint32_t> stack;
+    stack.reserve(64);
+    stack.push_back(0);
+
+    while (stack.size() > 0)
+    {
+        const BvhNode &node = nodes[stack.back()];
+        stack.pop_back();
+
+        int intersect_mask = 0;
+        int inside_mask = 0;
+        classify_bvh_node_frustum(node, frustum, intersect_mask, inside_mask);
+
+        for (uint32_t slot = 0; slot < BVH_WIDTH; slot++)
+        {
+            const uint32_t child = node.children[slot];
+
+            if ((intersect_mask & (1 << slot)) == 0 || child == BVH_EMPTY_CHILD)
+            {
+                continue;
+            }
+
+            if ((child & BVH_LEAF_FLAG) != 0)
+            {
+                results.push_back(proxies[child & ~BVH_LEAF_FLAG].user_data);
+            }
+            else if ((inside_mask & (1 << slot)) != 0)
+            {
+                collect_subtree(child, results);
+            }
+            else stack.push_back(child);
+        }
+    }
+}
+
+// Query several frustums at once (e.g. the cascades of a shadow map).
+void SceneBvh::query_frustums
+(
+    const std::vector<Frustum> &frustums,
+    std::vector<std::vector<uint32_t>> &results
+) const
+{
+    results.resize(frustums.size());
+
+    for (size_t i = 0; i < frustums.size(); i++)
+    {
+        results[i].clear();
+        query_frustum(frustums[i], results[i]);
+    }
+}
+
+// Return the closest object box hit by a ray.
+// The children are visited closest first and the subtrees behind the closest hit are skipped.
+BvhHit SceneBvh::intersect_ray
+(
+    const BvhRay &ray
+) const
+{
+    BvhHit hit { BVH_EMPTY_CHILD, ray.max_distance };
+
+    if (nodes.size() < 1)
+    {
+        return hit;
+    }
+
+    const glm::vec3 inverse_direction = glm::vec3(1.0f) / ray.direction;
+
+    std::vector<std::pair<uint32_t, float>> stack;
+    stack.reserve(64);
+    stack.push_back({ 0, 0.0f });
+
+    while (stack.size() > 0)
+    {
+        const std::pair<uint32_t, float> entry = stack.back();
+        stack.pop_back();
+
+        if (entry.second > hit.distance)
+        {
+            continue;
+        }
+
+        const BvhNode &node = nodes[entry.first];
+
+        float distances[BVH_WIDTH];
+        const int mask = intersect_bvh_node_ray(node, ray.origin, inverse_direction, hit.distance, distances);
+
+        // Push the farthest children first, so that the closest one is visited next.
+        uint32_t order[BVH_WIDTH] = { 0, 1, 2, 3 };
+        std::sort(order, order + BVH_WIDTH, [&](const uint32_t &first, const uint32_t &second) { return distances[first] > distances[second]; });
+
+        for (const uint32_t &slot : order)
+        {
+            const uint32_t child = node.children[slot];
+
+            if ((mask & (1 << slot)) == 0 || child == BVH_EMPTY_CHILD || distances[slot] > hit.distance)
+            {
+                continue;
+            }
+
+            if ((child & BVH_LEAF_FLAG) != 0)
+            {
+                hit.object = proxies[child & ~BVH_LEAF_FLAG].user_data;
+                hit.distance = distances[slot];
+            }
+            else stack.push_back({ child, distances[slot] });
+        }
+    }
+
+    return hit;
+}
+
+void SceneBvh::intersect_rays
+(
+    const std::vector<BvhRay> &rays,
+    std::vector<BvhHit> &hits
+) const
+{
+    hits.resize(rays.size());
+
+    for (size_t i = 0; i < rays.size(); i++)
+    {
+        hits[i] = intersect_ray(rays[i]);
+    }
+}
+
+// Build a binary node over a range of objects, split where the surface area heuristic is the lowest.
+uint32_t SceneBvh::build_binary_node
+(
+    std::vector<BvhBuildNode> &build_nodes,
+    std::vector<BvhBuildObject> &objects,
+    const size_t &first,
+    const size_t &last
+)
+{
+    BoundingBox box = get_empty_box();
+    BoundingBox centroids = get_empty_box();
+
+    for (size_t i = first; i < last; i++)
+    {
+        box = merge_boxes(box, objects[i].box);
+        centroids = merge_boxes(centroids, { objects[i].centroid, objects[i].centroid });
+    }
+
+    const uint32_t index = static_cast<uint32_t>(build_nodes.size());
+    build_nodes.push_back({ box, BVH_EMPTY_CHILD, BVH_EMPTY_CHILD, objects[first].proxy });
+
+    if (last - first == 1)
+    {
+        return index;
+    }
+
+    const glm::vec3 extent = centroids.maximum - centroids.minimum;
+    const int axis = extent.x > extent.y && extent.x > extent.z ? 0 : (extent.y > extent.z ? 1 : 2);
+
+    size_t middle = (first + last) / 2;
+
+    // The ranges of up to 4 objects fit in a single node, so they are split in the middle instead of evaluating the SAH.
+    if (last - first > BVH_WIDTH && extent[axis] > 0.0f)
+    {
+        // Bin the centroids along the largest axis, then evaluate the split between each pair of bins.
+        BoundingBox bin_boxes[BVH_SAH_BINS];
+        size_t bin_counts[BVH_SAH_BINS] = {};
+        std::fill(std::begin(bin_boxes), std::end(bin_boxes), get_empty_box());
+
+        const float scale = BVH_SAH_BINS / extent[axis];
+
+        const auto get_bin = [&](const BvhBuildObject &object) -> uint32_t
+        {
+            return std::min(BVH_SAH_BINS - 1, static_cast<uint32_t>((object.centroid[axis] - centroids.minimum[axis]) * scale));
+        };
+
+        for (size_t i = first; i < last; i++)
+        {
+            const uint32_t bin = get_bin(objects[i]);
+
+            bin_boxes[bin] = merge_boxes(bin_boxes[bin], objects[i].box);
+            bin_counts[bin]++;
+        }
+
+        float right_costs[BVH_SAH_BINS] = {};
+        BoundingBox right_box = get_empty_box();
+        size_t right_count = 0;
+
+        for (uint32_t bin = BVH_SAH_BINS - 1; bin > 0; bin--)
+        {
+            right_box = merge_boxes(right_box, bin_boxes[bin]);
+            right_count += bin_counts[bin];
+            right_costs[bin] = get_box_surface_area(right_box) * right_count;
+        }
+
+        BoundingBox left_box = get_empty_box();
+        size_t left_count = 0;
+        float best_cost = FLT_MAX;
+        uint32_t best_split = 0;
+
+        for (uint32_t split = 1; split < BVH_SAH_BINS; split++)
+        {
+            left_box = merge_boxes(left_box, bin_boxes[split - 1]);
+            left_count += bin_counts[split - 1];
+
+            const float cost = get_box_surface_area(left_box) * left_count + right_costs[split];
+
+            if (left_count > 0 && left_count < last - first && cost < best_cost)
+            {
+                best_cost = cost;
+                best_split = split;
+            }
+        }
+
+        if (best_split > 0)
+        {
+            const auto split_point = std::partition(objects.begin() + first, objects.begin() + last, [&](const BvhBuildObject &object) { return get_bin(object) < best_split; });
+            middle = static_cast<size_t>(split_point - objects.begin());
+        }
+    }
+
+    // Every object in the same place or in the same bin: split the range in two halves.
+    if (middle <= first || middle >= last)
+    {
+        middle = (first + last) / 2;
+    }
+
+    const uint32_t left = build_binary_node(build_nodes, objects, first, middle);
+    const uint32_t right = build_binary_node(build_nodes, objects, middle, last);
+
+    build_nodes[index].left = left;
+    build_nodes[index].right = right;
+
+    return index;
+}
+
+// Create a 4-wide node from a binary node, by opening its largest descendants until it has 4 children.
+// The nodes are created depth first, so a parent always comes before its children.
+void SceneBvh::collapse_build_node
+(
+    const std::vector<BvhBuildNode> &build_nodes,
+    const uint32_t &build_node,
+    const uint32_t &parent,
+    const uint32_t &parent_slot
+)
+{
+    const uint32_t node_index = static_cast<uint32_t>(nodes.size());
+
+    BvhNode node {};
+    node.parent = parent;
+    node.parent_slot = parent_slot;
+
+    for (uint32_t slot = 0; slot < BVH_WIDTH; slot++)
+    {
+        set_bvh_node_child(node, slot, BVH_EMPTY_CHILD, get_empty_box());
+    }
+
+    nodes.push_back(node);
+
+    if (parent != BVH_EMPTY_CHILD)
+    {
+        set_bvh_node_child(nodes[parent], parent_slot, node_index, build_nodes[build_node].box);
+    }
+
+    std::vector<uint32_t> children;
+
+    if (build_nodes[build_node].left == BVH_EMPTY_CHILD)
+    {
+        children.push_back(build_node); // A single object at the root.
+    }
+    else children = { build_nodes[build_node].left, build_nodes[build_node].right };
+
+    while (children.size() < BVH_WIDTH)
+    {
+        int largest = -1;
+        float largest_area = -1.0f;
+
+        for (size_t i = 0; i < children.size(); i++)
+        {
+            const BvhBuildNode &child = build_nodes[children[i]];
+            const float area = get_box_surface_area(child.box);
+
+            if (child.left != BVH_EMPTY_CHILD && area > largest_area)
+            {
+                largest = static_cast<int>(i);
+                largest_area = area;
+            }
+        }
+
+        if (largest < 0)
+        {
+            break;
+        }
+
+        const BvhBuildNode &opened = build_nodes[children[largest]];
+        children[largest] = opened.left;
+        children.push_back(opened.right);
+    }
+
+    for (uint32_t slot = 0; slot < children.size(); slot++)
+    {
+        const BvhBuildNode &child = build_nodes[children[slot]];
+
+        if (child.left == BVH_EMPTY_CHILD)
+        {
+            set_bvh_node_child(nodes[node_index], slot, child.proxy | BVH_LEAF_FLAG, child.box);
+            proxies[child.proxy].node = node_index;
+            proxies[child.proxy].slot = slot;
+        }
+        else collapse_build_node(build_nodes, children[slot], node_index, slot);
+    }
+}
+
+// Update the boxes of the moved objects, then the boxes of their ancestors.
+// The parents come before their children, so walking the nodes backward refits each node once, after its children.
+void SceneBvh::refit()
+{
+    uint32_t last_dirty = 0;
+
+    for (const uint32_t &proxy : moved_proxies)
+    {
+        const BvhProxy &object = proxies[proxy];
+
+        if (!object.alive || object.node == BVH_EMPTY_CHILD)
+        {
+            continue;
+        }
+
+        set_bvh_node_child(nodes[object.node], object.slot, proxy | BVH_LEAF_FLAG, object.box);
+        dirty_nodes[object.node] = 1;
+        last_dirty = std::max(last_dirty, object.node);
+    }
+
+    moved_proxies.clear();
+
+    for (uint32_t node = last_dirty; node > 0; node--)
+    {
+        if (dirty_nodes[node] == 0)
+        {
+            continue;
+        }
+
+        const uint32_t parent = nodes[node].parent;
+
+        set_bvh_node_child(nodes[parent], nodes[node].parent_slot, node, get_bvh_node_box(nodes[node]));
+        dirty_nodes[parent] = 1;
+        dirty_nodes[node] = 0;
+    }
+
+    dirty_nodes[0] = 0;
+}
+
+// Append every object of a subtree.
+void SceneBvh::collect_subtree
+(
+    const uint32_t &node,
+    std::vector<uint32_t> &results
+) const
+{
+    for (const uint32_t &child : nodes[node].children)
+    {
+        if (child == BVH_EMPTY_CHILD)
+        {
+            continue;
+        }
+
+        if ((child & BVH_LEAF_FLAG) != 0)
+        {
+            results.push_back(proxies[child & ~BVH_LEAF_FLAG].user_data);
+        }
+        else collect_subtree(child, results);
+    }
+}
@@ -0,0 +1,195 @@
+#include "../vulkan/uniform/uniform.frustum.hpp"
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+#ifndef SCENE_BVH_HPP
+#define SCENE_BVH_HPP
+
+// Amount of children of each node, tested at once with SSE.
+constexpr const uint32_t BVH_WIDTH = 4;
+
+// Flags of the node children: a child is either a node, an object (leaf) or empty.
+constexpr const uint32_t BVH_LEAF_FLAG = 0x80000000;
+constexpr const uint32_t BVH_EMPTY_CHILD = 0xFFFFFFFF;
+
+////////////////////////////////////////////////////
+//////////////////// Structures ////////////////////
+////////////////////////////////////////////////////
+
+// Axis aligned bounding box.
+struct BoundingBox
+{
+    glm::vec3 minimum;
+    glm::vec3 maximum;
+};
+
+// Node with 4 children, their boxes are stored as structure of arrays so that one SSE register holds 4 bounds.
+// The 128 bytes node fills exactly two cache lines.
+struct alignas(64) BvhNode
+{
+    float minimum_x[BVH_WIDTH];
+    float minimum_y[BVH_WIDTH];
+    float minimum_z[BVH_WIDTH];
+    float maximum_x[BVH_WIDTH];
+    float maximum_y[BVH_WIDTH];
+    float maximum_z[BVH_WIDTH];
+    uint32_t children[BVH_WIDTH];  // Node index, object proxy with BVH_LEAF_FLAG, or BVH_EMPTY_CHILD.
+    uint32_t parent;               // Parent node, BVH_EMPTY_CHILD for the root.
+    uint32_t parent_slot;          // Slot of the node in its parent.
+};
+
+// Ray for the intersection queries.
+struct BvhRay
+{
+    glm::vec3 origin;
+    glm::vec3 direction;
+    float max_distance;
+};
+
+// Closest object box hit by a ray, the object is BVH_EMPTY_CHILD if nothing was hit.
+struct BvhHit
+{
+    uint32_t object;
+    float distance;
+};
+
+// Object stored in the hierarchy.
+struct BvhProxy
+{
+    BoundingBox box;
+    uint32_t user_data;  // Value returned by the queries (e.g. index of a render object).
+    uint32_t node;       // Node and slot holding the object, BVH_EMPTY_CHILD until the next build.
+    uint32_t slot;
+    bool alive;
+};
+
+// Object copied for the SAH build, so that the partitions move contiguous data instead of following indices.
+struct BvhBuildObject
+{
+    BoundingBox box;
+    glm::vec3 centroid;
+    uint32_t proxy;
+};
+
+// Temporary node of the binary SAH build, collapsed into 4-wide nodes afterwards.
+struct BvhBuildNode
+{
+    BoundingBox box;
+    uint32_t left;    // Children build nodes, BVH_EMPTY_CHILD for a leaf.
+    uint32_t right;
+    uint32_t proxy;   // Object of a leaf.
+};
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+BoundingBox get_empty_box();
+
+BoundingBox merge_boxes
+(
+    const BoundingBox &first,
+    const BoundingBox &second
+);
+
+float get_box_surface_area
+(
+    const BoundingBox &box
+);
+
+void set_bvh_node_child
+(
+    BvhNode &node,
+    const uint32_t &slot,
+    const uint32_t &child,
+    const BoundingBox &box
+);
+
+BoundingBox get_bvh_node_box
+(
+    const BvhNode &node
+);
+
+int intersect_bvh_node_box
+(
+    const BvhNode &node,
+    const BoundingBox &box
+);
+
+int intersect_bvh_node_ray
+(
+    const BvhNode &node,
+    const glm::vec3 &origin,
+    const glm::vec3 &inverse_direction,
+    const float &max_distance,
+    float distances[BVH_WIDTH]
+);
+
+void classify_bvh_node_frustum
+(
+    const BvhNode &node,
+    const Frustum &frustum,
+    int &intersect_mask,
+    int &inside_mask
+);
+
+///////////////////////////////////////////////
+//////////////////// Class ////////////////////
+///////////////////////////////////////////////
+
+// Dynamic bounding volume hierarchy over the scene objects, shared by the spatial queries of the engine.
+// - The nodes have 4 children, tested together with SSE during the traversals.
+// - Moving objects only refit the boxes of their ancestors.
+// - Adding or removing objects, or refitting for too long, triggers a full binned SAH rebuild at the next update.
+class SceneBvh
+{
+
+public:
+    // Constructor.
+    SceneBvh();
+
+    // Destructor.
+    ~SceneBvh();
+
+    uint32_t insert_object(const BoundingBox &box, const uint32_t &user_data);
+    void remove_object(const uint32_t &proxy);
+    void move_object(const uint32_t &proxy, const BoundingBox &box);
+    size_t get_objects_count() const;
+    size_t get_nodes_count() const;
+
+    void update();
+    void rebuild();
+
+    void query_box(const BoundingBox &box, std::vector<uint32_t> &results) const;
+    void query_boxes(const std::vector<BoundingBox> &boxes, std::vector<std::vector<uint32_t>> &results) const;
+    void query_frustum(const Frustum &frustum, std::vector<uint32_t> &results) const;
+    void query_frustums(const std::vector<Frustum> &frustums, std::vector<std::vector<uint32_t>> &results) const;
+    BvhHit intersect_ray(const BvhRay &ray) const;
+    void intersect_rays(const std::vector<BvhRay> &rays, std::vector<BvhHit> &hits) const;
+
+    // Prevent data duplication.
+    SceneBvh(const SceneBvh&) = delete;
+    SceneBvh& operator=(const SceneBvh&) = delete;
+
+private:
+    // We declare the members of the class to store.
+    std::vector<BvhNode> nodes;            // The root is the first node, the parents come before their children.
+    std::vector<BvhProxy> proxies;
+    std::vector<uint32_t> free_proxies;
+    std::vector<uint32_t> moved_proxies;
+    std::vector<uint8_t> dirty_nodes;
+    size_t objects_count = 0;
+    uint32_t refits_count = 0;             // Refits since the last build.
+    bool needs_rebuild = false;
+
+    uint32_t build_binary_node(std::vector<BvhBuildNode> &build_nodes, std::vector<BvhBuildObject> &objects, const size_t &first, const size_t &last);
+    void collapse_build_node(const std::vector<BvhBuildNode> &build_nodes, const uint32_t &build_node, const uint32_t &parent, const uint32_t &parent_slot);
+    void refit();
+    void collect_subtree(const uint32_t &node, std::vector<uint32_t> &results) const;
+
+};
+
+#endif
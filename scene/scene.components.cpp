@@ -0,0 +1,18 @@
+#include "scene.components.hpp"
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+// Return the model matrix of a transform (scale, then rotation, then translation).
+glm::mat4 get_transform_matrix
+(
+    const Transform &transform
+)
+{
+    glm::mat4 matrix = glm::translate(glm::mat4(1.0f), transform.position);
+    matrix = glm::rotate(matrix, transform.rotation.z, glm::vec3(0.0f, 0.0f, 1.0f));
+    matrix = glm::rotate(matrix, transform.rotation.y, glm::vec3(0.0f, 1.0f, 0.0f));
+    matrix = glm::rotate(matrix, transform.rotation.x, glm::vec3(1.0f, 0.0f, 0.0f));
+
+    return glm::scale(matrix, transform.scale);
+}
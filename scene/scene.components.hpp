@@ -0,0 +1,49 @@
+#include <glm/glm.hpp>
+#include <cstdint>
+
+#ifndef SCENE_COMPONENTS_HPP
+#define SCENE_COMPONENTS_HPP
+
+////////////////////////////////////////////////////
+//////////////////// Structures ////////////////////
+////////////////////////////////////////////////////
+
+// Position, orientation and size of an object, relative to its parent node.
+struct Transform
+{
+    glm::vec3 position;
+    glm::vec3 rotation;  // Euler angles in radians, applied in the X, Y then Z order.
+    glm::vec3 scale;
+};
+
+// Node of the object in the transform hierarchy.
+// The transform of the object is relative to the node parent.
+struct SceneNode
+{
+    uint32_t node;
+};
+
+// Movement of an object, per second.
+struct Velocity
+{
+    glm::vec3 linear;
+    glm::vec3 angular;  // Radians per second around each axis.
+};
+
+// Mesh drawn at the position of the object.
+struct MeshRenderer
+{
+    uint32_t mesh;    // Index of the mesh in the loaded meshes.
+    int32_t texture;  // Index of the texture in the loaded textures.
+};
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+glm::mat4 get_transform_matrix
+(
+    const Transform &transform
+);
+
+#endif
@@ -0,0 +1,42 @@
+#include "scene.entities.hpp"
+
+#include "../logs/logs.handler.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Return the registry of the component types.
+// Note: A function-local static avoids any dependency on the global initialization order.
+std::vector<ComponentInfo> &get_component_registry()
+{
+    static std::vector<ComponentInfo> registry;
+    return registry;
+}
+
+// Register a new component type and return its identifier.
+uint32_t register_component_type
+(
+    const size_t &size,
+    const size_t &alignment
+)
+{
+    std::vector<ComponentInfo> &registry = get_component_registry();
+
+    if (registry.size() >= MAX_COMPONENT_TYPES)
+    {
+        fatal_error_log("Component type registration failed! The maximum amount of component types (" + std::to_string(MAX_COMPONENT_TYPES) + ") is reached!");
+    }
+
+    registry.push_back({ size, alignment });
+    return static_cast<uint32_t>(registry.size() - 1);
+}
+
+// Return the size and alignment of a registered component type.
+const ComponentInfo &get_component_info
+(
+    const uint32_t &component
+)
+{
+    return get_component_registry()[component];
+}
@@ -0,0 +1,84 @@
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+#ifndef SCENE_ENTITIES_HPP
+#define SCENE_ENTITIES_HPP
+
+// Maximum amount of component types, each one takes a bit of the archetypes masks.
+constexpr const uint32_t MAX_COMPONENT_TYPES = 64;
+
+// Set of component types, one bit per component identifier.
+using ComponentMask = uint64_t;
+
+////////////////////////////////////////////////////
+//////////////////// Structures ////////////////////
+////////////////////////////////////////////////////
+
+// Handle of an entity.
+// The generation changes each time the index is reused, so handles of destroyed entities stay invalid.
+struct Entity
+{
+    uint32_t index;
+    uint32_t generation;
+
+    bool operator==(const Entity &other) const
+    {
+        return index == other.index && generation == other.generation;
+    }
+
+    bool operator!=(const Entity &other) const
+    {
+        return !(*this == other);
+    }
+};
+
+constexpr const Entity NULL_ENTITY { UINT32_MAX, 0 };
+
+struct ComponentInfo
+{
+    size_t size;
+    size_t alignment;
+};
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+std::vector<ComponentInfo> &get_component_registry();
+
+uint32_t register_component_type
+(
+    const size_t &size,
+    const size_t &alignment
+);
+
+const ComponentInfo &get_component_info
+(
+    const uint32_t &component
+);
+
+///////////////////////////////////////////////////
+//////////////////// Templates ////////////////////
+///////////////////////////////////////////////////
+
+// Return the identifier of a component type, registering it on first use.
+// Note: The components are moved in memory with memcpy, so they must be trivially copyable.
+template <typename Component>
+uint32_t get_component_id()
+{
+    static_assert(std::is_trivially_copyable<Component>::value, "The components must be trivially copyable!");
+
+    static const uint32_t identifier = register_component_type(sizeof(Component), alignof(Component));
+    return identifier;
+}
+
+// Return the mask bit of a component type.
+template <typename Component>
+ComponentMask get_component_bit()
+{
+    return ComponentMask(1) << get_component_id<Component>();
+}
+
+#endif
@@ -0,0 +1,453 @@
+#include "scene.hierarchy.hpp"
+
+#include "../config/engine.config.hpp"
+#include "../logs/logs.handler.hpp"
+
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#if defined(__AVX__)
+    #include <immintrin.h>
+#elif defined(__SSE__) || defined(_M_X64)
+    #include <xmmintrin.h>
+#endif
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+// Multiply a parent world matrix by a local matrix (column-major, like GLM).
+// Each output column is a combination of the parent columns, weighted by the elements of the local column.
+// Note: The output must not be the local matrix.
+void multiply_transform_matrices
+(
+    const glm::mat4 &parent,
+    const glm::mat4 &local,
+    glm::mat4 &output
+)
+{
+    const float* parent_data = &parent[0][0];
+    const float* local_data = &local[0][0];
+    float* output_data = &output[0][0];
+
+    #if defined(__AVX__)
+        // Each parent column is duplicated in both halves of a register, so two output columns are computed at once.
+        const __m256 column_0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(parent_data));
+        const __m256 column_1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(parent_data + 4));
+        const __m256 column_2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(parent_data + 8));
+        const __m256 column_3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(parent_data + 12));
+
+        for (int i = 0; i < 16; i += 8)
+        {
+            const __m256 columns = _mm256_loadu_ps(local_data + i);
+
+            __m256 result = _mm256_mul_ps(column_0, _mm256_permute_ps(columns, 0x00));
+            result = _mm256_add_ps(result, _mm256_mul_ps(column_1, _mm256_permute_ps(columns, 0x55)));
+            result = _mm256_add_ps(result, _mm256_mul_ps(column_2, _mm256_permute_ps(columns, 0xAA)));
+            result = _mm256_add_ps(result, _mm256_mul_ps(column_3, _mm256_permute_ps(columns, 0xFF)));
+
+            _mm256_storeu_ps(output_data + i, result);
+        }
+    #elif defined(__SSE__) || defined(_M_X64)
+        const __m128 column_0 = _mm_loadu_ps(parent_data);
+        const __m128 column_1 = _mm_loadu_ps(parent_data + 4);
+        const __m128 column_2 = _mm_loadu_ps(parent_data + 8);
+        const __m128 column_3 = _mm_loadu_ps(parent_data + 12);
+
+        for (int i = 0; i < 16; i += 4)
+        {
+            const __m128 column = _mm_loadu_ps(local_data + i);
+
+            __m128 result = _mm_mul_ps(column_0, _mm_shuffle_ps(column, column, 0x00));
+            result = _mm_add_ps(result, _mm_mul_ps(column_1, _mm_shuffle_ps(column, column, 0x55)));
+            result = _mm_add_ps(result, _mm_mul_ps(column_2, _mm_shuffle_ps(column, column, 0xAA)));
+            result = _mm_add_ps(result, _mm_mul_ps(column_3, _mm_shuffle_ps(column, column, 0xFF)));
+
+            _mm_storeu_ps(output_data + i, result);
+        }
+    #else
+        output = parent * local;
+    #endif
+}
+
+///////////////////////////////////////////////
+//////////////////// Class ////////////////////
+///////////////////////////////////////////////
+
+// Create an empty hierarchy, uploaded to one transform buffer per frame in flight.
+TransformHierarchy::TransformHierarchy
+(
+    const uint32_t &frames_count
+)
+{
+    if (frames_count < 1)
+    {
+        fatal_error_log("Transform hierarchy creation failed! The frames count provided (" + std::to_string(frames_count) + ") is not valid!");
+    }
+
+    frame_changes.resize(frames_count);
+    frame_flags.resize(frames_count);
+}
+
+// Destroy the hierarchy and every node in it.
+TransformHierarchy::~TransformHierarchy()
+{
+    slot_nodes.clear();
+    node_slots.clear();
+}
+
+// Create a node, the parent is NO_PARENT_NODE for a root node.
+// Output: NO_PARENT_NODE when the transform buffers are full, as the GPU couldn't read the matrix of the node.
+// Note: The node is placed in depth order at the next update.
+uint32_t TransformHierarchy::create_node
+(
+    const uint32_t &parent,
+    const glm::mat4 &local_transform
+)
+{
+    uint32_t parent_node = parent;
+
+    if (parent_node != NO_PARENT_NODE && !is_node_alive(parent_node))
+    {
+        error_log("The parent node #" + std::to_string(parent_node) + " doesn't exist! The node is created as a root node.");
+        parent_node = NO_PARENT_NODE;
+    }
+
+    uint32_t node = 0;
+
+    // Reuse the identifiers of the destroyed nodes first, to keep the transform buffers compact.
+    if (free_nodes.size() > 0)
+    {
+        node = free_nodes.back();
+        free_nodes.pop_back();
+    }
+    else if (node_slots.size() >= EngineConfig::MAX_SCENE_TRANSFORMS)
+    {
+        error_log("Failed to create a node! The transform buffers can't hold more than " + std::to_string(EngineConfig::MAX_SCENE_TRANSFORMS) + " nodes.");
+        return NO_PARENT_NODE;
+    }
+    else
+    {
+        node = static_cast<uint32_t>(node_slots.size());
+
+        node_slots.push_back(NO_PARENT_NODE);
+        node_parents.push_back(NO_PARENT_NODE);
+        dirty_flags.push_back(0);
+
+        for (std::vector<uint8_t> &flags : frame_flags)
+        {
+            flags.push_back(0);
+        }
+    }
+
+    // Append the node in a temporary slot until the nodes are sorted.
+    node_slots[node] = static_cast<uint32_t>(slot_nodes.size());
+    node_parents[node] = parent_node;
+
+    slot_nodes.push_back(node);
+    slot_parents.push_back(NO_PARENT_NODE);
+    slot_depths.push_back(0);
+    first_children.push_back(0);
+    children_counts.push_back(0);
+    local_transforms.push_back(local_transform);
+    world_transforms.push_back(local_transform);
+
+    needs_sorting = true;
+    mark_dirty(node);
+
+    return node;
+}
+
+// Destroy a node, its children are attached to its parent.
+void TransformHierarchy::destroy_node
+(
+    const uint32_t &node
+)
+{
+    if (!is_node_alive(node))
+    {
+        error_log("Failed to destroy the node #" + std::to_string(node) + "! It doesn't exist.");
+        return;
+    }
+
+    for (uint32_t child = 0; child < node_parents.size(); child++)
+    {
+        if (node_parents[child] == node && is_node_alive(child))
+        {
+            node_parents[child] = node_parents[node];
+            mark_dirty(child);
+        }
+    }
+
+    node_slots[node] = NO_PARENT_NODE;
+    node_parents[node] = NO_PARENT_NODE;
+    free_nodes.push_back(node);
+
+    needs_sorting = true;
+}
+
+bool TransformHierarchy::is_node_alive
+(
+    const uint32_t &node
+) const
+{
+    return node < node_slots.size() && node_slots[node] != NO_PARENT_NODE;
+}
+
+// Return the amount of matrices the transform buffers need to hold every node.
+uint32_t TransformHierarchy::get_nodes_capacity() const
+{
+    return static_cast<uint32_t>(node_slots.size());
+}
+
+// Change the transform of a node relative to its parent.
+void TransformHierarchy::set_local_transform
+(
+    const uint32_t &node,
+    const glm::mat4 &local_transform
+)
+{
+    if (!is_node_alive(node))
+    {
+        error_log("Failed to set the local transform of the node #" + std::to_string(node) + "! It doesn't exist.");
+        return;
+    }
+
+    local_transforms[node_slots[node]] = local_transform;
+    mark_dirty(node);
+}
+
+// Return the world transform of a node, as computed by the last update.
+const glm::mat4& TransformHierarchy::get_world_transform
+(
+    const uint32_t &node
+) const
+{
+    static const glm::mat4 identity(1.0f);
+
+    if (!is_node_alive(node))
+    {
+        error_log("Failed to get the world transform of the node #" + std::to_string(node) + "! It doesn't exist.");
+        return identity;
+    }
+
+    return world_transforms[node_slots[node]];
+}
+
+// Recompute the world transforms of the dirty nodes and of their subtrees.
+// The depth levels are processed in order, so the parents of a batch are always up to date.
+void TransformHierarchy::update_transforms()
+{
+    if (needs_sorting)
+    {
+        sort_nodes();
+    }
+
+    if (dirty_nodes.size() < 1)
+    {
+        return;
+    }
+
+    // The dirty flags stay set until their node is computed, so a dirty child of a dirty parent is only queued once.
+    for (const uint32_t &node : dirty_nodes)
+    {
+        if (!is_node_alive(node))
+        {
+            dirty_flags[node] = 0;
+            continue;
+        }
+
+        const uint32_t slot = node_slots[node];
+        level_batches[slot_depths[slot]].push_back(slot);
+    }
+
+    dirty_nodes.clear();
+
+    for (size_t depth = 0; depth < level_batches.size(); depth++)
+    {
+        std::vector<uint32_t> &batch = level_batches[depth];
+
+        if (batch.size() < 1)
+        {
+            continue;
+        }
+
+        compute_world_transforms(batch);
+
+        for (const uint32_t &slot : batch)
+        {
+            const uint32_t node = slot_nodes[slot];
+            dirty_flags[node] = 0;
+
+            for (size_t frame = 0; frame < frame_changes.size(); frame++)
+            {
+                if (frame_flags[frame][node] == 0)
+                {
+                    frame_flags[frame][node] = 1;
+                    frame_changes[frame].push_back(node);
+                }
+            }
+
+            for (uint32_t child = first_children[slot]; child < first_children[slot] + children_counts[slot]; child++)
+            {
+                if (dirty_flags[slot_nodes[child]] == 0)
+                {
+                    level_batches[depth + 1].push_back(child);
+                }
+            }
+        }
+
+        batch.clear();
+    }
+}
+
+// Return the nodes whose world transform changed since the transform buffer of a frame was last written.
+const std::vector<uint32_t>& TransformHierarchy::get_frame_changes
+(
+    const uint32_t &frame
+) const
+{
+    return frame_changes[frame % frame_changes.size()];
+}
+
+// Forget the changes of a frame once its transform buffer is written.
+void TransformHierarchy::clear_frame_changes
+(
+    const uint32_t &frame
+)
+{
+    const size_t index = frame % frame_changes.size();
+
+    for (const uint32_t &node : frame_changes[index])
+    {
+        frame_flags[index][node] = 0;
+    }
+
+    frame_changes[index].clear();
+}
+
+void TransformHierarchy::mark_dirty
+(
+    const uint32_t &node
+)
+{
+    if (dirty_flags[node] == 0)
+    {
+        dirty_flags[node] = 1;
+        dirty_nodes.push_back(node);
+    }
+}
+
+// Rebuild the slots in breadth-first order, after nodes were created or destroyed.
+void TransformHierarchy::sort_nodes()
+{
+    const size_t nodes_count = node_slots.size();
+
+    // Children of each node, in a compressed list.
+    std::vector<uint32_t> children_offsets(nodes_count + 1, 0);
+    std::vector<uint32_t> order;
+
+    for (uint32_t node = 0; node < nodes_count; node++)
+    {
+        if (!is_node_alive(node))
+        {
+            continue;
+        }
+
+        if (node_parents[node] == NO_PARENT_NODE || !is_node_alive(node_parents[node]))
+        {
+            node_parents[node] = NO_PARENT_NODE;
+            order.push_back(node); // The roots fill the first depth level.
+        }
+        else children_offsets[node_parents[node] + 1]++;
+    }
+
+    for (size_t i = 0; i < nodes_count; i++)
+    {
+        children_offsets[i + 1] += children_offsets[i];
+    }
+
+    std::vector<uint32_t> children(children_offsets[nodes_count]);
+    std::vector<uint32_t> children_filled(children_offsets.begin(), children_offsets.end() - 1);
+
+    for (uint32_t node = 0; node < nodes_count; node++)
+    {
+        if (is_node_alive(node) && node_parents[node] != NO_PARENT_NODE)
+        {
+            children[children_filled[node_parents[node]]++] = node;
+        }
+    }
+
+    const size_t roots_count = order.size();
+    std::vector<uint32_t> sorted_parents(roots_count, NO_PARENT_NODE);
+    std::vector<uint32_t> sorted_depths(roots_count, 0);
+    std::vector<uint32_t> sorted_first_children;
+    std::vector<uint32_t> sorted_children_counts;
+
+    // Breadth-first walk: appending the children of each slot keeps the levels sorted and the siblings contiguous.
+    for (size_t slot = 0; slot < order.size(); slot++)
+    {
+        const uint32_t node = order[slot];
+
+        sorted_first_children.push_back(static_cast<uint32_t>(order.size()));
+        sorted_children_counts.push_back(children_offsets[node + 1] - children_offsets[node]);
+
+        for (uint32_t i = children_offsets[node]; i < children_offsets[node + 1]; i++)
+        {
+            order.push_back(children[i]);
+            sorted_parents.push_back(static_cast<uint32_t>(slot));
+            sorted_depths.push_back(sorted_depths[slot] + 1);
+        }
+    }
+
+    std::vector<glm::mat4> sorted_local_transforms(order.size());
+    std::vector<glm::mat4> sorted_world_transforms(order.size());
+    uint32_t levels_count = 0;
+
+    for (size_t slot = 0; slot < order.size(); slot++)
+    {
+        const uint32_t previous_slot = node_slots[order[slot]];
+
+        sorted_local_transforms[slot] = local_transforms[previous_slot];
+        sorted_world_transforms[slot] = world_transforms[previous_slot];
+        levels_count = std::max(levels_count, sorted_depths[slot] + 1);
+    }
+
+    for (size_t slot = 0; slot < order.size(); slot++)
+    {
+        node_slots[order[slot]] = static_cast<uint32_t>(slot);
+    }
+
+    slot_nodes = std::move(order);
+    slot_parents = std::move(sorted_parents);
+    slot_depths = std::move(sorted_depths);
+    first_children = std::move(sorted_first_children);
+    children_counts = std::move(sorted_children_counts);
+    local_transforms = std::move(sorted_local_transforms);
+    world_transforms = std::move(sorted_world_transforms);
+
+    // One more level so that the deepest batch can queue its (nonexistent) children without checks.
+    level_batches.resize(levels_count + 1);
+    needs_sorting = false;
+}
+
+// Compute the world transforms of a batch of slots of the same depth level.
+void TransformHierarchy::compute_world_transforms
+(
+    const std::vector<uint32_t> &slots
+)
+{
+    for (const uint32_t &slot : slots)
+    {
+        const uint32_t parent = slot_parents[slot];
+
+        if (parent == NO_PARENT_NODE)
+        {
+            world_transforms[slot] = local_transforms[slot];
+        }
+        else multiply_transform_matrices(world_transforms[parent], local_transforms[slot], world_transforms[slot]);
+    }
+}
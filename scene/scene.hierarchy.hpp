@@ -0,0 +1,87 @@
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+#ifndef SCENE_HIERARCHY_HPP
+#define SCENE_HIERARCHY_HPP
+
+// Parent of the root nodes.
+constexpr const uint32_t NO_PARENT_NODE = UINT32_MAX;
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+void multiply_transform_matrices
+(
+    const glm::mat4 &parent,
+    const glm::mat4 &local,
+    glm::mat4 &output
+);
+
+///////////////////////////////////////////////
+//////////////////// Class ////////////////////
+///////////////////////////////////////////////
+
+// Parent/child hierarchy of the scene transforms.
+// - The nodes are stored in flat arrays sorted by depth (breadth-first), so the parents always come before their
+//   children and the children of a node are contiguous.
+// - Only the dirty nodes and their subtrees are recomputed, one depth level at a time, in SIMD batches.
+// - The nodes identifiers never change, they are the indices of the matrices in the GPU transform buffers.
+// - Each frame in flight keeps the list of the nodes it has to upload, so the static nodes cost nothing per frame.
+class TransformHierarchy
+{
+
+public:
+    // Constructor.
+    TransformHierarchy(const uint32_t &frames_count);
+
+    // Destructor.
+    ~TransformHierarchy();
+
+    uint32_t create_node(const uint32_t &parent, const glm::mat4 &local_transform);
+    void destroy_node(const uint32_t &node);
+    bool is_node_alive(const uint32_t &node) const;
+    uint32_t get_nodes_capacity() const;
+
+    void set_local_transform(const uint32_t &node, const glm::mat4 &local_transform);
+    const glm::mat4& get_world_transform(const uint32_t &node) const;
+
+    void update_transforms();
+    const std::vector<uint32_t>& get_frame_changes(const uint32_t &frame) const;
+    void clear_frame_changes(const uint32_t &frame);
+
+    // Prevent data duplication.
+    TransformHierarchy(const TransformHierarchy&) = delete;
+    TransformHierarchy& operator=(const TransformHierarchy&) = delete;
+
+private:
+    // We declare the members of the class to store.
+    // Arrays indexed by slot, in depth order.
+    std::vector<uint32_t> slot_nodes;          // Node stored in each slot.
+    std::vector<uint32_t> slot_parents;        // Slot of the parent, NO_PARENT_NODE for the roots.
+    std::vector<uint32_t> slot_depths;
+    std::vector<uint32_t> first_children;      // Slot of the first child, the children are contiguous.
+    std::vector<uint32_t> children_counts;
+    std::vector<glm::mat4> local_transforms;
+    std::vector<glm::mat4> world_transforms;
+
+    // Arrays indexed by node.
+    std::vector<uint32_t> node_slots;          // NO_PARENT_NODE for the destroyed nodes.
+    std::vector<uint32_t> node_parents;
+    std::vector<uint32_t> free_nodes;
+    std::vector<uint8_t> dirty_flags;
+    std::vector<uint32_t> dirty_nodes;
+
+    std::vector<std::vector<uint32_t>> level_batches;  // Slots to recompute at each depth, reused between updates.
+    std::vector<std::vector<uint32_t>> frame_changes;  // Nodes to upload for each frame in flight.
+    std::vector<std::vector<uint8_t>> frame_flags;
+    bool needs_sorting = false;
+
+    void mark_dirty(const uint32_t &node);
+    void sort_nodes();
+    void compute_world_transforms(const std::vector<uint32_t> &slots);
+
+};
+
+#endif
@@ -0,0 +1,55 @@
+#include "scene.systems.hpp"
+
+#include "scene.world.hpp"
+#include "scene.hierarchy.hpp"
+#include "scene.components.hpp"
+#include "../vulkan/vertex/models/models.geometry.hpp"
+
+#include <glm/glm.hpp>
+#include <vector>
+
+// Move and rotate the objects according to their velocity.
+// Only the moving objects update their node, the static ones are never recomputed.
+void update_movement_system
+(
+    EntityWorld &world,
+    TransformHierarchy &hierarchy,
+    const float &delta_time
+)
+{
+    world.for_each<Transform, Velocity, SceneNode>([&](const Entity &, Transform &transform, const Velocity &velocity, const SceneNode &scene_node)
+    {
+        transform.position += velocity.linear * delta_time;
+        transform.rotation += velocity.angular * delta_time;
+
+        // The node creation fails once the transform buffers are full.
+        if (!hierarchy.is_node_alive(scene_node.node))
+        {
+            return;
+        }
+
+        hierarchy.set_local_transform(scene_node.node, get_transform_matrix(transform));
+    });
+}
+
+// List the meshes to draw this frame with their world transform.
+void collect_render_objects
+(
+    EntityWorld &world,
+    const TransformHierarchy &hierarchy,
+    std::vector<RenderObject> &objects
+)
+{
+    objects.clear();
+
+    world.for_each<SceneNode, MeshRenderer>([&](const Entity &, const SceneNode &scene_node, const MeshRenderer &renderer)
+    {
+        // Without a node, the object has no matrix the GPU can read.
+        if (!hierarchy.is_node_alive(scene_node.node))
+        {
+            return;
+        }
+
+        objects.push_back({ renderer.mesh, renderer.texture, scene_node.node, hierarchy.get_world_transform(scene_node.node) });
+    });
+}
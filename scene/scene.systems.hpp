@@ -0,0 +1,28 @@
+#include "scene.world.hpp"
+#include "scene.hierarchy.hpp"
+#include "../vulkan/vertex/models/models.geometry.hpp"
+
+#include <vector>
+
+#ifndef SCENE_SYSTEMS_HPP
+#define SCENE_SYSTEMS_HPP
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+void update_movement_system
+(
+    EntityWorld &world,
+    TransformHierarchy &hierarchy,
+    const float &delta_time
+);
+
+void collect_render_objects
+(
+    EntityWorld &world,
+    const TransformHierarchy &hierarchy,
+    std::vector<RenderObject> &objects
+);
+
+#endif
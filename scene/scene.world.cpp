@@ -0,0 +1,344 @@
+#include "scene.world.hpp"
+
+#include "scene.entities.hpp"
+#include "../config/engine.config.hpp"
+#include "../logs/logs.handler.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Create an empty world, with the archetype of the entities without components.
+EntityWorld::EntityWorld()
+{
+    find_or_create_archetype(0);
+}
+
+// Destroy the world and every entity in it.
+EntityWorld::~EntityWorld()
+{
+    archetypes.clear();
+    records.clear();
+}
+
+// Create an entity without any component.
+// Note: During an iteration, the entity is only placed in the storage once the iteration ends.
+Entity EntityWorld::create_entity()
+{
+    uint32_t index = 0;
+
+    // Reuse the indices of the destroyed entities first.
+    if (free_indices.size() > 0)
+    {
+        index = free_indices.back();
+        free_indices.pop_back();
+    }
+    else
+    {
+        index = static_cast<uint32_t>(records.size());
+        records.push_back({ 0, PENDING_ARCHETYPE, 0, 0 });
+    }
+
+    const Entity entity { index, records[index].generation };
+    records[index].archetype = PENDING_ARCHETYPE;
+    entities_count++;
+
+    if (iteration_depth > 0)
+    {
+        deferred_commands.push_back([this, entity]() { place_entity(entity); });
+    }
+    else place_entity(entity);
+
+    return entity;
+}
+
+// Destroy an entity and its components.
+// Note: During an iteration, the destruction is applied once the iteration ends.
+void EntityWorld::destroy_entity
+(
+    const Entity &entity
+)
+{
+    if (iteration_depth > 0)
+    {
+        deferred_commands.push_back([this, entity]() { destroy_entity(entity); });
+        return;
+    }
+
+    if (!is_alive(entity))
+    {
+        error_log("Failed to destroy the entity #" + std::to_string(entity.index) + "! It doesn't exist anymore!");
+        return;
+    }
+
+    EntityRecord &record = records[entity.index];
+
+    if (record.archetype != PENDING_ARCHETYPE)
+    {
+        remove_row(record.archetype, record.chunk, record.row);
+    }
+
+    record.generation++; // Invalidate every handle of the entity.
+    record.archetype = PENDING_ARCHETYPE;
+    free_indices.push_back(entity.index);
+    entities_count--;
+}
+
+// Check if an entity handle still refers to an existing entity.
+bool EntityWorld::is_alive
+(
+    const Entity &entity
+) const
+{
+    // Destroying an entity bumps the generation of its index, so the old handles never match again.
+    return entity.index < records.size() && records[entity.index].generation == entity.generation;
+}
+
+size_t EntityWorld::get_entities_count() const
+{
+    return entities_count;
+}
+
+// Register a system, the systems run in their registration order.
+void EntityWorld::add_system
+(
+    const std::string &name,
+    const std::function<void(EntityWorld &, const float &)> &update
+)
+{
+    systems.push_back({ name, update });
+    log("System \"" + name + "\" added to the world!");
+}
+
+// Run every system once.
+void EntityWorld::run_systems
+(
+    const float &delta_time
+)
+{
+    for (const SceneSystem &system : systems)
+    {
+        system.update(*this, delta_time);
+    }
+
+    flush_deferred_commands();
+}
+
+// Return the archetype storing the given set of components, creating it if needed.
+uint32_t EntityWorld::find_or_create_archetype
+(
+    const ComponentMask &mask
+)
+{
+    const auto found = archetype_indices.find(mask);
+
+    if (found != archetype_indices.end())
+    {
+        return found->second;
+    }
+
+    Archetype archetype {};
+    archetype.mask = mask;
+    std::fill(std::begin(archetype.columns), std::end(archetype.columns), -1);
+
+    size_t entity_size = 0;
+
+    for (uint32_t i = 0; i < MAX_COMPONENT_TYPES; i++)
+    {
+        if ((mask & (ComponentMask(1) << i)) != 0)
+        {
+            archetype.columns[i] = static_cast<int32_t>(archetype.components.size());
+            archetype.components.push_back(i);
+            entity_size += get_component_info(i).size;
+        }
+    }
+
+    // Fill the chunk size with as many entities as possible, then lay the columns one after the other.
+    const size_t chunk_size = EngineConfig::ECS_CHUNK_SIZE;
+    archetype.chunk_capacity = static_cast<uint32_t>(std::max<size_t>(1, entity_size > 0 ? chunk_size / entity_size : chunk_size));
+
+    size_t offset = 0;
+
+    for (const uint32_t &component : archetype.components)
+    {
+        const ComponentInfo &info = get_component_info(component);
+
+        offset = (offset + info.alignment - 1) / info.alignment * info.alignment;
+        archetype.column_offsets.push_back(offset);
+        offset += info.size * archetype.chunk_capacity;
+    }
+
+    // The alignment padding can overflow the chunk size, remove entities until the columns fit.
+    while (archetype.chunk_capacity > 1 && offset > chunk_size)
+    {
+        archetype.chunk_capacity--;
+        archetype.column_offsets.clear();
+        offset = 0;
+
+        for (const uint32_t &component : archetype.components)
+        {
+            const ComponentInfo &info = get_component_info(component);
+
+            offset = (offset + info.alignment - 1) / info.alignment * info.alignment;
+            archetype.column_offsets.push_back(offset);
+            offset += info.size * archetype.chunk_capacity;
+        }
+    }
+
+    archetypes.push_back(std::move(archetype));
+    archetype_indices[mask] = static_cast<uint32_t>(archetypes.size() - 1);
+
+    return static_cast<uint32_t>(archetypes.size() - 1);
+}
+
+// Place a newly created entity in the archetype without components.
+void EntityWorld::place_entity
+(
+    const Entity &entity
+)
+{
+    if (!is_alive(entity) || records[entity.index].archetype != PENDING_ARCHETYPE)
+    {
+        return; // Destroyed before the end of the iteration.
+    }
+
+    EntityRecord &record = records[entity.index];
+    allocate_row(0, entity, record.chunk, record.row);
+    record.archetype = 0;
+}
+
+// Add a row at the end of an archetype, allocating a new chunk if the last one is full.
+void EntityWorld::allocate_row
+(
+    const uint32_t &archetype_index,
+    const Entity &entity,
+    uint32_t &chunk_index,
+    uint32_t &row
+)
+{
+    Archetype &archetype = archetypes[archetype_index];
+
+    if (archetype.chunks.size() < 1 || archetype.chunks.back().entities.size() >= archetype.chunk_capacity)
+    {
+        constexpr size_t cache_line = 64;
+
+        ArchetypeChunk chunk {};
+        chunk.storage = std::make_unique<uint8_t[]>(EngineConfig::ECS_CHUNK_SIZE + cache_line);
+        chunk.data = chunk.storage.get() + (cache_line - reinterpret_cast<uintptr_t>(chunk.storage.get()) % cache_line) % cache_line;
+        chunk.entities.reserve(archetype.chunk_capacity);
+
+        archetype.chunks.push_back(std::move(chunk));
+    }
+
+    chunk_index = static_cast<uint32_t>(archetype.chunks.size() - 1);
+    row = static_cast<uint32_t>(archetype.chunks.back().entities.size());
+    archetype.chunks.back().entities.push_back(entity);
+}
+
+// Remove a row from an archetype by moving its last row into it, so that the chunks stay packed.
+void EntityWorld::remove_row
+(
+    const uint32_t &archetype_index,
+    const uint32_t &chunk_index,
+    const uint32_t &row
+)
+{
+    Archetype &archetype = archetypes[archetype_index];
+    ArchetypeChunk &last_chunk = archetype.chunks.back();
+
+    const uint32_t last_chunk_index = static_cast<uint32_t>(archetype.chunks.size() - 1);
+    const uint32_t last_row = static_cast<uint32_t>(last_chunk.entities.size() - 1);
+
+    if (chunk_index != last_chunk_index || row != last_row)
+    {
+        ArchetypeChunk &chunk = archetype.chunks[chunk_index];
+
+        for (size_t i = 0; i < archetype.components.size(); i++)
+        {
+            const size_t size = get_component_info(archetype.components[i]).size;
+            memcpy(chunk.data + archetype.column_offsets[i] + row * size, last_chunk.data + archetype.column_offsets[i] + last_row * size, size);
+        }
+
+        const Entity moved = last_chunk.entities[last_row];
+        chunk.entities[row] = moved;
+        records[moved.index].chunk = chunk_index;
+        records[moved.index].row = row;
+    }
+
+    last_chunk.entities.pop_back();
+
+    if (last_chunk.entities.size() < 1)
+    {
+        archetype.chunks.pop_back();
+    }
+}
+
+// Move an entity to the archetype of a new set of components, keeping the components both archetypes share.
+void EntityWorld::move_entity
+(
+    const Entity &entity,
+    const ComponentMask &mask
+)
+{
+    const uint32_t target_index = find_or_create_archetype(mask); // Can reallocate the archetypes.
+    EntityRecord &record = records[entity.index];
+
+    uint32_t chunk_index = 0;
+    uint32_t row = 0;
+    allocate_row(target_index, entity, chunk_index, row);
+
+    const Archetype &source = archetypes[record.archetype];
+    const Archetype &target = archetypes[target_index];
+
+    for (size_t i = 0; i < target.components.size(); i++)
+    {
+        const uint32_t component = target.components[i];
+        const size_t size = get_component_info(component).size;
+        uint8_t* destination = target.chunks[chunk_index].data + target.column_offsets[i] + row * size;
+
+        if (source.columns[component] >= 0)
+        {
+            memcpy(destination, source.chunks[record.chunk].data + source.column_offsets[source.columns[component]] + record.row * size, size);
+        }
+        else memset(destination, 0, size);
+    }
+
+    remove_row(record.archetype, record.chunk, record.row);
+
+    record.archetype = target_index;
+    record.chunk = chunk_index;
+    record.row = row;
+}
+
+// Return the address of a component of an entity.
+uint8_t* EntityWorld::get_component_data
+(
+    const EntityRecord &record,
+    const uint32_t &component
+)
+{
+    const Archetype &archetype = archetypes[record.archetype];
+    const int32_t column = archetype.columns[component];
+    const size_t size = get_component_info(component).size;
+
+    return archetype.chunks[record.chunk].data + archetype.column_offsets[column] + record.row * size;
+}
+
+// Apply the structural changes requested during the iterations.
+void EntityWorld::flush_deferred_commands()
+{
+    while (deferred_commands.size() > 0)
+    {
+        std::vector<std::function<void()>> commands;
+        commands.swap(deferred_commands);
+
+        for (const std::function<void()> &command : commands)
+        {
+            command();
+        }
+    }
+}
@@ -0,0 +1,256 @@
+#include "scene.entities.hpp"
+#include "../logs/logs.handler.hpp"
+
+#include <unordered_map>
+#include <functional>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+#include <tuple>
+
+#ifndef SCENE_WORLD_HPP
+#define SCENE_WORLD_HPP
+
+class EntityWorld;
+
+////////////////////////////////////////////////////
+//////////////////// Structures ////////////////////
+////////////////////////////////////////////////////
+
+// Fixed size block of entities sharing the same archetype.
+// The components are stored as structure of arrays: one contiguous column per component type.
+struct ArchetypeChunk
+{
+    std::unique_ptr<uint8_t[]> storage;
+    uint8_t* data;                  // Start of the columns, aligned on a cache line.
+    std::vector<Entity> entities;   // Entity of each row.
+};
+
+// Storage of every entity having exactly the same set of components.
+struct Archetype
+{
+    ComponentMask mask;
+    std::vector<uint32_t> components;              // Component identifiers, in increasing order.
+    std::vector<size_t> column_offsets;            // Byte offset of each component column inside a chunk.
+    int32_t columns[MAX_COMPONENT_TYPES];          // Column of each component identifier, -1 when absent.
+    uint32_t chunk_capacity;                       // Amount of entities per chunk.
+    std::vector<ArchetypeChunk> chunks;            // Only the last chunk can be partially filled.
+};
+
+// Location of an entity inside the archetypes storage.
+struct EntityRecord
+{
+    uint32_t generation;
+    uint32_t archetype;  // PENDING_ARCHETYPE until a deferred creation is applied.
+    uint32_t chunk;
+    uint32_t row;
+};
+
+// Update function run once per frame over the world.
+struct SceneSystem
+{
+    std::string name;
+    std::function<void(EntityWorld &, const float &)> update;
+};
+
+///////////////////////////////////////////////
+//////////////////// Class ////////////////////
+///////////////////////////////////////////////
+
+// Entity-component system storing the entities by archetype, in chunks of structure of arrays.
+// - The entities are generational handles, creating and destroying them is O(1).
+// - Iterating over a set of components walks contiguous arrays, chunk by chunk.
+// - During an iteration, the structural changes (creations, destructions, added or removed components)
+//   are deferred and applied once the outermost iteration ends, so the iterated arrays never move.
+class EntityWorld
+{
+
+public:
+    // Constructor.
+    EntityWorld();
+
+    // Destructor.
+    ~EntityWorld();
+
+    Entity create_entity();
+    void destroy_entity(const Entity &entity);
+    bool is_alive(const Entity &entity) const;
+    size_t get_entities_count() const;
+
+    void add_system(const std::string &name, const std::function<void(EntityWorld &, const float &)> &update);
+    void run_systems(const float &delta_time);
+
+    template <typename Component>
+    void add_component(const Entity &entity, const Component &value);
+
+    template <typename Component>
+    void remove_component(const Entity &entity);
+
+    template <typename Component>
+    Component* get_component(const Entity &entity);
+
+    template <typename Component>
+    bool has_component(const Entity &entity) const;
+
+    template <typename... Components, typename Function>
+    void for_each(Function &&function);
+
+    // Prevent data duplication.
+    EntityWorld(const EntityWorld&) = delete;
+    EntityWorld& operator=(const EntityWorld&) = delete;
+
+private:
+    // We declare the members of the class to store.
+    std::vector<Archetype> archetypes;
+    std::unordered_map<ComponentMask, uint32_t> archetype_indices;
+    std::vector<EntityRecord> records;
+    std::vector<uint32_t> free_indices;
+    std::vector<SceneSystem> systems;
+    std::vector<std::function<void()>> deferred_commands;
+    size_t entities_count = 0;
+    int iteration_depth = 0;
+
+    uint32_t find_or_create_archetype(const ComponentMask &mask);
+    void place_entity(const Entity &entity);
+    void allocate_row(const uint32_t &archetype_index, const Entity &entity, uint32_t &chunk_index, uint32_t &row);
+    void remove_row(const uint32_t &archetype_index, const uint32_t &chunk_index, const uint32_t &row);
+    void move_entity(const Entity &entity, const ComponentMask &mask);
+    uint8_t* get_component_data(const EntityRecord &record, const uint32_t &component);
+    void flush_deferred_commands();
+
+};
+
+// Archetype of the entities created during an iteration, until they are placed in the storage.
+constexpr const uint32_t PENDING_ARCHETYPE = UINT32_MAX;
+
+///////////////////////////////////////////////////
+//////////////////// Templates ////////////////////
+///////////////////////////////////////////////////
+
+// Add a component to an entity, or overwrite it if the entity already has one.
+template <typename Component>
+void EntityWorld::add_component(const Entity &entity, const Component &value)
+{
+    if (iteration_depth > 0)
+    {
+        deferred_commands.push_back([this, entity, value]() { add_component<Component>(entity, value); });
+        return;
+    }
+
+    if (!is_alive(entity))
+    {
+        error_log("Failed to add a component! The entity #" + std::to_string(entity.index) + " doesn't exist anymore!");
+        return;
+    }
+
+    const uint32_t component = get_component_id<Component>();
+    const EntityRecord &record = records[entity.index];
+
+    if ((archetypes[record.archetype].mask & get_component_bit<Component>()) == 0)
+    {
+        move_entity(entity, archetypes[record.archetype].mask | get_component_bit<Component>());
+    }
+
+    memcpy(get_component_data(records[entity.index], component), &value, sizeof(Component));
+}
+
+// Remove a component from an entity.
+template <typename Component>
+void EntityWorld::remove_component(const Entity &entity)
+{
+    if (iteration_depth > 0)
+    {
+        deferred_commands.push_back([this, entity]() { remove_component<Component>(entity); });
+        return;
+    }
+
+    if (!is_alive(entity))
+    {
+        error_log("Failed to remove a component! The entity #" + std::to_string(entity.index) + " doesn't exist anymore!");
+        return;
+    }
+
+    const EntityRecord &record = records[entity.index];
+
+    if ((archetypes[record.archetype].mask & get_component_bit<Component>()) != 0)
+    {
+        move_entity(entity, archetypes[record.archetype].mask & ~get_component_bit<Component>());
+    }
+}
+
+// Return a component of an entity, or nullptr if the entity doesn't have it.
+// Note: The pointer is only valid until the next structural change of the world.
+template <typename Component>
+Component* EntityWorld::get_component(const Entity &entity)
+{
+    if (!is_alive(entity) || records[entity.index].archetype == PENDING_ARCHETYPE)
+    {
+        return nullptr;
+    }
+
+    const EntityRecord &record = records[entity.index];
+
+    if ((archetypes[record.archetype].mask & get_component_bit<Component>()) == 0)
+    {
+        return nullptr;
+    }
+
+    return reinterpret_cast<Component*>(get_component_data(record, get_component_id<Component>()));
+}
+
+// Check if an entity has a component.
+template <typename Component>
+bool EntityWorld::has_component(const Entity &entity) const
+{
+    if (!is_alive(entity) || records[entity.index].archetype == PENDING_ARCHETYPE)
+    {
+        return false;
+    }
+
+    return (archetypes[records[entity.index].archetype].mask & get_component_bit<Component>()) != 0;
+}
+
+// Call a function for each entity having all the given components.
+// The function receives the entity and a reference to each component: function(entity, components...).
+template <typename... Components, typename Function>
+void EntityWorld::for_each(Function &&function)
+{
+    const ComponentMask required = (ComponentMask(0) | ... | get_component_bit<Components>());
+    iteration_depth++;
+
+    for (Archetype &archetype : archetypes)
+    {
+        if ((archetype.mask & required) != required)
+        {
+            continue;
+        }
+
+        for (ArchetypeChunk &chunk : archetype.chunks)
+        {
+            const size_t count = chunk.entities.size();
+            const Entity* entities = chunk.entities.data();
+
+            // Resolve the columns once per chunk, the inner loop only walks arrays.
+            const auto columns = std::make_tuple(reinterpret_cast<Components*>(chunk.data + archetype.column_offsets[archetype.columns[get_component_id<Components>()]])...);
+
+            std::apply([&](Components*... column)
+            {
+                for (size_t i = 0; i < count; i++)
+                {
+                    function(entities[i], column[i]...);
+                }
+            }, columns);
+        }
+    }
+
+    iteration_depth--;
+
+    if (iteration_depth == 0)
+    {
+        flush_deferred_commands();
+    }
+}
+
+#endif
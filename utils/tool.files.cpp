@@ -6,6 +6,7 @@
 #include <fstream>
 #include <filesystem>
 #include <string>
+#include <system_error>
 #include <vector>
 
 // Return the content of a binary file.
@@ -175,3 +176,57 @@ bool write_file
     file.close(); // Free the file.
     return true;
 }
+
+// Write binary data into a file, replacing it at once.
+// Note: The data is written into a temporary file which is then renamed over the file, so a crash never leaves a partial file.
+bool write_binary_file_atomically
+(
+    const std::string &file_path,
+    const std::vector<char> &data
+)
+{
+    if (trim(file_path).size() < 1)
+    {
+        error_log("Binary file writing failed! The path provided (\"" + file_path + "\") is not valid!");
+        return false;
+    }
+
+    const bool has_filename = std::filesystem::path(file_path).has_filename();
+
+    if (!has_filename)
+    {
+        error_log("Binary file writing failed! The path provided (\"" + file_path + "\") doesn't contain any file name!");
+        return false;
+    }
+
+    const std::string temporary_path = file_path + ".tmp";
+    std::error_code file_error;
+    std::ofstream file (temporary_path, std::ios::binary | std::ios::trunc);
+
+    if (!file.is_open())
+    {
+        error_log("Failed to open the \"" + temporary_path + "\" file!");
+        return false;
+    }
+
+    file.write(data.data(), static_cast<std::streamsize>(data.size()));
+    file.close(); // Flush the data before the renaming.
+
+    if (!file)
+    {
+        error_log("Failed to write data into the \"" + temporary_path + "\" file!");
+        std::filesystem::remove(temporary_path, file_error);
+        return false;
+    }
+
+    std::filesystem::rename(temporary_path, file_path, file_error); // Replace the previous file, if any.
+
+    if (file_error)
+    {
+        error_log("Failed to replace the \"" + file_path + "\" file: " + file_error.message() + ".");
+        std::filesystem::remove(temporary_path, file_error);
+        return false;
+    }
+
+    return true;
+}
@@ -21,4 +21,10 @@ bool write_file
     const bool &append
 );
 
+bool write_binary_file_atomically
+(
+    const std::string &file_path,
+    const std::vector<char> &data
+);
+
 #endif
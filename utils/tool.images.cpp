@@ -0,0 +1,177 @@
+#include "tool.images.hpp"
+
+#include "../config/engine.config.hpp"
+#include "../logs/logs.handler.hpp"
+
+#include <stb/stb_image.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Write 8 bits RGB pixels into a binary PPM file, readable without any library.
+bool write_ppm_image
+(
+    const std::string &file_path,
+    const int &width,
+    const int &height,
+    const std::vector<uint8_t> &pixels
+)
+{
+    if (width < 1 || height < 1 || pixels.size() != static_cast<size_t>(width) * height * 3)
+    {
+        error_log("PPM image writing failed! The pixels provided don't match the size of the image (" + std::to_string(width) + "x" + std::to_string(height) + ").");
+        return false;
+    }
+
+    std::ofstream file (file_path, std::ios::binary | std::ios::trunc);
+
+    if (!file.is_open())
+    {
+        error_log("Failed to open the following PPM image for writing: \"" + file_path + "\"!");
+        return false;
+    }
+
+    file << "P6\n" << width << " " << height << "\n255\n";
+    file.write(reinterpret_cast<const char*>(pixels.data()), pixels.size());
+
+    if (!file.good())
+    {
+        error_log("Failed to write the following PPM image: \"" + file_path + "\"!");
+        return false;
+    }
+
+    log("PPM image \"" + file_path + "\" (" + std::to_string(width) + "x" + std::to_string(height) + ") written successfully!");
+    return true;
+}
+
+// Load the 8 bits RGB pixels of a PNG or PPM image, empty when it can't be read.
+std::vector<uint8_t> load_rgb_image
+(
+    const std::string &file_path,
+    int &width,
+    int &height
+)
+{
+    int channels = 0;
+    stbi_uc* pixels = stbi_load(file_path.c_str(), &width, &height, &channels, STBI_rgb);
+
+    if (pixels == nullptr)
+    {
+        error_log("Failed to load the following image: \"" + file_path + "\"! " + std::string(stbi_failure_reason()));
+        return {};
+    }
+
+    const std::vector<uint8_t> output(pixels, pixels + static_cast<size_t>(width) * height * 3);
+    stbi_image_free(pixels);
+
+    return output;
+}
+
+// Compare two RGB images of the same size, and draw the pixels differing by more than the tolerance in red over the dimmed reference.
+ImageDifference compare_rgb_images
+(
+    const std::vector<uint8_t> &image,
+    const std::vector<uint8_t> &reference,
+    const uint32_t &tolerance,
+    std::vector<uint8_t> &difference_pixels
+)
+{
+    ImageDifference difference {};
+    difference_pixels.assign(reference.size(), 0);
+
+    if (image.size() != reference.size() || reference.size() < 3)
+    {
+        error_log("Failed to compare the images! Their sizes are different: " + std::to_string(image.size()) + " != " + std::to_string(reference.size()) + ".");
+        return difference;
+    }
+
+    uint64_t difference_sum = 0;
+
+    for (size_t i = 0; i < reference.size(); i += 3)
+    {
+        uint32_t pixel_difference = 0;
+
+        for (size_t channel = i; channel < i + 3; channel++)
+        {
+            const uint32_t channel_difference = static_cast<uint32_t>(std::abs(static_cast<int>(image[channel]) - static_cast<int>(reference[channel])));
+
+            pixel_difference = std::max(pixel_difference, channel_difference);
+            difference_sum += channel_difference;
+        }
+
+        difference.max_difference = std::max(difference.max_difference, pixel_difference);
+
+        if (pixel_difference > tolerance)
+        {
+            difference.differing_pixels++;
+            difference_pixels[i] = 255;
+            continue;
+        }
+
+        const uint8_t dimmed = static_cast<uint8_t>((reference[i] + reference[i + 1] + reference[i + 2]) / 12);
+        difference_pixels[i] = dimmed;
+        difference_pixels[i + 1] = dimmed;
+        difference_pixels[i + 2] = dimmed;
+    }
+
+    difference.average_difference = static_cast<double>(difference_sum) / static_cast<double>(reference.size());
+    return difference;
+}
+
+// Compare a rendered image with its golden image, the reference known to be right.
+// A few pixels may differ by more than the tolerance, as the rasterization slightly differs between the drivers.
+// When they differ, the differing pixels are drawn into a "<image>.diff.ppm" image.
+bool compare_with_golden_image
+(
+    const std::string &image_path,
+    const std::string &golden_path
+)
+{
+    log("Comparing \"" + image_path + "\" with the golden image \"" + golden_path + "\"..");
+
+    if (!std::filesystem::exists(golden_path))
+    {
+        error_log("Golden image test failed! The golden image \"" + golden_path + "\" doesn't exist, record it with the \"record_golden_image\" build target.");
+        return false;
+    }
+
+    int width = 0, height = 0, golden_width = 0, golden_height = 0;
+    const std::vector<uint8_t> image = load_rgb_image(image_path, width, height);
+    const std::vector<uint8_t> golden = load_rgb_image(golden_path, golden_width, golden_height);
+
+    if (image.empty() || golden.empty())
+    {
+        error_log("Golden image test failed! The images couldn't be loaded.");
+        return false;
+    }
+
+    if (width != golden_width || height != golden_height)
+    {
+        error_log("Golden image test failed! The image size (" + std::to_string(width) + "x" + std::to_string(height) + ") doesn't match the golden one (" + std::to_string(golden_width) + "x" + std::to_string(golden_height) + ").");
+        return false;
+    }
+
+    std::vector<uint8_t> difference_pixels;
+    const ImageDifference difference = compare_rgb_images(image, golden, EngineConfig::GOLDEN_IMAGE_TOLERANCE, difference_pixels);
+
+    const uint64_t pixels_count = static_cast<uint64_t>(width) * height;
+    const uint64_t allowed_pixels = static_cast<uint64_t>(static_cast<double>(pixels_count) * EngineConfig::GOLDEN_IMAGE_MAX_DIFFERING_RATIO);
+
+    log("Golden image difference: " + std::to_string(difference.differing_pixels) + "/" + std::to_string(pixels_count) + " differing pixels ("
+        + std::to_string(allowed_pixels) + " allowed), " + std::to_string(difference.max_difference) + " max difference, "
+        + std::to_string(difference.average_difference) + " average difference.");
+
+    if (difference.differing_pixels > allowed_pixels)
+    {
+        error_log("Golden image test failed! The image differs from the golden one.");
+        write_ppm_image(image_path + ".diff.ppm", width, height, difference_pixels);
+        return false;
+    }
+
+    log("Golden image test passed!");
+    return true;
+}
@@ -0,0 +1,53 @@
+#include <cstdint>
+#include <vector>
+#include <string>
+
+#ifndef HELPER_IMAGES_HPP
+#define HELPER_IMAGES_HPP
+
+////////////////////////////////////////////////////
+//////////////////// Structures ////////////////////
+////////////////////////////////////////////////////
+
+// Difference between two images of the same size, the channels being compared one by one.
+struct ImageDifference
+{
+    uint64_t differing_pixels; // Pixels with a channel differing by more than the tolerance.
+    uint32_t max_difference;   // Largest difference of a channel, from 0 to 255.
+    double average_difference; // Average difference of the channels.
+};
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+bool write_ppm_image
+(
+    const std::string &file_path,
+    const int &width,
+    const int &height,
+    const std::vector<uint8_t> &pixels
+);
+
+std::vector<uint8_t> load_rgb_image
+(
+    const std::string &file_path,
+    int &width,
+    int &height
+);
+
+ImageDifference compare_rgb_images
+(
+    const std::vector<uint8_t> &image,
+    const std::vector<uint8_t> &reference,
+    const uint32_t &tolerance,
+    std::vector<uint8_t> &difference_pixels
+);
+
+bool compare_with_golden_image
+(
+    const std::string &image_path,
+    const std::string &golden_path
+);
+
+#endif
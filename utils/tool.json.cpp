@@ -0,0 +1,438 @@
+#include "tool.json.hpp"
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+// Skip the spaces, tabulations and line breaks.
+void skip_json_whitespaces
+(
+    const char* data,
+    const size_t &size,
+    size_t &position
+)
+{
+    while (position < size && (data[position] == ' ' || data[position] == '\t' || data[position] == '\n' || data[position] == '\r'))
+    {
+        position++;
+    }
+}
+
+// Append a unicode code point to a string in UTF-8.
+void append_utf8
+(
+    std::string &output,
+    const uint32_t &code_point
+)
+{
+    if (code_point < 0x80)
+    {
+        output += static_cast<char>(code_point);
+    }
+    else if (code_point < 0x800)
+    {
+        output += static_cast<char>(0xC0 | (code_point >> 6));
+        output += static_cast<char>(0x80 | (code_point & 0x3F));
+    }
+    else if (code_point < 0x10000)
+    {
+        output += static_cast<char>(0xE0 | (code_point >> 12));
+        output += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+        output += static_cast<char>(0x80 | (code_point & 0x3F));
+    }
+    else
+    {
+        output += static_cast<char>(0xF0 | (code_point >> 18));
+        output += static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+        output += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+        output += static_cast<char>(0x80 | (code_point & 0x3F));
+    }
+}
+
+// Read the 4 hexadecimal digits of a \u escape sequence.
+bool parse_json_hexadecimal
+(
+    const char* data,
+    const size_t &size,
+    size_t &position,
+    uint32_t &output
+)
+{
+    if (position + 4 > size)
+    {
+        return false;
+    }
+
+    output = 0;
+
+    for (int i = 0; i < 4; i++)
+    {
+        const char character = data[position++];
+        output <<= 4;
+
+        if (character >= '0' && character <= '9') output |= character - '0';
+        else if (character >= 'a' && character <= 'f') output |= character - 'a' + 10;
+        else if (character >= 'A' && character <= 'F') output |= character - 'A' + 10;
+        else return false;
+    }
+
+    return true;
+}
+
+// Parse a JSON string, the position must be on its opening quote.
+bool parse_json_string
+(
+    const char* data,
+    const size_t &size,
+    size_t &position,
+    std::string &output,
+    std::string &error
+)
+{
+    position++; // Skip the opening quote.
+    output.clear();
+
+    while (position < size)
+    {
+        const char character = data[position++];
+
+        if (character == '"')
+        {
+            return true;
+        }
+
+        if (character != '\\')
+        {
+            output += character;
+            continue;
+        }
+
+        if (position >= size)
+        {
+            break;
+        }
+
+        const char escaped = data[position++];
+
+        switch (escaped)
+        {
+            case '"': output += '"'; break;
+            case '\\': output += '\\'; break;
+            case '/': output += '/'; break;
+            case 'b': output += '\b'; break;
+            case 'f': output += '\f'; break;
+            case 'n': output += '\n'; break;
+            case 'r': output += '\r'; break;
+            case 't': output += '\t'; break;
+            case 'u':
+            {
+                uint32_t code_point = 0;
+
+                if (!parse_json_hexadecimal(data, size, position, code_point))
+                {
+                    error = "invalid unicode escape sequence at byte " + std::to_string(position);
+                    return false;
+                }
+
+                // Combine the UTF-16 surrogate pairs.
+                if (code_point >= 0xD800 && code_point <= 0xDBFF && position + 6 <= size && data[position] == '\\' && data[position + 1] == 'u')
+                {
+                    position += 2;
+                    uint32_t low_surrogate = 0;
+
+                    if (!parse_json_hexadecimal(data, size, position, low_surrogate))
+                    {
+                        error = "invalid unicode escape sequence at byte " + std::to_string(position);
+                        return false;
+                    }
+
+                    code_point = 0x10000 + ((code_point - 0xD800) << 10) + (low_surrogate - 0xDC00);
+                }
+
+                append_utf8(output, code_point);
+                break;
+            }
+            default:
+                error = "invalid escape sequence at byte " + std::to_string(position);
+                return false;
+        }
+    }
+
+    error = "unterminated string";
+    return false;
+}
+
+// Parse any JSON value starting at the current position.
+// Note: The depth is limited to protect the stack against malicious files.
+bool parse_json_value
+(
+    const char* data,
+    const size_t &size,
+    size_t &position,
+    const int &depth,
+    JsonValue &output,
+    std::string &error
+)
+{
+    if (depth > 512)
+    {
+        error = "the document is nested too deeply";
+        return false;
+    }
+
+    skip_json_whitespaces(data, size, position);
+
+    if (position >= size)
+    {
+        error = "unexpected end of the document";
+        return false;
+    }
+
+    const char character = data[position];
+
+    if (character == '{')
+    {
+        output.type = JsonType::Object;
+        position++;
+        skip_json_whitespaces(data, size, position);
+
+        if (position < size && data[position] == '}')
+        {
+            position++;
+            return true;
+        }
+
+        while (position < size)
+        {
+            skip_json_whitespaces(data, size, position);
+
+            if (position >= size || data[position] != '"')
+            {
+                error = "expected a member name at byte " + std::to_string(position);
+                return false;
+            }
+
+            std::pair<std::string, JsonValue> member;
+
+            if (!parse_json_string(data, size, position, member.first, error))
+            {
+                return false;
+            }
+
+            skip_json_whitespaces(data, size, position);
+
+            if (position >= size || data[position] != ':')
+            {
+                error = "expected ':' at byte " + std::to_string(position);
+                return false;
+            }
+
+            position++;
+
+            if (!parse_json_value(data, size, position, depth + 1, member.second, error))
+            {
+                return false;
+            }
+
+            output.object.push_back(std::move(member));
+            skip_json_whitespaces(data, size, position);
+
+            if (position < size && data[position] == ',')
+            {
+                position++;
+                continue;
+            }
+
+            if (position < size && data[position] == '}')
+            {
+                position++;
+                return true;
+            }
+
+            error = "expected ',' or '}' at byte " + std::to_string(position);
+            return false;
+        }
+
+        error = "unterminated object";
+        return false;
+    }
+
+    if (character == '[')
+    {
+        output.type = JsonType::Array;
+        position++;
+        skip_json_whitespaces(data, size, position);
+
+        if (position < size && data[position] == ']')
+        {
+            position++;
+            return true;
+        }
+
+        while (position < size)
+        {
+            output.array.emplace_back();
+
+            if (!parse_json_value(data, size, position, depth + 1, output.array.back(), error))
+            {
+                return false;
+            }
+
+            skip_json_whitespaces(data, size, position);
+
+            if (position < size && data[position] == ',')
+            {
+                position++;
+                continue;
+            }
+
+            if (position < size && data[position] == ']')
+            {
+                position++;
+                return true;
+            }
+
+            error = "expected ',' or ']' at byte " + std::to_string(position);
+            return false;
+        }
+
+        error = "unterminated array";
+        return false;
+    }
+
+    if (character == '"')
+    {
+        output.type = JsonType::String;
+        return parse_json_string(data, size, position, output.string, error);
+    }
+
+    if (size - position >= 4 && strncmp(data + position, "true", 4) == 0)
+    {
+        output.type = JsonType::Boolean;
+        output.boolean = true;
+        position += 4;
+        return true;
+    }
+
+    if (size - position >= 5 && strncmp(data + position, "false", 5) == 0)
+    {
+        output.type = JsonType::Boolean;
+        output.boolean = false;
+        position += 5;
+        return true;
+    }
+
+    if (size - position >= 4 && strncmp(data + position, "null", 4) == 0)
+    {
+        output.type = JsonType::Null;
+        position += 4;
+        return true;
+    }
+
+    // The document isn't null terminated, so the number is copied before the conversion.
+    char number[64] {};
+    size_t length = 0;
+
+    while (position < size && length < sizeof(number) - 1 && strchr("+-0123456789.eE", data[position]) != nullptr)
+    {
+        number[length++] = data[position++];
+    }
+
+    char* end = nullptr;
+    output.number = strtod(number, &end);
+
+    if (length < 1 || end != number + length)
+    {
+        error = "invalid value at byte " + std::to_string(position);
+        return false;
+    }
+
+    output.type = JsonType::Number;
+    return true;
+}
+
+// Parse a whole JSON document.
+// Output: false with an error message if the document is malformed.
+bool parse_json
+(
+    const char* data,
+    const size_t &size,
+    JsonValue &output,
+    std::string &error
+)
+{
+    size_t position = 0;
+    output = JsonValue {};
+
+    if (!parse_json_value(data, size, position, 0, output, error))
+    {
+        return false;
+    }
+
+    skip_json_whitespaces(data, size, position);
+
+    // The binary chunks of GLB files pad their JSON with spaces, but nothing else may follow the document.
+    if (position < size && data[position] != '\0')
+    {
+        error = "unexpected data after the document at byte " + std::to_string(position);
+        return false;
+    }
+
+    return true;
+}
+
+// Return a member of a JSON object, or nullptr if it doesn't exist.
+const JsonValue* find_json_member
+(
+    const JsonValue &object,
+    const std::string &key
+)
+{
+    for (const auto &member : object.object)
+    {
+        if (member.first == key)
+        {
+            return &member.second;
+        }
+    }
+
+    return nullptr;
+}
+
+// Return a number member of a JSON object, or the fallback value if it doesn't exist.
+double get_json_number
+(
+    const JsonValue &object,
+    const std::string &key,
+    const double &fallback
+)
+{
+    const JsonValue* value = find_json_member(object, key);
+
+    if (value == nullptr || value->type != JsonType::Number)
+    {
+        return fallback;
+    }
+
+    return value->number;
+}
+
+// Return a string member of a JSON object, or the fallback value if it doesn't exist.
+std::string get_json_string
+(
+    const JsonValue &object,
+    const std::string &key,
+    const std::string &fallback
+)
+{
+    const JsonValue* value = find_json_member(object, key);
+
+    if (value == nullptr || value->type != JsonType::String)
+    {
+        return fallback;
+    }
+
+    return value->string;
+}
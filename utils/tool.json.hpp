@@ -0,0 +1,108 @@
+#include <string>
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+
+#ifndef HELPER_JSON_HPP
+#define HELPER_JSON_HPP
+
+////////////////////////////////////////////////////
+//////////////////// Structures ////////////////////
+////////////////////////////////////////////////////
+
+enum class JsonType
+{
+    Null,
+    Boolean,
+    Number,
+    String,
+    Array,
+    Object
+};
+
+// Node of a parsed JSON document.
+// The objects keep their members in the file order.
+struct JsonValue
+{
+    JsonType type = JsonType::Null;
+    bool boolean = false;
+    double number = 0.0;
+    std::string string;
+    std::vector<JsonValue> array;
+    std::vector<std::pair<std::string, JsonValue>> object;
+};
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+void skip_json_whitespaces
+(
+    const char* data,
+    const size_t &size,
+    size_t &position
+);
+
+void append_utf8
+(
+    std::string &output,
+    const uint32_t &code_point
+);
+
+bool parse_json_hexadecimal
+(
+    const char* data,
+    const size_t &size,
+    size_t &position,
+    uint32_t &output
+);
+
+bool parse_json
+(
+    const char* data,
+    const size_t &size,
+    JsonValue &output,
+    std::string &error
+);
+
+bool parse_json_value
+(
+    const char* data,
+    const size_t &size,
+    size_t &position,
+    const int &depth,
+    JsonValue &output,
+    std::string &error
+);
+
+bool parse_json_string
+(
+    const char* data,
+    const size_t &size,
+    size_t &position,
+    std::string &output,
+    std::string &error
+);
+
+const JsonValue* find_json_member
+(
+    const JsonValue &object,
+    const std::string &key
+);
+
+double get_json_number
+(
+    const JsonValue &object,
+    const std::string &key,
+    const double &fallback
+);
+
+std::string get_json_string
+(
+    const JsonValue &object,
+    const std::string &key,
+    const std::string &fallback
+);
+
+#endif
@@ -0,0 +1,138 @@
+#include "tool.mapped.file.hpp"
+
+#include "tool.text.format.hpp"
+#include "../logs/logs.handler.hpp"
+
+#include <filesystem>
+#include <string>
+#include <cstdint>
+
+#if defined(_WIN64)
+    #include "windows.h"
+#else
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+// Map a whole file into memory in read-only mode.
+// Note: On failure, the mapped file stays empty and is_valid() returns false.
+MappedFile::MappedFile
+(
+    const std::string &file_path
+)
+{
+    if (trim(file_path).size() < 1 || !std::filesystem::exists(file_path))
+    {
+        error_log("File mapping failed! The file \"" + file_path + "\" doesn't exist!");
+        return;
+    }
+
+    #if defined(_WIN64)
+        const HANDLE file = CreateFileA(file_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            error_log("File mapping failed! The file \"" + file_path + "\" can't be opened!");
+            return;
+        }
+
+        LARGE_INTEGER file_size {};
+        GetFileSizeEx(file, &file_size);
+
+        if (file_size.QuadPart < 1)
+        {
+            error_log("File mapping failed! The file \"" + file_path + "\" is empty!");
+            CloseHandle(file);
+            return;
+        }
+
+        const HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+        if (mapping == nullptr)
+        {
+            error_log("File mapping failed! The mapping of \"" + file_path + "\" can't be created!");
+            CloseHandle(file);
+            return;
+        }
+
+        const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+        if (view == nullptr)
+        {
+            error_log("File mapping failed! The view of \"" + file_path + "\" can't be mapped!");
+            CloseHandle(mapping);
+            CloseHandle(file);
+            return;
+        }
+
+        file_handle = file;
+        mapping_handle = mapping;
+        mapped_data = static_cast<const uint8_t*>(view);
+        mapped_size = static_cast<size_t>(file_size.QuadPart);
+    #else
+        const int file = open(file_path.c_str(), O_RDONLY);
+
+        if (file < 0)
+        {
+            error_log("File mapping failed! The file \"" + file_path + "\" can't be opened!");
+            return;
+        }
+
+        struct stat file_status {};
+
+        if (fstat(file, &file_status) != 0 || file_status.st_size < 1)
+        {
+            error_log("File mapping failed! The file \"" + file_path + "\" is empty or unreadable!");
+            close(file);
+            return;
+        }
+
+        void* view = mmap(nullptr, static_cast<size_t>(file_status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+        close(file); // The mapping keeps its own reference to the file.
+
+        if (view == MAP_FAILED)
+        {
+            error_log("File mapping failed! The file \"" + file_path + "\" can't be mapped!");
+            return;
+        }
+
+        madvise(view, static_cast<size_t>(file_status.st_size), MADV_SEQUENTIAL); // Models are mostly read from the start to the end.
+
+        mapped_data = static_cast<const uint8_t*>(view);
+        mapped_size = static_cast<size_t>(file_status.st_size);
+    #endif
+}
+
+// Unmap the file.
+MappedFile::~MappedFile()
+{
+    if (mapped_data == nullptr)
+    {
+        return;
+    }
+
+    #if defined(_WIN64)
+        UnmapViewOfFile(mapped_data);
+        CloseHandle(static_cast<HANDLE>(mapping_handle));
+        CloseHandle(static_cast<HANDLE>(file_handle));
+    #else
+        munmap(const_cast<uint8_t*>(mapped_data), mapped_size);
+    #endif
+}
+
+const uint8_t* MappedFile::data() const
+{
+    return mapped_data;
+}
+
+size_t MappedFile::size() const
+{
+    return mapped_size;
+}
+
+bool MappedFile::is_valid() const
+{
+    return mapped_data != nullptr;
+}
@@ -0,0 +1,44 @@
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+#ifndef HELPER_MAPPED_FILE_HPP
+#define HELPER_MAPPED_FILE_HPP
+
+///////////////////////////////////////////////
+//////////////////// Class ////////////////////
+///////////////////////////////////////////////
+
+// Read-only view of a whole file mapped into memory.
+// The operating system loads the pages on demand, so nothing is copied until the data is read.
+class MappedFile
+{
+public:
+
+    // Constructor.
+    MappedFile
+    (
+        const std::string &file_path
+    );
+
+    // Destructor.
+    ~MappedFile();
+
+    const uint8_t* data() const;
+    size_t size() const;
+    bool is_valid() const;
+
+    // Prevent data duplication.
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+private:
+
+    // We declare the members of the class to store.
+    const uint8_t* mapped_data = nullptr;
+    size_t mapped_size = 0;
+    void* file_handle = nullptr;     // Windows only: file and mapping handles.
+    void* mapping_handle = nullptr;
+};
+
+#endif
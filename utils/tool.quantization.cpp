@@ -0,0 +1,93 @@
+#include "tool.quantization.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+
+// Convert a 32 bits float into a 16 bits IEEE half float (rounded to the nearest value).
+uint16_t float_to_half
+(
+    const float &input
+)
+{
+    uint32_t bits;
+    memcpy(&bits, &input, sizeof(bits)); // Read the float as raw bits without breaking the aliasing rules.
+
+    const uint32_t sign = (bits >> 16) & 0x8000;
+    const uint32_t float_exponent = (bits >> 23) & 0xFF;
+    const int32_t exponent = static_cast<int32_t>(float_exponent) - 127 + 15; // Rebias the exponent for the half float range.
+    uint32_t mantissa = bits & 0x7FFFFF;
+
+    // Infinity and NaN keep their meaning.
+    if (float_exponent == 0xFF)
+    {
+        return static_cast<uint16_t>(sign | 0x7C00 | (mantissa != 0 ? 0x200 : 0));
+    }
+
+    // Too big to be represented, we clamp to infinity.
+    if (exponent >= 31)
+    {
+        return static_cast<uint16_t>(sign | 0x7C00);
+    }
+
+    // Too small to be a normal half float, we output a subnormal (or zero).
+    if (exponent <= 0)
+    {
+        if (exponent < -10)
+        {
+            return static_cast<uint16_t>(sign);
+        }
+
+        mantissa |= 0x800000; // Restore the implicit leading bit.
+
+        const uint32_t shift = static_cast<uint32_t>(14 - exponent);
+        uint32_t half = mantissa >> shift;
+
+        if ((mantissa >> (shift - 1)) & 1)
+        {
+            half++; // Round to the nearest value.
+        }
+
+        return static_cast<uint16_t>(sign | half);
+    }
+
+    uint32_t half = sign | (static_cast<uint32_t>(exponent) << 10) | (mantissa >> 13);
+
+    // Round to the nearest value, a carry naturally moves into the exponent.
+    if (mantissa & 0x1000)
+    {
+        half++;
+    }
+
+    return static_cast<uint16_t>(half);
+}
+
+// Convert a float in the [-1; 1] range into a signed normalized 8 bits integer.
+int8_t float_to_snorm8
+(
+    const float &input
+)
+{
+    const float clamped = std::fmax(-1.0f, std::fmin(1.0f, input));
+    return static_cast<int8_t>(std::round(clamped * 127.0f));
+}
+
+// Convert a float in the [-1; 1] range into a signed normalized 16 bits integer.
+int16_t float_to_snorm16
+(
+    const float &input
+)
+{
+    const float clamped = std::fmax(-1.0f, std::fmin(1.0f, input));
+    return static_cast<int16_t>(std::round(clamped * 32767.0f));
+}
+
+// Convert a float in the [0; 1] range into an unsigned normalized 8 bits integer.
+uint8_t float_to_unorm8
+(
+    const float &input
+)
+{
+    const float clamped = std::fmax(0.0f, std::fmin(1.0f, input));
+    return static_cast<uint8_t>(std::round(clamped * 255.0f));
+}
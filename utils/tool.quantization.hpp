@@ -0,0 +1,26 @@
+#include <cstdint>
+
+#ifndef HELPER_QUANTIZATION_HPP
+#define HELPER_QUANTIZATION_HPP
+
+uint16_t float_to_half
+(
+    const float &input
+);
+
+int8_t float_to_snorm8
+(
+    const float &input
+);
+
+int16_t float_to_snorm16
+(
+    const float &input
+);
+
+uint8_t float_to_unorm8
+(
+    const float &input
+);
+
+#endif
@@ -2,13 +2,15 @@
 
 #include "buffers.handler.hpp"
 #include "buffer.copy.hpp"
-#include "../vertex/vertex.handler.hpp"
+#include "../render/sync/render.sync.deletion.hpp"
 #include "../../logs/logs.handler.hpp"
 #include "../../utils/tool.text.format.hpp"
 
 #include <vulkan/vulkan.h>
 #include <cstring>
+#include <string>
 #include <utility>
+#include <vector>
 
 ///////////////////////////////////////////////////
 //////////////////// Functions ////////////////////
@@ -21,8 +23,7 @@ std::pair<VkBuffer, VkDeviceMemory> create_vulkan_index_buffer
     const VkPhysicalDevice &physical_device,
     const VkCommandPool &command_pool,
     const VkQueue &graphics_queue,
-    std::vector<Vertex> &vertices,
-    std::vector<uint32_t> &indices
+    const std::vector<uint8_t> &index_data
 )
 {
     log("Creating an index buffer..");
@@ -47,7 +48,12 @@ std::pair<VkBuffer, VkDeviceMemory> create_vulkan_index_buffer
         fatal_error_log("Index buffer creation failed! The graphics queue provided (" + force_string(graphics_queue) + ") is not valid!");
     }
 
-    const VkDeviceSize buffer_size = sizeof(vertices[0]) * vertices.size(); // Calculate the size of the index buffer.
+    if (index_data.size() < 1)
+    {
+        fatal_error_log("Index buffer creation failed! No index data was provided!");
+    }
+
+    const VkDeviceSize buffer_size = index_data.size(); // The indices are already packed with their per mesh type.
     VkBuffer staging_index_buffer = VK_NULL_HANDLE;
     VkDeviceMemory staging_buffer_memory = VK_NULL_HANDLE;
 
@@ -56,9 +62,14 @@ std::pair<VkBuffer, VkDeviceMemory> create_vulkan_index_buffer
     void* data;
 
     // Map the buffer memory in the app address space.
-    const bool map_memory = vkMapMemory(logical_device, staging_buffer_memory, 0, buffer_size, 0, &data);
+    const VkResult map_memory = vkMapMemory(logical_device, staging_buffer_memory, 0, buffer_size, 0, &data);
 
-    memcpy(data, indices.data(), (size_t) buffer_size);   // Copy the index data into the map memory.
+    if (map_memory != VK_SUCCESS)
+    {
+        fatal_error_log("Index buffer creation failed! The staging buffer memory mapping returned error code " + std::to_string(map_memory) + ".");
+    }
+
+    memcpy(data, index_data.data(), (size_t) buffer_size);   // Copy the index data into the map memory.
     vkUnmapMemory(logical_device, staging_buffer_memory); // Unmap the memory once we finished.
 
     VkBuffer index_buffer = VK_NULL_HANDLE;
@@ -119,11 +130,10 @@ Vulkan_IndexBuffer::Vulkan_IndexBuffer
     const VkPhysicalDevice &physical_device,
     const VkCommandPool &command_pool,
     const VkQueue &graphics_queue,
-    std::vector<Vertex> &vertices,
-    std::vector<uint32_t> &indices
+    const std::vector<uint8_t> &index_data
 ) : logical_device(logical_device)
 {
-    const std::pair buffer_data = create_vulkan_index_buffer(logical_device, physical_device, command_pool, graphics_queue, vertices, indices);
+    const std::pair buffer_data = create_vulkan_index_buffer(logical_device, physical_device, command_pool, graphics_queue, index_data);
 
     buffer = buffer_data.first;
     buffer_memory = buffer_data.second;
@@ -132,7 +142,10 @@ Vulkan_IndexBuffer::Vulkan_IndexBuffer
 // Destructor.
 Vulkan_IndexBuffer::~Vulkan_IndexBuffer()
 {
-    destroy_vulkan_index_buffer(logical_device, buffer, buffer_memory);
+    retire_vulkan_resource([logical_device = logical_device, buffer = buffer, buffer_memory = buffer_memory]() mutable
+    {
+        destroy_vulkan_index_buffer(logical_device, buffer, buffer_memory);
+    });
 }
 
 VkBuffer Vulkan_IndexBuffer::get() const
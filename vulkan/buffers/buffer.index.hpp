@@ -1,7 +1,7 @@
-#include "../vertex/vertex.handler.hpp"
-
 #include <vulkan/vulkan.h>
+#include <cstdint>
 #include <utility>
+#include <vector>
 
 #ifndef VULKAN_BUFFERS_INDEX_HPP
 #define VULKAN_BUFFERS_INDEX_HPP
@@ -16,8 +16,7 @@ std::pair<VkBuffer, VkDeviceMemory> create_vulkan_index_buffer
     const VkPhysicalDevice &physical_device,
     const VkCommandPool &command_pool,
     const VkQueue &graphics_queue,
-    std::vector<Vertex> &vertices,
-    std::vector<uint32_t> &indices
+    const std::vector<uint8_t> &index_data
 );
 
 void destroy_vulkan_index_buffer
@@ -42,8 +41,7 @@ public:
         const VkPhysicalDevice &physical_device,
         const VkCommandPool &command_pool,
         const VkQueue &graphics_queue,
-        std::vector<Vertex> &vertices,
-        std::vector<uint32_t> &indices
+        const std::vector<uint8_t> &index_data
     );
 
     // Destructor.
@@ -2,6 +2,7 @@
 
 #include "../images/image.views.handler.hpp"
 #include "../images/images.handler.hpp"
+#include "../render/sync/render.sync.deletion.hpp"
 #include "../../logs/logs.handler.hpp"
 #include "../../utils/tool.text.format.hpp"
 
@@ -99,7 +100,10 @@ Vulkan_ColorResources::Vulkan_ColorResources
 // Destructor.
 Vulkan_ColorResources::~Vulkan_ColorResources()
 {
-    destroy_color_resources(logical_device, color_resources);
+    retire_vulkan_resource([logical_device = logical_device, color_resources = color_resources]() mutable
+    {
+        destroy_color_resources(logical_device, color_resources);
+    });
 }
 
 ColorResources Vulkan_ColorResources::get() const
@@ -1,33 +1,62 @@
 #include "command.buffer.recorder.hpp"
 
-#include "../vertex/vertex.handler.hpp"
+#include "../render/render.statistics.hpp"
+#include "../render/render.indirect.hpp"
+#include "../render/render.culling.hpp"
+#include "../render/render.timestamps.hpp"
+#include "../render/render.capture.hpp"
+#include "../render/render.dynamic.hpp"
+#include "../render/graph/render.graph.hpp"
+#include "../render/graph/render.graph.cache.hpp"
+#include "../render/graph/render.graph.transients.hpp"
+#include "../depth/depth.pyramid.hpp"
+#include "command.buffer.secondary.hpp"
+#include "../pipeline/pipeline.layout.hpp"
+#include "../../config/engine.config.hpp"
 #include "../../logs/logs.handler.hpp"
 #include "../../utils/tool.text.format.hpp"
 
 #include <vulkan/vulkan.h>
 #include <unistd.h>
+#include <algorithm>
+#include <chrono>
 #include <cstdint>
 #include <vector>
 #include <array>
 
-// Record the current state of a command buffer for rendering.
+// Record the current state of a command buffer for rendering, through a render graph recording the barriers between its passes.
+// The draws go through the render passes and their framebuffers, or the dynamic rendering when its attachments are given.
 void record_command_buffer
 (
     const VkCommandBuffer &command_buffer,
+    const SecondaryCommandBuffers &secondary_command_buffers,
     const uint32_t &image_index,
     const VkExtent2D &extent,
     const std::vector<VkFramebuffer> &framebuffers,
     const VkRenderPass &render_pass,
+    const VkRenderPass &late_render_pass,
+    const DynamicRenderingAttachments &dynamic_rendering,
     const VkPipeline &graphics_pipeline,
     const VkViewport &viewport,
     const VkRect2D &scissor,
     const VkBuffer &vertex_buffer,
     const VkBuffer &index_buffer,
+    const VkBuffer &instance_buffer,
+    const VkBuffer &indirect_buffer,
     const size_t &frame,
     const VkPipelineLayout &pipeline_layout,
     const std::vector<VkDescriptorSet> descriptor_sets,
     const std::vector<VkImageView> texture_image_views,
-    std::vector<uint32_t> indices
+    const std::vector<VkDrawIndexedIndirectCommand> &commands,
+    const std::vector<IndirectDrawRun> &runs,
+    const IndirectDrawSupport &indirect_support,
+    const GpuCullingResources &culling,
+    const uint32_t &culling_objects_count,
+    const DepthPyramid &depth_pyramid,
+    const VkImage &depth_image,
+    const FrameCaptureTarget &capture,
+    const GpuTimestamps &timestamps,
+    DrawStatistics &statistics
 )
 {
     if (command_buffer == VK_NULL_HANDLE)
@@ -36,24 +65,44 @@ void record_command_buffer
         return;
     }
 
-    if (framebuffers.size() < 1)
+    const bool dynamic = !dynamic_rendering.images.empty();
+
+    if (dynamic && image_index >= dynamic_rendering.images.size())
+    {
+        error_log("Failed to render a frame! The image index provided is out of bounds for the dynamic rendering images: " + std::to_string(image_index) + " >= " + std::to_string(dynamic_rendering.images.size()) + ".");
+        return;
+    }
+
+    if (!dynamic && framebuffers.size() < 1)
     {
         error_log("Failed to render a frame! No frame buffers were provided!");
         return;
     }
 
-    if (image_index >= framebuffers.size())
+    if (!dynamic && image_index >= framebuffers.size())
     {
         error_log("Failed to render a frame! The image index provided is out of bounds for the frame buffers: " + std::to_string(image_index) + " >= " + std::to_string(framebuffers.size()) + ".");
         return;
     }
 
-    if (render_pass == VK_NULL_HANDLE)
+    if (!dynamic && render_pass == VK_NULL_HANDLE)
     {
         error_log("Failed to render a frame! The render pass provided (" + force_string(render_pass) + ") is not valid!");
         return;
     }
 
+    if (!dynamic && culling.occlusion && late_render_pass == VK_NULL_HANDLE)
+    {
+        error_log("Failed to render a frame! The late render pass provided (" + force_string(late_render_pass) + ") is not valid!");
+        return;
+    }
+
+    if (culling.pipeline != VK_NULL_HANDLE && frame >= culling.frame_buffers.size())
+    {
+        error_log("Failed to render a frame! The frame index provided is out of bounds for the culling frame buffers: " + std::to_string(frame) + " >= " + std::to_string(culling.frame_buffers.size()) + ".");
+        return;
+    }
+
     if (graphics_pipeline == VK_NULL_HANDLE)
     {
         error_log("Failed to render a frame! The graphics pipeline provided (" + force_string(graphics_pipeline) + ") is not valid!");
@@ -72,6 +121,18 @@ void record_command_buffer
         return;
     }
 
+    if (instance_buffer == VK_NULL_HANDLE)
+    {
+        error_log("Failed to render a frame! The instance buffer provided (" + force_string(instance_buffer) + ") is not valid!");
+        return;
+    }
+
+    if (indirect_buffer == VK_NULL_HANDLE)
+    {
+        error_log("Failed to render a frame! The indirect buffer provided (" + force_string(indirect_buffer) + ") is not valid!");
+        return;
+    }
+
     if (pipeline_layout == VK_NULL_HANDLE)
     {
         error_log("Failed to render a frame! The pipeline layout provided (" + force_string(pipeline_layout) + ") is not valid!");
@@ -96,6 +157,8 @@ void record_command_buffer
         return;
     }
 
+    const auto recording_start = std::chrono::high_resolution_clock::now();
+
     VkCommandBufferBeginInfo begin_info
     {
         .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO
@@ -108,6 +171,8 @@ void record_command_buffer
         fatal_error_log("Failed to render a frame! The command buffer start returned error code " + std::to_string(buffer_launch) + ".");
     }
 
+    record_gpu_frame_start(command_buffer, timestamps, frame); // Time the GPU work of the frame.
+
     std::array<VkClearValue, 2> clear_values {};
     clear_values[0].color = {{ 0.0f, 0.0f, 0.0f, 1.0f }};
     clear_values[1].depthStencil = { 1.0f, 0 };
@@ -116,7 +181,7 @@ void record_command_buffer
     {
         .sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
         .renderPass = render_pass,
-        .framebuffer = framebuffers[image_index],
+        .framebuffer = dynamic ? VK_NULL_HANDLE : framebuffers[image_index], // Unused by the dynamic rendering.
         .renderArea =
         {
             .offset = { 0, 0 }, // Select the beginning of the rendering area.
@@ -126,30 +191,270 @@ void record_command_buffer
         .pClearValues = clear_values.data()
     };
 
-    const VkBuffer vertex_buffers = { vertex_buffer };
-    const VkDeviceSize offsets[] = { 0 };
+    // Cull the objects on the GPU first, it fills the draws and the instances read by the render pass.
+    // With the occlusion culling, this first phase only draws the objects visible in the previous frame.
+    const bool gpu_culling = culling.pipeline != VK_NULL_HANDLE;
+    const bool occlusion = gpu_culling && culling.occlusion;
+
+    const VkBuffer vertex_buffers[] = { vertex_buffer, instance_buffer };
+    const VkDeviceSize offsets[] = { 0, 0 };
+
+    // The draws are read from the indirect buffer when the device can read several of them per call, starting after the first instance.
+    // Otherwise, the same draws are recorded one by one, unless the GPU culling writes their instance counts.
+    // The second half of the runs belongs to the second culling phase.
+    const bool indirect_draws = (EngineConfig::USE_INDIRECT_DRAWS || gpu_culling) && indirect_support.multi_draw && indirect_support.first_instance;
+    const size_t early_runs = occlusion ? runs.size() / 2 : runs.size();
+
+    // Many draws recorded one by one are split between the job threads, each slice going to its own secondary command buffer.
+    // The secondary command buffers don't inherit the state bound above, they bind it again.
+    const SecondaryDrawState secondary_state
+    {
+        .render_pass = dynamic ? VK_NULL_HANDLE : render_pass,
+        .framebuffer = dynamic ? VK_NULL_HANDLE : framebuffers[image_index],
+        .color_format = dynamic_rendering.color_format,
+        .depth_format = dynamic_rendering.depth_format,
+        .samples_count = dynamic_rendering.samples_count,
+        .graphics_pipeline = graphics_pipeline,
+        .pipeline_layout = pipeline_layout,
+        .descriptor_set = descriptor_sets[frame],
+        .viewport = viewport,
+        .scissor = scissor,
+        .vertex_buffer = vertex_buffer,
+        .instance_buffer = instance_buffer,
+        .index_buffer = index_buffer
+    };
+
+    // The multisampled color of the dynamic rendering is a transient image of the render graph, created once the graph is compiled.
+    VkImageView color_image_view = VK_NULL_HANDLE;
+
+    // Draw the runs of a culling phase in a render pass or a dynamic rendering, the late phase keeping what the early one drew.
+    // The state of the primary command buffer is undefined once it executed secondary command buffers, so the inline draws bind all of it again.
+    const auto record_draws = [&](const VkCommandBuffer &buffer, const uint32_t &phase)
+    {
+        const size_t first_run = phase == 0 ? 0 : early_runs;
+        const size_t runs_count = phase == 0 ? early_runs : runs.size() - early_runs;
+        const size_t slices = indirect_draws ? 0 : get_secondary_slices_count(secondary_command_buffers, get_runs_draws_count(commands, runs, first_run, runs_count));
+        const bool load = phase > 0;
+
+        render_pass_begin_info.renderPass = phase == 0 ? render_pass : late_render_pass;
+
+        if (slices > 0)
+        {
+            SecondaryDrawState phase_state = secondary_state;
+            phase_state.render_pass = dynamic ? VK_NULL_HANDLE : render_pass_begin_info.renderPass;
+
+            if (dynamic)
+            {
+                begin_dynamic_rendering(buffer, dynamic_rendering, color_image_view, image_index, extent, load, VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT);
+            }
+            else vkCmdBeginRenderPass(buffer, &render_pass_begin_info, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS); // Start the render pass, its draws come from the secondary command buffers.
+
+            record_secondary_draws(buffer, secondary_command_buffers, frame, phase, slices, phase_state, commands, runs, first_run, runs_count);
+        }
+        else
+        {
+            if (dynamic)
+            {
+                begin_dynamic_rendering(buffer, dynamic_rendering, color_image_view, image_index, extent, load, 0);
+            }
+            else vkCmdBeginRenderPass(buffer, &render_pass_begin_info, VK_SUBPASS_CONTENTS_INLINE); // Start the render pass for drawing.
+
+            vkCmdSetViewport(buffer, 0, 1, &viewport);                                     // Set the viewport.
+            vkCmdSetScissor(buffer, 0, 1, &scissor);                                       // Set the scissor.
+            vkCmdBindPipeline(buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, graphics_pipeline); // Bind the graphics pipeline to the command buffer.
+            vkCmdBindVertexBuffers(buffer, 0, 2, vertex_buffers, offsets);                 // Bind the vertex and instance buffers to the command buffer.
+            vkCmdBindDescriptorSets(buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout, 0, 1, &descriptor_sets[frame], 0, nullptr); // Bind the descriptor set to the command buffer.
+
+            record_indirect_draws(buffer, index_buffer, indirect_buffer, commands, runs, first_run, runs_count, indirect_draws, indirect_support, statistics);
+        }
+
+        if (dynamic)
+        {
+            end_dynamic_rendering(buffer);
+        }
+        else vkCmdEndRenderPass(buffer); // End the render pass.
+    };
+
+    // The frame goes through a render graph, which records the barriers between its passes from the resources they declare.
+    // The render passes change the attachments layouts themselves, so they only declare the depth sampled by the pyramid, and the captured output they leave ready to be copied from in headless mode.
+    const bool captured = capture.buffer != VK_NULL_HANDLE;
+    const RenderGraphState no_state = { VK_IMAGE_LAYOUT_UNDEFINED, 0, 0 };
+    const RenderGraphState host_read_state = get_render_graph_usage_state(RenderGraphUsage::HostRead);
+
+    RenderGraph graph {};
+    uint32_t output = RENDER_GRAPH_NONE;
+    uint32_t color = RENDER_GRAPH_NONE;
+    uint32_t depth = RENDER_GRAPH_NONE;
+
+    // The output waits for the acquired image at the color output stage, the depth for its writes of the previous frame.
+    if (dynamic)
+    {
+        const bool transfer = dynamic_rendering.final_layout == VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        const RenderGraphState output_final_state = { dynamic_rendering.final_layout, transfer ? VK_PIPELINE_STAGE_TRANSFER_BIT : VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, transfer ? static_cast<VkAccessFlags>(VK_ACCESS_TRANSFER_READ_BIT) : 0 };
+
+        // The multisampled color only lives during the frame, as it is resolved into the output.
+        const VkImageCreateInfo color_info
+        {
+            .sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+            .imageType = VK_IMAGE_TYPE_2D,
+            .format = dynamic_rendering.color_format,
+            .extent = { extent.width, extent.height, 1 },
+            .mipLevels = 1,
+            .arrayLayers = 1,
+            .samples = dynamic_rendering.samples_count,
+            .tiling = VK_IMAGE_TILING_OPTIMAL,
+            .usage = VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT | VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT,
+            .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+            .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED
+        };
+
+        output = import_render_graph_image(graph, "output", dynamic_rendering.images[image_index], VK_IMAGE_ASPECT_COLOR_BIT, { VK_IMAGE_LAYOUT_UNDEFINED, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, 0 }, output_final_state);
+        color = create_render_graph_image(graph, "multisampled color", color_info, VK_IMAGE_ASPECT_COLOR_BIT);
+    }
+    else if (captured)
+    {
+        output = import_render_graph_image(graph, "output", capture.image, VK_IMAGE_ASPECT_COLOR_BIT, { VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT }, no_state);
+    }
+
+    if (dynamic || occlusion)
+    {
+        depth = import_render_graph_image(graph, "depth", depth_image, dynamic ? dynamic_rendering.depth_aspect : depth_pyramid.depth_aspect, { VK_IMAGE_LAYOUT_UNDEFINED, VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT, VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT }, no_state);
+    }
+
+    // The culling writes the draws, the instances and its counters, which the CPU reads back once the frame is done.
+    // Those buffers belong to the frame in flight, so only the visibility shared by the frames waits for the second phase of the previous frame, and the pyramid for the culling reading it.
+    uint32_t indirect = RENDER_GRAPH_NONE;
+    uint32_t instances = RENDER_GRAPH_NONE;
+    uint32_t culling_frame = RENDER_GRAPH_NONE;
+    uint32_t visibility = RENDER_GRAPH_NONE;
+    uint32_t pyramid = RENDER_GRAPH_NONE;
+
+    if (gpu_culling)
+    {
+        indirect = import_render_graph_buffer(graph, "indirect draws", indirect_buffer, no_state, host_read_state);
+        instances = import_render_graph_buffer(graph, "instances", instance_buffer, no_state, host_read_state);
+        culling_frame = import_render_graph_buffer(graph, "culling frame", culling.frame_buffers[frame].buffer, no_state, host_read_state);
+    }
+
+    if (occlusion)
+    {
+        visibility = import_render_graph_buffer(graph, "visibility", culling.visibility_buffer, { VK_IMAGE_LAYOUT_UNDEFINED, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_WRITE_BIT }, no_state);
+        pyramid = import_render_graph_image(graph, "depth pyramid", depth_pyramid.image, VK_IMAGE_ASPECT_COLOR_BIT, { VK_IMAGE_LAYOUT_UNDEFINED, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0 }, no_state);
+    }
+
+    const auto declare_culling = [&](const uint32_t &pass)
+    {
+        write_render_graph_resource(graph, pass, indirect, RenderGraphUsage::Storage);
+        write_render_graph_resource(graph, pass, instances, RenderGraphUsage::Storage);
+        write_render_graph_resource(graph, pass, culling_frame, RenderGraphUsage::Storage); // The occluded objects are counted in the frame buffer.
+
+        if (occlusion)
+        {
+            write_render_graph_resource(graph, pass, visibility, RenderGraphUsage::Storage);
+        }
+    };
+
+    // The late draws load the attachments the early ones drew, and both read the draws and the instances written by the culling.
+    const auto declare_draws = [&](const uint32_t &pass, const bool &load)
+    {
+        if (depth != RENDER_GRAPH_NONE)
+        {
+            if (load)
+            {
+                read_render_graph_resource(graph, pass, depth, RenderGraphUsage::DepthAttachment);
+            }
 
-    vkCmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, graphics_pipeline); // Bind the graphics pipeline to the command buffer.
-    vkCmdBindVertexBuffers(command_buffer, 0, 1, &vertex_buffers, offsets);                // Bind the vertex buffers to the command buffer.
-    vkCmdBindIndexBuffer(command_buffer, index_buffer, 0, VK_INDEX_TYPE_UINT32);           // Bind the index buffer to the command buffer.
-    vkCmdBindDescriptorSets(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout, 0, 1, &descriptor_sets[frame], 0, nullptr); // Bind the descriptor set to the command buffer.
+            write_render_graph_resource(graph, pass, depth, RenderGraphUsage::DepthAttachment);
+        }
 
-    int targeted_texture = 0;
+        if (dynamic)
+        {
+            if (load)
+            {
+                read_render_graph_resource(graph, pass, color, RenderGraphUsage::ColorAttachment);
+            }
 
-    // Select the default texture if the targeted texture doesn't exist.
-    if (targeted_texture < 0 || targeted_texture > texture_image_views.size())
+            write_render_graph_resource(graph, pass, color, RenderGraphUsage::ColorAttachment);
+            write_render_graph_resource(graph, pass, output, RenderGraphUsage::ColorAttachment); // The color is resolved into the output.
+        }
+
+        if (gpu_culling)
+        {
+            read_render_graph_resource(graph, pass, indirect, RenderGraphUsage::IndirectRead);
+            read_render_graph_resource(graph, pass, instances, RenderGraphUsage::VertexInput);
+        }
+    };
+
+    if (gpu_culling)
     {
-        error_log("Texture #" + std::to_string(targeted_texture) + " not found!");
-        targeted_texture = 0;
+        const uint32_t early_culling = add_render_graph_pass(graph, "early culling", false, [&](const VkCommandBuffer &buffer)
+        {
+            record_gpu_culling(buffer, culling, frame, 0, culling_objects_count);
+        });
+
+        declare_culling(early_culling);
     }
 
-    vkCmdPushConstants(command_buffer, pipeline_layout, VK_SHADER_STAGE_FRAGMENT_BIT, 0, sizeof(int), &targeted_texture); // Apply the texture.
-    vkCmdBeginRenderPass(command_buffer, &render_pass_begin_info, VK_SUBPASS_CONTENTS_INLINE); // Start the render pass for drawing.
-    vkCmdSetViewport(command_buffer, 0, 1, &viewport);                                         // Set the viewport.
-    vkCmdSetScissor(command_buffer, 0, 1, &scissor);                                           // Set the scissor.
-    vkCmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, graphics_pipeline);     // Bind the graphics pipeline to the command buffer.
-    vkCmdDrawIndexed(command_buffer, static_cast<uint32_t>(indices.size()), 1, 0, 0, 0);       // Make the draw call.
-    vkCmdEndRenderPass(command_buffer);                                                        // End the render pass.
+    // The render passes write the output without the graph knowing it, so their draws are never culled.
+    const uint32_t early_draws = add_render_graph_pass(graph, "early draws", !dynamic, [&](const VkCommandBuffer &buffer)
+    {
+        record_draws(buffer, 0);
+    });
+
+    declare_draws(early_draws, false);
+
+    // With the occlusion culling, the depth of the first phase is reduced into the pyramid, then the objects it no longer hides are drawn in a second phase.
+    if (occlusion)
+    {
+        const uint32_t pyramid_reduction = add_render_graph_pass(graph, "depth pyramid", false, [&](const VkCommandBuffer &buffer)
+        {
+            record_depth_pyramid(buffer, depth_pyramid, extent);
+        });
+
+        read_render_graph_resource(graph, pyramid_reduction, depth, RenderGraphUsage::Sampled);
+        write_render_graph_resource(graph, pyramid_reduction, pyramid, RenderGraphUsage::Storage);
+
+        const uint32_t late_culling = add_render_graph_pass(graph, "late culling", false, [&](const VkCommandBuffer &buffer)
+        {
+            record_gpu_culling(buffer, culling, frame, 1, culling_objects_count);
+        });
+
+        declare_culling(late_culling);
+        read_render_graph_resource(graph, late_culling, pyramid, RenderGraphUsage::Storage); // The pyramid stays in the general layout of its reduction.
+
+        const uint32_t late_draws = add_render_graph_pass(graph, "late draws", !dynamic, [&](const VkCommandBuffer &buffer)
+        {
+            record_draws(buffer, 1);
+        });
+
+        declare_draws(late_draws, true);
+    }
+
+    // Copy the frame back to the CPU when it is captured.
+    if (captured)
+    {
+        const uint32_t capture_buffer = import_render_graph_buffer(graph, "frame capture", capture.buffer, no_state, host_read_state);
+        const uint32_t frame_capture = add_render_graph_pass(graph, "frame capture", false, [&](const VkCommandBuffer &buffer)
+        {
+            record_frame_capture(buffer, capture, extent);
+        });
+
+        read_render_graph_resource(graph, frame_capture, output, RenderGraphUsage::TransferSource);
+        write_render_graph_resource(graph, frame_capture, capture_buffer, RenderGraphUsage::TransferDestination);
+    }
+
+    // The frames of the same shape add the same passes and accesses, so they share the compilation of their graph and its transient images.
+    const uint64_t shape = (dynamic ? 1u : 0u) | (gpu_culling ? 2u : 0u) | (occlusion ? 4u : 0u) | (captured ? 8u : 0u) | (static_cast<uint64_t>(dynamic_rendering.final_layout) << 4);
+    const CachedRenderGraph &cached_graph = get_cached_render_graph(shape, graph);
+
+    if (dynamic)
+    {
+        color_image_view = get_render_graph_transient_view(cached_graph.transients, color);
+    }
+
+    execute_render_graph(command_buffer, graph, cached_graph.compiled_graph);
+
+    record_gpu_frame_end(command_buffer, timestamps, frame);
 
     const VkResult buffer_end = vkEndCommandBuffer(command_buffer);
 
@@ -157,4 +462,6 @@ void record_command_buffer
     {
         fatal_error_log("Failed to render a frame! The command buffer end returned error code " + std::to_string(buffer_end) + ".");
     }
+
+    statistics.recording_time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - recording_start).count();
 }
@@ -1,3 +1,12 @@
+#include "../render/render.statistics.hpp"
+#include "../render/render.indirect.hpp"
+#include "../render/render.culling.hpp"
+#include "../render/render.timestamps.hpp"
+#include "../render/render.capture.hpp"
+#include "../render/render.dynamic.hpp"
+#include "../depth/depth.pyramid.hpp"
+#include "command.buffer.secondary.hpp"
+
 #include <vulkan/vulkan.h>
 #include <stdint.h>
 #include <vector>
@@ -8,20 +17,34 @@
 void record_command_buffer
 (
     const VkCommandBuffer &command_buffer,
+    const SecondaryCommandBuffers &secondary_command_buffers,
     const uint32_t &image_index,
     const VkExtent2D &extent,
     const std::vector<VkFramebuffer> &framebuffers,
     const VkRenderPass &render_pass,
+    const VkRenderPass &late_render_pass,
+    const DynamicRenderingAttachments &dynamic_rendering,
     const VkPipeline &graphics_pipeline,
     const VkViewport &viewport,
     const VkRect2D &scissor,
     const VkBuffer &vertex_buffer,
     const VkBuffer &index_buffer,
+    const VkBuffer &instance_buffer,
+    const VkBuffer &indirect_buffer,
     const size_t &frame,
     const VkPipelineLayout &pipeline_layout,
     const std::vector<VkDescriptorSet> descriptor_sets,
     const std::vector<VkImageView> texture_image_views,
-    std::vector<uint32_t> indices
+    const std::vector<VkDrawIndexedIndirectCommand> &commands,
+    const std::vector<IndirectDrawRun> &runs,
+    const IndirectDrawSupport &indirect_support,
+    const GpuCullingResources &culling,
+    const uint32_t &culling_objects_count,
+    const DepthPyramid &depth_pyramid,
+    const VkImage &depth_image,
+    const FrameCaptureTarget &capture,
+    const GpuTimestamps &timestamps,
+    DrawStatistics &statistics
 );
 
 #endif
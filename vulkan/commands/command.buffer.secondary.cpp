@@ -0,0 +1,379 @@
+#include "command.buffer.secondary.hpp"
+
+#include "../render/render.indirect.hpp"
+#include "../render/sync/render.sync.deletion.hpp"
+#include "../../config/engine.config.hpp"
+#include "../../jobs/jobs.system.hpp"
+#include "../../logs/logs.handler.hpp"
+#include "../../utils/tool.text.format.hpp"
+
+#include <vulkan/vulkan.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+// Create the command pools of the secondary command buffers.
+// Their buffers are only recorded once per frame, so they are reset all at once with their pool.
+std::vector<VkCommandPool> create_vulkan_secondary_command_pools
+(
+    const VkDevice &logical_device,
+    const uint32_t &graphics_family_index,
+    const size_t &pools_count
+)
+{
+    log("Creating " + std::to_string(pools_count) + " secondary command pools..");
+
+    if (logical_device == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Secondary command pools creation failed! The logical device provided (" + force_string(logical_device) + ") is not valid!");
+    }
+
+    if (pools_count < 1)
+    {
+        fatal_error_log("Secondary command pools creation failed! The amount of pools provided (" + std::to_string(pools_count) + ") is not valid!");
+    }
+
+    const VkCommandPoolCreateInfo create_info
+    {
+        .sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+        .flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT, // The buffers are recorded again at each frame.
+        .queueFamilyIndex = graphics_family_index      // Pass the index of the graphics family.
+    };
+
+    std::vector<VkCommandPool> command_pools(pools_count, VK_NULL_HANDLE);
+
+    for (size_t i = 0; i < pools_count; i++)
+    {
+        const VkResult pool_creation = vkCreateCommandPool(logical_device, &create_info, nullptr, &command_pools[i]);
+
+        if (pool_creation != VK_SUCCESS)
+        {
+            fatal_error_log("Secondary command pool creation returned error code " + std::to_string(pool_creation) + ".");
+        }
+    }
+
+    log(std::to_string(pools_count) + " secondary command pools created successfully!");
+    return command_pools;
+}
+
+// Destroy the command pools of the secondary command buffers, which also frees their buffers.
+void destroy_vulkan_secondary_command_pools
+(
+    const VkDevice &logical_device,
+    std::vector<VkCommandPool> &command_pools
+)
+{
+    log("Destroying " + std::to_string(command_pools.size()) + " secondary command pools..");
+
+    if (logical_device == VK_NULL_HANDLE)
+    {
+        error_log("Secondary command pools destruction failed! The logical device provided (" + force_string(logical_device) + ") is not valid!");
+        return;
+    }
+
+    for (VkCommandPool &command_pool : command_pools)
+    {
+        if (command_pool != VK_NULL_HANDLE)
+        {
+            vkDestroyCommandPool(logical_device, command_pool, nullptr);
+            command_pool = VK_NULL_HANDLE;
+        }
+    }
+
+    command_pools.clear();
+    log("Secondary command pools destroyed successfully!");
+}
+
+// Allocate a secondary command buffer for each render pass from each command pool.
+// The pools are ordered by frame then slice, the buffers by frame, render pass then slice.
+std::vector<VkCommandBuffer> create_vulkan_secondary_command_buffers
+(
+    const VkDevice &logical_device,
+    const std::vector<VkCommandPool> &command_pools,
+    const size_t &slices_count
+)
+{
+    log("Creating " + std::to_string(command_pools.size() * SECONDARY_PASSES_COUNT) + " secondary command buffers..");
+
+    if (logical_device == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Secondary command buffers creation failed! The logical device provided (" + force_string(logical_device) + ") is not valid!");
+    }
+
+    if (slices_count < 1 || command_pools.size() % slices_count != 0)
+    {
+        fatal_error_log("Secondary command buffers creation failed! The amount of slices provided (" + std::to_string(slices_count) + ") doesn't match the " + std::to_string(command_pools.size()) + " command pools!");
+    }
+
+    std::vector<VkCommandBuffer> command_buffers(command_pools.size() * SECONDARY_PASSES_COUNT, VK_NULL_HANDLE);
+    VkCommandBuffer pool_buffers[SECONDARY_PASSES_COUNT];
+
+    for (size_t i = 0; i < command_pools.size(); i++)
+    {
+        const VkCommandBufferAllocateInfo allocation_info
+        {
+            .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+            .commandPool = command_pools[i],
+            .level = VK_COMMAND_BUFFER_LEVEL_SECONDARY, // Executed from the primary command buffer, inside a render pass.
+            .commandBufferCount = SECONDARY_PASSES_COUNT
+        };
+
+        const VkResult buffer_allocation = vkAllocateCommandBuffers(logical_device, &allocation_info, pool_buffers);
+
+        if (buffer_allocation != VK_SUCCESS)
+        {
+            fatal_error_log("Secondary command buffers allocation returned error code " + std::to_string(buffer_allocation) + ".");
+        }
+
+        const size_t frame = i / slices_count;
+        const size_t slice = i % slices_count;
+
+        for (uint32_t pass = 0; pass < SECONDARY_PASSES_COUNT; pass++)
+        {
+            command_buffers[(frame * SECONDARY_PASSES_COUNT + pass) * slices_count + slice] = pool_buffers[pass];
+        }
+    }
+
+    log(std::to_string(command_buffers.size()) + " secondary command buffers created successfully!");
+    return command_buffers;
+}
+
+// Reset the secondary command buffers of a frame, once the GPU is done with them.
+void reset_vulkan_secondary_command_buffers
+(
+    const VkDevice &logical_device,
+    const SecondaryCommandBuffers &secondary_command_buffers,
+    const size_t &frame
+)
+{
+    const size_t slices_count = secondary_command_buffers.slices_count;
+
+    for (size_t i = frame * slices_count; i < (frame + 1) * slices_count && i < secondary_command_buffers.command_pools.size(); i++)
+    {
+        vkResetCommandPool(logical_device, secondary_command_buffers.command_pools[i], 0);
+    }
+}
+
+// Return the amount of slices to record some draws in, or 0 when they are too few to be worth splitting.
+size_t get_secondary_slices_count
+(
+    const SecondaryCommandBuffers &secondary_command_buffers,
+    const size_t &draws_count
+)
+{
+    const size_t slices_count = std::min(secondary_command_buffers.slices_count, draws_count / std::max(1u, EngineConfig::SECONDARY_DRAWS_PER_THREAD));
+    return slices_count < 2 ? 0 : slices_count;
+}
+
+// Return the amount of draws of some runs, skipping the runs out of the draws like record_indirect_draws() does.
+size_t get_runs_draws_count
+(
+    const std::vector<VkDrawIndexedIndirectCommand> &commands,
+    const std::vector<IndirectDrawRun> &runs,
+    const size_t &first_run,
+    const size_t &runs_count
+)
+{
+    size_t draws_count = 0;
+
+    for (size_t i = first_run; i < first_run + runs_count && i < runs.size(); i++)
+    {
+        if (runs[i].first_command + runs[i].commands_count <= commands.size())
+        {
+            draws_count += runs[i].commands_count;
+        }
+    }
+
+    return draws_count;
+}
+
+// Record a slice of the draws of some runs into a secondary command buffer, the slice being a [first, last) range of their draws.
+void record_secondary_draws_slice
+(
+    const VkCommandBuffer &command_buffer,
+    const SecondaryDrawState &state,
+    const std::vector<VkDrawIndexedIndirectCommand> &commands,
+    const std::vector<IndirectDrawRun> &runs,
+    const size_t &first_run,
+    const size_t &runs_count,
+    const size_t &first_draw,
+    const size_t &last_draw
+)
+{
+    const bool dynamic_rendering = state.render_pass == VK_NULL_HANDLE;
+
+    const VkCommandBufferInheritanceRenderingInfo rendering_info
+    {
+        .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO,
+        .colorAttachmentCount = 1,
+        .pColorAttachmentFormats = &state.color_format,
+        .depthAttachmentFormat = state.depth_format,
+        .stencilAttachmentFormat = VK_FORMAT_UNDEFINED, // No stencil attachment, like the dynamic rendering.
+        .rasterizationSamples = state.samples_count
+    };
+
+    const VkCommandBufferInheritanceInfo inheritance_info
+    {
+        .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO,
+        .pNext = dynamic_rendering ? &rendering_info : nullptr, // Attachments of the dynamic rendering the buffer is executed in.
+        .renderPass = state.render_pass,                        // Render pass the buffer is executed in, none with the dynamic rendering.
+        .subpass = 0,
+        .framebuffer = state.framebuffer                        // Optional, but it lets the driver know the attachments.
+    };
+
+    const VkCommandBufferBeginInfo begin_info
+    {
+        .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+        .flags = VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT | VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT, // Entirely inside the render pass, recorded again at the next frame.
+        .pInheritanceInfo = &inheritance_info
+    };
+
+    const VkResult buffer_launch = vkBeginCommandBuffer(command_buffer, &begin_info);
+
+    if (buffer_launch != VK_SUCCESS)
+    {
+        error_log("Failed to record some draws! The secondary command buffer start returned error code " + std::to_string(buffer_launch) + ".");
+        return;
+    }
+
+    const VkBuffer vertex_buffers[] = { state.vertex_buffer, state.instance_buffer };
+    const VkDeviceSize offsets[] = { 0, 0 };
+
+    vkCmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, state.graphics_pipeline);
+    vkCmdBindVertexBuffers(command_buffer, 0, 2, vertex_buffers, offsets);
+    vkCmdBindDescriptorSets(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, state.pipeline_layout, 0, 1, &state.descriptor_set, 0, nullptr);
+    vkCmdSetViewport(command_buffer, 0, 1, &state.viewport);
+    vkCmdSetScissor(command_buffer, 0, 1, &state.scissor);
+
+    size_t run_first_draw = 0; // Index of the first draw of the current run, among the draws of all the runs.
+
+    for (size_t i = first_run; i < first_run + runs_count && i < runs.size() && run_first_draw < last_draw; i++)
+    {
+        const IndirectDrawRun &run = runs[i];
+
+        if (run.first_command + run.commands_count > commands.size())
+        {
+            continue;
+        }
+
+        const size_t run_last_draw = run_first_draw + run.commands_count;
+        const size_t first = std::max(first_draw, run_first_draw);
+        const size_t last = std::min(last_draw, run_last_draw);
+
+        if (first < last)
+        {
+            vkCmdBindIndexBuffer(command_buffer, state.index_buffer, 0, run.index_type);
+
+            for (size_t j = run.first_command + (first - run_first_draw); j < run.first_command + (last - run_first_draw); j++)
+            {
+                const VkDrawIndexedIndirectCommand &command = commands[j];
+                vkCmdDrawIndexed(command_buffer, command.indexCount, command.instanceCount, command.firstIndex, command.vertexOffset, command.firstInstance); // Make the draw call.
+            }
+        }
+
+        run_first_draw = run_last_draw;
+    }
+
+    const VkResult buffer_end = vkEndCommandBuffer(command_buffer);
+
+    if (buffer_end != VK_SUCCESS)
+    {
+        error_log("Failed to record some draws! The secondary command buffer end returned error code " + std::to_string(buffer_end) + ".");
+    }
+}
+
+// Split the draws of some runs into slices, record each slice from a job thread into its own secondary command buffer, then execute them in order.
+// The render pass must have been started with the VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS contents.
+// Likewise, the dynamic rendering must have been started with the VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT flag.
+void record_secondary_draws
+(
+    const VkCommandBuffer &command_buffer,
+    const SecondaryCommandBuffers &secondary_command_buffers,
+    const size_t &frame,
+    const uint32_t &pass,
+    const size_t &slices_count,
+    const SecondaryDrawState &state,
+    const std::vector<VkDrawIndexedIndirectCommand> &commands,
+    const std::vector<IndirectDrawRun> &runs,
+    const size_t &first_run,
+    const size_t &runs_count
+)
+{
+    if (slices_count < 1 || slices_count > secondary_command_buffers.slices_count || pass >= SECONDARY_PASSES_COUNT)
+    {
+        error_log("Failed to record some draws! The " + std::to_string(slices_count) + " slices of the render pass #" + std::to_string(pass) + " don't match the secondary command buffers.");
+        return;
+    }
+
+    const size_t first_buffer = (frame * SECONDARY_PASSES_COUNT + pass) * secondary_command_buffers.slices_count;
+
+    if (first_buffer + slices_count > secondary_command_buffers.command_buffers.size())
+    {
+        error_log("Failed to record some draws! The frame index is out of bounds for the secondary command buffers: " + std::to_string(frame) + ".");
+        return;
+    }
+
+    const size_t draws_count = get_runs_draws_count(commands, runs, first_run, runs_count);
+    const VkCommandBuffer* slices_buffers = &secondary_command_buffers.command_buffers[first_buffer];
+
+    // A slice always uses the same command buffer whatever the thread recording it, so each command pool is only used by one thread at once.
+    parallel_for(slices_count, 1, [&](const size_t &first_slice, const size_t &last_slice)
+    {
+        for (size_t slice = first_slice; slice < last_slice; slice++)
+        {
+            record_secondary_draws_slice(slices_buffers[slice], state, commands, runs, first_run, runs_count, draws_count * slice / slices_count, draws_count * (slice + 1) / slices_count);
+        }
+    });
+
+    vkCmdExecuteCommands(command_buffer, static_cast<uint32_t>(slices_count), slices_buffers);
+}
+
+///////////////////////////////////////////////
+//////////////////// Class ////////////////////
+///////////////////////////////////////////////
+
+// Constructor.
+// One slice per job thread, nothing is created when the draws are recorded from a single thread.
+Vulkan_SecondaryCommandBuffers::Vulkan_SecondaryCommandBuffers
+(
+    const bool &enabled,
+    const VkDevice &logical_device,
+    const uint32_t &graphics_family_index,
+    const uint32_t &images_count,
+    const size_t &threads_count
+) : logical_device(logical_device)
+{
+    if (!enabled || threads_count < 2)
+    {
+        return;
+    }
+
+    slices_count = threads_count;
+    command_pools = create_vulkan_secondary_command_pools(logical_device, graphics_family_index, images_count * slices_count);
+    command_buffers = create_vulkan_secondary_command_buffers(logical_device, command_pools, slices_count);
+}
+
+// Destructor.
+Vulkan_SecondaryCommandBuffers::~Vulkan_SecondaryCommandBuffers()
+{
+    if (command_pools.empty())
+    {
+        return;
+    }
+
+    retire_vulkan_resource([logical_device = logical_device, command_pools = command_pools]() mutable
+    {
+        destroy_vulkan_secondary_command_pools(logical_device, command_pools); // Also frees the command buffers.
+    });
+}
+
+SecondaryCommandBuffers Vulkan_SecondaryCommandBuffers::get() const
+{
+    return { slices_count, command_pools, command_buffers };
+}
@@ -0,0 +1,140 @@
+#include "../render/render.indirect.hpp"
+
+#include <vulkan/vulkan.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#ifndef VULKAN_COMMAND_BUFFER_SECONDARY_HPP
+#define VULKAN_COMMAND_BUFFER_SECONDARY_HPP
+
+// Amount of render passes recording their draws into secondary command buffers: the early one and the late one of the occlusion culling.
+constexpr const uint32_t SECONDARY_PASSES_COUNT = 2;
+
+////////////////////////////////////////////////////
+//////////////////// Structures ////////////////////
+////////////////////////////////////////////////////
+
+// Secondary command buffers recording the draws of each frame in slices, each slice from its own thread.
+struct SecondaryCommandBuffers
+{
+    size_t slices_count;                          // Maximum amount of slices per render pass, 0 when the draws are recorded into the primary command buffer.
+    std::vector<VkCommandPool> command_pools;     // One per frame and slice, as a command pool can't be used by several threads at once.
+    std::vector<VkCommandBuffer> command_buffers; // Ordered by frame, render pass then slice, so the slices of a render pass are executed together.
+};
+
+// Graphics state bound by each secondary command buffer, as they don't inherit the state bound in the primary one.
+// Without render pass, the buffers are executed inside a dynamic rendering with the attachments formats given here.
+struct SecondaryDrawState
+{
+    VkRenderPass render_pass;
+    VkFramebuffer framebuffer;
+    VkFormat color_format;
+    VkFormat depth_format;
+    VkSampleCountFlagBits samples_count;
+    VkPipeline graphics_pipeline;
+    VkPipelineLayout pipeline_layout;
+    VkDescriptorSet descriptor_set;
+    VkViewport viewport;
+    VkRect2D scissor;
+    VkBuffer vertex_buffer;
+    VkBuffer instance_buffer;
+    VkBuffer index_buffer;
+};
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+std::vector<VkCommandPool> create_vulkan_secondary_command_pools
+(
+    const VkDevice &logical_device,
+    const uint32_t &graphics_family_index,
+    const size_t &pools_count
+);
+
+void destroy_vulkan_secondary_command_pools
+(
+    const VkDevice &logical_device,
+    std::vector<VkCommandPool> &command_pools
+);
+
+std::vector<VkCommandBuffer> create_vulkan_secondary_command_buffers
+(
+    const VkDevice &logical_device,
+    const std::vector<VkCommandPool> &command_pools,
+    const size_t &slices_count
+);
+
+void reset_vulkan_secondary_command_buffers
+(
+    const VkDevice &logical_device,
+    const SecondaryCommandBuffers &secondary_command_buffers,
+    const size_t &frame
+);
+
+size_t get_secondary_slices_count
+(
+    const SecondaryCommandBuffers &secondary_command_buffers,
+    const size_t &draws_count
+);
+
+size_t get_runs_draws_count
+(
+    const std::vector<VkDrawIndexedIndirectCommand> &commands,
+    const std::vector<IndirectDrawRun> &runs,
+    const size_t &first_run,
+    const size_t &runs_count
+);
+
+void record_secondary_draws
+(
+    const VkCommandBuffer &command_buffer,
+    const SecondaryCommandBuffers &secondary_command_buffers,
+    const size_t &frame,
+    const uint32_t &pass,
+    const size_t &slices_count,
+    const SecondaryDrawState &state,
+    const std::vector<VkDrawIndexedIndirectCommand> &commands,
+    const std::vector<IndirectDrawRun> &runs,
+    const size_t &first_run,
+    const size_t &runs_count
+);
+
+///////////////////////////////////////////////
+//////////////////// Class ////////////////////
+///////////////////////////////////////////////
+
+class Vulkan_SecondaryCommandBuffers
+{
+
+public:
+    // Constructor.
+    Vulkan_SecondaryCommandBuffers
+    (
+        const bool &enabled,
+        const VkDevice &logical_device,
+        const uint32_t &graphics_family_index,
+        const uint32_t &images_count,
+        const size_t &threads_count
+    );
+
+    // Destructor.
+    ~Vulkan_SecondaryCommandBuffers();
+
+    SecondaryCommandBuffers get() const;
+
+    // Prevent data duplication.
+    Vulkan_SecondaryCommandBuffers(const Vulkan_SecondaryCommandBuffers&) = delete;
+    Vulkan_SecondaryCommandBuffers &operator = (const Vulkan_SecondaryCommandBuffers&) = delete;
+
+private:
+    // We declare the members of the class to store.
+    VkDevice logical_device = VK_NULL_HANDLE;
+    size_t slices_count = 0;
+    std::vector<VkCommandPool> command_pools;
+    std::vector<VkCommandBuffer> command_buffers;
+
+};
+
+#endif
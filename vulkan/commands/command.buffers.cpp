@@ -7,7 +7,7 @@
 #include <cstdint>
 #include <vector>
 
-// Create a command buffer for each swap chain image.
+// Create a command buffer for each frame in flight.
 std::vector<VkCommandBuffer> create_vulkan_command_buffers
 (
     const VkDevice &logical_device,
@@ -1,5 +1,6 @@
 #include "command.pool.hpp"
 
+#include "../render/sync/render.sync.deletion.hpp"
 #include "../../logs/logs.handler.hpp"
 #include "../../utils/tool.text.format.hpp"
 
@@ -99,7 +100,10 @@ Vulkan_CommandPool::Vulkan_CommandPool
 // Destructor.
 Vulkan_CommandPool::~Vulkan_CommandPool()
 {
-    destroy_vulkan_command_pool(logical_device, command_pool);
+    retire_vulkan_resource([logical_device = logical_device, command_pool = command_pool]() mutable
+    {
+        destroy_vulkan_command_pool(logical_device, command_pool);
+    });
 }
 
 VkCommandPool Vulkan_CommandPool::get() const
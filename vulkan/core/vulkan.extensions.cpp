@@ -70,3 +70,56 @@ void check_vulkan_extensions_support
 
     log("The Vulkan extensions verification has ended successfully!");
 }
+
+// Return true if a physical device handles an optional Vulkan extension.
+bool is_vulkan_extension_supported
+(
+    const VkPhysicalDevice &physical_device,
+    const char* extension_name
+)
+{
+    if (physical_device == VK_NULL_HANDLE)
+    {
+        error_log("Failed to check the support of the \"" + std::string(extension_name) + "\" extension! The physical device provided (" + force_string(physical_device) + ") is not valid!");
+        return false;
+    }
+
+    uint32_t extensions_count = 0;
+    vkEnumerateDeviceExtensionProperties(physical_device, nullptr, &extensions_count, nullptr);
+
+    std::vector<VkExtensionProperties> available_extensions(extensions_count);
+    vkEnumerateDeviceExtensionProperties(physical_device, nullptr, &extensions_count, available_extensions.data());
+
+    for (const VkExtensionProperties &extension : available_extensions)
+    {
+        if (std::string(extension.extensionName) == extension_name)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Return true if the Vulkan instance can enable an optional extension.
+bool is_vulkan_instance_extension_supported
+(
+    const char* extension_name
+)
+{
+    uint32_t extensions_count = 0;
+    vkEnumerateInstanceExtensionProperties(nullptr, &extensions_count, nullptr);
+
+    std::vector<VkExtensionProperties> available_extensions(extensions_count);
+    vkEnumerateInstanceExtensionProperties(nullptr, &extensions_count, available_extensions.data());
+
+    for (const VkExtensionProperties &extension : available_extensions)
+    {
+        if (std::string(extension.extensionName) == extension_name)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
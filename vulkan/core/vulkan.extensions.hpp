@@ -10,4 +10,15 @@ void check_vulkan_extensions_support
     const std::vector<const char *> &required_extensions
 );
 
+bool is_vulkan_extension_supported
+(
+    const VkPhysicalDevice &physical_device,
+    const char* extension_name
+);
+
+bool is_vulkan_instance_extension_supported
+(
+    const char* extension_name
+);
+
 #endif
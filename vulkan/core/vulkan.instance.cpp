@@ -1,5 +1,6 @@
 #include "vulkan.instance.hpp"
 
+#include "vulkan.extensions.hpp"
 #include "../../config/game.config.hpp"
 #include "../../config/engine.config.hpp"
 #include "../../config/engine.version.hpp"
@@ -17,9 +18,12 @@
 ///////////////////////////////////////////////////
 
 // Create a Vulkan instance.
+// In headless mode, nothing is presented to a window, so the instance doesn't need the SDL3 extensions.
+// Otherwise, the surface maintenance extensions are added when available, the present fences need them.
 VkInstance create_vulkan_instance
 (
-    const std::vector<const char*> &layers
+    const std::vector<const char*> &layers,
+    const bool &headless
 )
 {
     log("Creating a Vulkan instance..");
@@ -52,21 +56,29 @@ VkInstance create_vulkan_instance
     };
 
     Uint32 extensions_count = 0;
-    const char* const* extensions_list = SDL_Vulkan_GetInstanceExtensions(&extensions_count);
+    const char* const* extensions_list = headless ? nullptr : SDL_Vulkan_GetInstanceExtensions(&extensions_count);
 
-    if (!extensions_list || !extensions_count)
+    if (!headless && (!extensions_list || !extensions_count))
     {
         fatal_error_log("Vulkan instance creation failed! Failed to retrieve the required SDL3 extensions!");
     }
 
+    std::vector<const char*> extensions(extensions_list, extensions_list + extensions_count);
+
+    if (!headless && is_vulkan_instance_extension_supported(VK_EXT_SURFACE_MAINTENANCE_1_EXTENSION_NAME) && is_vulkan_instance_extension_supported(VK_KHR_GET_SURFACE_CAPABILITIES_2_EXTENSION_NAME))
+    {
+        extensions.push_back(VK_KHR_GET_SURFACE_CAPABILITIES_2_EXTENSION_NAME);
+        extensions.push_back(VK_EXT_SURFACE_MAINTENANCE_1_EXTENSION_NAME);
+    }
+
     const VkInstanceCreateInfo create_info
     {
         .sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO,
         .pApplicationInfo = &app_info,
-        .enabledLayerCount = static_cast<uint32_t>(layers.size()), // Amount of layers to enable.
-        .ppEnabledLayerNames = layers.data(),                      // Pass the layers list.
-        .enabledExtensionCount = extensions_count,                 // Amount of extensions to enable.
-        .ppEnabledExtensionNames = extensions_list                 // List of the required extensions.
+        .enabledLayerCount = static_cast<uint32_t>(layers.size()),         // Amount of layers to enable.
+        .ppEnabledLayerNames = layers.data(),                              // Pass the layers list.
+        .enabledExtensionCount = static_cast<uint32_t>(extensions.size()), // Amount of extensions to enable.
+        .ppEnabledExtensionNames = extensions.data()                       // List of the required extensions.
     };
 
     VkInstance vulkan_instance = VK_NULL_HANDLE;
@@ -113,10 +125,11 @@ void destroy_vulkan_instance
 // Constructor.
 Vulkan_Instance::Vulkan_Instance
 (
-    const std::vector<const char*> &layers
+    const std::vector<const char*> &layers,
+    const bool &headless
 )
 {
-    vulkan_instance = create_vulkan_instance(layers);
+    vulkan_instance = create_vulkan_instance(layers, headless);
 }
 
 // Destructor.
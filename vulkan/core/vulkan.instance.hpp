@@ -11,7 +11,8 @@
 
 VkInstance create_vulkan_instance
 (
-    const std::vector<const char*> &layers
+    const std::vector<const char*> &layers,
+    const bool &headless
 );
 
 void destroy_vulkan_instance
@@ -30,7 +31,8 @@ public:
     // Constructor.
     Vulkan_Instance
     (
-        const std::vector<const char*> &layers
+        const std::vector<const char*> &layers,
+        const bool &headless
     );
 
     // Destructor.
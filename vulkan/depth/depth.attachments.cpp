@@ -1,6 +1,7 @@
 #include "depth.attachments.hpp"
 
 #include "depth.formats.hpp"
+#include "../../config/engine.config.hpp"
 #include "../../logs/logs.handler.hpp"
 
 #include <vulkan/vulkan.h>
@@ -19,7 +20,7 @@ VkAttachmentDescription create_depth_attachment
         .format = find_depth_format(physical_device),
         .samples = samples_count,                    // MSAA.
         .loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR,       // Clear depth buffer.
-        .storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE, // Don't store depth buffer data after render pass.
+        .storeOp = EngineConfig::USE_OCCLUSION_CULLING ? VK_ATTACHMENT_STORE_OP_STORE : VK_ATTACHMENT_STORE_OP_DONT_CARE, // Only store the depth buffer data for the occlusion culling.
         .stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE,   // Ignore stencil buffer loading.
         .stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE, // Ignore stencil buffer storing.
         .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED,
@@ -0,0 +1,439 @@
+#include "depth.pyramid.hpp"
+
+#include "depth.formats.hpp"
+#include "../images/images.handler.hpp"
+#include "../pipeline/compute.pipeline.hpp"
+#include "../pipeline/pipeline.layout.hpp"
+#include "../descriptors/descriptor.set.layout.hpp"
+#include "../descriptors/descriptor.pool.hpp"
+#include "../shaders/shader.modules.hpp"
+#include "../shaders/shader.stages.hpp"
+#include "../render/sync/render.sync.deletion.hpp"
+#include "../../logs/logs.handler.hpp"
+#include "../../utils/tool.text.format.hpp"
+
+#include <vulkan/vulkan.h>
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <array>
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+// Return the size of the first level of the depth pyramid: half the depth attachment, rounded up to cover all its texels.
+VkExtent2D get_depth_pyramid_extent
+(
+    const VkExtent2D &extent
+)
+{
+    return { std::max((extent.width + 1) / 2, 1u), std::max((extent.height + 1) / 2, 1u) };
+}
+
+// Return the amount of levels of the depth pyramid, down to a single texel.
+uint32_t get_depth_pyramid_levels_count
+(
+    const VkExtent2D &pyramid_extent
+)
+{
+    uint32_t levels_count = 1;
+    uint32_t size = std::max(pyramid_extent.width, pyramid_extent.height);
+
+    while (size > 1)
+    {
+        size = (size + 1) / 2;
+        levels_count++;
+    }
+
+    return levels_count;
+}
+
+// Create a view on some levels of the depth pyramid image.
+VkImageView create_vulkan_depth_pyramid_view
+(
+    const VkDevice &logical_device,
+    const VkImage &image,
+    const uint32_t &base_level,
+    const uint32_t &levels_count
+)
+{
+    if (logical_device == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Depth pyramid view creation failed! The logical device provided (" + force_string(logical_device) + ") is not valid!");
+    }
+
+    if (image == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Depth pyramid view creation failed! The image provided (" + force_string(image) + ") is not valid!");
+    }
+
+    const VkImageViewCreateInfo info
+    {
+        .sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
+        .image = image,
+        .viewType = VK_IMAGE_VIEW_TYPE_2D,
+        .format = VK_FORMAT_R32_SFLOAT,
+        .subresourceRange =
+        {
+            .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+            .baseMipLevel = base_level,   // Set the starting level.
+            .levelCount = levels_count,   // Amount of levels seen by the view.
+            .baseArrayLayer = 0,
+            .layerCount = 1
+        }
+    };
+
+    VkImageView image_view = VK_NULL_HANDLE;
+    const VkResult view_creation = vkCreateImageView(logical_device, &info, nullptr, &image_view);
+
+    if (view_creation != VK_SUCCESS)
+    {
+        fatal_error_log("Depth pyramid view creation returned error code " + std::to_string(view_creation) + ".");
+    }
+
+    if (image_view == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Depth pyramid view creation output (" + force_string(image_view) + ") is not valid!");
+    }
+
+    return image_view;
+}
+
+// Create the sampler of the depth pyramid, only its texels are fetched so it doesn't filter.
+VkSampler create_vulkan_depth_pyramid_sampler
+(
+    const VkDevice &logical_device
+)
+{
+    if (logical_device == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Depth pyramid sampler creation failed! The logical device provided (" + force_string(logical_device) + ") is not valid!");
+    }
+
+    const VkSamplerCreateInfo create_info
+    {
+        .sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO,
+        .magFilter = VK_FILTER_NEAREST,
+        .minFilter = VK_FILTER_NEAREST,
+        .mipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST,
+        .addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE,
+        .addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE,
+        .addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE,
+        .anisotropyEnable = VK_FALSE,
+        .maxAnisotropy = 1.0f,
+        .compareEnable = VK_FALSE,
+        .compareOp = VK_COMPARE_OP_ALWAYS,
+        .maxLod = VK_LOD_CLAMP_NONE,
+        .unnormalizedCoordinates = VK_FALSE
+    };
+
+    VkSampler sampler = VK_NULL_HANDLE;
+    const VkResult sampler_creation = vkCreateSampler(logical_device, &create_info, nullptr, &sampler);
+
+    if (sampler_creation != VK_SUCCESS)
+    {
+        fatal_error_log("Depth pyramid sampler creation returned error code " + std::to_string(sampler_creation) + ".");
+    }
+
+    if (sampler == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Depth pyramid sampler creation output (" + force_string(sampler) + ") is not valid!");
+    }
+
+    return sampler;
+}
+
+// Create a descriptor set per level of the depth pyramid: the previous level (or the depth attachment) is read, the level is written.
+std::vector<VkDescriptorSet> create_vulkan_depth_pyramid_descriptor_sets
+(
+    const VkDevice &logical_device,
+    const VkDescriptorSetLayout &descriptor_set_layout,
+    const VkDescriptorPool &descriptor_pool,
+    const VkImageView &depth_image_view,
+    const VkSampler &sampler,
+    const std::vector<VkImageView> &level_views
+)
+{
+    if (logical_device == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Depth pyramid descriptor sets creation failed! The logical device provided (" + force_string(logical_device) + ") is not valid!");
+    }
+
+    if (descriptor_set_layout == VK_NULL_HANDLE || descriptor_pool == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Depth pyramid descriptor sets creation failed! The descriptor set layout (" + force_string(descriptor_set_layout) + ") or the descriptor pool (" + force_string(descriptor_pool) + ") provided is not valid!");
+    }
+
+    if (depth_image_view == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Depth pyramid descriptor sets creation failed! The depth image view provided (" + force_string(depth_image_view) + ") is not valid!");
+    }
+
+    const uint32_t levels_count = static_cast<uint32_t>(level_views.size());
+    std::vector<VkDescriptorSet> descriptor_sets(levels_count);
+    std::vector<VkDescriptorSetLayout> layouts(levels_count, descriptor_set_layout);
+
+    VkDescriptorSetAllocateInfo allocation_info
+    {
+        .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
+        .descriptorPool = descriptor_pool,
+        .descriptorSetCount = levels_count, // Amount of descriptor sets to pass.
+        .pSetLayouts = layouts.data()       // Pass the descriptor set layouts.
+    };
+
+    const VkResult sets_allocation = vkAllocateDescriptorSets(logical_device, &allocation_info, descriptor_sets.data());
+
+    if (sets_allocation != VK_SUCCESS)
+    {
+        fatal_error_log("Depth pyramid descriptor sets creation failed! Descriptor sets allocation returned error code " + std::to_string(sets_allocation) + ".");
+    }
+
+    for (uint32_t i = 0; i < levels_count; i++)
+    {
+        // The depth attachment is read in its shader read layout, the pyramid stays in the general layout.
+        const VkDescriptorImageInfo source_info
+        {
+            .sampler = sampler,
+            .imageView = i == 0 ? depth_image_view : level_views[i - 1],
+            .imageLayout = i == 0 ? VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL : VK_IMAGE_LAYOUT_GENERAL
+        };
+
+        const VkDescriptorImageInfo destination_info
+        {
+            .sampler = VK_NULL_HANDLE,
+            .imageView = level_views[i],
+            .imageLayout = VK_IMAGE_LAYOUT_GENERAL
+        };
+
+        std::array<VkWriteDescriptorSet, 2> write_sets {};
+
+        write_sets[0].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        write_sets[0].dstSet = descriptor_sets[i];
+        write_sets[0].dstBinding = 0;
+        write_sets[0].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        write_sets[0].descriptorCount = 1;
+        write_sets[0].pImageInfo = &source_info;
+
+        write_sets[1].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        write_sets[1].dstSet = descriptor_sets[i];
+        write_sets[1].dstBinding = 1;
+        write_sets[1].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+        write_sets[1].descriptorCount = 1;
+        write_sets[1].pImageInfo = &destination_info;
+
+        vkUpdateDescriptorSets(logical_device, static_cast<uint32_t>(write_sets.size()), write_sets.data(), 0, nullptr);
+    }
+
+    return descriptor_sets;
+}
+
+// Create the depth pyramid of a depth attachment, with the pipelines reducing it level by level.
+DepthPyramid create_depth_pyramid
+(
+    const VkPhysicalDevice &physical_device,
+    const VkDevice &logical_device,
+    const PipelineCache &pipeline_cache,
+    const std::vector<ShaderInfo> &shaders_modules,
+    const VkImageView &depth_image_view,
+    const VkExtent2D &extent,
+    const VkSampleCountFlagBits &samples_count
+)
+{
+    log("Creating the depth pyramid..");
+
+    if (physical_device == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Depth pyramid creation failed! The physical device provided (" + force_string(physical_device) + ") is not valid!");
+    }
+
+    if (logical_device == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Depth pyramid creation failed! The logical device provided (" + force_string(logical_device) + ") is not valid!");
+    }
+
+    DepthPyramid depth_pyramid {};
+    depth_pyramid.extent = get_depth_pyramid_extent(extent);
+    depth_pyramid.levels_count = get_depth_pyramid_levels_count(depth_pyramid.extent);
+
+    const VkFormat depth_format = find_depth_format(physical_device);
+    depth_pyramid.depth_aspect = has_stencil_component(depth_format) ? VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT : VK_IMAGE_ASPECT_DEPTH_BIT;
+
+    const std::pair<VkImage, VkDeviceMemory> image = create_image
+    (
+        physical_device,
+        logical_device,
+        depth_pyramid.extent.width,
+        depth_pyramid.extent.height,
+        depth_pyramid.levels_count,
+        VK_SAMPLE_COUNT_1_BIT,
+        VK_FORMAT_R32_SFLOAT,
+        VK_IMAGE_TILING_OPTIMAL,
+        VK_IMAGE_USAGE_STORAGE_BIT | VK_IMAGE_USAGE_SAMPLED_BIT // Written by the reduction, read by the next level and the culling.
+    );
+
+    depth_pyramid.image = image.first;
+    depth_pyramid.image_memory = image.second;
+    depth_pyramid.image_view = create_vulkan_depth_pyramid_view(logical_device, depth_pyramid.image, 0, depth_pyramid.levels_count);
+
+    for (uint32_t i = 0; i < depth_pyramid.levels_count; i++)
+    {
+        depth_pyramid.level_views.push_back(create_vulkan_depth_pyramid_view(logical_device, depth_pyramid.image, i, 1));
+    }
+
+    depth_pyramid.sampler = create_vulkan_depth_pyramid_sampler(logical_device);
+
+    // The first level reads all the samples of a multisampled depth attachment.
+    const std::vector<VkDescriptorType> bindings_types = { VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE };
+    const VkPipelineShaderStageCreateInfo first_stage = create_vulkan_compute_shader_stage(shaders_modules, samples_count == VK_SAMPLE_COUNT_1_BIT ? "depth.pyramid.comp" : "depth.pyramid.multisampled.comp");
+    const VkPipelineShaderStageCreateInfo stage = create_vulkan_compute_shader_stage(shaders_modules, "depth.pyramid.comp");
+
+    depth_pyramid.descriptor_set_layout = create_vulkan_compute_descriptor_set_layout(logical_device, bindings_types);
+    depth_pyramid.pipeline_layout = create_vulkan_compute_pipeline_layout(logical_device, depth_pyramid.descriptor_set_layout, 4 * sizeof(uint32_t));
+    depth_pyramid.first_pipeline = create_vulkan_compute_pipeline(logical_device, pipeline_cache, first_stage, depth_pyramid.pipeline_layout);
+    depth_pyramid.pipeline = create_vulkan_compute_pipeline(logical_device, pipeline_cache, stage, depth_pyramid.pipeline_layout);
+
+    depth_pyramid.descriptor_pool = create_vulkan_compute_descriptor_pool(logical_device, bindings_types, depth_pyramid.levels_count);
+    depth_pyramid.descriptor_sets = create_vulkan_depth_pyramid_descriptor_sets(logical_device, depth_pyramid.descriptor_set_layout, depth_pyramid.descriptor_pool, depth_image_view, depth_pyramid.sampler, depth_pyramid.level_views);
+
+    log("Depth pyramid of " + std::to_string(depth_pyramid.extent.width) + "x" + std::to_string(depth_pyramid.extent.height) + " texels and " + std::to_string(depth_pyramid.levels_count) + " levels created successfully!");
+    return depth_pyramid;
+}
+
+// Destroy the depth pyramid.
+void destroy_depth_pyramid
+(
+    const VkDevice &logical_device,
+    DepthPyramid &depth_pyramid
+)
+{
+    log("Destroying the depth pyramid..");
+
+    if (logical_device == VK_NULL_HANDLE)
+    {
+        error_log("Depth pyramid destruction failed! The logical device provided (" + force_string(logical_device) + ") is not valid!");
+        return;
+    }
+
+    if (depth_pyramid.image == VK_NULL_HANDLE)
+    {
+        error_log("Depth pyramid destruction failed! The depth pyramid image provided (" + force_string(depth_pyramid.image) + ") is not valid!");
+        return;
+    }
+
+    destroy_vulkan_descriptor_pool(logical_device, depth_pyramid.descriptor_pool); // Also frees the descriptor sets.
+    destroy_vulkan_compute_pipeline(logical_device, depth_pyramid.first_pipeline);
+    destroy_vulkan_compute_pipeline(logical_device, depth_pyramid.pipeline);
+    destroy_vulkan_pipeline_layout(logical_device, depth_pyramid.pipeline_layout);
+    destroy_vulkan_descriptor_set_layout(logical_device, depth_pyramid.descriptor_set_layout);
+
+    vkDestroySampler(logical_device, depth_pyramid.sampler, nullptr);
+
+    for (VkImageView &level_view : depth_pyramid.level_views)
+    {
+        vkDestroyImageView(logical_device, level_view, nullptr);
+    }
+
+    vkDestroyImageView(logical_device, depth_pyramid.image_view, nullptr);
+    vkDestroyImage(logical_device, depth_pyramid.image, nullptr);
+    vkFreeMemory(logical_device, depth_pyramid.image_memory, nullptr);
+
+    depth_pyramid = {};
+    log("Depth pyramid destroyed successfully!");
+}
+
+// Record the reduction of the depth attachment into the depth pyramid, once the first render pass ended.
+// The render graph of the frame gives the sampled depth attachment and the discarded pyramid, then gives the depth back to the second render pass.
+// Only the levels are synchronized here, each reduction reading the level written before it.
+void record_depth_pyramid
+(
+    const VkCommandBuffer &command_buffer,
+    const DepthPyramid &depth_pyramid,
+    const VkExtent2D &extent
+)
+{
+    if (depth_pyramid.image == VK_NULL_HANDLE)
+    {
+        error_log("Failed to record the depth pyramid! The depth pyramid image (" + force_string(depth_pyramid.image) + ") is not valid!");
+        return;
+    }
+
+    VkExtent2D source_extent = extent;
+    VkExtent2D level_extent = depth_pyramid.extent;
+
+    for (uint32_t i = 0; i < depth_pyramid.levels_count; i++)
+    {
+        const uint32_t sizes[] = { source_extent.width, source_extent.height, level_extent.width, level_extent.height };
+
+        vkCmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, i == 0 ? depth_pyramid.first_pipeline : depth_pyramid.pipeline);
+        vkCmdBindDescriptorSets(command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, depth_pyramid.pipeline_layout, 0, 1, &depth_pyramid.descriptor_sets[i], 0, nullptr);
+        vkCmdPushConstants(command_buffer, depth_pyramid.pipeline_layout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(sizes), sizes);
+        vkCmdDispatch(command_buffer, (level_extent.width + DEPTH_PYRAMID_WORKGROUP_SIZE - 1) / DEPTH_PYRAMID_WORKGROUP_SIZE, (level_extent.height + DEPTH_PYRAMID_WORKGROUP_SIZE - 1) / DEPTH_PYRAMID_WORKGROUP_SIZE, 1);
+
+        // The level is read by the next reduction, the render graph makes the last one visible to the culling.
+        if (i + 1 < depth_pyramid.levels_count)
+        {
+            const VkImageMemoryBarrier level_barrier
+            {
+                .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+                .srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT,
+                .dstAccessMask = VK_ACCESS_SHADER_READ_BIT,
+                .oldLayout = VK_IMAGE_LAYOUT_GENERAL,
+                .newLayout = VK_IMAGE_LAYOUT_GENERAL,
+                .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                .image = depth_pyramid.image,
+                .subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, i, 1, 0, 1 }
+            };
+
+            vkCmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, &level_barrier);
+        }
+
+        source_extent = level_extent;
+        level_extent = { std::max((level_extent.width + 1) / 2, 1u), std::max((level_extent.height + 1) / 2, 1u) };
+    }
+}
+
+///////////////////////////////////////////////
+//////////////////// Class ////////////////////
+///////////////////////////////////////////////
+
+// Constructor.
+// Nothing is created without the occlusion culling, the pyramid then holds a null image.
+Vulkan_DepthPyramid::Vulkan_DepthPyramid
+(
+    const bool &enabled,
+    const VkPhysicalDevice &physical_device,
+    const VkDevice &logical_device,
+    const PipelineCache &pipeline_cache,
+    const std::vector<ShaderInfo> &shaders_modules,
+    const VkImageView &depth_image_view,
+    const VkExtent2D &extent,
+    const VkSampleCountFlagBits &samples_count
+) : logical_device(logical_device)
+{
+    if (enabled)
+    {
+        depth_pyramid = create_depth_pyramid(physical_device, logical_device, pipeline_cache, shaders_modules, depth_image_view, extent, samples_count);
+    }
+}
+
+// Destructor.
+Vulkan_DepthPyramid::~Vulkan_DepthPyramid()
+{
+    if (depth_pyramid.image == VK_NULL_HANDLE)
+    {
+        return;
+    }
+
+    retire_vulkan_resource([logical_device = logical_device, depth_pyramid = depth_pyramid]() mutable
+    {
+        destroy_depth_pyramid(logical_device, depth_pyramid);
+    });
+}
+
+DepthPyramid Vulkan_DepthPyramid::get() const
+{
+    return depth_pyramid;
+}
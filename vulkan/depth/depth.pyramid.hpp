@@ -0,0 +1,134 @@
+#include "../shaders/shader.modules.hpp"
+#include "../pipeline/pipeline.cache.hpp"
+
+#include <vulkan/vulkan.h>
+#include <cstdint>
+#include <vector>
+
+#ifndef VULKAN_DEPTH_PYRAMID_HPP
+#define VULKAN_DEPTH_PYRAMID_HPP
+
+// Size of the 2D workgroups reducing the depth levels (see local_size_x and local_size_y in depth.pyramid.comp).
+constexpr const uint32_t DEPTH_PYRAMID_WORKGROUP_SIZE = 8;
+
+////////////////////////////////////////////////////
+//////////////////// Structures ////////////////////
+////////////////////////////////////////////////////
+
+// Farthest depth of the depth attachment, at a resolution halved by each level.
+struct DepthPyramid
+{
+    VkImage image;                                // VK_NULL_HANDLE when the occlusion culling is disabled.
+    VkDeviceMemory image_memory;
+    VkImageView image_view;                       // All the levels, sampled by the culling shader.
+    std::vector<VkImageView> level_views;         // A single level each, written by the reduction.
+    VkSampler sampler;
+    VkExtent2D extent;                            // Size of the first level, half the depth attachment.
+    uint32_t levels_count;
+    VkImageAspectFlags depth_aspect;              // Aspects of the depth attachment format.
+    VkDescriptorSetLayout descriptor_set_layout;
+    VkPipelineLayout pipeline_layout;
+    VkPipeline first_pipeline;                    // Reduces the depth attachment, multisampled or not.
+    VkPipeline pipeline;                          // Reduces a level of the pyramid.
+    VkDescriptorPool descriptor_pool;
+    std::vector<VkDescriptorSet> descriptor_sets; // One per level.
+};
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+VkExtent2D get_depth_pyramid_extent
+(
+    const VkExtent2D &extent
+);
+
+uint32_t get_depth_pyramid_levels_count
+(
+    const VkExtent2D &pyramid_extent
+);
+
+VkImageView create_vulkan_depth_pyramid_view
+(
+    const VkDevice &logical_device,
+    const VkImage &image,
+    const uint32_t &base_level,
+    const uint32_t &levels_count
+);
+
+VkSampler create_vulkan_depth_pyramid_sampler
+(
+    const VkDevice &logical_device
+);
+
+std::vector<VkDescriptorSet> create_vulkan_depth_pyramid_descriptor_sets
+(
+    const VkDevice &logical_device,
+    const VkDescriptorSetLayout &descriptor_set_layout,
+    const VkDescriptorPool &descriptor_pool,
+    const VkImageView &depth_image_view,
+    const VkSampler &sampler,
+    const std::vector<VkImageView> &level_views
+);
+
+DepthPyramid create_depth_pyramid
+(
+    const VkPhysicalDevice &physical_device,
+    const VkDevice &logical_device,
+    const PipelineCache &pipeline_cache,
+    const std::vector<ShaderInfo> &shaders_modules,
+    const VkImageView &depth_image_view,
+    const VkExtent2D &extent,
+    const VkSampleCountFlagBits &samples_count
+);
+
+void destroy_depth_pyramid
+(
+    const VkDevice &logical_device,
+    DepthPyramid &depth_pyramid
+);
+
+void record_depth_pyramid
+(
+    const VkCommandBuffer &command_buffer,
+    const DepthPyramid &depth_pyramid,
+    const VkExtent2D &extent
+);
+
+///////////////////////////////////////////////
+//////////////////// Class ////////////////////
+///////////////////////////////////////////////
+
+class Vulkan_DepthPyramid
+{
+
+public:
+    // Constructor.
+    Vulkan_DepthPyramid
+    (
+        const bool &enabled,
+        const VkPhysicalDevice &physical_device,
+        const VkDevice &logical_device,
+        const PipelineCache &pipeline_cache,
+        const std::vector<ShaderInfo> &shaders_modules,
+        const VkImageView &depth_image_view,
+        const VkExtent2D &extent,
+        const VkSampleCountFlagBits &samples_count
+    );
+
+    // Destructor.
+    ~Vulkan_DepthPyramid();
+
+    DepthPyramid get() const;
+
+    // Prevent data duplication.
+    Vulkan_DepthPyramid(const Vulkan_DepthPyramid&) = delete;
+    Vulkan_DepthPyramid &operator = (const Vulkan_DepthPyramid&) = delete;
+
+private:
+    DepthPyramid depth_pyramid {};
+    VkDevice logical_device = VK_NULL_HANDLE;
+
+};
+
+#endif
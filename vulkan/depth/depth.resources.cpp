@@ -1,9 +1,10 @@
 #include "depth.resources.hpp"
 
 #include "depth.formats.hpp"
-#include "../images/image.transitions.hpp"
 #include "../images/image.views.handler.hpp"
 #include "../images/images.handler.hpp"
+#include "../render/sync/render.sync.deletion.hpp"
+#include "../../config/engine.config.hpp"
 #include "../../utils/tool.text.format.hpp"
 #include "../../logs/logs.handler.hpp"
 
@@ -15,12 +16,11 @@
 ///////////////////////////////////////////////////
 
 // Create all resources for the depth buffering.
+// The image isn't transitioned, the render pass clears it from an undefined layout, so it can be created while the frames are in flight.
 DepthResources create_depth_resources
 (
     const VkPhysicalDevice &physical_device,
     const VkDevice &logical_device,
-    const VkCommandPool &command_pool,
-    const VkQueue &graphics_queue,
     const VkExtent2D &extent,
     const VkSampleCountFlagBits &samples_count
 )
@@ -37,16 +37,6 @@ DepthResources create_depth_resources
         fatal_error_log("Depth resources creation failed! The logical device provided (" + force_string(logical_device) + ") is not valid!");
     }
 
-    if (command_pool == VK_NULL_HANDLE)
-    {
-        fatal_error_log("Depth resources creation failed! The command pool provided (" + force_string(command_pool) + ") is not valid!");
-    }
-
-    if (graphics_queue == VK_NULL_HANDLE)
-    {
-        fatal_error_log("Depth resources creation failed! The graphics queue provided (" + force_string(graphics_queue) + ") is not valid!");
-    }
-
     const VkFormat depth_format = find_depth_format(physical_device);
 
     const std::pair<VkImage, VkDeviceMemory> depth_image = create_image
@@ -59,11 +49,10 @@ DepthResources create_depth_resources
         samples_count,
         depth_format,
         VK_IMAGE_TILING_OPTIMAL,
-        VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT
+        EngineConfig::USE_OCCLUSION_CULLING ? VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT : VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT // The occlusion culling reads the depth to build its pyramid.
     );
 
     const VkImageView image_view = create_image_view(logical_device, depth_image.first, depth_format, VK_IMAGE_ASPECT_DEPTH_BIT, 1);
-    transition_image_layout(logical_device, command_pool, graphics_queue, depth_image.first, depth_format, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL, 1);
 
     log("Depth resources created successfully!");
     return { depth_image.first, depth_image.second, image_view };
@@ -127,19 +116,20 @@ Vulkan_DepthResources::Vulkan_DepthResources
 (
     const VkPhysicalDevice &physical_device,
     const VkDevice &logical_device,
-    const VkCommandPool &command_pool,
-    const VkQueue &graphics_queue,
     const VkExtent2D &extent,
     const VkSampleCountFlagBits &samples_count
 ) : logical_device(logical_device)
 {
-    depth_resources = create_depth_resources(physical_device, logical_device, command_pool, graphics_queue, extent, samples_count);
+    depth_resources = create_depth_resources(physical_device, logical_device, extent, samples_count);
 }
 
 // Destructor.
 Vulkan_DepthResources::~Vulkan_DepthResources()
 {
-    destroy_depth_resources(logical_device, depth_resources);
+    retire_vulkan_resource([logical_device = logical_device, depth_resources = depth_resources]() mutable
+    {
+        destroy_depth_resources(logical_device, depth_resources);
+    });
 }
 
 DepthResources Vulkan_DepthResources::get() const
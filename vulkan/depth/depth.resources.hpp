@@ -22,8 +22,6 @@ DepthResources create_depth_resources
 (
     const VkPhysicalDevice &physical_device,
     const VkDevice &logical_device,
-    const VkCommandPool &command_pool,
-    const VkQueue &graphics_queue,
     const VkExtent2D &extent,
     const VkSampleCountFlagBits &samples_count
 );
@@ -47,8 +45,6 @@ public:
     (
         const VkPhysicalDevice &physical_device,
         const VkDevice &logical_device,
-        const VkCommandPool &command_pool,
-        const VkQueue &graphics_queue,
         const VkExtent2D &extent,
         const VkSampleCountFlagBits &samples_count
     );
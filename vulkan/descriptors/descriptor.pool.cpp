@@ -1,5 +1,6 @@
 #include "descriptor.pool.hpp"
 
+#include "../render/sync/render.sync.deletion.hpp"
 #include "../../logs/logs.handler.hpp"
 #include "../../utils/tool.text.format.hpp"
 
@@ -37,11 +38,13 @@ VkDescriptorPool create_vulkan_descriptor_pool
         fatal_error_log("Descriptor pool creation failed! The texture images count provided (" + std::to_string(texture_images_count) + ") is not valid!");
     }
 
-    std::vector<VkDescriptorPoolSize> pool_sizes(2);
+    std::vector<VkDescriptorPoolSize> pool_sizes(3);
     pool_sizes[0].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;              // Descriptor pool for uniform buffers.
     pool_sizes[0].descriptorCount = static_cast<uint32_t>(images_count); // Amount of descriptors to create.
     pool_sizes[1].type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;      // Pool for an image sampler.
     pool_sizes[1].descriptorCount = static_cast<uint32_t>(images_count * texture_images_count);
+    pool_sizes[2].type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;              // Pool for the transform buffers.
+    pool_sizes[2].descriptorCount = static_cast<uint32_t>(images_count);
 
     const VkDescriptorPoolCreateInfo create_info
     {
@@ -113,7 +116,10 @@ Vulkan_DescriptorPool::Vulkan_DescriptorPool
 // Destructor.
 Vulkan_DescriptorPool::~Vulkan_DescriptorPool()
 {
-    destroy_vulkan_descriptor_pool(logical_device, descriptor_pool);
+    retire_vulkan_resource([logical_device = logical_device, descriptor_pool = descriptor_pool]() mutable
+    {
+        destroy_vulkan_descriptor_pool(logical_device, descriptor_pool);
+    });
 }
 
 VkDescriptorPool Vulkan_DescriptorPool::get() const
@@ -1,5 +1,6 @@
 #include "descriptor.set.layout.hpp"
 
+#include "../render/sync/render.sync.deletion.hpp"
 #include "../../logs/logs.handler.hpp"
 #include "../../utils/tool.text.format.hpp"
 
@@ -46,8 +47,16 @@ VkDescriptorSetLayout create_vulkan_descriptor_set_layout
         .stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT // Allow stage fragment shader stages to access to this binding.
     };
 
-    // Merge the two bindings into one vector list.
-    std::vector<VkDescriptorSetLayoutBinding> bindings = { uniform_buffer_binding, sampler_binding };
+    const VkDescriptorSetLayoutBinding transform_buffer_binding
+    {
+        .binding = 2,
+        .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, // Use this binding for the world matrices of the scene.
+        .descriptorCount = 1,
+        .stageFlags = VK_SHADER_STAGE_VERTEX_BIT
+    };
+
+    // Merge the bindings into one vector list.
+    std::vector<VkDescriptorSetLayoutBinding> bindings = { uniform_buffer_binding, sampler_binding, transform_buffer_binding };
 
     const VkDescriptorSetLayoutCreateInfo create_info
     {
@@ -117,7 +126,10 @@ Vulkan_DescriptorSetLayout::Vulkan_DescriptorSetLayout
 // Destructor.
 Vulkan_DescriptorSetLayout::~Vulkan_DescriptorSetLayout()
 {
-    destroy_vulkan_descriptor_set_layout(logical_device, descriptor_set_layout);
+    retire_vulkan_resource([logical_device = logical_device, descriptor_set_layout = descriptor_set_layout]() mutable
+    {
+        destroy_vulkan_descriptor_set_layout(logical_device, descriptor_set_layout);
+    });
 }
 
 VkDescriptorSetLayout Vulkan_DescriptorSetLayout::get() const
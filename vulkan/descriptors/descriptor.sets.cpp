@@ -9,7 +9,7 @@
 #include <cstdint>
 #include <string>
 
-// Create a descriptor set for each swap chain image.
+// Create a descriptor set for each frame in flight.
 std::vector<VkDescriptorSet> create_vulkan_descriptor_sets
 (
     const VkDevice &logical_device,
@@ -17,6 +17,7 @@ std::vector<VkDescriptorSet> create_vulkan_descriptor_sets
     const VkDescriptorSetLayout &descriptor_set_layout,
     const VkDescriptorPool &descriptor_pool,
     const std::vector<UniformBufferInfo> &uniform_buffers,
+    const std::vector<UniformBufferInfo> &transform_buffers,
     const std::vector<VkImageView> &texture_image_views,
     const VkSampler &texture_sampler
 )
@@ -48,6 +49,11 @@ std::vector<VkDescriptorSet> create_vulkan_descriptor_sets
         fatal_error_log("Descriptor sets creation failed! No uniform buffers were provided!");
     }
 
+    if (transform_buffers.size() < images_count)
+    {
+        fatal_error_log("Descriptor sets creation failed! " + std::to_string(transform_buffers.size()) + " transform buffers were provided for " + std::to_string(images_count) + " images!");
+    }
+
     if (texture_image_views.size() < 1)
     {
         fatal_error_log("Descriptor sets creation failed! No texture image views were provided!");
@@ -85,7 +91,14 @@ std::vector<VkDescriptorSet> create_vulkan_descriptor_sets
             .range = sizeof(UniformBufferObject) // Pass the size of the buffer.
         };
 
-        std::vector<VkWriteDescriptorSet> write_sets(2);
+        VkDescriptorBufferInfo transform_buffer_info
+        {
+            .buffer = transform_buffers[i].buffer,
+            .offset = 0,
+            .range = VK_WHOLE_SIZE // The shaders index the whole array of matrices.
+        };
+
+        std::vector<VkWriteDescriptorSet> write_sets(3);
         std::vector<VkDescriptorImageInfo> descriptor_image_info(texture_image_views.size());
 
         write_sets[0].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
@@ -112,6 +125,14 @@ std::vector<VkDescriptorSet> create_vulkan_descriptor_sets
         write_sets[1].descriptorCount = static_cast<uint32_t>(descriptor_image_info.size());
         write_sets[1].pImageInfo = descriptor_image_info.data();
 
+        write_sets[2].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        write_sets[2].dstSet = descriptor_sets[i];
+        write_sets[2].dstBinding = 2;
+        write_sets[2].dstArrayElement = 0;
+        write_sets[2].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER; // Descriptor for the transform buffer.
+        write_sets[2].descriptorCount = 1;
+        write_sets[2].pBufferInfo = &transform_buffer_info;
+
         vkUpdateDescriptorSets(logical_device, static_cast<uint32_t>(write_sets.size()), write_sets.data(), 0, nullptr);
         log("- Descriptor set #" + std::to_string(i + 1) + "/" + std::to_string(descriptor_sets.size()) + " created successfully!");
     }
@@ -13,6 +13,7 @@ std::vector<VkDescriptorSet> create_vulkan_descriptor_sets
     const VkDescriptorSetLayout &descriptor_set_layout,
     const VkDescriptorPool &descriptor_pool,
     const std::vector<UniformBufferInfo> &uniform_buffers,
+    const std::vector<UniformBufferInfo> &transform_buffers,
     const std::vector<VkImageView> &texture_image_views,
     const VkSampler &texture_sampler
 );
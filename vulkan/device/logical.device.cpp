@@ -6,6 +6,7 @@
 #include <vulkan/vulkan.h>
 #include <vector>
 #include <cstdint>
+#include <string>
 
 ///////////////////////////////////////////////////
 //////////////////// Functions ////////////////////
@@ -34,9 +35,100 @@ VkDevice create_logical_device
     VkPhysicalDeviceFeatures device_features { .sampleRateShading = VK_TRUE };
     vkGetPhysicalDeviceFeatures(physical_device, &device_features);
 
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(physical_device, &properties);
+
+    // The frames are synchronized with a timeline semaphore, which needs Vulkan 1.2.
+    if (properties.apiVersion < VK_API_VERSION_1_2)
+    {
+        fatal_error_log("Logical device creation failed! The physical device only supports Vulkan " + std::to_string(VK_API_VERSION_MAJOR(properties.apiVersion)) + "." + std::to_string(VK_API_VERSION_MINOR(properties.apiVersion)) + ", the timeline semaphores need Vulkan 1.2.");
+    }
+
+    // The Vulkan 1.2 and 1.3 features are enabled one by one, only the ones used by the renderer and supported by the device.
+    // The features of a Vulkan version can only be queried on the devices supporting that version, Vulkan 1.2 being checked above.
+    const bool vulkan13 = properties.apiVersion >= VK_API_VERSION_1_3;
+    VkPhysicalDeviceVulkan13Features supported_vulkan13_features { .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES };
+    VkPhysicalDeviceVulkan12Features supported_vulkan12_features
+    {
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES,
+        .pNext = vulkan13 ? &supported_vulkan13_features : nullptr
+    };
+
+    VkPhysicalDeviceFeatures2 supported_features
+    {
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2,
+        .pNext = &supported_vulkan12_features
+    };
+
+    vkGetPhysicalDeviceFeatures2(physical_device, &supported_features);
+
+    if (supported_vulkan12_features.timelineSemaphore != VK_TRUE)
+    {
+        fatal_error_log("Logical device creation failed! The physical device doesn't support the timeline semaphores the frames are synchronized with.");
+    }
+
+    VkPhysicalDeviceVulkan12Features vulkan12_features
+    {
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES,
+        .drawIndirectCount = supported_vulkan12_features.drawIndirectCount, // Read the amount of indirect draws from a buffer.
+        .hostQueryReset = supported_vulkan12_features.hostQueryReset,       // Reset the GPU timestamps from the CPU before their first use.
+        .timelineSemaphore = VK_TRUE                                        // Synchronize the frames with a GPU counter, checked above.
+    };
+
+    VkPhysicalDeviceVulkan13Features vulkan13_features
+    {
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES,
+        .dynamicRendering = supported_vulkan13_features.dynamicRendering // Draw without render pass nor framebuffer.
+    };
+
+    // The optional features are added at the end of the chain, after the last Vulkan version features.
+    void** features_end = &vulkan12_features.pNext;
+
+    if (vulkan13)
+    {
+        vulkan12_features.pNext = &vulkan13_features;
+        features_end = &vulkan13_features.pNext;
+    }
+
+    // The present wait and the present fences are optional, their features are only enabled with their extensions.
+    VkPhysicalDevicePresentWaitFeaturesKHR present_wait_features
+    {
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR,
+        .presentWait = VK_TRUE // Wait for the presentation of a given frame.
+    };
+
+    VkPhysicalDevicePresentIdFeaturesKHR present_id_features
+    {
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR,
+        .pNext = &present_wait_features,
+        .presentId = VK_TRUE // Give an id to each presented frame.
+    };
+
+    VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT swapchain_maintenance_features
+    {
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SWAPCHAIN_MAINTENANCE_1_FEATURES_EXT,
+        .swapchainMaintenance1 = VK_TRUE // Signal a fence once a present is done.
+    };
+
+    for (const char* extension : required_extensions)
+    {
+        if (std::string(extension) == VK_KHR_PRESENT_WAIT_EXTENSION_NAME)
+        {
+            *features_end = &present_id_features;
+            features_end = &present_wait_features.pNext;
+        }
+
+        if (std::string(extension) == VK_EXT_SWAPCHAIN_MAINTENANCE_1_EXTENSION_NAME)
+        {
+            *features_end = &swapchain_maintenance_features;
+            features_end = &swapchain_maintenance_features.pNext;
+        }
+    }
+
     const VkDeviceCreateInfo create_info
     {
         .sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
+        .pNext = &vulkan12_features,                                                // Pass the Vulkan 1.2 and 1.3 features to enable.
         .queueCreateInfoCount = static_cast<uint32_t>(queues_create_info.size()),   // Amount of queues to create.
         .pQueueCreateInfos = queues_create_info.data(),                             // Pass the queues create info.
         .enabledExtensionCount = static_cast<uint32_t>(required_extensions.size()), // Amount of extensions to enable.
@@ -0,0 +1,258 @@
+#include "compute.pipeline.hpp"
+
+#include "../../logs/logs.handler.hpp"
+#include "../../utils/tool.text.format.hpp"
+
+#include <vulkan/vulkan.h>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+// Create the descriptor set layout of a compute shader, with a binding per type in the shader order.
+VkDescriptorSetLayout create_vulkan_compute_descriptor_set_layout
+(
+    const VkDevice &logical_device,
+    const std::vector<VkDescriptorType> &bindings_types
+)
+{
+    log("Creating a compute descriptor set layout..");
+
+    if (logical_device == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Compute descriptor set layout creation failed! The logical device provided (" + force_string(logical_device) + ") is not valid!");
+    }
+
+    if (bindings_types.size() < 1)
+    {
+        fatal_error_log("Compute descriptor set layout creation failed! No bindings were provided!");
+    }
+
+    std::vector<VkDescriptorSetLayoutBinding> bindings(bindings_types.size());
+
+    for (uint32_t i = 0; i < bindings.size(); i++)
+    {
+        bindings[i].binding = i;                              // Binding index in the shader.
+        bindings[i].descriptorType = bindings_types[i];
+        bindings[i].descriptorCount = 1;
+        bindings[i].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT; // Only the compute shader accesses to these bindings.
+    }
+
+    const VkDescriptorSetLayoutCreateInfo create_info
+    {
+        .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
+        .bindingCount = static_cast<uint32_t>(bindings.size()), // Amount of bindings to pass.
+        .pBindings = bindings.data()                            // Pass the bindings.
+    };
+
+    VkDescriptorSetLayout descriptor_set_layout = VK_NULL_HANDLE;
+    const VkResult layout_creation = vkCreateDescriptorSetLayout(logical_device, &create_info, nullptr, &descriptor_set_layout);
+
+    if (layout_creation != VK_SUCCESS)
+    {
+        fatal_error_log("Compute descriptor set layout creation returned error code " + std::to_string(layout_creation) + ".");
+    }
+
+    if (descriptor_set_layout == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Compute descriptor set layout creation output (" + force_string(descriptor_set_layout) + ") is not valid!");
+    }
+
+    log("Compute descriptor set layout " + force_string(descriptor_set_layout) + " created successfully!");
+    return descriptor_set_layout;
+}
+
+// Create the pipeline layout of a compute shader, its small per dispatch data is passed through push constants.
+VkPipelineLayout create_vulkan_compute_pipeline_layout
+(
+    const VkDevice &logical_device,
+    const VkDescriptorSetLayout &descriptor_set_layout,
+    const uint32_t &push_constants_size
+)
+{
+    log("Creating a compute pipeline layout..");
+
+    if (logical_device == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Compute pipeline layout creation failed! The logical device provided (" + force_string(logical_device) + ") is not valid!");
+    }
+
+    if (descriptor_set_layout == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Compute pipeline layout creation failed! The descriptor set layout provided (" + force_string(descriptor_set_layout) + ") is not valid!");
+    }
+
+    const VkPushConstantRange push_constant_range
+    {
+        .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT,
+        .offset = 0,
+        .size = push_constants_size
+    };
+
+    const VkPipelineLayoutCreateInfo create_info
+    {
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
+        .setLayoutCount = 1,                                         // Amount of layouts to enable.
+        .pSetLayouts = &descriptor_set_layout,
+        .pushConstantRangeCount = push_constants_size > 0 ? 1u : 0u, // No range without push constants.
+        .pPushConstantRanges = &push_constant_range
+    };
+
+    VkPipelineLayout pipeline_layout = VK_NULL_HANDLE;
+    const VkResult layout_creation = vkCreatePipelineLayout(logical_device, &create_info, nullptr, &pipeline_layout);
+
+    if (layout_creation != VK_SUCCESS)
+    {
+        fatal_error_log("Compute pipeline layout creation returned error code " + std::to_string(layout_creation) + ".");
+    }
+
+    if (pipeline_layout == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Compute pipeline layout creation output (" + force_string(pipeline_layout) + ") is not valid!");
+    }
+
+    log("Compute pipeline layout " + force_string(pipeline_layout) + " created successfully!");
+    return pipeline_layout;
+}
+
+// Create a compute pipeline running a single shader, looked up in the pipeline cache first.
+VkPipeline create_vulkan_compute_pipeline
+(
+    const VkDevice &logical_device,
+    const PipelineCache &pipeline_cache,
+    const VkPipelineShaderStageCreateInfo &shader_stage,
+    const VkPipelineLayout &pipeline_layout
+)
+{
+    log("Creating a compute pipeline..");
+
+    if (logical_device == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Compute pipeline creation failed! The logical device provided (" + force_string(logical_device) + ") is not valid!");
+    }
+
+    if (shader_stage.module == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Compute pipeline creation failed! The shader module provided (" + force_string(shader_stage.module) + ") is not valid!");
+    }
+
+    if (pipeline_layout == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Compute pipeline creation failed! The pipeline layout provided (" + force_string(pipeline_layout) + ") is not valid!");
+    }
+
+    VkPipelineCreationFeedback feedback {};
+    const VkPipelineCreationFeedbackCreateInfo feedback_info = create_vulkan_pipeline_creation_feedback_info(feedback, nullptr);
+
+    const VkComputePipelineCreateInfo create_info
+    {
+        .sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
+        .pNext = pipeline_cache.creation_feedback ? &feedback_info : nullptr, // Tell if the pipeline was found in the cache.
+        .stage = shader_stage,                                                 // Pass the compute shader stage.
+        .layout = pipeline_layout
+    };
+
+    const auto creation_start = std::chrono::high_resolution_clock::now();
+
+    VkPipeline pipeline = VK_NULL_HANDLE;
+    const VkResult pipeline_creation = vkCreateComputePipelines(logical_device, pipeline_cache.cache, 1, &create_info, nullptr, &pipeline);
+
+    if (pipeline_creation != VK_SUCCESS)
+    {
+        fatal_error_log("Compute pipeline creation returned error code " + std::to_string(pipeline_creation) + ".");
+    }
+
+    if (pipeline == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Compute pipeline creation output (" + force_string(pipeline) + ") is not valid!");
+    }
+
+    log_pipeline_cache_lookup("Compute pipeline " + force_string(pipeline), pipeline_cache, feedback, std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - creation_start).count());
+    log("Compute pipeline " + force_string(pipeline) + " created successfully!");
+    return pipeline;
+}
+
+// Destroy a compute pipeline.
+void destroy_vulkan_compute_pipeline
+(
+    const VkDevice &logical_device,
+    VkPipeline &compute_pipeline
+)
+{
+    log("Destroying the " + force_string(compute_pipeline) + " compute pipeline..");
+
+    if (logical_device == VK_NULL_HANDLE)
+    {
+        error_log("Compute pipeline destruction failed! The logical device provided (" + force_string(logical_device) + ") is not valid!");
+        return;
+    }
+
+    if (compute_pipeline == VK_NULL_HANDLE)
+    {
+        error_log("Compute pipeline destruction failed! The compute pipeline provided (" + force_string(compute_pipeline) + ") is not valid!");
+        return;
+    }
+
+    vkDestroyPipeline(logical_device, compute_pipeline, nullptr);
+    compute_pipeline = VK_NULL_HANDLE;
+
+    log("Compute pipeline destroyed successfully!");
+}
+
+// Create a descriptor pool holding some descriptor sets of a compute shader.
+VkDescriptorPool create_vulkan_compute_descriptor_pool
+(
+    const VkDevice &logical_device,
+    const std::vector<VkDescriptorType> &bindings_types,
+    const uint32_t &sets_count
+)
+{
+    log("Creating a compute descriptor pool..");
+
+    if (logical_device == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Compute descriptor pool creation failed! The logical device provided (" + force_string(logical_device) + ") is not valid!");
+    }
+
+    if (bindings_types.size() < 1 || sets_count < 1)
+    {
+        fatal_error_log("Compute descriptor pool creation failed! The bindings count (" + std::to_string(bindings_types.size()) + ") or the sets count (" + std::to_string(sets_count) + ") provided is not valid!");
+    }
+
+    // A pool size per binding, each set holding one descriptor of every binding.
+    std::vector<VkDescriptorPoolSize> pool_sizes;
+    pool_sizes.reserve(bindings_types.size());
+
+    for (const VkDescriptorType &binding_type : bindings_types)
+    {
+        pool_sizes.push_back({ binding_type, sets_count });
+    }
+
+    const VkDescriptorPoolCreateInfo create_info
+    {
+        .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
+        .maxSets = sets_count,                                     // Maximum amount of sets to make.
+        .poolSizeCount = static_cast<uint32_t>(pool_sizes.size()), // Amount of pool sizes to pass.
+        .pPoolSizes = pool_sizes.data()                            // Pass the pool sizes.
+    };
+
+    VkDescriptorPool descriptor_pool = VK_NULL_HANDLE;
+    const VkResult pool_creation = vkCreateDescriptorPool(logical_device, &create_info, nullptr, &descriptor_pool);
+
+    if (pool_creation != VK_SUCCESS)
+    {
+        fatal_error_log("Compute descriptor pool creation returned error code " + std::to_string(pool_creation) + ".");
+    }
+
+    if (descriptor_pool == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Compute descriptor pool creation output (" + force_string(descriptor_pool) + ") is not valid!");
+    }
+
+    log("Compute descriptor pool " + force_string(descriptor_pool) + " created successfully!");
+    return descriptor_pool;
+}
@@ -0,0 +1,48 @@
+#include "pipeline.cache.hpp"
+
+#include <vulkan/vulkan.h>
+#include <cstdint>
+#include <vector>
+
+#ifndef VULKAN_COMPUTE_PIPELINE_HPP
+#define VULKAN_COMPUTE_PIPELINE_HPP
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+VkDescriptorSetLayout create_vulkan_compute_descriptor_set_layout
+(
+    const VkDevice &logical_device,
+    const std::vector<VkDescriptorType> &bindings_types
+);
+
+VkPipelineLayout create_vulkan_compute_pipeline_layout
+(
+    const VkDevice &logical_device,
+    const VkDescriptorSetLayout &descriptor_set_layout,
+    const uint32_t &push_constants_size
+);
+
+VkPipeline create_vulkan_compute_pipeline
+(
+    const VkDevice &logical_device,
+    const PipelineCache &pipeline_cache,
+    const VkPipelineShaderStageCreateInfo &shader_stage,
+    const VkPipelineLayout &pipeline_layout
+);
+
+void destroy_vulkan_compute_pipeline
+(
+    const VkDevice &logical_device,
+    VkPipeline &compute_pipeline
+);
+
+VkDescriptorPool create_vulkan_compute_descriptor_pool
+(
+    const VkDevice &logical_device,
+    const std::vector<VkDescriptorType> &bindings_types,
+    const uint32_t &sets_count
+);
+
+#endif
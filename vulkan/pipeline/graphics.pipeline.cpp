@@ -1,9 +1,11 @@
 #include "graphics.pipeline.hpp"
 
+#include "../render/sync/render.sync.deletion.hpp"
 #include "../../logs/logs.handler.hpp"
 #include "../../utils/tool.text.format.hpp"
 
 #include <vulkan/vulkan.h>
+#include <chrono>
 #include <vector>
 
 ///////////////////////////////////////////////////
@@ -11,9 +13,12 @@
 ///////////////////////////////////////////////////
 
 // Create a graphics pipeline.
+// Without render pass, the pipeline draws with the dynamic rendering into the attachments described by the rendering info.
+// The pipeline is looked up in the pipeline cache first, its shaders are only compiled when it isn't found.
 VkPipeline create_vulkan_graphics_pipeline
 (
     const VkDevice &logical_device,
+    const PipelineCache &pipeline_cache,
     const std::vector<VkPipelineShaderStageCreateInfo> &pipeline_shaders_stages,
     const VkPipelineVertexInputStateCreateInfo &vertex_input_state,
     const VkPipelineInputAssemblyStateCreateInfo &assembly_input_state,
@@ -22,6 +27,7 @@ VkPipeline create_vulkan_graphics_pipeline
     const VkPipelineMultisampleStateCreateInfo &multisampling_state,
     const VkPipelineLayout &pipeline_layout,
     const VkRenderPass &render_pass,
+    const VkPipelineRenderingCreateInfo &rendering_info,
     const VkPipelineDynamicStateCreateInfo &dynamic_state
 )
 {
@@ -42,9 +48,9 @@ VkPipeline create_vulkan_graphics_pipeline
         fatal_error_log("Graphics pipeline creation failed! The pipeline layout provided (" + force_string(pipeline_layout) + ") is not valid!");
     }
 
-    if (render_pass == VK_NULL_HANDLE)
+    if (render_pass == VK_NULL_HANDLE && rendering_info.colorAttachmentCount < 1)
     {
-        fatal_error_log("Graphics pipeline creation failed! The render pass provided (" + force_string(render_pass) + ") is not valid!");
+        fatal_error_log("Graphics pipeline creation failed! Neither a render pass nor the attachments of the dynamic rendering were provided!");
     }
 
     // Attachment for the color blend state.
@@ -73,9 +79,16 @@ VkPipeline create_vulkan_graphics_pipeline
         .stencilTestEnable = VK_FALSE
     };
 
+    // The rendering info is only read by the dynamic rendering.
+    const void* rendering_next = render_pass == VK_NULL_HANDLE ? &rendering_info : nullptr;
+
+    VkPipelineCreationFeedback feedback {};
+    const VkPipelineCreationFeedbackCreateInfo feedback_info = create_vulkan_pipeline_creation_feedback_info(feedback, rendering_next);
+
     const VkGraphicsPipelineCreateInfo pipeline_create_info
     {
         .sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+        .pNext = pipeline_cache.creation_feedback ? &feedback_info : rendering_next, // Tell if the pipeline was found in the cache.
         .stageCount = static_cast<uint32_t>(pipeline_shaders_stages.size()), // Amount of shader stages to pass.
         .pStages = pipeline_shaders_stages.data(),
         .pVertexInputState = &vertex_input_state,
@@ -90,8 +103,10 @@ VkPipeline create_vulkan_graphics_pipeline
         .renderPass = render_pass
     };
 
+    const auto creation_start = std::chrono::high_resolution_clock::now();
+
     VkPipeline graphics_pipeline = VK_NULL_HANDLE;
-    const VkResult pipeline_creation = vkCreateGraphicsPipelines(logical_device, VK_NULL_HANDLE, 1, &pipeline_create_info, nullptr, &graphics_pipeline);
+    const VkResult pipeline_creation = vkCreateGraphicsPipelines(logical_device, pipeline_cache.cache, 1, &pipeline_create_info, nullptr, &graphics_pipeline);
 
     if (pipeline_creation != VK_SUCCESS)
     {
@@ -103,6 +118,7 @@ VkPipeline create_vulkan_graphics_pipeline
         fatal_error_log("Graphics pipeline creation output \"" + force_string(graphics_pipeline) + "\" is not valid!");
     }
 
+    log_pipeline_cache_lookup("Graphics pipeline " + force_string(graphics_pipeline), pipeline_cache, feedback, std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - creation_start).count());
     log("Graphics pipeline " + force_string(graphics_pipeline) + " created successfully!");
     return graphics_pipeline;
 }
@@ -142,6 +158,7 @@ void destroy_vulkan_graphics_pipeline
 Vulkan_GraphicsPipeline::Vulkan_GraphicsPipeline
 (
     const VkDevice &logical_device,
+    const PipelineCache &pipeline_cache,
     const std::vector<VkPipelineShaderStageCreateInfo> &pipeline_shaders_stages,
     const VkPipelineVertexInputStateCreateInfo &vertex_input_state,
     const VkPipelineInputAssemblyStateCreateInfo &assembly_input_state,
@@ -150,16 +167,20 @@ Vulkan_GraphicsPipeline::Vulkan_GraphicsPipeline
     const VkPipelineMultisampleStateCreateInfo &multisampling_state,
     const VkPipelineLayout &pipeline_layout,
     const VkRenderPass &render_pass,
+    const VkPipelineRenderingCreateInfo &rendering_info,
     const VkPipelineDynamicStateCreateInfo &dynamic_state
 ) : logical_device(logical_device)
 {
-    graphics_pipeline = create_vulkan_graphics_pipeline(logical_device, pipeline_shaders_stages, vertex_input_state, assembly_input_state, viewport_state, rasterization_state, multisampling_state, pipeline_layout, render_pass, dynamic_state);
+    graphics_pipeline = create_vulkan_graphics_pipeline(logical_device, pipeline_cache, pipeline_shaders_stages, vertex_input_state, assembly_input_state, viewport_state, rasterization_state, multisampling_state, pipeline_layout, render_pass, rendering_info, dynamic_state);
 }
 
 // Destructor.
 Vulkan_GraphicsPipeline::~Vulkan_GraphicsPipeline()
 {
-    destroy_vulkan_graphics_pipeline(logical_device, graphics_pipeline);
+    retire_vulkan_resource([logical_device = logical_device, graphics_pipeline = graphics_pipeline]() mutable
+    {
+        destroy_vulkan_graphics_pipeline(logical_device, graphics_pipeline);
+    });
 }
 
 VkPipeline Vulkan_GraphicsPipeline::get() const
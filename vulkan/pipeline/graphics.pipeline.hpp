@@ -1,3 +1,5 @@
+#include "pipeline.cache.hpp"
+
 #include <vulkan/vulkan.h>
 #include <vector>
 
@@ -11,6 +13,7 @@
 VkPipeline create_vulkan_graphics_pipeline
 (
     const VkDevice &logical_device,
+    const PipelineCache &pipeline_cache,
     const std::vector<VkPipelineShaderStageCreateInfo> &pipeline_shaders_stages,
     const VkPipelineVertexInputStateCreateInfo &vertex_input_state,
     const VkPipelineInputAssemblyStateCreateInfo &assembly_input_state,
@@ -19,6 +22,7 @@ VkPipeline create_vulkan_graphics_pipeline
     const VkPipelineMultisampleStateCreateInfo &multisampling_state,
     const VkPipelineLayout &pipeline_layout,
     const VkRenderPass &render_pass,
+    const VkPipelineRenderingCreateInfo &rendering_info,
     const VkPipelineDynamicStateCreateInfo &dynamic_state
 );
 
@@ -40,6 +44,7 @@ public:
     Vulkan_GraphicsPipeline
     (
         const VkDevice &logical_device,
+        const PipelineCache &pipeline_cache,
         const std::vector<VkPipelineShaderStageCreateInfo> &pipeline_shaders_stages,
         const VkPipelineVertexInputStateCreateInfo &vertex_input_state,
         const VkPipelineInputAssemblyStateCreateInfo &assembly_input_state,
@@ -48,6 +53,7 @@ public:
         const VkPipelineMultisampleStateCreateInfo &multisampling_state,
         const VkPipelineLayout &pipeline_layout,
         const VkRenderPass &render_pass,
+        const VkPipelineRenderingCreateInfo &rendering_info,
         const VkPipelineDynamicStateCreateInfo &dynamic_state
     );
 
@@ -0,0 +1,380 @@
+#include "pipeline.cache.hpp"
+
+#include "../render/sync/render.sync.deletion.hpp"
+#include "../../logs/logs.handler.hpp"
+#include "../../utils/tool.files.hpp"
+#include "../../utils/tool.text.format.hpp"
+
+#include <vulkan/vulkan.h>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+// Hash some pipeline cache data with the 64 bits FNV-1a algorithm, to detect the corrupted files.
+uint64_t get_pipeline_cache_data_hash
+(
+    const char* data,
+    const size_t &size
+)
+{
+    uint64_t hash = 14695981039346656037ull;
+
+    for (size_t i = 0; i < size; i++)
+    {
+        hash ^= static_cast<uint8_t>(data[i]);
+        hash *= 1099511628211ull;
+    }
+
+    return hash;
+}
+
+// Read the pipeline cache data saved by a previous launch, nothing is returned when the file is missing or corrupted.
+std::vector<char> read_pipeline_cache_file
+(
+    const std::string &file_path
+)
+{
+    // The file is missing on the first launch.
+    if (!std::filesystem::exists(file_path))
+    {
+        log("No pipeline cache file \"" + file_path + "\" was found, the pipelines will be compiled from scratch.");
+        return {};
+    }
+
+    const std::vector<char> file_data = read_binary_file(file_path);
+
+    if (file_data.size() < sizeof(PipelineCacheFileHeader))
+    {
+        error_log("Warning: The pipeline cache file \"" + file_path + "\" is too small (" + std::to_string(file_data.size()) + " bytes), it is discarded.");
+        return {};
+    }
+
+    PipelineCacheFileHeader header;
+    std::memcpy(&header, file_data.data(), sizeof(PipelineCacheFileHeader));
+
+    if (header.magic != PIPELINE_CACHE_FILE_MAGIC || header.header_size != sizeof(PipelineCacheFileHeader))
+    {
+        error_log("Warning: The pipeline cache file \"" + file_path + "\" has an unknown header, it is discarded.");
+        return {};
+    }
+
+    if (header.data_size != file_data.size() - sizeof(PipelineCacheFileHeader))
+    {
+        error_log("Warning: The pipeline cache file \"" + file_path + "\" is truncated: " + std::to_string(file_data.size() - sizeof(PipelineCacheFileHeader)) + " != " + std::to_string(header.data_size) + " bytes, it is discarded.");
+        return {};
+    }
+
+    const char* data = file_data.data() + sizeof(PipelineCacheFileHeader);
+
+    if (get_pipeline_cache_data_hash(data, header.data_size) != header.data_hash)
+    {
+        error_log("Warning: The pipeline cache file \"" + file_path + "\" is corrupted, its hash doesn't match its data, it is discarded.");
+        return {};
+    }
+
+    return std::vector<char>(data, data + header.data_size);
+}
+
+// Check the header the driver wrote before the pipeline cache data.
+// The data is only valid for the device and the driver version which wrote it, the pipeline cache UUID changing with the driver.
+bool get_pipeline_cache_data_validity
+(
+    const std::vector<char> &data,
+    const VkPhysicalDevice &physical_device
+)
+{
+    if (physical_device == VK_NULL_HANDLE)
+    {
+        error_log("Failed to check the pipeline cache data! The physical device provided (" + force_string(physical_device) + ") is not valid!");
+        return false;
+    }
+
+    if (data.size() < sizeof(VkPipelineCacheHeaderVersionOne))
+    {
+        error_log("Warning: The pipeline cache data is too small for its header (" + std::to_string(data.size()) + " bytes), it is discarded.");
+        return false;
+    }
+
+    VkPipelineCacheHeaderVersionOne header;
+    std::memcpy(&header, data.data(), sizeof(VkPipelineCacheHeaderVersionOne));
+
+    if (header.headerSize < sizeof(VkPipelineCacheHeaderVersionOne) || header.headerSize > data.size())
+    {
+        error_log("Warning: The pipeline cache header size (" + std::to_string(header.headerSize) + ") is not valid, the data is discarded.");
+        return false;
+    }
+
+    if (header.headerVersion != VK_PIPELINE_CACHE_HEADER_VERSION_ONE)
+    {
+        error_log("Warning: The pipeline cache header version (" + std::to_string(header.headerVersion) + ") is not supported, the data is discarded.");
+        return false;
+    }
+
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(physical_device, &properties);
+
+    if (header.vendorID != properties.vendorID || header.deviceID != properties.deviceID)
+    {
+        error_log("Warning: The pipeline cache data was written by another device (vendor " + std::to_string(header.vendorID) + ", device " + std::to_string(header.deviceID) + "), it is discarded.");
+        return false;
+    }
+
+    if (std::memcmp(header.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE) != 0)
+    {
+        error_log("Warning: The pipeline cache data was written by another driver version, it is discarded.");
+        return false;
+    }
+
+    return true;
+}
+
+// Create the pipeline cache, filled with the data saved by the previous launch when it is still valid for this device.
+// Nothing is created when the pipeline cache is disabled, the pipelines then being compiled at each launch.
+PipelineCache create_vulkan_pipeline_cache
+(
+    const VkPhysicalDevice &physical_device,
+    const VkDevice &logical_device,
+    const std::string &file_path,
+    const bool &enabled
+)
+{
+    PipelineCache pipeline_cache {};
+    pipeline_cache.file_path = file_path;
+
+    if (!enabled)
+    {
+        return pipeline_cache;
+    }
+
+    log("Creating the pipeline cache..");
+
+    if (physical_device == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Pipeline cache creation failed! The physical device provided (" + force_string(physical_device) + ") is not valid!");
+    }
+
+    if (logical_device == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Pipeline cache creation failed! The logical device provided (" + force_string(logical_device) + ") is not valid!");
+    }
+
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(physical_device, &properties);
+    pipeline_cache.creation_feedback = properties.apiVersion >= VK_API_VERSION_1_3;
+
+    std::vector<char> data = read_pipeline_cache_file(file_path);
+
+    if (!data.empty() && !get_pipeline_cache_data_validity(data, physical_device))
+    {
+        data.clear();
+    }
+
+    VkPipelineCacheCreateInfo create_info
+    {
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,
+        .initialDataSize = data.size(), // Start empty without valid data.
+        .pInitialData = data.data()
+    };
+
+    VkResult cache_creation = vkCreatePipelineCache(logical_device, &create_info, nullptr, &pipeline_cache.cache);
+
+    // Some drivers refuse the data they can't read instead of ignoring it, the cache then starts empty.
+    if (cache_creation != VK_SUCCESS && !data.empty())
+    {
+        error_log("Warning: The pipeline cache creation with the saved data returned error code " + std::to_string(cache_creation) + ", the data is discarded.");
+
+        data.clear();
+        create_info.initialDataSize = 0;
+        create_info.pInitialData = nullptr;
+        cache_creation = vkCreatePipelineCache(logical_device, &create_info, nullptr, &pipeline_cache.cache);
+    }
+
+    if (cache_creation != VK_SUCCESS)
+    {
+        fatal_error_log("Pipeline cache creation returned error code " + std::to_string(cache_creation) + ".");
+    }
+
+    pipeline_cache.loaded_size = data.size();
+
+    log("Pipeline cache " + force_string(pipeline_cache.cache) + " created successfully with " + std::to_string(pipeline_cache.loaded_size) + " bytes loaded from \"" + file_path + "\"!");
+    return pipeline_cache;
+}
+
+// Ask the driver if a pipeline was found in the pipeline cache, and how long its creation took.
+VkPipelineCreationFeedbackCreateInfo create_vulkan_pipeline_creation_feedback_info
+(
+    VkPipelineCreationFeedback &feedback,
+    const void* next
+)
+{
+    feedback = {};
+
+    const VkPipelineCreationFeedbackCreateInfo feedback_info
+    {
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO,
+        .pNext = next,
+        .pPipelineCreationFeedback = &feedback,
+        .pipelineStageCreationFeedbackCount = 0, // Only the whole pipeline is looked up.
+        .pPipelineStageCreationFeedbacks = nullptr
+    };
+
+    return feedback_info;
+}
+
+// Log if a pipeline was found in the pipeline cache or compiled, with the time its creation took.
+// The driver measures that time itself when it gives its feedback, the CPU measured one is used otherwise.
+void log_pipeline_cache_lookup
+(
+    const std::string &pipeline_name,
+    const PipelineCache &pipeline_cache,
+    const VkPipelineCreationFeedback &feedback,
+    const int64_t &creation_time
+)
+{
+    if (pipeline_cache.cache == VK_NULL_HANDLE)
+    {
+        log(pipeline_name + " created in " + std::to_string(creation_time) + " microseconds without pipeline cache.");
+        return;
+    }
+
+    if ((feedback.flags & VK_PIPELINE_CREATION_FEEDBACK_VALID_BIT) == 0)
+    {
+        log(pipeline_name + " created in " + std::to_string(creation_time) + " microseconds, the device doesn't tell if it was found in the pipeline cache.");
+        return;
+    }
+
+    const bool hit = (feedback.flags & VK_PIPELINE_CREATION_FEEDBACK_APPLICATION_PIPELINE_CACHE_HIT_BIT) != 0;
+    const uint64_t driver_time = feedback.duration / 1000; // From nanoseconds.
+
+    log(pipeline_name + (hit ? " found in the pipeline cache (hit) in " : " compiled (pipeline cache miss) in ") + std::to_string(driver_time) + " microseconds.");
+}
+
+// Save the pipeline cache data on the disk, after the header checking its size and hash on the next launch.
+// The data is written into a temporary file first, so a crash while saving never leaves a partial file behind.
+bool save_vulkan_pipeline_cache
+(
+    const VkDevice &logical_device,
+    const PipelineCache &pipeline_cache
+)
+{
+    if (pipeline_cache.cache == VK_NULL_HANDLE)
+    {
+        return false;
+    }
+
+    if (logical_device == VK_NULL_HANDLE)
+    {
+        error_log("Failed to save the pipeline cache! The logical device provided (" + force_string(logical_device) + ") is not valid!");
+        return false;
+    }
+
+    const auto saving_start = std::chrono::high_resolution_clock::now();
+
+    size_t data_size = 0;
+    VkResult data_query = vkGetPipelineCacheData(logical_device, pipeline_cache.cache, &data_size, nullptr);
+
+    if (data_query != VK_SUCCESS || data_size < 1)
+    {
+        error_log("Failed to save the pipeline cache! Its data size query returned error code " + std::to_string(data_query) + ".");
+        return false;
+    }
+
+    std::vector<char> file_data(sizeof(PipelineCacheFileHeader) + data_size);
+    data_query = vkGetPipelineCacheData(logical_device, pipeline_cache.cache, &data_size, file_data.data() + sizeof(PipelineCacheFileHeader));
+
+    if (data_query != VK_SUCCESS)
+    {
+        error_log("Failed to save the pipeline cache! Its data query returned error code " + std::to_string(data_query) + ".");
+        return false;
+    }
+
+    file_data.resize(sizeof(PipelineCacheFileHeader) + data_size);
+
+    const PipelineCacheFileHeader header
+    {
+        .magic = PIPELINE_CACHE_FILE_MAGIC,
+        .header_size = sizeof(PipelineCacheFileHeader),
+        .data_size = data_size,
+        .data_hash = get_pipeline_cache_data_hash(file_data.data() + sizeof(PipelineCacheFileHeader), data_size)
+    };
+
+    std::memcpy(file_data.data(), &header, sizeof(PipelineCacheFileHeader));
+
+    if (!write_binary_file_atomically(pipeline_cache.file_path, file_data))
+    {
+        error_log("Failed to save the pipeline cache into \"" + pipeline_cache.file_path + "\"!");
+        return false;
+    }
+
+    const int64_t saving_time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - saving_start).count();
+    log("Pipeline cache saved into \"" + pipeline_cache.file_path + "\" in " + std::to_string(saving_time) + " microseconds: " + std::to_string(data_size) + " bytes (" + std::to_string(pipeline_cache.loaded_size) + " loaded at startup).");
+
+    return true;
+}
+
+// Destroy the pipeline cache, its data must be saved before.
+void destroy_vulkan_pipeline_cache
+(
+    const VkDevice &logical_device,
+    PipelineCache &pipeline_cache
+)
+{
+    // Nothing was created when the pipeline cache is disabled.
+    if (pipeline_cache.cache == VK_NULL_HANDLE)
+    {
+        return;
+    }
+
+    log("Destroying the " + force_string(pipeline_cache.cache) + " pipeline cache..");
+
+    if (logical_device == VK_NULL_HANDLE)
+    {
+        error_log("Pipeline cache destruction failed! The logical device provided (" + force_string(logical_device) + ") is not valid!");
+        return;
+    }
+
+    vkDestroyPipelineCache(logical_device, pipeline_cache.cache, nullptr);
+    pipeline_cache.cache = VK_NULL_HANDLE;
+
+    log("Pipeline cache destroyed successfully!");
+}
+
+///////////////////////////////////////////////
+//////////////////// Class ////////////////////
+///////////////////////////////////////////////
+
+// Constructor.
+Vulkan_PipelineCache::Vulkan_PipelineCache
+(
+    const VkPhysicalDevice &physical_device,
+    const VkDevice &logical_device,
+    const std::string &file_path,
+    const bool &enabled
+) : logical_device(logical_device)
+{
+    pipeline_cache = create_vulkan_pipeline_cache(physical_device, logical_device, file_path, enabled);
+}
+
+// Destructor.
+// The data is saved right away, while the pipelines created with the cache are all done.
+Vulkan_PipelineCache::~Vulkan_PipelineCache()
+{
+    save_vulkan_pipeline_cache(logical_device, pipeline_cache);
+
+    retire_vulkan_resource([logical_device = logical_device, pipeline_cache = pipeline_cache]() mutable
+    {
+        destroy_vulkan_pipeline_cache(logical_device, pipeline_cache);
+    });
+}
+
+PipelineCache Vulkan_PipelineCache::get() const
+{
+    return pipeline_cache;
+}
@@ -0,0 +1,122 @@
+#include <vulkan/vulkan.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#ifndef VULKAN_PIPELINE_CACHE_HPP
+#define VULKAN_PIPELINE_CACHE_HPP
+
+// Magic number starting the pipeline cache files ("OSGP").
+constexpr const uint32_t PIPELINE_CACHE_FILE_MAGIC = 0x5047534F;
+
+////////////////////////////////////////////////////
+//////////////////// Structures ////////////////////
+////////////////////////////////////////////////////
+
+// Header written before the pipeline cache data, so a truncated or corrupted file is discarded before reaching the driver.
+struct PipelineCacheFileHeader
+{
+    uint32_t magic;
+    uint32_t header_size;
+    uint64_t data_size;
+    uint64_t data_hash;   // FNV-1a hash of the pipeline cache data.
+};
+
+// Pipeline cache shared by all the pipelines, its data is saved on the disk so the next launches skip the shaders compilation.
+struct PipelineCache
+{
+    VkPipelineCache cache;    // VK_NULL_HANDLE when the pipeline cache is disabled.
+    std::string file_path;
+    bool creation_feedback;   // The Vulkan 1.3 devices tell if each pipeline was found in the cache.
+    size_t loaded_size;       // Size of the data loaded from the disk, 0 when nothing valid was found.
+};
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+uint64_t get_pipeline_cache_data_hash
+(
+    const char* data,
+    const size_t &size
+);
+
+std::vector<char> read_pipeline_cache_file
+(
+    const std::string &file_path
+);
+
+bool get_pipeline_cache_data_validity
+(
+    const std::vector<char> &data,
+    const VkPhysicalDevice &physical_device
+);
+
+PipelineCache create_vulkan_pipeline_cache
+(
+    const VkPhysicalDevice &physical_device,
+    const VkDevice &logical_device,
+    const std::string &file_path,
+    const bool &enabled
+);
+
+VkPipelineCreationFeedbackCreateInfo create_vulkan_pipeline_creation_feedback_info
+(
+    VkPipelineCreationFeedback &feedback,
+    const void* next
+);
+
+void log_pipeline_cache_lookup
+(
+    const std::string &pipeline_name,
+    const PipelineCache &pipeline_cache,
+    const VkPipelineCreationFeedback &feedback,
+    const int64_t &creation_time
+);
+
+bool save_vulkan_pipeline_cache
+(
+    const VkDevice &logical_device,
+    const PipelineCache &pipeline_cache
+);
+
+void destroy_vulkan_pipeline_cache
+(
+    const VkDevice &logical_device,
+    PipelineCache &pipeline_cache
+);
+
+///////////////////////////////////////////////
+//////////////////// Class ////////////////////
+///////////////////////////////////////////////
+
+class Vulkan_PipelineCache
+{
+
+public:
+    // Constructor.
+    Vulkan_PipelineCache
+    (
+        const VkPhysicalDevice &physical_device,
+        const VkDevice &logical_device,
+        const std::string &file_path,
+        const bool &enabled
+    );
+
+    // Destructor.
+    ~Vulkan_PipelineCache();
+
+    PipelineCache get() const;
+
+    // Prevent data duplication.
+    Vulkan_PipelineCache(const Vulkan_PipelineCache&) = delete;
+    Vulkan_PipelineCache &operator = (const Vulkan_PipelineCache&) = delete;
+
+private:
+    // We declare the members of the class to store.
+    PipelineCache pipeline_cache {};
+    VkDevice logical_device = VK_NULL_HANDLE;
+
+};
+
+#endif
@@ -1,5 +1,6 @@
 #include "pipeline.layout.hpp"
 
+#include "../render/sync/render.sync.deletion.hpp"
 #include "../../logs/logs.handler.hpp"
 #include "../../utils/tool.text.format.hpp"
 
@@ -28,21 +29,12 @@ VkPipelineLayout create_vulkan_pipeline_layout
         fatal_error_log("Pipeline layout creation failed! The descriptor set layout provided (" + force_string(descriptor_set_layout) + ") is not valid!");
     }
 
-    // Push constant range for texture selection.
-    const VkPushConstantRange push_constant_range
-    {
-        .stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT,
-        .offset = 0,
-        .size = sizeof(int)
-    };
-
     const VkPipelineLayoutCreateInfo create_info
     {
         .sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
         .setLayoutCount = 1,         // Amount of layouts to enable.
         .pSetLayouts = &descriptor_set_layout,
-        .pushConstantRangeCount = 1, // Amount of constant range to pass.
-        .pPushConstantRanges = &push_constant_range
+        .pushConstantRangeCount = 0  // The transform and the texture of each object come from the instance buffer.
     };
 
     VkPipelineLayout pipeline_layout = VK_NULL_HANDLE;
@@ -106,7 +98,10 @@ Vulkan_PipelineLayout::Vulkan_PipelineLayout
 // Destructor.
 Vulkan_PipelineLayout::~Vulkan_PipelineLayout()
 {
-    destroy_vulkan_pipeline_layout(logical_device, pipeline_layout);
+    retire_vulkan_resource([logical_device = logical_device, pipeline_layout = pipeline_layout]() mutable
+    {
+        destroy_vulkan_pipeline_layout(logical_device, pipeline_layout);
+    });
 }
 
 VkPipelineLayout Vulkan_PipelineLayout::get() const
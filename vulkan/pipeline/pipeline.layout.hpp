@@ -1,4 +1,5 @@
 #include <vulkan/vulkan.h>
+#include <cstdint>
 
 #ifndef VULKAN_PIPELINE_LAYOUT_HPP
 #define VULKAN_PIPELINE_LAYOUT_HPP
@@ -3,26 +3,48 @@
 #include "../commands/command.buffer.recorder.hpp"
 #include "../uniform/uniform.buffer.update.hpp"
 #include "../uniform/uniform.buffers.hpp"
+#include "../uniform/uniform.camera.hpp"
+#include "../../scene/scene.hierarchy.hpp"
+#include "render.statistics.hpp"
+#include "render.batches.hpp"
+#include "render.indirect.hpp"
+#include "render.culling.hpp"
+#include "../depth/depth.pyramid.hpp"
+#include "../commands/command.buffer.secondary.hpp"
+#include "sync/render.sync.timeline.hpp"
+#include "sync/render.sync.present.hpp"
+#include "render.latency.hpp"
+#include "render.timestamps.hpp"
+#include "render.capture.hpp"
+#include "render.dynamic.hpp"
 #include "../../logs/logs.handler.hpp"
 #include "../../utils/tool.text.format.hpp"
 
 #include <vulkan/vulkan.h>
 #include <unistd.h>
+#include <algorithm>
 #include <vector>
 #include <string>
 
 // Render, draw and present a frame.
+// Without a swap chain (headless mode), the frame is rendered into the offscreen image of its frame in flight and isn't presented.
+// A suboptimal swap chain still draws and presents the image it gave, its semaphore being signaled, then asks for the recreation.
 std::string draw_frame
 (
     const VkDevice &logical_device,
-    const std::vector<VkFence> &fences,
+    const VkSemaphore &timeline_semaphore,
+    uint64_t &timeline_value,
+    std::vector<uint64_t> &frames_timeline_values,
     const VkSwapchainKHR &swapchain,
     const std::vector<VkSemaphore> &image_available_semaphores,
     const std::vector<VkSemaphore> &render_finished_semaphores,
     const std::vector<VkCommandBuffer> &command_buffers,
+    const SecondaryCommandBuffers &secondary_command_buffers,
     const VkExtent2D &extent,
     const std::vector<VkFramebuffer> &framebuffers,
     const VkRenderPass &render_pass,
+    const VkRenderPass &late_render_pass,
+    const DynamicRenderingAttachments &dynamic_rendering,
     const VkPipeline &graphics_pipeline,
     const VkViewport &viewport,
     const VkRect2D &scissor,
@@ -32,10 +54,28 @@ std::string draw_frame
     const VkBuffer &vertex_buffer,
     const VkBuffer &index_buffer,
     const std::vector<UniformBufferInfo> &uniform_buffers,
+    const std::vector<UniformBufferInfo> &transform_buffers,
+    const std::vector<UniformBufferInfo> &instance_buffers,
+    const std::vector<UniformBufferInfo> &indirect_buffers,
+    TransformHierarchy &hierarchy,
     const VkPipelineLayout &pipeline_layout,
     const std::vector<VkDescriptorSet> descriptor_sets,
     const std::vector<VkImageView> texture_image_views,
-    std::vector<uint32_t> indices
+    const std::vector<MeshRange> &meshes,
+    const std::vector<RenderObject> &objects,
+    const std::vector<uint32_t> &visible_objects,
+    std::vector<DrawBatch> &batches,
+    std::vector<VkDrawIndexedIndirectCommand> &draw_commands,
+    std::vector<IndirectDrawRun> &draw_runs,
+    const IndirectDrawSupport &indirect_support,
+    const GpuCullingResources &culling,
+    const DepthPyramid &depth_pyramid,
+    const VkImage &depth_image,
+    const CameraData &camera,
+    const FrameCaptureTarget &capture,
+    const GpuTimestamps &timestamps,
+    DrawStatistics &statistics,
+    LatencyGovernor &latency
 )
 {
     if (logical_device == VK_NULL_HANDLE)
@@ -44,15 +84,9 @@ std::string draw_frame
         return "failed";
     }
 
-    if (fences.size() < 1)
+    if (timeline_semaphore == VK_NULL_HANDLE)
     {
-        error_log("Failed to draw a frame! No fences were provided!");
-        return "failed";
-    }
-
-    if (swapchain == VK_NULL_HANDLE)
-    {
-        error_log("Failed to draw a frame! The swap chain provided (" + force_string(swapchain) + ") is not valid!");
+        error_log("Failed to draw a frame! The timeline semaphore provided (" + force_string(timeline_semaphore) + ") is not valid!");
         return "failed";
     }
 
@@ -74,13 +108,16 @@ std::string draw_frame
         return "failed";
     }
 
-    if (framebuffers.size() < 1)
+    // The dynamic rendering draws without framebuffers nor render pass.
+    const bool dynamic = !dynamic_rendering.images.empty();
+
+    if (!dynamic && framebuffers.size() < 1)
     {
         error_log("Failed to draw a frame! No frame buffers were provided!");
         return "failed";
     }
 
-    if (render_pass == VK_NULL_HANDLE)
+    if (!dynamic && render_pass == VK_NULL_HANDLE)
     {
         error_log("Failed to draw a frame! The render pass provided (" + force_string(render_pass) + ") is not valid!");
         return "failed";
@@ -104,9 +141,9 @@ std::string draw_frame
         return "failed";
     }
 
-    if (frame >= fences.size())
+    if (frame >= frames_timeline_values.size())
     {
-        error_log("Failed to draw a frame! The frame index is out of bounds for the fences: " + std::to_string(frame) + " >= " + std::to_string(fences.size()) + ".");
+        error_log("Failed to draw a frame! The frame index is out of bounds for the timeline values: " + std::to_string(frame) + " >= " + std::to_string(frames_timeline_values.size()) + ".");
         return "failed";
     }
 
@@ -140,6 +177,30 @@ std::string draw_frame
         return "failed";
     }
 
+    if (frame >= transform_buffers.size())
+    {
+        error_log("Failed to draw a frame! The frame index is out of bounds for the transform buffers: " + std::to_string(frame) + " >= " + std::to_string(transform_buffers.size()) + ".");
+        return "failed";
+    }
+
+    if (frame >= instance_buffers.size())
+    {
+        error_log("Failed to draw a frame! The frame index is out of bounds for the instance buffers: " + std::to_string(frame) + " >= " + std::to_string(instance_buffers.size()) + ".");
+        return "failed";
+    }
+
+    if (frame >= indirect_buffers.size())
+    {
+        error_log("Failed to draw a frame! The frame index is out of bounds for the indirect buffers: " + std::to_string(frame) + " >= " + std::to_string(indirect_buffers.size()) + ".");
+        return "failed";
+    }
+
+    if (culling.pipeline != VK_NULL_HANDLE && frame >= culling.frame_buffers.size())
+    {
+        error_log("Failed to draw a frame! The frame index is out of bounds for the culling frame buffers: " + std::to_string(frame) + " >= " + std::to_string(culling.frame_buffers.size()) + ".");
+        return "failed";
+    }
+
     if (pipeline_layout == VK_NULL_HANDLE)
     {
         error_log("Failed to draw a frame! The pipeline layout provided (" + force_string(pipeline_layout) + ") is not valid!");
@@ -158,29 +219,35 @@ std::string draw_frame
         return "failed";
     }
 
-    // Wait for the fence to be available.
-    vkWaitForFences(logical_device, 1, &fences[frame], VK_TRUE, UINT64_MAX);
-
-    // Try to acquire the next image to display on screen.
-    uint32_t image_index;
-    VkResult acquire_image = vkAcquireNextImageKHR(logical_device, swapchain, UINT64_MAX, image_available_semaphores[frame], VK_NULL_HANDLE, &image_index);
-
-    if (acquire_image == VK_ERROR_OUT_OF_DATE_KHR)
+    // Wait for the GPU to be done with the last submit of this frame, its resources can then be written again.
+    if (!wait_vulkan_timeline_value(logical_device, timeline_semaphore, frames_timeline_values[frame]))
     {
-        error_log("Failed to draw a frame! The swap chain is outdated.");
-        return "recreate";
+        return "failed";
     }
 
-    if (acquire_image == VK_SUBOPTIMAL_KHR)
-    {
-        error_log("Failed to draw a frame! The swap chain is suboptimal.");
-        return "recreate";
-    }
+    // The offscreen images follow the frames in flight, the wait above made sure the image of this frame is free.
+    const bool headless = swapchain == VK_NULL_HANDLE;
+    uint32_t image_index = static_cast<uint32_t>(frame);
+    bool suboptimal = false;
 
-    if (acquire_image != VK_SUCCESS)
+    // Try to acquire the next image to display on screen.
+    if (!headless)
     {
-        error_log("Failed to draw a frame! Next image acquirement returned error code " + std::to_string(acquire_image) + ".");
-        return "failed";
+        VkResult acquire_image = vkAcquireNextImageKHR(logical_device, swapchain, UINT64_MAX, image_available_semaphores[frame], VK_NULL_HANDLE, &image_index);
+
+        if (acquire_image == VK_ERROR_OUT_OF_DATE_KHR)
+        {
+            error_log("Failed to draw a frame! The swap chain is outdated.");
+            return "recreate";
+        }
+
+        suboptimal = acquire_image == VK_SUBOPTIMAL_KHR;
+
+        if (acquire_image != VK_SUCCESS && !suboptimal)
+        {
+            error_log("Failed to draw a frame! Next image acquirement returned error code " + std::to_string(acquire_image) + ".");
+            return "failed";
+        }
     }
 
     if (image_index >= render_finished_semaphores.size())
@@ -189,31 +256,81 @@ std::string draw_frame
         return "failed";
     }
 
-    vkResetFences(logical_device, 1, &fences[frame]); // Reset the fence.
-    vkResetCommandBuffer(command_buffers[frame], 0);  // Reset the command buffer.
+    vkResetCommandBuffer(command_buffers[frame], 0); // Reset the command buffer.
+    reset_vulkan_secondary_command_buffers(logical_device, secondary_command_buffers, frame); // Reset the draws recorded by the job threads.
+
+    statistics = {};
+    statistics.gpu_time = read_gpu_frame_time(logical_device, timestamps, frame); // The last frame drawn with this frame in flight is done.
+    uint32_t culling_objects_count = 0;
+
+    if (culling.pipeline != VK_NULL_HANDLE)
+    {
+        // The buffers of this frame still hold the draws and the occluded objects counted by the GPU when they were last used.
+        read_gpu_culling_statistics(culling.frame_buffers[frame].data, indirect_buffers[frame].data, statistics);
+
+        // Hand all the objects to the culling shader, it fills the empty draws and the instance buffer of this frame.
+        // The objects follow the frame header, which is rewritten once the draws are known.
+        GpuCullFrame* culling_frame = static_cast<GpuCullFrame*>(culling.frame_buffers[frame].data);
+        GpuCullObject* culling_objects = reinterpret_cast<GpuCullObject*>(culling_frame + 1);
+
+        culling_objects_count = write_gpu_culling_objects(objects, meshes, texture_image_views.size(), culling.occlusion, culling_objects, draw_commands, draw_runs, statistics);
+        upload_indirect_draws(draw_commands, draw_runs, indirect_buffers[frame].data);
+
+        const uint32_t late_commands = culling.occlusion ? static_cast<uint32_t>(draw_commands.size() / 2) : 0;
+        culling_frame->parameters = get_gpu_culling_parameters(camera, extent, culling_objects_count, late_commands, depth_pyramid);
+        culling_frame->occluded_objects = 0;
+
+        statistics.culled_objects = culling_objects_count - std::min(culling_objects_count, statistics.visible_objects + statistics.occluded_objects);
+    }
+    else
+    {
+        // Group the visible objects into draws, their instances go to the instance buffer of this frame.
+        build_draw_batches(objects, visible_objects, meshes, camera, extent, texture_image_views.size(), static_cast<InstanceData*>(instance_buffers[frame].data), batches, statistics);
+
+        // Turn the batches into a flat list of draws, read from the indirect buffer of this frame.
+        write_indirect_draws(batches, objects, meshes, camera, extent, draw_commands, draw_runs, statistics);
+        upload_indirect_draws(draw_commands, draw_runs, indirect_buffers[frame].data);
+    }
 
     // Record the command buffer state.
-    record_command_buffer(command_buffers[frame], image_index, extent, framebuffers, render_pass, graphics_pipeline, viewport, scissor, vertex_buffer, index_buffer, frame, pipeline_layout, descriptor_sets, texture_image_views, indices);
-    update_uniform_buffer(frame, extent, uniform_buffers[frame].data); // Update the uniform buffer data.
+    record_command_buffer(command_buffers[frame], secondary_command_buffers, image_index, extent, framebuffers, render_pass, late_render_pass, dynamic_rendering, graphics_pipeline, viewport, scissor, vertex_buffer, index_buffer, instance_buffers[frame].buffer, indirect_buffers[frame].buffer, frame, pipeline_layout, descriptor_sets, texture_image_views, draw_commands, draw_runs, indirect_support, culling, culling_objects_count, depth_pyramid, depth_image, capture, timestamps, statistics);
+    update_uniform_buffer(frame, extent, camera, uniform_buffers[frame].data); // Update the uniform buffer data.
+    update_transform_buffer(frame, hierarchy, transform_buffers[frame].data);  // Write the world matrices changed since this frame was last drawn.
+
+    // The frame signals the next value of the timeline, the binary semaphore is left for the presentation.
+    // In headless mode, nothing waits for an image or presents it, so only the timeline is left.
+    const uint64_t signal_value = timeline_value + 1;
+
+    const VkSemaphore wait_semaphores[] = { image_available_semaphores[frame] };                             // Semaphores to wait on, before we start the command buffer execution.
+    const VkPipelineStageFlags wait_stages[] = { VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT };            // Define at what stage in the rendering process, we start to wait.
+    const VkSemaphore signal_semaphores[] = { render_finished_semaphores[image_index], timeline_semaphore }; // Semaphores to signal after the rendering has finished.
+    const uint64_t wait_values[] = { 0 };                                                                    // Binary semaphores ignore their value.
+    const uint64_t signal_values[] = { 0, signal_value };                                                    // Signal the binary semaphore, then the timeline value of this frame.
 
-    const VkSemaphore wait_semaphores[] = { image_available_semaphores[frame] };                  // Semaphores to wait on, before we start the command buffer execution.
-    const VkPipelineStageFlags wait_stages[] = { VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT }; // Define at what stage in the rendering process, we start to wait.
-    const VkSemaphore signal_semaphores[] = { render_finished_semaphores[image_index] };          // Semaphores to signal after the rendering has finished.
+    const VkTimelineSemaphoreSubmitInfo timeline_info
+    {
+        .sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO,
+        .waitSemaphoreValueCount = headless ? 0u : 1u,                         // Amount of wait values to pass.
+        .pWaitSemaphoreValues = wait_values,                                   // Pass the wait values.
+        .signalSemaphoreValueCount = headless ? 1u : 2u,                       // Amount of signal values to pass.
+        .pSignalSemaphoreValues = headless ? &signal_values[1] : signal_values // Pass the signal values.
+    };
 
     VkSubmitInfo submit_info
     {
         .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
-        .waitSemaphoreCount = 1,                    // Amount of wait semaphores to pass.
-        .pWaitSemaphores = wait_semaphores,         // Pass the wait semaphores.
-        .pWaitDstStageMask = wait_stages,           // Pass the wait stages.
-        .commandBufferCount = 1,                    // Amount of command buffer to pass.
-        .pCommandBuffers = &command_buffers[frame], // Pass the command buffer.
-        .signalSemaphoreCount = 1,                  // Amount of signal semaphores to pass.
-        .pSignalSemaphores = signal_semaphores      // Pass the signal semaphores.
+        .pNext = &timeline_info,                                                  // Pass the timeline values.
+        .waitSemaphoreCount = headless ? 0u : 1u,                                 // Amount of wait semaphores to pass.
+        .pWaitSemaphores = wait_semaphores,                                       // Pass the wait semaphores.
+        .pWaitDstStageMask = wait_stages,                                         // Pass the wait stages.
+        .commandBufferCount = 1,                                                  // Amount of command buffer to pass.
+        .pCommandBuffers = &command_buffers[frame],                               // Pass the command buffer.
+        .signalSemaphoreCount = headless ? 1u : 2u,                               // Amount of signal semaphores to pass.
+        .pSignalSemaphores = headless ? &signal_semaphores[1] : signal_semaphores // Pass the signal semaphores.
     };
 
     // Try to submit the frame to the graphics queue.
-    const VkResult queue_submit = vkQueueSubmit(graphics_queue, 1, &submit_info, fences[frame]);
+    const VkResult queue_submit = vkQueueSubmit(graphics_queue, 1, &submit_info, VK_NULL_HANDLE);
 
     if (queue_submit != VK_SUCCESS)
     {
@@ -221,29 +338,73 @@ std::string draw_frame
         return "failed";
     }
 
+    // Only the submitted frames move the timeline, so no wait targets a value which is never signaled.
+    timeline_value = signal_value;
+    frames_timeline_values[frame] = signal_value;
+    end_low_latency_frame(latency, signal_value);
+
+    if (headless)
+    {
+        return "success";
+    }
+
+    // Give an id to the presented frame, so the next frame can wait for it to be displayed.
+    const uint64_t present_id = latency.present_id + 1;
+
+    const VkPresentIdKHR present_id_info
+    {
+        .sType = VK_STRUCTURE_TYPE_PRESENT_ID_KHR,
+        .swapchainCount = 1,       // Amount of swap chains to pass.
+        .pPresentIds = &present_id // Pass the id of the frame.
+    };
+
+    // Signal a fence once the present is done, so a replaced swap chain and its semaphores are destroyed once its presents are.
+    const VkFence present_fence = acquire_vulkan_present_fence(logical_device, frame);
+
+    const VkSwapchainPresentFenceInfoEXT present_fence_info
+    {
+        .sType = VK_STRUCTURE_TYPE_SWAPCHAIN_PRESENT_FENCE_INFO_EXT,
+        .pNext = latency.wait_for_present != nullptr ? &present_id_info : nullptr, // Pass the frame id when the present wait is used.
+        .swapchainCount = 1,                                                       // Amount of swap chains to pass.
+        .pFences = &present_fence                                                  // Pass the fence of the present.
+    };
+
     VkPresentInfoKHR present_info
     {
         .sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR,
-        .waitSemaphoreCount = 1,              // Amount of wait semaphores to pass.
-        .pWaitSemaphores = signal_semaphores, // Pass the signal semaphores as wait semaphores.
-        .swapchainCount = 1,                  // Amount of swap chains to pass.
-        .pSwapchains = &swapchain,            // Pass the swap chain.
-        .pImageIndices = &image_index         // Pass the index of the image to present.
+        .pNext = present_fence != VK_NULL_HANDLE ? &present_fence_info : present_fence_info.pNext, // Pass the present fence when the device supports it.
+        .waitSemaphoreCount = 1,                                                                   // Amount of wait semaphores to pass.
+        .pWaitSemaphores = &render_finished_semaphores[image_index],                               // Wait for the rendering to finish.
+        .swapchainCount = 1,                                                                       // Amount of swap chains to pass.
+        .pSwapchains = &swapchain,                                                                 // Pass the swap chain.
+        .pImageIndices = &image_index                                                              // Pass the index of the image to present.
     };
 
     const VkResult present_result = vkQueuePresentKHR(present_queue, &present_info);
 
+    if (present_result == VK_SUCCESS || present_result == VK_SUBOPTIMAL_KHR)
+    {
+        latency.present_id = present_id;
+    }
+
     if (present_result == VK_ERROR_OUT_OF_DATE_KHR)
     {
         error_log("Failed to draw a frame! The swap chain is outdated.");
         return "recreate";
     }
 
-    if (present_result != VK_SUCCESS)
+    if (present_result != VK_SUCCESS && present_result != VK_SUBOPTIMAL_KHR)
     {
         error_log("Failed to draw a frame! Frame presentation returned error code " + std::to_string(present_result) + ".");
         return "failed";
     }
 
+    // The frame was drawn, but the next ones need a new swap chain.
+    if (suboptimal || present_result == VK_SUBOPTIMAL_KHR)
+    {
+        log("The swap chain is suboptimal, it is recreated after this frame.");
+        return "recreate";
+    }
+
     return "success";
 }
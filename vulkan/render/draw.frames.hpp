@@ -1,4 +1,17 @@
 #include "../uniform/uniform.buffers.hpp"
+#include "../vertex/models/models.geometry.hpp"
+#include "../uniform/uniform.camera.hpp"
+#include "../../scene/scene.hierarchy.hpp"
+#include "render.statistics.hpp"
+#include "render.batches.hpp"
+#include "render.indirect.hpp"
+#include "render.culling.hpp"
+#include "../depth/depth.pyramid.hpp"
+#include "../commands/command.buffer.secondary.hpp"
+#include "render.latency.hpp"
+#include "render.timestamps.hpp"
+#include "render.capture.hpp"
+#include "render.dynamic.hpp"
 
 #include <vulkan/vulkan.h>
 #include <vector>
@@ -10,14 +23,19 @@
 std::string draw_frame
 (
     const VkDevice &logical_device,
-    const std::vector<VkFence> &fences,
+    const VkSemaphore &timeline_semaphore,
+    uint64_t &timeline_value,
+    std::vector<uint64_t> &frames_timeline_values,
     const VkSwapchainKHR &swapchain,
     const std::vector<VkSemaphore> &image_available_semaphores,
     const std::vector<VkSemaphore> &render_finished_semaphores,
     const std::vector<VkCommandBuffer> &command_buffers,
+    const SecondaryCommandBuffers &secondary_command_buffers,
     const VkExtent2D &extent,
     const std::vector<VkFramebuffer> &framebuffers,
     const VkRenderPass &render_pass,
+    const VkRenderPass &late_render_pass,
+    const DynamicRenderingAttachments &dynamic_rendering,
     const VkPipeline &graphics_pipeline,
     const VkViewport &viewport,
     const VkRect2D &scissor,
@@ -27,10 +45,28 @@ std::string draw_frame
     const VkBuffer &vertex_buffer,
     const VkBuffer &index_buffer,
     const std::vector<UniformBufferInfo> &uniform_buffers,
+    const std::vector<UniformBufferInfo> &transform_buffers,
+    const std::vector<UniformBufferInfo> &instance_buffers,
+    const std::vector<UniformBufferInfo> &indirect_buffers,
+    TransformHierarchy &hierarchy,
     const VkPipelineLayout &pipeline_layout,
     const std::vector<VkDescriptorSet> descriptor_sets,
     const std::vector<VkImageView> texture_image_views,
-    std::vector<uint32_t> indices
+    const std::vector<MeshRange> &meshes,
+    const std::vector<RenderObject> &objects,
+    const std::vector<uint32_t> &visible_objects,
+    std::vector<DrawBatch> &batches,
+    std::vector<VkDrawIndexedIndirectCommand> &draw_commands,
+    std::vector<IndirectDrawRun> &draw_runs,
+    const IndirectDrawSupport &indirect_support,
+    const GpuCullingResources &culling,
+    const DepthPyramid &depth_pyramid,
+    const VkImage &depth_image,
+    const CameraData &camera,
+    const FrameCaptureTarget &capture,
+    const GpuTimestamps &timestamps,
+    DrawStatistics &statistics,
+    LatencyGovernor &latency
 );
 
 #endif
@@ -0,0 +1,151 @@
+#include "render.graph.cache.hpp"
+
+#include "render.graph.hpp"
+#include "render.graph.transients.hpp"
+#include "../sync/render.sync.deletion.hpp"
+#include "../../../config/engine.config.hpp"
+#include "../../../logs/logs.handler.hpp"
+
+#include <vulkan/vulkan.h>
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+// The frames are only recorded on the main thread.
+VkPhysicalDevice render_graph_physical_device = VK_NULL_HANDLE;
+VkDevice render_graph_logical_device = VK_NULL_HANDLE;
+std::map<uint64_t, CachedRenderGraph> cached_render_graphs; // Per frame shape, the frames of a shape adding the same passes and accesses to their graph.
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+// Return true if two transient images are created the same way, so the image created for the first one can serve the second one.
+bool is_same_render_graph_image
+(
+    const VkImageCreateInfo &first_info,
+    const VkImageCreateInfo &second_info
+)
+{
+    return first_info.flags == second_info.flags
+        && first_info.imageType == second_info.imageType
+        && first_info.format == second_info.format
+        && first_info.extent.width == second_info.extent.width
+        && first_info.extent.height == second_info.extent.height
+        && first_info.extent.depth == second_info.extent.depth
+        && first_info.mipLevels == second_info.mipLevels
+        && first_info.arrayLayers == second_info.arrayLayers
+        && first_info.samples == second_info.samples
+        && first_info.tiling == second_info.tiling
+        && first_info.usage == second_info.usage;
+}
+
+// Start caching the compiled graphs, their transient images being created on the given device.
+void start_vulkan_render_graph_cache
+(
+    const VkPhysicalDevice &physical_device,
+    const VkDevice &logical_device
+)
+{
+    if (render_graph_logical_device != VK_NULL_HANDLE)
+    {
+        error_log("Failed to start the render graph cache! It is already started.");
+        return;
+    }
+
+    render_graph_physical_device = physical_device;
+    render_graph_logical_device = logical_device;
+}
+
+// Retire the transient images of the cached graphs, then forget the graphs.
+void stop_vulkan_render_graph_cache()
+{
+    for (std::pair<const uint64_t, CachedRenderGraph> &cached_graph : cached_render_graphs)
+    {
+        retire_vulkan_resource([logical_device = render_graph_logical_device, transients = cached_graph.second.transients]() mutable
+        {
+            destroy_vulkan_render_graph_transients(logical_device, transients);
+        });
+    }
+
+    cached_render_graphs.clear();
+    render_graph_physical_device = VK_NULL_HANDLE;
+    render_graph_logical_device = VK_NULL_HANDLE;
+}
+
+// Give the compiled graph of a frame shape, and bind its transient images to the graph of the frame.
+// - The graph is only compiled the first time its shape is recorded, and only the first one is dumped.
+// - The transient images are created again when the graph asks for other ones, the replaced ones being retired.
+// Note: the caller gives the shape, the graphs of the same shape must add the same passes and accesses.
+const CachedRenderGraph &get_cached_render_graph
+(
+    const uint64_t &shape,
+    RenderGraph &graph
+)
+{
+    std::map<uint64_t, CachedRenderGraph>::iterator cached_graph = cached_render_graphs.find(shape);
+
+    if (cached_graph == cached_render_graphs.end())
+    {
+        cached_graph = cached_render_graphs.emplace(shape, CachedRenderGraph {}).first;
+        cached_graph->second.compiled_graph = compile_render_graph(graph);
+
+        if (EngineConfig::DUMP_RENDER_GRAPH && cached_render_graphs.size() == 1)
+        {
+            log(dump_render_graph(graph, cached_graph->second.compiled_graph));
+        }
+    }
+
+    CachedRenderGraph &cached = cached_graph->second;
+    std::vector<VkImageCreateInfo> transients_infos;
+
+    for (const RenderGraphResource &resource : graph.resources)
+    {
+        if (resource.transient)
+        {
+            transients_infos.emplace_back(resource.create_info);
+        }
+    }
+
+    bool same_transients = transients_infos.size() == cached.transients_infos.size();
+
+    for (size_t i = 0; same_transients && i < transients_infos.size(); i++)
+    {
+        same_transients = is_same_render_graph_image(transients_infos[i], cached.transients_infos[i]);
+    }
+
+    if (!same_transients)
+    {
+        retire_vulkan_resource([logical_device = render_graph_logical_device, transients = cached.transients]() mutable
+        {
+            destroy_vulkan_render_graph_transients(logical_device, transients);
+        });
+
+        cached.transients = create_vulkan_render_graph_transients(render_graph_physical_device, render_graph_logical_device, graph, cached.compiled_graph);
+        cached.transients_infos = transients_infos;
+    }
+
+    bind_render_graph_transients(graph, cached.transients);
+    return cached;
+}
+
+///////////////////////////////////////////////
+//////////////////// Class ////////////////////
+///////////////////////////////////////////////
+
+// Constructor.
+Vulkan_RenderGraphCache::Vulkan_RenderGraphCache
+(
+    const VkPhysicalDevice &physical_device,
+    const VkDevice &logical_device
+)
+{
+    start_vulkan_render_graph_cache(physical_device, logical_device);
+}
+
+// Destructor.
+Vulkan_RenderGraphCache::~Vulkan_RenderGraphCache()
+{
+    stop_vulkan_render_graph_cache();
+}
@@ -0,0 +1,74 @@
+#include "render.graph.hpp"
+#include "render.graph.transients.hpp"
+
+#include <vulkan/vulkan.h>
+#include <cstdint>
+#include <vector>
+
+#ifndef VULKAN_RENDER_GRAPH_CACHE_HPP
+#define VULKAN_RENDER_GRAPH_CACHE_HPP
+
+////////////////////////////////////////////////////
+//////////////////// Structures ////////////////////
+////////////////////////////////////////////////////
+
+// Graph compiled for a frame shape, with the transient images created for it.
+// The compiled graph doesn't hold the imported images, so it serves every swap chain image and stays valid when the swap chain is recreated.
+struct CachedRenderGraph
+{
+    CompiledRenderGraph compiled_graph;
+    RenderGraphTransients transients;
+    std::vector<VkImageCreateInfo> transients_infos; // The transient images are created again when they change, like on a resize.
+};
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+bool is_same_render_graph_image
+(
+    const VkImageCreateInfo &first_info,
+    const VkImageCreateInfo &second_info
+);
+
+void start_vulkan_render_graph_cache
+(
+    const VkPhysicalDevice &physical_device,
+    const VkDevice &logical_device
+);
+
+void stop_vulkan_render_graph_cache();
+
+const CachedRenderGraph &get_cached_render_graph
+(
+    const uint64_t &shape,
+    RenderGraph &graph
+);
+
+///////////////////////////////////////////////
+//////////////////// Class ////////////////////
+///////////////////////////////////////////////
+
+// Keep the compiled graphs and their transient images while it exists, the transient images are retired with it.
+// Note: it must be destroyed before the deletion queue, as the transient images are then handed to that queue.
+class Vulkan_RenderGraphCache
+{
+
+public:
+    // Constructor.
+    Vulkan_RenderGraphCache
+    (
+        const VkPhysicalDevice &physical_device,
+        const VkDevice &logical_device
+    );
+
+    // Destructor.
+    ~Vulkan_RenderGraphCache();
+
+    // Prevent data duplication.
+    Vulkan_RenderGraphCache(const Vulkan_RenderGraphCache&) = delete;
+    Vulkan_RenderGraphCache &operator = (const Vulkan_RenderGraphCache&) = delete;
+
+};
+
+#endif
@@ -0,0 +1,675 @@
+#include "render.graph.hpp"
+
+#include "../../../logs/logs.handler.hpp"
+#include "../../../utils/tool.text.format.hpp"
+
+#include <vulkan/vulkan.h>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// Accesses which make a resource content visible to the next uses only through a barrier.
+constexpr const VkAccessFlags RENDER_GRAPH_WRITE_ACCESSES = VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT
+    | VK_ACCESS_TRANSFER_WRITE_BIT | VK_ACCESS_HOST_WRITE_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+// Give the layout, the stages and the accesses of a usage, its write accesses included.
+// The buffers have no layout, so their usages give the undefined one.
+RenderGraphState get_render_graph_usage_state
+(
+    const RenderGraphUsage &usage
+)
+{
+    switch (usage)
+    {
+        case RenderGraphUsage::ColorAttachment:
+            return { VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT };
+
+        case RenderGraphUsage::DepthAttachment:
+            return { VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL, VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT, VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT };
+
+        case RenderGraphUsage::Sampled:
+            return { VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT };
+
+        case RenderGraphUsage::Storage:
+            return { VK_IMAGE_LAYOUT_GENERAL, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT };
+
+        case RenderGraphUsage::TransferSource:
+            return { VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_READ_BIT };
+
+        case RenderGraphUsage::TransferDestination:
+            return { VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT };
+
+        case RenderGraphUsage::IndirectRead:
+            return { VK_IMAGE_LAYOUT_UNDEFINED, VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT, VK_ACCESS_INDIRECT_COMMAND_READ_BIT };
+
+        case RenderGraphUsage::VertexInput:
+            return { VK_IMAGE_LAYOUT_UNDEFINED, VK_PIPELINE_STAGE_VERTEX_INPUT_BIT, VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT };
+
+        case RenderGraphUsage::HostRead:
+            return { VK_IMAGE_LAYOUT_UNDEFINED, VK_PIPELINE_STAGE_HOST_BIT, VK_ACCESS_HOST_READ_BIT };
+    }
+
+    return { VK_IMAGE_LAYOUT_UNDEFINED, 0, 0 };
+}
+
+// Give a readable name to a usage, for the graph dumps.
+std::string get_render_graph_usage_name
+(
+    const RenderGraphUsage &usage
+)
+{
+    switch (usage)
+    {
+        case RenderGraphUsage::ColorAttachment: return "color attachment";
+        case RenderGraphUsage::DepthAttachment: return "depth attachment";
+        case RenderGraphUsage::Sampled: return "sampled";
+        case RenderGraphUsage::Storage: return "storage";
+        case RenderGraphUsage::TransferSource: return "transfer source";
+        case RenderGraphUsage::TransferDestination: return "transfer destination";
+        case RenderGraphUsage::IndirectRead: return "indirect read";
+        case RenderGraphUsage::VertexInput: return "vertex input";
+        case RenderGraphUsage::HostRead: return "host read";
+    }
+
+    return "unknown";
+}
+
+// Add an image living outside of the graph, like a swap chain image.
+// The image is an output of the graph when a final layout is given, the passes writing it are then never culled.
+uint32_t import_render_graph_image
+(
+    RenderGraph &graph,
+    const std::string &name,
+    const VkImage &image,
+    const VkImageAspectFlags &aspect,
+    const RenderGraphState &initial_state,
+    const RenderGraphState &final_state
+)
+{
+    if (image == VK_NULL_HANDLE)
+    {
+        error_log("Warning: The image \"" + name + "\" imported into the render graph (" + force_string(image) + ") is not valid!");
+    }
+
+    RenderGraphResource resource {};
+    resource.name = name;
+    resource.is_image = true;
+    resource.output = final_state.layout != VK_IMAGE_LAYOUT_UNDEFINED;
+    resource.image = image;
+    resource.aspect = aspect;
+    resource.initial_state = initial_state;
+    resource.final_state = final_state;
+
+    graph.resources.emplace_back(resource);
+    return static_cast<uint32_t>(graph.resources.size() - 1);
+}
+
+// Add a buffer living outside of the graph, like the buffers written by the culling.
+// The buffer is an output of the graph when the stages of a final state are given, like a buffer read back by the CPU.
+uint32_t import_render_graph_buffer
+(
+    RenderGraph &graph,
+    const std::string &name,
+    const VkBuffer &buffer,
+    const RenderGraphState &initial_state,
+    const RenderGraphState &final_state
+)
+{
+    if (buffer == VK_NULL_HANDLE)
+    {
+        error_log("Warning: The buffer \"" + name + "\" imported into the render graph (" + force_string(buffer) + ") is not valid!");
+    }
+
+    RenderGraphResource resource {};
+    resource.name = name;
+    resource.output = final_state.stages != 0;
+    resource.buffer = buffer;
+    resource.initial_state = { VK_IMAGE_LAYOUT_UNDEFINED, initial_state.stages, initial_state.accesses }; // The buffers have no layout.
+    resource.final_state = { VK_IMAGE_LAYOUT_UNDEFINED, final_state.stages, final_state.accesses };
+
+    graph.resources.emplace_back(resource);
+    return static_cast<uint32_t>(graph.resources.size() - 1);
+}
+
+// Add an image only living during the graph execution, its content is discarded before its first pass.
+// The image itself is created once the graph is compiled (see render.graph.transients.hpp), sharing its memory with the images used at other times.
+uint32_t create_render_graph_image
+(
+    RenderGraph &graph,
+    const std::string &name,
+    const VkImageCreateInfo &create_info,
+    const VkImageAspectFlags &aspect
+)
+{
+    RenderGraphResource resource {};
+    resource.name = name;
+    resource.is_image = true;
+    resource.transient = true;
+    resource.aspect = aspect;
+    resource.create_info = create_info;
+    resource.create_info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    resource.create_info.flags |= VK_IMAGE_CREATE_ALIAS_BIT; // Its memory may hold another image at other times.
+    resource.initial_state = { VK_IMAGE_LAYOUT_UNDEFINED, 0, 0 };
+
+    graph.resources.emplace_back(resource);
+    return static_cast<uint32_t>(graph.resources.size() - 1);
+}
+
+// Add a pass, recorded after the ones added before it.
+// The passes without side effects are culled when nothing reads what they write.
+uint32_t add_render_graph_pass
+(
+    RenderGraph &graph,
+    const std::string &name,
+    const bool &side_effects,
+    const std::function<void(const VkCommandBuffer &)> &record
+)
+{
+    RenderGraphPass pass {};
+    pass.name = name;
+    pass.side_effects = side_effects;
+    pass.record = record;
+
+    graph.passes.emplace_back(pass);
+    return static_cast<uint32_t>(graph.passes.size() - 1);
+}
+
+// Declare that a pass reads a resource, it waits for the passes which wrote it before.
+void read_render_graph_resource
+(
+    RenderGraph &graph,
+    const uint32_t &pass,
+    const uint32_t &resource,
+    const RenderGraphUsage &usage
+)
+{
+    if (pass >= graph.passes.size() || resource >= graph.resources.size())
+    {
+        error_log("Failed to declare a render graph read! The pass (" + std::to_string(pass) + ") or the resource (" + std::to_string(resource) + ") provided is out of bounds.");
+        return;
+    }
+
+    graph.passes[pass].accesses.push_back({ resource, usage, false });
+}
+
+// Declare that a pass writes a resource, it waits for the passes which used it before.
+void write_render_graph_resource
+(
+    RenderGraph &graph,
+    const uint32_t &pass,
+    const uint32_t &resource,
+    const RenderGraphUsage &usage
+)
+{
+    if (pass >= graph.passes.size() || resource >= graph.resources.size())
+    {
+        error_log("Failed to declare a render graph write! The pass (" + std::to_string(pass) + ") or the resource (" + std::to_string(resource) + ") provided is out of bounds.");
+        return;
+    }
+
+    graph.passes[pass].accesses.push_back({ resource, usage, true });
+}
+
+// Add the barrier bringing a resource to the state needed by a pass, when the pass must wait for the previous uses.
+// - A write waits for the previous reads and writes.
+// - A read waits for the last write, unless it was already made visible to the stages of that read.
+// - A layout change always waits for the previous uses, the buffers keeping the undefined layout never change it.
+void add_render_graph_transition
+(
+    RenderGraphBarriers &barriers,
+    RenderGraphSync &sync,
+    const RenderGraphState &needed_state,
+    const uint32_t &resource_index
+)
+{
+    const VkAccessFlags needed_writes = needed_state.accesses & RENDER_GRAPH_WRITE_ACCESSES;
+    const VkPipelineStageFlags previous_stages = sync.write_stages | sync.read_stages;
+    const bool layout_change = sync.layout != needed_state.layout;
+    const bool visible = (needed_state.stages & ~sync.visible_stages) == 0 && (needed_state.accesses & ~sync.visible_accesses) == 0;
+
+    bool barrier = layout_change;
+    barrier = barrier || (needed_writes != 0 && previous_stages != 0);
+    barrier = barrier || (needed_writes == 0 && sync.write_stages != 0 && !visible);
+
+    if (barrier)
+    {
+        barriers.source_stages |= previous_stages != 0 ? previous_stages : static_cast<VkPipelineStageFlags>(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT);
+        barriers.destination_stages |= needed_state.stages != 0 ? needed_state.stages : static_cast<VkPipelineStageFlags>(VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT);
+
+        barriers.barriers.push_back
+        ({
+            resource_index,
+            sync.write_accesses, // Only the writes must be made available, the reads only need the execution order.
+            needed_state.accesses,
+            sync.layout,
+            needed_state.layout
+        });
+
+        sync.layout = needed_state.layout;
+        sync.visible_stages |= needed_state.stages;
+        sync.visible_accesses |= needed_state.accesses;
+    }
+
+    // After a write, the next uses wait for it, and it isn't visible to anything yet.
+    if (needed_writes != 0)
+    {
+        sync.write_stages = needed_state.stages;
+        sync.write_accesses = needed_writes;
+        sync.read_stages = 0;
+        sync.visible_stages = 0;
+        sync.visible_accesses = 0;
+    }
+    else sync.read_stages |= needed_state.stages;
+}
+
+// Compile a graph into the passes to record and the barriers between them.
+// - The passes are culled when they have no side effects and nothing after them reads what they write.
+// - The passes keep the order they were added in, each pass only reading what the passes added before it wrote.
+// - The barriers needed before each pass are merged into a single pipeline barrier.
+// - The transient images whose lifetimes don't overlap are given the same alias slot, to share their memory.
+CompiledRenderGraph compile_render_graph
+(
+    const RenderGraph &graph
+)
+{
+    CompiledRenderGraph compiled_graph {};
+    const size_t resources_count = graph.resources.size();
+
+    // Walk the passes backward, so a pass is kept once a kept pass after it reads what it writes.
+    std::vector<bool> needed_resources(resources_count, false);
+    std::vector<bool> kept_passes(graph.passes.size(), false);
+
+    for (size_t i = 0; i < resources_count; i++)
+    {
+        needed_resources[i] = graph.resources[i].output;
+    }
+
+    for (size_t i = graph.passes.size(); i-- > 0;)
+    {
+        const RenderGraphPass &pass = graph.passes[i];
+        bool kept = pass.side_effects;
+
+        for (const RenderGraphAccess &access : pass.accesses)
+        {
+            kept = kept || (access.write && needed_resources[access.resource]);
+        }
+
+        if (!kept)
+        {
+            continue;
+        }
+
+        kept_passes[i] = true;
+
+        for (const RenderGraphAccess &access : pass.accesses)
+        {
+            if (!access.write)
+            {
+                needed_resources[access.resource] = true;
+            }
+        }
+    }
+
+    for (uint32_t i = 0; i < graph.passes.size(); i++)
+    {
+        if (kept_passes[i])
+        {
+            compiled_graph.passes.emplace_back(i);
+        }
+        else compiled_graph.culled_passes.emplace_back(i);
+    }
+
+    // The lifetimes follow the execution order of the passes kept.
+    compiled_graph.lifetimes.assign(resources_count, { RENDER_GRAPH_NONE, RENDER_GRAPH_NONE });
+
+    for (uint32_t i = 0; i < compiled_graph.passes.size(); i++)
+    {
+        for (const RenderGraphAccess &access : graph.passes[compiled_graph.passes[i]].accesses)
+        {
+            RenderGraphLifetime &lifetime = compiled_graph.lifetimes[access.resource];
+            lifetime.first_pass = std::min(lifetime.first_pass, i);
+            lifetime.last_pass = lifetime.last_pass == RENDER_GRAPH_NONE ? i : std::max(lifetime.last_pass, i);
+        }
+    }
+
+    // Give each transient image the first slot free at its first pass, the images are sorted by first pass.
+    // The image using a slot before gives the stages to wait for before the first use of the next one.
+    std::vector<uint32_t> transient_images;
+    std::vector<uint32_t> previous_aliases(resources_count, RENDER_GRAPH_NONE);
+    std::vector<uint32_t> slots_last_images;
+    compiled_graph.alias_slots.assign(resources_count, RENDER_GRAPH_NONE);
+
+    for (uint32_t i = 0; i < resources_count; i++)
+    {
+        if (graph.resources[i].transient && compiled_graph.lifetimes[i].first_pass != RENDER_GRAPH_NONE)
+        {
+            transient_images.emplace_back(i);
+        }
+    }
+
+    std::stable_sort(transient_images.begin(), transient_images.end(), [&compiled_graph](const uint32_t &a, const uint32_t &b)
+    {
+        return compiled_graph.lifetimes[a].first_pass < compiled_graph.lifetimes[b].first_pass;
+    });
+
+    for (const uint32_t &image : transient_images)
+    {
+        uint32_t slot = RENDER_GRAPH_NONE;
+
+        for (uint32_t i = 0; i < slots_last_images.size(); i++)
+        {
+            if (compiled_graph.lifetimes[slots_last_images[i]].last_pass < compiled_graph.lifetimes[image].first_pass)
+            {
+                slot = i;
+                break;
+            }
+        }
+
+        if (slot == RENDER_GRAPH_NONE)
+        {
+            slot = static_cast<uint32_t>(slots_last_images.size());
+            slots_last_images.emplace_back(image);
+        }
+        else
+        {
+            previous_aliases[image] = slots_last_images[slot];
+            slots_last_images[slot] = image;
+        }
+
+        compiled_graph.alias_slots[image] = slot;
+    }
+
+    compiled_graph.alias_slots_count = static_cast<uint32_t>(slots_last_images.size());
+
+    // The transient images are kept for the next frames, which run the same graph.
+    // So the first image of a slot waits for all the uses of that slot by the previous frame.
+    std::vector<RenderGraphSync> slots_syncs(compiled_graph.alias_slots_count, { VK_IMAGE_LAYOUT_UNDEFINED, 0, 0, 0, 0, 0 });
+
+    for (const uint32_t &pass : compiled_graph.passes)
+    {
+        for (const RenderGraphAccess &access : graph.passes[pass].accesses)
+        {
+            const uint32_t slot = compiled_graph.alias_slots[access.resource];
+
+            if (slot == RENDER_GRAPH_NONE)
+            {
+                continue;
+            }
+
+            const RenderGraphState access_state = get_render_graph_usage_state(access.usage);
+
+            if (access.write)
+            {
+                slots_syncs[slot].write_stages |= access_state.stages;
+                slots_syncs[slot].write_accesses |= access_state.accesses & RENDER_GRAPH_WRITE_ACCESSES;
+            }
+            else slots_syncs[slot].read_stages |= access_state.stages;
+        }
+    }
+
+    // Follow the synchronization of each resource through the passes, adding the barriers each pass needs.
+    // The writes of the initial state come from before the graph, like the previous frame.
+    std::vector<RenderGraphSync> syncs(resources_count);
+
+    for (size_t i = 0; i < resources_count; i++)
+    {
+        const RenderGraphState &initial_state = graph.resources[i].initial_state;
+        const bool written = (initial_state.accesses & RENDER_GRAPH_WRITE_ACCESSES) != 0;
+
+        syncs[i] = { initial_state.layout, written ? initial_state.stages : 0, initial_state.accesses & RENDER_GRAPH_WRITE_ACCESSES, written ? 0 : initial_state.stages, 0, 0 };
+
+        if (compiled_graph.alias_slots[i] != RENDER_GRAPH_NONE && previous_aliases[i] == RENDER_GRAPH_NONE)
+        {
+            syncs[i] = slots_syncs[compiled_graph.alias_slots[i]];
+        }
+    }
+
+    compiled_graph.barriers.resize(compiled_graph.passes.size(), { 0, 0, {} });
+
+    for (uint32_t i = 0; i < compiled_graph.passes.size(); i++)
+    {
+        const RenderGraphPass &pass = graph.passes[compiled_graph.passes[i]];
+        RenderGraphBarriers &barriers = compiled_graph.barriers[i];
+
+        // The accesses of a pass to the same resource are merged, as they are synchronized by the same barrier.
+        std::vector<uint32_t> used_resources;
+        std::vector<RenderGraphState> needed_states;
+
+        for (const RenderGraphAccess &access : pass.accesses)
+        {
+            RenderGraphState access_state = get_render_graph_usage_state(access.usage);
+
+            if (!access.write)
+            {
+                access_state.accesses &= ~RENDER_GRAPH_WRITE_ACCESSES;
+            }
+
+            if (!graph.resources[access.resource].is_image)
+            {
+                access_state.layout = VK_IMAGE_LAYOUT_UNDEFINED; // The buffers have no layout.
+            }
+
+            const std::vector<uint32_t>::iterator used = std::find(used_resources.begin(), used_resources.end(), access.resource);
+
+            if (used == used_resources.end())
+            {
+                used_resources.emplace_back(access.resource);
+                needed_states.emplace_back(access_state);
+                continue;
+            }
+
+            RenderGraphState &needed_state = needed_states[used - used_resources.begin()];
+
+            if (needed_state.layout != access_state.layout)
+            {
+                error_log("Warning: The render graph pass \"" + pass.name + "\" uses the image \"" + graph.resources[access.resource].name + "\" in two layouts, only the first one is used.");
+            }
+
+            needed_state.stages |= access_state.stages;
+            needed_state.accesses |= access_state.accesses;
+        }
+
+        for (size_t j = 0; j < used_resources.size(); j++)
+        {
+            const uint32_t resource = used_resources[j];
+
+            // The first use of an aliased image waits for the last use of the image sharing its memory before it.
+            if (compiled_graph.lifetimes[resource].first_pass == i && previous_aliases[resource] != RENDER_GRAPH_NONE)
+            {
+                const RenderGraphSync &alias_sync = syncs[previous_aliases[resource]];
+                syncs[resource].write_stages = alias_sync.write_stages;
+                syncs[resource].write_accesses = alias_sync.write_accesses;
+                syncs[resource].read_stages = alias_sync.read_stages;
+            }
+
+            add_render_graph_transition(barriers, syncs[resource], needed_states[j], resource);
+        }
+    }
+
+    // Leave the outputs in their final state, only their last writes not visible to it yet need a barrier.
+    compiled_graph.final_barriers = { 0, 0, {} };
+
+    for (uint32_t i = 0; i < resources_count; i++)
+    {
+        if (graph.resources[i].output)
+        {
+            add_render_graph_transition(compiled_graph.final_barriers, syncs[i], graph.resources[i].final_state, i);
+        }
+    }
+
+    // Count the barriers recorded, a pass without barriers records no pipeline barrier.
+    std::vector<RenderGraphBarriers> recorded_barriers = compiled_graph.barriers;
+    recorded_barriers.emplace_back(compiled_graph.final_barriers);
+
+    for (const RenderGraphBarriers &barriers : recorded_barriers)
+    {
+        compiled_graph.pipeline_barriers_count += barriers.barriers.empty() ? 0 : 1;
+
+        for (const RenderGraphBarrier &barrier : barriers.barriers)
+        {
+            if (graph.resources[barrier.resource].is_image)
+            {
+                compiled_graph.image_barriers_count++;
+            }
+            else compiled_graph.buffer_barriers_count++;
+        }
+    }
+
+    return compiled_graph;
+}
+
+// Record some merged barriers as a single pipeline barrier, nothing is recorded without barriers.
+void record_render_graph_barriers
+(
+    const VkCommandBuffer &command_buffer,
+    const RenderGraph &graph,
+    const RenderGraphBarriers &barriers
+)
+{
+    if (barriers.barriers.empty())
+    {
+        return;
+    }
+
+    std::vector<VkImageMemoryBarrier> image_barriers;
+    std::vector<VkBufferMemoryBarrier> buffer_barriers;
+
+    for (const RenderGraphBarrier &barrier : barriers.barriers)
+    {
+        const RenderGraphResource &resource = graph.resources[barrier.resource];
+
+        if (!resource.is_image && resource.buffer == VK_NULL_HANDLE)
+        {
+            error_log("Failed to record a render graph barrier! The buffer \"" + resource.name + "\" (" + force_string(resource.buffer) + ") is not valid!");
+            continue;
+        }
+
+        if (!resource.is_image)
+        {
+            buffer_barriers.push_back
+            ({
+                .sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+                .srcAccessMask = barrier.source_accesses,
+                .dstAccessMask = barrier.destination_accesses,
+                .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                .buffer = resource.buffer,
+                .offset = 0,
+                .size = VK_WHOLE_SIZE
+            });
+
+            continue;
+        }
+
+        if (resource.image == VK_NULL_HANDLE)
+        {
+            error_log("Failed to record a render graph barrier! The image \"" + resource.name + "\" (" + force_string(resource.image) + ") is not valid!");
+            continue;
+        }
+
+        image_barriers.push_back
+        ({
+            .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+            .srcAccessMask = barrier.source_accesses,
+            .dstAccessMask = barrier.destination_accesses,
+            .oldLayout = barrier.old_layout,
+            .newLayout = barrier.new_layout,
+            .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+            .image = resource.image,
+            .subresourceRange = { resource.aspect, 0, VK_REMAINING_MIP_LEVELS, 0, VK_REMAINING_ARRAY_LAYERS }
+        });
+    }
+
+    vkCmdPipelineBarrier(command_buffer, barriers.source_stages, barriers.destination_stages, 0, 0, nullptr, static_cast<uint32_t>(buffer_barriers.size()), buffer_barriers.data(), static_cast<uint32_t>(image_barriers.size()), image_barriers.data());
+}
+
+// Record the passes kept by the compilation, each after its barriers, then bring the outputs to their final state.
+void execute_render_graph
+(
+    const VkCommandBuffer &command_buffer,
+    const RenderGraph &graph,
+    const CompiledRenderGraph &compiled_graph
+)
+{
+    if (command_buffer == VK_NULL_HANDLE)
+    {
+        error_log("Failed to execute the render graph! The command buffer provided (" + force_string(command_buffer) + ") is not valid!");
+        return;
+    }
+
+    if (compiled_graph.barriers.size() != compiled_graph.passes.size())
+    {
+        error_log("Failed to execute the render graph! Its passes don't match its barriers: " + std::to_string(compiled_graph.passes.size()) + " != " + std::to_string(compiled_graph.barriers.size()) + ".");
+        return;
+    }
+
+    for (size_t i = 0; i < compiled_graph.passes.size(); i++)
+    {
+        const RenderGraphPass &pass = graph.passes[compiled_graph.passes[i]];
+        record_render_graph_barriers(command_buffer, graph, compiled_graph.barriers[i]);
+
+        if (pass.record)
+        {
+            pass.record(command_buffer);
+        }
+    }
+
+    record_render_graph_barriers(command_buffer, graph, compiled_graph.final_barriers);
+}
+
+// Describe a compiled graph: its passes in order with the resources they use, the culled ones, the barriers and the alias slots.
+std::string dump_render_graph
+(
+    const RenderGraph &graph,
+    const CompiledRenderGraph &compiled_graph
+)
+{
+    uint32_t transient_images = 0;
+
+    for (const RenderGraphResource &resource : graph.resources)
+    {
+        transient_images += resource.transient ? 1 : 0;
+    }
+
+    std::string dump = "Render graph: " + std::to_string(compiled_graph.passes.size()) + " passes (" + std::to_string(compiled_graph.culled_passes.size()) + " culled), "
+        + std::to_string(graph.resources.size()) + " resources, " + std::to_string(compiled_graph.pipeline_barriers_count) + " pipeline barriers ("
+        + std::to_string(compiled_graph.image_barriers_count) + " image, " + std::to_string(compiled_graph.buffer_barriers_count) + " buffer), "
+        + std::to_string(transient_images) + " transient images in " + std::to_string(compiled_graph.alias_slots_count) + " alias slots.";
+
+    for (size_t i = 0; i < compiled_graph.passes.size(); i++)
+    {
+        const RenderGraphPass &pass = graph.passes[compiled_graph.passes[i]];
+        dump += "\n - #" + std::to_string(i) + " \"" + pass.name + "\"" + (pass.side_effects ? " (side effects)" : "") + ":";
+
+        for (const RenderGraphAccess &access : pass.accesses)
+        {
+            dump += std::string(access.write ? " writes" : " reads") + " \"" + graph.resources[access.resource].name + "\" (" + get_render_graph_usage_name(access.usage) + "),";
+        }
+
+        dump += " " + std::to_string(compiled_graph.barriers[i].barriers.size()) + " barriers before.";
+    }
+
+    for (const uint32_t &pass : compiled_graph.culled_passes)
+    {
+        dump += "\n - Culled \"" + graph.passes[pass].name + "\".";
+    }
+
+    for (size_t i = 0; i < graph.resources.size(); i++)
+    {
+        if (compiled_graph.alias_slots[i] != RENDER_GRAPH_NONE)
+        {
+            dump += "\n - Transient \"" + graph.resources[i].name + "\": passes #" + std::to_string(compiled_graph.lifetimes[i].first_pass)
+                + " to #" + std::to_string(compiled_graph.lifetimes[i].last_pass) + ", alias slot " + std::to_string(compiled_graph.alias_slots[i]) + ".";
+        }
+    }
+
+    dump += "\n - " + std::to_string(compiled_graph.final_barriers.barriers.size()) + " barriers after the last pass.";
+    return dump;
+}
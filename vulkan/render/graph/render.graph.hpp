@@ -0,0 +1,230 @@
+#include <vulkan/vulkan.h>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#ifndef VULKAN_RENDER_GRAPH_HPP
+#define VULKAN_RENDER_GRAPH_HPP
+
+// Index given to the resources and passes which aren't part of the compiled graph.
+constexpr const uint32_t RENDER_GRAPH_NONE = UINT32_MAX;
+
+////////////////////////////////////////////////////
+//////////////////// Structures ////////////////////
+////////////////////////////////////////////////////
+
+// How a pass uses a resource, which gives the layout, the stages and the accesses synchronized by the graph.
+enum class RenderGraphUsage
+{
+    ColorAttachment,     // Drawn into as a color attachment, or resolved into.
+    DepthAttachment,     // Tested and written as the depth attachment.
+    Sampled,             // Read by the fragment and compute shaders.
+    Storage,             // Read and written by the compute shaders.
+    TransferSource,
+    TransferDestination,
+    IndirectRead,        // Buffer read by the indirect draws.
+    VertexInput,         // Buffer read by the vertex fetch, like the instances.
+    HostRead             // Buffer read by the CPU once the frame is done.
+};
+
+// Synchronization state of a resource: the layout of an image, and the stages and accesses using it since the last barrier.
+struct RenderGraphState
+{
+    VkImageLayout layout;
+    VkPipelineStageFlags stages;
+    VkAccessFlags accesses;
+};
+
+// Synchronization of a resource followed through the passes during the compilation.
+struct RenderGraphSync
+{
+    VkImageLayout layout;
+    VkPipelineStageFlags write_stages;   // Last write, waited for by the next uses.
+    VkAccessFlags write_accesses;
+    VkPipelineStageFlags read_stages;    // Reads since the last write, waited for by the next write.
+    VkPipelineStageFlags visible_stages; // Stages and accesses the last write was made visible to.
+    VkAccessFlags visible_accesses;
+};
+
+// Image or buffer used by the passes of a graph.
+// The imported resources live outside of the graph, the transient images only live during the graph execution.
+struct RenderGraphResource
+{
+    std::string name;
+    bool is_image;
+    bool transient;                  // Created by the graph, its memory may be shared with the transient images used at other times.
+    bool output;                     // Read after the graph, so the passes writing it are never culled.
+    VkImage image;                   // Null for the transient images until they are created.
+    VkImageAspectFlags aspect;
+    VkImageCreateInfo create_info;   // Only used by the transient images.
+    VkBuffer buffer;
+    RenderGraphState initial_state;  // State before the graph, the undefined layout discarding the content of the image.
+    RenderGraphState final_state;    // State the outputs are left in after the graph.
+};
+
+// Use of a resource by a pass.
+struct RenderGraphAccess
+{
+    uint32_t resource;
+    RenderGraphUsage usage;
+    bool write;
+};
+
+// Work recorded by the graph, once the resources it declares are ready for it.
+// Note: a pass may still record its own barriers between the resources it doesn't declare.
+struct RenderGraphPass
+{
+    std::string name;
+    std::vector<RenderGraphAccess> accesses;
+    bool side_effects;                                   // Never culled, as its results are used outside of the graph.
+    std::function<void(const VkCommandBuffer &)> record;
+};
+
+// Frame work described by its passes and the resources they read and write, in the order the passes were added.
+struct RenderGraph
+{
+    std::vector<RenderGraphResource> resources;
+    std::vector<RenderGraphPass> passes;
+};
+
+// Barrier of a resource, its image or buffer is only read when the barrier is recorded.
+// That way, a compiled graph doesn't depend on the images created after its compilation, like the transient ones.
+struct RenderGraphBarrier
+{
+    uint32_t resource;
+    VkAccessFlags source_accesses;
+    VkAccessFlags destination_accesses;
+    VkImageLayout old_layout;
+    VkImageLayout new_layout;
+};
+
+// Barriers merged into a single pipeline barrier.
+struct RenderGraphBarriers
+{
+    VkPipelineStageFlags source_stages;
+    VkPipelineStageFlags destination_stages;
+    std::vector<RenderGraphBarrier> barriers;
+};
+
+// First and last compiled passes using a resource, none when it isn't used.
+struct RenderGraphLifetime
+{
+    uint32_t first_pass;
+    uint32_t last_pass;
+};
+
+// Passes kept by the compilation in their execution order, with the barriers to record before each of them.
+struct CompiledRenderGraph
+{
+    std::vector<uint32_t> passes;                 // Indexes of the passes kept, in execution order.
+    std::vector<uint32_t> culled_passes;          // Passes whose results are never used.
+    std::vector<RenderGraphBarriers> barriers;    // Recorded before each pass kept.
+    RenderGraphBarriers final_barriers;           // Bring the outputs to their final state.
+    std::vector<RenderGraphLifetime> lifetimes;   // Per resource, in the compiled passes order.
+    std::vector<uint32_t> alias_slots;            // Per resource, transient images sharing a slot share their memory.
+    uint32_t alias_slots_count;
+    uint32_t pipeline_barriers_count;             // Pipeline barrier commands recorded by the graph.
+    uint32_t image_barriers_count;
+    uint32_t buffer_barriers_count;
+};
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+RenderGraphState get_render_graph_usage_state
+(
+    const RenderGraphUsage &usage
+);
+
+std::string get_render_graph_usage_name
+(
+    const RenderGraphUsage &usage
+);
+
+uint32_t import_render_graph_image
+(
+    RenderGraph &graph,
+    const std::string &name,
+    const VkImage &image,
+    const VkImageAspectFlags &aspect,
+    const RenderGraphState &initial_state,
+    const RenderGraphState &final_state
+);
+
+uint32_t import_render_graph_buffer
+(
+    RenderGraph &graph,
+    const std::string &name,
+    const VkBuffer &buffer,
+    const RenderGraphState &initial_state,
+    const RenderGraphState &final_state
+);
+
+uint32_t create_render_graph_image
+(
+    RenderGraph &graph,
+    const std::string &name,
+    const VkImageCreateInfo &create_info,
+    const VkImageAspectFlags &aspect
+);
+
+uint32_t add_render_graph_pass
+(
+    RenderGraph &graph,
+    const std::string &name,
+    const bool &side_effects,
+    const std::function<void(const VkCommandBuffer &)> &record
+);
+
+void read_render_graph_resource
+(
+    RenderGraph &graph,
+    const uint32_t &pass,
+    const uint32_t &resource,
+    const RenderGraphUsage &usage
+);
+
+void write_render_graph_resource
+(
+    RenderGraph &graph,
+    const uint32_t &pass,
+    const uint32_t &resource,
+    const RenderGraphUsage &usage
+);
+
+void add_render_graph_transition
+(
+    RenderGraphBarriers &barriers,
+    RenderGraphSync &sync,
+    const RenderGraphState &needed_state,
+    const uint32_t &resource_index
+);
+
+CompiledRenderGraph compile_render_graph
+(
+    const RenderGraph &graph
+);
+
+void record_render_graph_barriers
+(
+    const VkCommandBuffer &command_buffer,
+    const RenderGraph &graph,
+    const RenderGraphBarriers &barriers
+);
+
+void execute_render_graph
+(
+    const VkCommandBuffer &command_buffer,
+    const RenderGraph &graph,
+    const CompiledRenderGraph &compiled_graph
+);
+
+std::string dump_render_graph
+(
+    const RenderGraph &graph,
+    const CompiledRenderGraph &compiled_graph
+);
+
+#endif
@@ -0,0 +1,238 @@
+#include "render.graph.transients.hpp"
+
+#include "../../buffers/buffers.memory.hpp"
+#include "../../images/image.views.handler.hpp"
+#include "../../../logs/logs.handler.hpp"
+#include "../../../utils/tool.text.format.hpp"
+
+#include <vulkan/vulkan.h>
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+// Create the transient images of a compiled graph, the images of an alias slot sharing the same memory at offset 0.
+// The culled transient images are never created.
+RenderGraphTransients create_vulkan_render_graph_transients
+(
+    const VkPhysicalDevice &physical_device,
+    const VkDevice &logical_device,
+    const RenderGraph &graph,
+    const CompiledRenderGraph &compiled_graph
+)
+{
+    RenderGraphTransients transients {};
+
+    if (physical_device == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Render graph transient images creation failed! The physical device provided (" + force_string(physical_device) + ") is not valid!");
+    }
+
+    if (logical_device == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Render graph transient images creation failed! The logical device provided (" + force_string(logical_device) + ") is not valid!");
+    }
+
+    if (compiled_graph.alias_slots.size() != graph.resources.size())
+    {
+        fatal_error_log("Render graph transient images creation failed! The graph doesn't match its compilation: " + std::to_string(graph.resources.size()) + " != " + std::to_string(compiled_graph.alias_slots.size()) + " resources.");
+    }
+
+    // Create the images first, their memory requirements give the memory each slot needs.
+    std::vector<VkMemoryRequirements> memory_requirements;
+
+    for (uint32_t i = 0; i < graph.resources.size(); i++)
+    {
+        if (compiled_graph.alias_slots[i] == RENDER_GRAPH_NONE)
+        {
+            continue;
+        }
+
+        VkImage image = VK_NULL_HANDLE;
+        const VkResult image_creation = vkCreateImage(logical_device, &graph.resources[i].create_info, nullptr, &image);
+
+        if (image_creation != VK_SUCCESS)
+        {
+            fatal_error_log("Render graph transient image \"" + graph.resources[i].name + "\" creation failed with error code " + std::to_string(image_creation) + ".");
+        }
+
+        VkMemoryRequirements requirements;
+        vkGetImageMemoryRequirements(logical_device, image, &requirements);
+
+        transients.resources.emplace_back(i);
+        transients.images.emplace_back(image);
+        memory_requirements.emplace_back(requirements);
+        transients.images_size += requirements.size;
+    }
+
+    if (transients.images.empty())
+    {
+        return transients;
+    }
+
+    log("Creating " + std::to_string(transients.images.size()) + " render graph transient images in " + std::to_string(compiled_graph.alias_slots_count) + " alias slots..");
+
+    VkPhysicalDeviceMemoryProperties memory_properties;
+    vkGetPhysicalDeviceMemoryProperties(physical_device, &memory_properties);
+
+    // Each slot takes the largest size of its images, in a memory type all of them accept.
+    // An image accepting none of the memory types of its slot gets its own memory.
+    for (uint32_t slot = 0; slot < compiled_graph.alias_slots_count; slot++)
+    {
+        std::vector<size_t> shared_images;
+        std::vector<size_t> own_memory_images;
+        uint32_t memory_types = UINT32_MAX;
+        VkDeviceSize slot_size = 0;
+
+        for (size_t i = 0; i < transients.images.size(); i++)
+        {
+            if (compiled_graph.alias_slots[transients.resources[i]] != slot)
+            {
+                continue;
+            }
+
+            if ((memory_types & memory_requirements[i].memoryTypeBits) == 0)
+            {
+                own_memory_images.emplace_back(i);
+                continue;
+            }
+
+            memory_types &= memory_requirements[i].memoryTypeBits;
+            slot_size = std::max(slot_size, memory_requirements[i].size);
+            shared_images.emplace_back(i);
+        }
+
+        // Gather the images bound to each memory with the requirements of that memory.
+        std::vector<std::vector<size_t>> memories_images;
+        std::vector<VkMemoryRequirements> memories_requirements;
+
+        if (!shared_images.empty())
+        {
+            memories_images.emplace_back(shared_images);
+            memories_requirements.push_back({ slot_size, 0, memory_types });
+        }
+
+        for (const size_t &image : own_memory_images)
+        {
+            memories_images.push_back({ image });
+            memories_requirements.emplace_back(memory_requirements[image]);
+        }
+
+        for (size_t i = 0; i < memories_images.size(); i++)
+        {
+            const VkMemoryAllocateInfo allocation_info
+            {
+                .sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+                .allocationSize = memories_requirements[i].size,
+                .memoryTypeIndex = find_memory_type(memories_requirements[i].memoryTypeBits, memory_properties, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT)
+            };
+
+            VkDeviceMemory memory = VK_NULL_HANDLE;
+            const VkResult memory_allocation = vkAllocateMemory(logical_device, &allocation_info, nullptr, &memory);
+
+            if (memory_allocation != VK_SUCCESS)
+            {
+                fatal_error_log("Render graph transient images creation failed! The memory allocation returned error code " + std::to_string(memory_allocation) + ".");
+            }
+
+            for (const size_t &image : memories_images[i])
+            {
+                vkBindImageMemory(logical_device, transients.images[image], memory, 0);
+            }
+
+            transients.memories.emplace_back(memory);
+            transients.memory_size += allocation_info.allocationSize;
+        }
+    }
+
+    for (size_t i = 0; i < transients.images.size(); i++)
+    {
+        const RenderGraphResource &resource = graph.resources[transients.resources[i]];
+        transients.images_views.emplace_back(create_image_view(logical_device, transients.images[i], resource.create_info.format, resource.aspect, resource.create_info.mipLevels));
+    }
+
+    log("Render graph transient images created successfully! They take " + std::to_string(transients.memory_size) + " bytes instead of " + std::to_string(transients.images_size) + " without aliasing.");
+    return transients;
+}
+
+// Give the transient images to the resources of the graph, the graph must be the one the images were created for.
+void bind_render_graph_transients
+(
+    RenderGraph &graph,
+    const RenderGraphTransients &transients
+)
+{
+    for (size_t i = 0; i < transients.resources.size(); i++)
+    {
+        if (transients.resources[i] >= graph.resources.size() || !graph.resources[transients.resources[i]].transient)
+        {
+            error_log("Failed to bind the render graph transient images! The resource " + std::to_string(transients.resources[i]) + " isn't a transient image of the graph.");
+            continue;
+        }
+
+        graph.resources[transients.resources[i]].image = transients.images[i];
+    }
+}
+
+// Give the view of a transient image, to draw into it or sample it in a pass.
+VkImageView get_render_graph_transient_view
+(
+    const RenderGraphTransients &transients,
+    const uint32_t &resource
+)
+{
+    const std::vector<uint32_t>::const_iterator image = std::find(transients.resources.begin(), transients.resources.end(), resource);
+
+    if (image == transients.resources.end())
+    {
+        error_log("Failed to get a render graph transient image view! No image was created for the resource " + std::to_string(resource) + ".");
+        return VK_NULL_HANDLE;
+    }
+
+    return transients.images_views[image - transients.resources.begin()];
+}
+
+// Destroy the transient images, then the memory they share.
+void destroy_vulkan_render_graph_transients
+(
+    const VkDevice &logical_device,
+    RenderGraphTransients &transients
+)
+{
+    // Nothing was created when the graph has no transient images.
+    if (transients.images.empty())
+    {
+        return;
+    }
+
+    log("Destroying " + std::to_string(transients.images.size()) + " render graph transient images..");
+
+    if (logical_device == VK_NULL_HANDLE)
+    {
+        error_log("Render graph transient images destruction failed! The logical device provided (" + force_string(logical_device) + ") is not valid!");
+        return;
+    }
+
+    for (const VkImageView &image_view : transients.images_views)
+    {
+        vkDestroyImageView(logical_device, image_view, nullptr);
+    }
+
+    for (const VkImage &image : transients.images)
+    {
+        vkDestroyImage(logical_device, image, nullptr);
+    }
+
+    for (const VkDeviceMemory &memory : transients.memories)
+    {
+        vkFreeMemory(logical_device, memory, nullptr);
+    }
+
+    transients = {};
+
+    log("Render graph transient images destroyed successfully!");
+}
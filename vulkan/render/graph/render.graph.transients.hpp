@@ -0,0 +1,56 @@
+#include "render.graph.hpp"
+
+#include <vulkan/vulkan.h>
+#include <cstdint>
+#include <vector>
+
+#ifndef VULKAN_RENDER_GRAPH_TRANSIENTS_HPP
+#define VULKAN_RENDER_GRAPH_TRANSIENTS_HPP
+
+////////////////////////////////////////////////////
+//////////////////// Structures ////////////////////
+////////////////////////////////////////////////////
+
+// Images created for the transient resources of a compiled graph.
+// The images of the same alias slot are bound to the same memory, as the graph never uses them at the same time.
+struct RenderGraphTransients
+{
+    std::vector<uint32_t> resources;       // Graph resource of each image.
+    std::vector<VkImage> images;
+    std::vector<VkImageView> images_views;
+    std::vector<VkDeviceMemory> memories;  // One per alias slot, plus one per image whose memory types don't match its slot.
+    VkDeviceSize images_size;              // Memory the images would take without aliasing.
+    VkDeviceSize memory_size;              // Memory the images take once aliased.
+};
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+RenderGraphTransients create_vulkan_render_graph_transients
+(
+    const VkPhysicalDevice &physical_device,
+    const VkDevice &logical_device,
+    const RenderGraph &graph,
+    const CompiledRenderGraph &compiled_graph
+);
+
+void bind_render_graph_transients
+(
+    RenderGraph &graph,
+    const RenderGraphTransients &transients
+);
+
+VkImageView get_render_graph_transient_view
+(
+    const RenderGraphTransients &transients,
+    const uint32_t &resource
+);
+
+void destroy_vulkan_render_graph_transients
+(
+    const VkDevice &logical_device,
+    RenderGraphTransients &transients
+);
+
+#endif
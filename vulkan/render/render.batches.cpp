@@ -0,0 +1,181 @@
+#include "render.batches.hpp"
+
+#include "render.statistics.hpp"
+#include "../vertex/models/models.geometry.hpp"
+#include "../vertex/models/models.lod.hpp"
+#include "../vertex/vertex.instances.hpp"
+#include "../uniform/uniform.camera.hpp"
+#include "../../config/engine.config.hpp"
+#include "../../logs/logs.handler.hpp"
+
+#include <vulkan/vulkan.h>
+#include <glm/glm.hpp>
+#include <unordered_map>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <tuple>
+
+// Group the visible objects into draws and write their instances into the instance buffer of the frame.
+// - The objects sharing a mesh, a level of detail and a texture form a single instanced batch.
+// - The objects whose clusters are culled keep their own batch, as their draws depend on their position.
+// The instances of each batch are contiguous, in the order the objects are visible.
+// The batches are sorted by index type, texture and mesh, so the consecutive draws share as much state as possible.
+void build_draw_batches
+(
+    const std::vector<RenderObject> &objects,
+    const std::vector<uint32_t> &visible_objects,
+    const std::vector<MeshRange> &meshes,
+    const CameraData &camera,
+    const VkExtent2D &extent,
+    const size_t &textures_count,
+    InstanceData* instances,
+    std::vector<DrawBatch> &batches,
+    DrawStatistics &statistics
+)
+{
+    batches.clear();
+
+    statistics.visible_objects = static_cast<uint32_t>(visible_objects.size());
+    statistics.culled_objects = static_cast<uint32_t>(objects.size() - std::min(objects.size(), visible_objects.size()));
+
+    if (instances == nullptr)
+    {
+        error_log("Failed to build the draw batches! The instance buffer isn't mapped.");
+        return;
+    }
+
+    std::vector<InstanceData> object_instances;  // Instance and batch of each drawn object.
+    std::vector<uint32_t> object_batches;
+    object_instances.reserve(visible_objects.size());
+    object_batches.reserve(visible_objects.size());
+
+    std::unordered_map<uint64_t, uint32_t> batch_indices;
+    uint64_t previous_key = UINT64_MAX;
+    uint32_t previous_batch = 0;
+    size_t skipped_objects = 0;
+
+    // Find the batch of each object, the neighboring objects usually share it so the last one is checked first.
+    for (const uint32_t &object_index : visible_objects)
+    {
+        if (object_index >= objects.size())
+        {
+            continue;
+        }
+
+        const RenderObject &object = objects[object_index];
+
+        if (object.mesh >= meshes.size() || meshes[object.mesh].lods.size() < 1)
+        {
+            continue;
+        }
+
+        if (object_instances.size() >= EngineConfig::MAX_SCENE_INSTANCES)
+        {
+            skipped_objects++;
+            continue;
+        }
+
+        const MeshRange &mesh = meshes[object.mesh];
+        const glm::vec3 world_center = glm::vec3(object.model * glm::vec4(mesh.bounds_center, 1.0f));
+        const uint32_t lod = select_mesh_lod(mesh, world_center, get_model_scale(object.model), camera, extent);
+
+        statistics.total_triangles += mesh.lods[0].index_count / 3;
+
+        // Select the default texture if the targeted texture doesn't exist.
+        int32_t texture = object.texture;
+
+        if (texture < 0 || static_cast<size_t>(texture) >= textures_count)
+        {
+            error_log("Texture #" + std::to_string(texture) + " not found!");
+            texture = 0;
+        }
+
+        // The clusters only exist for the full resolution mesh, a single cluster is already culled with the object.
+        const bool culled_clusters = EngineConfig::USE_CLUSTER_CULLING && lod == 0 && mesh.clusters.size() > 1;
+        uint32_t batch = 0;
+
+        if (!EngineConfig::USE_GPU_INSTANCING || culled_clusters)
+        {
+            batch = static_cast<uint32_t>(batches.size());
+            batches.push_back({ object.mesh, lod, texture, object_index, 0, 0 });
+            previous_key = UINT64_MAX;
+        }
+        else
+        {
+            const uint64_t key = (static_cast<uint64_t>(object.mesh) << 32) | (static_cast<uint64_t>(lod) << 24) | static_cast<uint64_t>(texture & 0xFFFFFF);
+
+            if (key == previous_key)
+            {
+                batch = previous_batch;
+            }
+            else
+            {
+                const auto found = batch_indices.find(key);
+
+                if (found != batch_indices.end())
+                {
+                    batch = found->second;
+                }
+                else
+                {
+                    batch = static_cast<uint32_t>(batches.size());
+                    batches.push_back({ object.mesh, lod, texture, INSTANCED_BATCH_OBJECT, 0, 0 });
+                    batch_indices.emplace(key, batch);
+                }
+
+                previous_key = key;
+                previous_batch = batch;
+            }
+        }
+
+        batches[batch].instance_count++;
+        object_instances.push_back({ object.transform, texture });
+        object_batches.push_back(batch);
+    }
+
+    if (skipped_objects > 0)
+    {
+        error_log(std::to_string(skipped_objects) + " objects don't fit in the instance buffer (" + std::to_string(EngineConfig::MAX_SCENE_INSTANCES) + " instances)!");
+    }
+
+    // Sort the batches, there is a single graphics pipeline so the index type (that needs an index buffer binding) comes first.
+    std::vector<uint32_t> batch_order(batches.size());
+
+    for (size_t i = 0; i < batch_order.size(); i++)
+    {
+        batch_order[i] = static_cast<uint32_t>(i);
+    }
+
+    std::sort(batch_order.begin(), batch_order.end(), [&](const uint32_t &a, const uint32_t &b)
+    {
+        const DrawBatch &first = batches[a];
+        const DrawBatch &second = batches[b];
+
+        return std::make_tuple(meshes[first.mesh].index_type, first.texture, first.mesh, first.lod, first.object)
+            < std::make_tuple(meshes[second.mesh].index_type, second.texture, second.mesh, second.lod, second.object);
+    });
+
+    // Place the batches one after another in the instance buffer, in their sorted order.
+    std::vector<DrawBatch> sorted_batches;
+    sorted_batches.reserve(batches.size());
+    std::vector<uint32_t> batch_cursors(batches.size());
+    uint32_t first_instance = 0;
+
+    for (const uint32_t &batch : batch_order)
+    {
+        sorted_batches.push_back(batches[batch]);
+        sorted_batches.back().first_instance = first_instance;
+        batch_cursors[batch] = first_instance;
+        first_instance += batches[batch].instance_count;
+    }
+
+    batches.swap(sorted_batches);
+
+    for (size_t i = 0; i < object_instances.size(); i++)
+    {
+        instances[batch_cursors[object_batches[i]]++] = object_instances[i];
+    }
+}
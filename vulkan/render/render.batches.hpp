@@ -0,0 +1,49 @@
+#include "render.statistics.hpp"
+#include "../vertex/models/models.geometry.hpp"
+#include "../vertex/vertex.instances.hpp"
+#include "../uniform/uniform.camera.hpp"
+
+#include <vulkan/vulkan.h>
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+#ifndef VULKAN_RENDER_BATCHES_HPP
+#define VULKAN_RENDER_BATCHES_HPP
+
+// Object of the instanced batches, which draw several objects at once.
+constexpr const uint32_t INSTANCED_BATCH_OBJECT = UINT32_MAX;
+
+////////////////////////////////////////////////////
+//////////////////// Structures ////////////////////
+////////////////////////////////////////////////////
+
+// Draw of the frame: the instances sharing a mesh level of detail and a texture, or a single object whose clusters are culled.
+struct DrawBatch
+{
+    uint32_t mesh;
+    uint32_t lod;
+    int32_t texture;
+    uint32_t object;          // Object drawn alone, INSTANCED_BATCH_OBJECT for the instanced batches.
+    uint32_t first_instance;  // First instance of the batch in the instance buffer.
+    uint32_t instance_count;
+};
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+void build_draw_batches
+(
+    const std::vector<RenderObject> &objects,
+    const std::vector<uint32_t> &visible_objects,
+    const std::vector<MeshRange> &meshes,
+    const CameraData &camera,
+    const VkExtent2D &extent,
+    const size_t &textures_count,
+    InstanceData* instances,
+    std::vector<DrawBatch> &batches,
+    DrawStatistics &statistics
+);
+
+#endif
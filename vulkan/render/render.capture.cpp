@@ -0,0 +1,174 @@
+#include "render.capture.hpp"
+
+#include "../buffers/buffers.handler.hpp"
+#include "sync/render.sync.deletion.hpp"
+#include "../../logs/logs.handler.hpp"
+#include "../../utils/tool.images.hpp"
+#include "../../utils/tool.text.format.hpp"
+
+#include <vulkan/vulkan.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+// Create the host visible buffer a frame is copied into, nothing is created when no frame is captured.
+FrameCapture create_vulkan_frame_capture
+(
+    const VkDevice &logical_device,
+    const VkPhysicalDevice &physical_device,
+    const VkExtent2D &extent,
+    const bool &enabled
+)
+{
+    FrameCapture capture {};
+    capture.extent = extent;
+
+    if (!enabled)
+    {
+        return capture;
+    }
+
+    log("Creating a frame capture buffer..");
+
+    if (logical_device == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Frame capture buffer creation failed! The logical device provided (" + force_string(logical_device) + ") is not valid!");
+    }
+
+    if (physical_device == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Frame capture buffer creation failed! The physical device provided (" + force_string(physical_device) + ") is not valid!");
+    }
+
+    const VkDeviceSize buffer_size = static_cast<VkDeviceSize>(extent.width) * extent.height * 4;
+
+    create_vulkan_buffer(logical_device, physical_device, buffer_size, VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, capture.buffer.buffer, capture.buffer.buffer_memory);
+    vkMapMemory(logical_device, capture.buffer.buffer_memory, 0, buffer_size, 0, &capture.buffer.data); // Map the buffer memory in the app address space.
+
+    log("Frame capture buffer " + force_string(capture.buffer.buffer) + " created successfully!");
+    return capture;
+}
+
+// Destroy the frame capture buffer.
+void destroy_vulkan_frame_capture
+(
+    const VkDevice &logical_device,
+    FrameCapture &capture
+)
+{
+    // Nothing was created when no frame is captured.
+    if (capture.buffer.buffer == VK_NULL_HANDLE)
+    {
+        return;
+    }
+
+    log("Destroying the " + force_string(capture.buffer.buffer) + " frame capture buffer..");
+
+    if (logical_device == VK_NULL_HANDLE)
+    {
+        error_log("Frame capture buffer destruction failed! The logical device provided (" + force_string(logical_device) + ") is not valid!");
+        return;
+    }
+
+    vkDestroyBuffer(logical_device, capture.buffer.buffer, nullptr);
+    vkFreeMemory(logical_device, capture.buffer.buffer_memory, nullptr);
+    capture = {};
+
+    log("Frame capture buffer destroyed successfully!");
+}
+
+// Copy the rendered image into the capture buffer, after the last render pass of the frame.
+// The copy runs on the GPU with the frame, the CPU only reads the buffer once the frame is done, so the next frames are never stalled.
+// The render graph of the frame waits for the image writes before the copy, then makes the copied pixels visible to the CPU.
+void record_frame_capture
+(
+    const VkCommandBuffer &command_buffer,
+    const FrameCaptureTarget &target,
+    const VkExtent2D &extent
+)
+{
+    if (target.buffer == VK_NULL_HANDLE)
+    {
+        return;
+    }
+
+    if (target.image == VK_NULL_HANDLE)
+    {
+        error_log("Failed to record the frame capture! The image provided (" + force_string(target.image) + ") is not valid!");
+        return;
+    }
+
+    const VkBufferImageCopy region
+    {
+        .bufferOffset = 0,
+        .bufferRowLength = 0,                                       // The rows are tightly packed.
+        .bufferImageHeight = 0,
+        .imageSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1 }, // Copy the color of the single level and layer.
+        .imageOffset = { 0, 0, 0 },
+        .imageExtent = { extent.width, extent.height, 1 }
+    };
+
+    vkCmdCopyImageToBuffer(command_buffer, target.image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, target.buffer, 1, &region);
+}
+
+// Write the captured frame into a PPM image, the frame must be done.
+bool save_frame_capture
+(
+    const FrameCapture &capture,
+    const std::string &file_path
+)
+{
+    if (capture.buffer.data == nullptr)
+    {
+        error_log("Failed to save the frame capture! No frame capture buffer was created.");
+        return false;
+    }
+
+    // The offscreen images store their pixels in the B8G8R8A8 order, the PPM images in the RGB one.
+    const size_t pixels_count = static_cast<size_t>(capture.extent.width) * capture.extent.height;
+    const uint8_t* source = static_cast<const uint8_t*>(capture.buffer.data);
+    std::vector<uint8_t> pixels(pixels_count * 3);
+
+    for (size_t i = 0; i < pixels_count; i++)
+    {
+        pixels[i * 3] = source[i * 4 + 2];
+        pixels[i * 3 + 1] = source[i * 4 + 1];
+        pixels[i * 3 + 2] = source[i * 4];
+    }
+
+    return write_ppm_image(file_path, static_cast<int>(capture.extent.width), static_cast<int>(capture.extent.height), pixels);
+}
+
+///////////////////////////////////////////////
+//////////////////// Class ////////////////////
+///////////////////////////////////////////////
+
+// Constructor.
+Vulkan_FrameCapture::Vulkan_FrameCapture
+(
+    const VkDevice &logical_device,
+    const VkPhysicalDevice &physical_device,
+    const VkExtent2D &extent,
+    const bool &enabled
+) : logical_device(logical_device)
+{
+    capture = create_vulkan_frame_capture(logical_device, physical_device, extent, enabled);
+}
+
+// Destructor.
+Vulkan_FrameCapture::~Vulkan_FrameCapture()
+{
+    retire_vulkan_resource([logical_device = logical_device, capture = capture]() mutable
+    {
+        destroy_vulkan_frame_capture(logical_device, capture);
+    });
+}
+
+FrameCapture Vulkan_FrameCapture::get() const
+{
+    return capture;
+}
@@ -0,0 +1,92 @@
+#include "../uniform/uniform.buffers.hpp"
+
+#include <vulkan/vulkan.h>
+#include <cstdint>
+#include <string>
+
+#ifndef VULKAN_RENDER_CAPTURE_HPP
+#define VULKAN_RENDER_CAPTURE_HPP
+
+////////////////////////////////////////////////////
+//////////////////// Structures ////////////////////
+////////////////////////////////////////////////////
+
+// Host visible copy of a frame rendered in headless mode, its pixels being in the B8G8R8A8 format of the offscreen images.
+struct FrameCapture
+{
+    UniformBufferInfo buffer; // Null when no frame is captured.
+    VkExtent2D extent;
+};
+
+// Image copied into the capture buffer at the end of a frame, nothing is copied with a null buffer.
+struct FrameCaptureTarget
+{
+    VkImage image;
+    VkBuffer buffer;
+};
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+FrameCapture create_vulkan_frame_capture
+(
+    const VkDevice &logical_device,
+    const VkPhysicalDevice &physical_device,
+    const VkExtent2D &extent,
+    const bool &enabled
+);
+
+void destroy_vulkan_frame_capture
+(
+    const VkDevice &logical_device,
+    FrameCapture &capture
+);
+
+void record_frame_capture
+(
+    const VkCommandBuffer &command_buffer,
+    const FrameCaptureTarget &target,
+    const VkExtent2D &extent
+);
+
+bool save_frame_capture
+(
+    const FrameCapture &capture,
+    const std::string &file_path
+);
+
+///////////////////////////////////////////////
+//////////////////// Class ////////////////////
+///////////////////////////////////////////////
+
+class Vulkan_FrameCapture
+{
+
+public:
+    // Constructor.
+    Vulkan_FrameCapture
+    (
+        const VkDevice &logical_device,
+        const VkPhysicalDevice &physical_device,
+        const VkExtent2D &extent,
+        const bool &enabled
+    );
+
+    // Destructor.
+    ~Vulkan_FrameCapture();
+
+    FrameCapture get() const;
+
+    // Prevent data duplication.
+    Vulkan_FrameCapture(const Vulkan_FrameCapture&) = delete;
+    Vulkan_FrameCapture &operator = (const Vulkan_FrameCapture&) = delete;
+
+private:
+    // We declare the members of the class to store.
+    FrameCapture capture {};
+    VkDevice logical_device = VK_NULL_HANDLE;
+
+};
+
+#endif
@@ -0,0 +1,746 @@
+#include "render.culling.hpp"
+
+#include "render.statistics.hpp"
+#include "render.indirect.hpp"
+#include "sync/render.sync.deletion.hpp"
+#include "../shaders/shader.modules.hpp"
+#include "../shaders/shader.stages.hpp"
+#include "../depth/depth.pyramid.hpp"
+#include "../pipeline/compute.pipeline.hpp"
+#include "../vertex/models/models.geometry.hpp"
+#include "../vertex/vertex.instances.hpp"
+#include "../uniform/uniform.buffers.hpp"
+#include "../uniform/uniform.camera.hpp"
+#include "../uniform/uniform.frustum.hpp"
+#include "../buffers/buffers.handler.hpp"
+#include "../pipeline/pipeline.layout.hpp"
+#include "../descriptors/descriptor.set.layout.hpp"
+#include "../descriptors/descriptor.pool.hpp"
+#include "../../config/engine.config.hpp"
+#include "../../logs/logs.handler.hpp"
+#include "../../utils/tool.text.format.hpp"
+
+#include <vulkan/vulkan.h>
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <iterator>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <cmath>
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+// Check if the culling can run on the GPU: the indirect draws must read their instances from any offset,
+// and the graphics queue must accept the compute dispatches.
+bool is_gpu_culling_supported
+(
+    const IndirectDrawSupport &indirect_support,
+    const VkQueueFamilyProperties &graphics_family
+)
+{
+    return indirect_support.multi_draw && indirect_support.first_instance && (graphics_family.queueFlags & VK_QUEUE_COMPUTE_BIT);
+}
+
+// Return the amount of levels of detail of a mesh read by the culling shader, 0 if its objects can't be culled on the GPU.
+uint32_t get_gpu_culling_lods_count
+(
+    const MeshRange &mesh
+)
+{
+    if (mesh.index_type != VK_INDEX_TYPE_UINT16 && mesh.index_type != VK_INDEX_TYPE_UINT32)
+    {
+        return 0;
+    }
+
+    return static_cast<uint32_t>(std::min(mesh.lods.size(), static_cast<size_t>(CULLING_MAX_LODS)));
+}
+
+// Describe the meshes to the culling shader.
+// Each mesh owns an indirect draw per level of detail, ordered by index type then by mesh, like write_gpu_culling_objects() writes them.
+// The two phases culling doubles these draws, the second phase ones following the first phase ones.
+std::vector<GpuCullMesh> build_gpu_culling_meshes
+(
+    const std::vector<MeshRange> &meshes,
+    const bool &two_phases
+)
+{
+    std::vector<GpuCullMesh> output(meshes.size(), GpuCullMesh {});
+    uint32_t commands_count = 0;
+
+    for (const VkIndexType &index_type : { VK_INDEX_TYPE_UINT16, VK_INDEX_TYPE_UINT32 })
+    {
+        for (size_t i = 0; i < meshes.size(); i++)
+        {
+            const MeshRange &mesh = meshes[i];
+            const uint32_t lods_count = get_gpu_culling_lods_count(mesh);
+
+            if (lods_count < 1 || mesh.index_type != index_type)
+            {
+                continue;
+            }
+
+            GpuCullMesh &output_mesh = output[i];
+            output_mesh.bounds = glm::vec4(mesh.bounds_center, mesh.bounds_radius);
+            output_mesh.first_command = commands_count;
+            output_mesh.lods_count = lods_count;
+
+            for (uint32_t j = 0; j < lods_count; j++)
+            {
+                output_mesh.lod_errors[j] = mesh.lods[j].error;
+            }
+
+            commands_count += lods_count;
+        }
+    }
+
+    if (two_phases)
+    {
+        commands_count *= 2;
+    }
+
+    if (commands_count > EngineConfig::MAX_INDIRECT_DRAWS)
+    {
+        fatal_error_log("GPU culling meshes creation failed! The levels of detail of the meshes need " + std::to_string(commands_count) + " indirect draws, more than the " + std::to_string(EngineConfig::MAX_INDIRECT_DRAWS) + " available!");
+    }
+
+    return output;
+}
+
+// Write the objects to cull on the GPU, and the empty indirect draws the culling shader fills.
+// Each level of detail of a mesh reserves a slot per object of the mesh in the instance buffer, as any object may select it.
+// Note: The CPU work doesn't depend on the camera: no culling, no level of detail selection and no sorting.
+uint32_t write_gpu_culling_objects
+(
+    const std::vector<RenderObject> &objects,
+    const std::vector<MeshRange> &meshes,
+    const size_t &textures_count,
+    const bool &two_phases,
+    GpuCullObject* records,
+    std::vector<VkDrawIndexedIndirectCommand> &commands,
+    std::vector<IndirectDrawRun> &runs,
+    DrawStatistics &statistics
+)
+{
+    commands.clear();
+    runs.clear();
+
+    if (records == nullptr)
+    {
+        error_log("Failed to write the objects to cull! The object buffer isn't mapped.");
+        return 0;
+    }
+
+    std::vector<uint32_t> mesh_objects(meshes.size(), 0);
+    uint32_t objects_count = 0;
+    size_t reserved_instances = 0;
+    size_t skipped_objects = 0;
+
+    for (const RenderObject &object : objects)
+    {
+        if (object.mesh >= meshes.size())
+        {
+            continue;
+        }
+
+        const MeshRange &mesh = meshes[object.mesh];
+        const uint32_t lods_count = get_gpu_culling_lods_count(mesh);
+
+        if (lods_count < 1)
+        {
+            continue;
+        }
+
+        if (reserved_instances + lods_count > EngineConfig::MAX_SCENE_INSTANCES)
+        {
+            skipped_objects++;
+            continue;
+        }
+
+        // Select the default texture if the targeted texture doesn't exist.
+        int32_t texture = object.texture;
+
+        if (texture < 0 || static_cast<size_t>(texture) >= textures_count)
+        {
+            error_log("Texture #" + std::to_string(texture) + " not found!");
+            texture = 0;
+        }
+
+        records[objects_count++] = { object.transform, texture, object.mesh, 0 };
+        reserved_instances += lods_count;
+        mesh_objects[object.mesh]++;
+
+        statistics.total_triangles += mesh.lods[0].index_count / 3;
+    }
+
+    if (skipped_objects > 0)
+    {
+        error_log(std::to_string(skipped_objects) + " objects don't fit in the instance buffer (" + std::to_string(EngineConfig::MAX_SCENE_INSTANCES) + " instances)!");
+    }
+
+    // The draws start without any instance, the culling shader counts the visible ones.
+    uint32_t first_instance = 0;
+
+    for (const VkIndexType &index_type : { VK_INDEX_TYPE_UINT16, VK_INDEX_TYPE_UINT32 })
+    {
+        for (size_t i = 0; i < meshes.size(); i++)
+        {
+            const MeshRange &mesh = meshes[i];
+            const uint32_t lods_count = get_gpu_culling_lods_count(mesh);
+
+            if (lods_count < 1 || mesh.index_type != index_type)
+            {
+                continue;
+            }
+
+            if (runs.empty() || runs.back().index_type != index_type)
+            {
+                runs.push_back({ index_type, static_cast<uint32_t>(commands.size()), 0 });
+            }
+
+            for (uint32_t j = 0; j < lods_count; j++)
+            {
+                const VkDrawIndexedIndirectCommand command
+                {
+                    .indexCount = mesh.lods[j].index_count,
+                    .instanceCount = 0,
+                    .firstIndex = mesh.lods[j].first_index,
+                    .vertexOffset = static_cast<int32_t>(mesh.vertex_offset),
+                    .firstInstance = first_instance + j * mesh_objects[i]
+                };
+
+                commands.push_back(command);
+                runs.back().commands_count++;
+            }
+
+            first_instance += lods_count * mesh_objects[i];
+        }
+    }
+
+    // The second phase draws start empty too, their first instance is only known once the first phase is done (see culling.comp).
+    if (two_phases)
+    {
+        const uint32_t late_commands = static_cast<uint32_t>(commands.size());
+        const size_t early_runs = runs.size();
+
+        for (uint32_t i = 0; i < late_commands; i++)
+        {
+            commands.push_back(commands[i]);
+        }
+
+        for (size_t i = 0; i < early_runs; i++)
+        {
+            runs.push_back({ runs[i].index_type, runs[i].first_command + late_commands, runs[i].commands_count });
+        }
+    }
+
+    statistics.draw_calls = static_cast<uint32_t>(commands.size());
+    return objects_count;
+}
+
+// Gather the camera data read by the culling shader.
+GpuCullParameters get_gpu_culling_parameters
+(
+    const CameraData &camera,
+    const VkExtent2D &extent,
+    const uint32_t &objects_count,
+    const uint32_t &late_commands,
+    const DepthPyramid &depth_pyramid
+)
+{
+    const glm::mat4 view_projection = get_camera_projection_matrix(camera, extent) * get_camera_view_matrix(camera);
+    const Frustum frustum = extract_frustum(view_projection);
+    const float pixels_per_unit = static_cast<float>(extent.height) / (2.0f * std::tan(glm::radians(camera.field_of_view) * 0.5f));
+
+    GpuCullParameters parameters {};
+    parameters.view_projection = view_projection;
+
+    for (int i = 0; i < 6; i++)
+    {
+        parameters.planes[i] = frustum.planes[i];
+    }
+
+    parameters.camera = glm::vec4(camera.position, pixels_per_unit);
+    parameters.near_plane = camera.near_plane;
+    parameters.pixel_threshold = EngineConfig::LOD_PIXEL_ERROR_THRESHOLD;
+    parameters.objects_count = objects_count;
+    parameters.late_commands = late_commands;
+    parameters.pyramid_size = glm::vec2(depth_pyramid.extent.width, depth_pyramid.extent.height);
+    parameters.pyramid_levels = depth_pyramid.levels_count;
+
+    return parameters;
+}
+
+// Record a culling dispatch of a frame, before its render pass.
+// The render graph of the frame synchronizes the buffers it reads and writes with the draws, the host and the other culling phase.
+void record_gpu_culling
+(
+    const VkCommandBuffer &command_buffer,
+    const GpuCullingResources &culling,
+    const size_t &frame,
+    const uint32_t &phase,
+    const uint32_t &objects_count
+)
+{
+    if (culling.pipeline == VK_NULL_HANDLE || culling.pipeline_layout == VK_NULL_HANDLE)
+    {
+        error_log("Failed to record the GPU culling! The culling pipeline (" + force_string(culling.pipeline) + ") or its layout (" + force_string(culling.pipeline_layout) + ") is not valid!");
+        return;
+    }
+
+    if (frame >= culling.descriptor_sets.size())
+    {
+        error_log("Failed to record the GPU culling! The frame index is out of bounds for the descriptor sets: " + std::to_string(frame) + " >= " + std::to_string(culling.descriptor_sets.size()) + ".");
+        return;
+    }
+
+    vkCmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, culling.pipeline); // Bind the culling pipeline to the command buffer.
+    vkCmdBindDescriptorSets(command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, culling.pipeline_layout, 0, 1, &culling.descriptor_sets[frame], 0, nullptr);
+    vkCmdPushConstants(command_buffer, culling.pipeline_layout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(uint32_t), &phase);
+
+    if (objects_count > 0)
+    {
+        vkCmdDispatch(command_buffer, (objects_count + CULLING_WORKGROUP_SIZE - 1) / CULLING_WORKGROUP_SIZE, 1, 1);
+    }
+}
+
+// Read the instances and the occluded objects counted by the culling shader the last time a frame was recorded.
+// The statistics are one frame in flight late, as the buffers are read right after their fence.
+void read_gpu_culling_statistics
+(
+    const void* frame_data,
+    const void* indirect_data,
+    DrawStatistics &statistics
+)
+{
+    if (frame_data == nullptr || indirect_data == nullptr)
+    {
+        return;
+    }
+
+    statistics.occluded_objects = static_cast<const GpuCullFrame*>(frame_data)->occluded_objects;
+
+    const VkDrawIndexedIndirectCommand* commands = static_cast<const VkDrawIndexedIndirectCommand*>(indirect_data);
+    const uint32_t* draw_counts = reinterpret_cast<const uint32_t*>(static_cast<const char*>(indirect_data) + get_indirect_count_offset(0));
+    uint32_t commands_count = 0;
+
+    for (uint32_t i = 0; i < MAX_INDIRECT_RUNS; i++)
+    {
+        commands_count += draw_counts[i];
+    }
+
+    commands_count = std::min(commands_count, static_cast<uint32_t>(EngineConfig::MAX_INDIRECT_DRAWS));
+    statistics.visible_objects = 0;
+    statistics.submitted_triangles = 0;
+
+    for (uint32_t i = 0; i < commands_count; i++)
+    {
+        statistics.visible_objects += commands[i].instanceCount;
+        statistics.submitted_triangles += static_cast<uint64_t>(commands[i].indexCount / 3) * commands[i].instanceCount;
+    }
+}
+
+// Compare the objects kept by the culling shader with the visible objects found by the CPU culling.
+// The indirect and instance buffers must hold the results of the frame, once the GPU is done with it.
+// The occlusion culling only removes objects, so the GPU may then miss some of the CPU visible objects, but never add any.
+bool validate_gpu_culling
+(
+    const std::vector<RenderObject> &objects,
+    const std::vector<MeshRange> &meshes,
+    const std::vector<uint32_t> &visible_objects,
+    const std::vector<VkDrawIndexedIndirectCommand> &commands,
+    const bool &occlusion,
+    const void* indirect_data,
+    const void* instance_data
+)
+{
+    if (indirect_data == nullptr || instance_data == nullptr)
+    {
+        error_log("Failed to validate the GPU culling! The indirect buffer or the instance buffer isn't mapped.");
+        return false;
+    }
+
+    const VkDrawIndexedIndirectCommand* gpu_commands = static_cast<const VkDrawIndexedIndirectCommand*>(indirect_data);
+    const InstanceData* gpu_instances = static_cast<const InstanceData*>(instance_data);
+
+    // The transforms identify the objects, the GPU only writes them in the instances.
+    std::vector<uint32_t> gpu_transforms;
+    std::vector<uint32_t> cpu_transforms;
+    cpu_transforms.reserve(visible_objects.size());
+
+    for (size_t i = 0; i < commands.size(); i++)
+    {
+        for (uint32_t j = 0; j < gpu_commands[i].instanceCount; j++)
+        {
+            gpu_transforms.push_back(gpu_instances[gpu_commands[i].firstInstance + j].transform_index);
+        }
+    }
+
+    for (const uint32_t &object_index : visible_objects)
+    {
+        if (object_index < objects.size() && objects[object_index].mesh < meshes.size() && get_gpu_culling_lods_count(meshes[objects[object_index].mesh]) > 0)
+        {
+            cpu_transforms.push_back(objects[object_index].transform);
+        }
+    }
+
+    std::sort(gpu_transforms.begin(), gpu_transforms.end());
+    std::sort(cpu_transforms.begin(), cpu_transforms.end());
+
+    std::vector<uint32_t> cpu_only;
+    std::vector<uint32_t> gpu_only;
+    std::set_difference(cpu_transforms.begin(), cpu_transforms.end(), gpu_transforms.begin(), gpu_transforms.end(), std::back_inserter(cpu_only));
+    std::set_difference(gpu_transforms.begin(), gpu_transforms.end(), cpu_transforms.begin(), cpu_transforms.end(), std::back_inserter(gpu_only));
+
+    if (gpu_only.empty() && (occlusion || cpu_only.empty()))
+    {
+        return true;
+    }
+
+    error_log("GPU culling mismatch! " + std::to_string(cpu_only.size()) + " objects are only visible on the CPU and " + std::to_string(gpu_only.size()) + " objects are only visible on the GPU ("
+        + std::to_string(cpu_transforms.size()) + " visible on the CPU, " + std::to_string(gpu_transforms.size()) + " on the GPU).");
+
+    return false;
+}
+
+// Types of the culling shader bindings (see culling.comp).
+// Transforms, frame, meshes, indirect draws and instances, then the visibility and the depth pyramid of the occlusion culling.
+std::vector<VkDescriptorType> get_culling_bindings_types
+(
+    const bool &occlusion
+)
+{
+    std::vector<VkDescriptorType> bindings_types(5, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+
+    if (occlusion)
+    {
+        bindings_types.push_back(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+        bindings_types.push_back(VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER);
+    }
+
+    return bindings_types;
+}
+
+// Create a culling descriptor set for each frame in flight, bound to the buffers of that frame.
+// The visibility buffer is shared by the images, the depth pyramid is bound apart as it follows the swap chain size.
+std::vector<VkDescriptorSet> create_vulkan_culling_descriptor_sets
+(
+    const VkDevice &logical_device,
+    const uint32_t &images_count,
+    const VkDescriptorSetLayout &descriptor_set_layout,
+    const VkDescriptorPool &descriptor_pool,
+    const std::vector<UniformBufferInfo> &transform_buffers,
+    const std::vector<UniformBufferInfo> &frame_buffers,
+    const UniformBufferInfo &mesh_buffer,
+    const std::vector<UniformBufferInfo> &indirect_buffers,
+    const std::vector<UniformBufferInfo> &instance_buffers,
+    const std::vector<UniformBufferInfo> &visibility_buffers
+)
+{
+    log("Creating " + std::to_string(images_count) + " culling descriptor sets..");
+
+    if (logical_device == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Culling descriptor sets creation failed! The logical device provided (" + force_string(logical_device) + ") is not valid!");
+    }
+
+    if (descriptor_set_layout == VK_NULL_HANDLE || descriptor_pool == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Culling descriptor sets creation failed! The descriptor set layout (" + force_string(descriptor_set_layout) + ") or the descriptor pool (" + force_string(descriptor_pool) + ") provided is not valid!");
+    }
+
+    if (transform_buffers.size() < images_count || frame_buffers.size() < images_count || indirect_buffers.size() < images_count || instance_buffers.size() < images_count)
+    {
+        fatal_error_log("Culling descriptor sets creation failed! Some buffers are missing for the " + std::to_string(images_count) + " images!");
+    }
+
+    if (mesh_buffer.buffer == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Culling descriptor sets creation failed! The mesh buffer provided (" + force_string(mesh_buffer.buffer) + ") is not valid!");
+    }
+
+    std::vector<VkDescriptorSet> descriptor_sets(images_count);
+    std::vector<VkDescriptorSetLayout> layouts(images_count, descriptor_set_layout); // Duplicate 'images count' times the descriptor set layout.
+
+    VkDescriptorSetAllocateInfo allocation_info
+    {
+        .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
+        .descriptorPool = descriptor_pool,
+        .descriptorSetCount = images_count, // Amount of descriptor sets to pass.
+        .pSetLayouts = layouts.data()       // Pass the descriptor set layouts.
+    };
+
+    const VkResult sets_allocation = vkAllocateDescriptorSets(logical_device, &allocation_info, descriptor_sets.data());
+
+    if (sets_allocation != VK_SUCCESS)
+    {
+        fatal_error_log("Culling descriptor sets creation failed! Descriptor sets allocation returned error code " + std::to_string(sets_allocation) + ".");
+    }
+
+    for (uint32_t i = 0; i < images_count; i++)
+    {
+        // The indirect draws binding stops before the draw counts, which stay written by the CPU.
+        std::vector<VkDescriptorBufferInfo> buffers_info =
+        {
+            { transform_buffers[i].buffer, 0, VK_WHOLE_SIZE },
+            { frame_buffers[i].buffer, 0, VK_WHOLE_SIZE },
+            { mesh_buffer.buffer, 0, VK_WHOLE_SIZE },
+            { indirect_buffers[i].buffer, 0, get_indirect_count_offset(0) },
+            { instance_buffers[i].buffer, 0, VK_WHOLE_SIZE }
+        };
+
+        if (!visibility_buffers.empty())
+        {
+            buffers_info.push_back({ visibility_buffers[0].buffer, 0, VK_WHOLE_SIZE });
+        }
+
+        std::vector<VkWriteDescriptorSet> write_sets(buffers_info.size());
+
+        for (uint32_t j = 0; j < write_sets.size(); j++)
+        {
+            write_sets[j].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            write_sets[j].dstSet = descriptor_sets[i];
+            write_sets[j].dstBinding = j;                                     // Binding index in the shader.
+            write_sets[j].dstArrayElement = 0;
+            write_sets[j].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            write_sets[j].descriptorCount = 1;
+            write_sets[j].pBufferInfo = &buffers_info[j];
+        }
+
+        vkUpdateDescriptorSets(logical_device, static_cast<uint32_t>(write_sets.size()), write_sets.data(), 0, nullptr);
+        log("- Culling descriptor set #" + std::to_string(i + 1) + "/" + std::to_string(descriptor_sets.size()) + " created successfully!");
+    }
+
+    log(std::to_string(descriptor_sets.size()) + " culling descriptor sets created successfully!");
+    return descriptor_sets;
+}
+
+// Bind the depth pyramid to the culling descriptor sets, again each time the pyramid is recreated.
+void bind_vulkan_culling_depth_pyramid
+(
+    const VkDevice &logical_device,
+    const std::vector<VkDescriptorSet> &descriptor_sets,
+    const DepthPyramid &depth_pyramid
+)
+{
+    if (logical_device == VK_NULL_HANDLE)
+    {
+        error_log("Culling depth pyramid binding failed! The logical device provided (" + force_string(logical_device) + ") is not valid!");
+        return;
+    }
+
+    if (depth_pyramid.image_view == VK_NULL_HANDLE || depth_pyramid.sampler == VK_NULL_HANDLE)
+    {
+        error_log("Culling depth pyramid binding failed! The depth pyramid provided (" + force_string(depth_pyramid.image_view) + ") is not valid!");
+        return;
+    }
+
+    const VkDescriptorImageInfo image_info
+    {
+        .sampler = depth_pyramid.sampler,
+        .imageView = depth_pyramid.image_view,
+        .imageLayout = VK_IMAGE_LAYOUT_GENERAL // The pyramid stays in the layout of its reduction.
+    };
+
+    for (const VkDescriptorSet &descriptor_set : descriptor_sets)
+    {
+        VkWriteDescriptorSet write_set {};
+        write_set.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        write_set.dstSet = descriptor_set;
+        write_set.dstBinding = 6;
+        write_set.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        write_set.descriptorCount = 1;
+        write_set.pImageInfo = &image_info;
+
+        vkUpdateDescriptorSets(logical_device, 1, &write_set, 0, nullptr);
+    }
+
+    log("Depth pyramid " + force_string(depth_pyramid.image_view) + " bound to " + std::to_string(descriptor_sets.size()) + " culling descriptor sets successfully!");
+}
+
+// Create some mapped storage buffers read by the culling shader.
+std::vector<UniformBufferInfo> create_vulkan_culling_buffers
+(
+    const VkDevice &logical_device,
+    const VkPhysicalDevice &physical_device,
+    const VkDeviceSize &buffer_size,
+    const uint32_t &buffers_count
+)
+{
+    log("Creating " + std::to_string(buffers_count) + " culling buffers..");
+
+    if (logical_device == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Culling buffers creation failed! The logical device provided (" + force_string(logical_device) + ") is not valid!");
+    }
+
+    if (physical_device == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Culling buffers creation failed! The physical device provided (" + force_string(physical_device) + ") is not valid!");
+    }
+
+    if (buffer_size < 1 || buffers_count < 1)
+    {
+        fatal_error_log("Culling buffers creation failed! The buffer size (" + std::to_string(buffer_size) + ") or the buffers count (" + std::to_string(buffers_count) + ") provided is not valid!");
+    }
+
+    std::vector<UniformBufferInfo> output;
+    output.reserve(buffers_count);
+
+    for (uint32_t i = 0; i < buffers_count; i++)
+    {
+        VkBuffer buffer = VK_NULL_HANDLE;
+        VkDeviceMemory buffer_memory = VK_NULL_HANDLE;
+        void* data;
+
+        create_vulkan_buffer(logical_device, physical_device, buffer_size, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, buffer, buffer_memory);
+        vkMapMemory(logical_device, buffer_memory, 0, buffer_size, 0, &data); // Map the buffer memory in the app address space.
+
+        const UniformBufferInfo info =
+        {
+            buffer,
+            buffer_memory,
+            data
+        };
+
+        output.emplace_back(info);
+        log("- Culling buffer #" + std::to_string(i + 1) + "/" + std::to_string(buffers_count) + " (" + force_string(buffer) + ") created successfully!");
+    }
+
+    log(std::to_string(output.size()) + " culling buffers created successfully!");
+    return output;
+}
+
+// Destroy some culling buffers.
+void destroy_vulkan_culling_buffers
+(
+    const VkDevice &logical_device,
+    std::vector<UniformBufferInfo> &culling_buffers
+)
+{
+    log("Destroying " + std::to_string(culling_buffers.size()) + " culling buffers..");
+
+    if (logical_device == VK_NULL_HANDLE)
+    {
+        error_log("Culling buffers destruction failed! The logical device provided (" + force_string(logical_device) + ") is not valid!");
+        return;
+    }
+
+    int failed = 0;
+
+    for (UniformBufferInfo &culling_buffer : culling_buffers)
+    {
+        if (culling_buffer.buffer == VK_NULL_HANDLE || culling_buffer.buffer_memory == VK_NULL_HANDLE)
+        {
+            failed++;
+            continue;
+        }
+
+        vkDestroyBuffer(logical_device, culling_buffer.buffer, nullptr);
+        vkFreeMemory(logical_device, culling_buffer.buffer_memory, nullptr);
+
+        culling_buffer.buffer = VK_NULL_HANDLE;
+        culling_buffer.buffer_memory = VK_NULL_HANDLE;
+        culling_buffer.data = nullptr;
+    }
+
+    if (failed > 0)
+    {
+        error_log("Warning: " + std::to_string(failed) + " culling buffers failed to destroy! This might lead to some memory leaks or memory overload.");
+    }
+
+    log(std::to_string(culling_buffers.size() - failed) + "/" + std::to_string(culling_buffers.size()) + " culling buffers destroyed successfully!");
+    culling_buffers.clear();
+}
+
+///////////////////////////////////////////////
+//////////////////// Class ////////////////////
+///////////////////////////////////////////////
+
+// Constructor.
+// Nothing is created when the culling runs on the CPU, the resources then hold a null pipeline.
+Vulkan_GpuCulling::Vulkan_GpuCulling
+(
+    const bool &enabled,
+    const bool &occlusion,
+    const VkDevice &logical_device,
+    const PipelineCache &pipeline_cache,
+    const VkPhysicalDevice &physical_device,
+    const std::vector<ShaderInfo> &shaders_modules,
+    const std::vector<MeshRange> &meshes,
+    const std::vector<UniformBufferInfo> &transform_buffers,
+    const std::vector<UniformBufferInfo> &indirect_buffers,
+    const std::vector<UniformBufferInfo> &instance_buffers,
+    const uint32_t &images_count
+) : logical_device(logical_device), occlusion(enabled && occlusion)
+{
+    if (!enabled)
+    {
+        return;
+    }
+
+    const std::vector<VkDescriptorType> bindings_types = get_culling_bindings_types(this->occlusion);
+    const VkPipelineShaderStageCreateInfo shader_stage = create_vulkan_compute_shader_stage(shaders_modules, this->occlusion ? "culling.occlusion.comp" : "culling.comp");
+
+    descriptor_set_layout = create_vulkan_compute_descriptor_set_layout(logical_device, bindings_types);
+    pipeline_layout = create_vulkan_compute_pipeline_layout(logical_device, descriptor_set_layout, sizeof(uint32_t)); // The culling phase.
+    pipeline = create_vulkan_compute_pipeline(logical_device, pipeline_cache, shader_stage, pipeline_layout);
+
+    // The meshes never change, their buffer is written once.
+    const std::vector<GpuCullMesh> culling_meshes = build_gpu_culling_meshes(meshes, this->occlusion);
+    mesh_buffers = create_vulkan_culling_buffers(logical_device, physical_device, sizeof(GpuCullMesh) * std::max(culling_meshes.size(), static_cast<size_t>(1)), 1);
+    std::memcpy(mesh_buffers[0].data, culling_meshes.data(), sizeof(GpuCullMesh) * culling_meshes.size());
+
+    frame_buffers = create_vulkan_culling_buffers(logical_device, physical_device, sizeof(GpuCullFrame) + sizeof(GpuCullObject) * EngineConfig::MAX_SCENE_INSTANCES, images_count);
+
+    // The visibility of the objects carries over the frames, nothing is visible at first.
+    if (this->occlusion)
+    {
+        visibility_buffers = create_vulkan_culling_buffers(logical_device, physical_device, sizeof(uint32_t) * EngineConfig::MAX_SCENE_INSTANCES, 1);
+        std::memset(visibility_buffers[0].data, 0, sizeof(uint32_t) * EngineConfig::MAX_SCENE_INSTANCES);
+    }
+
+    descriptor_pool = create_vulkan_compute_descriptor_pool(logical_device, bindings_types, images_count);
+    descriptor_sets = create_vulkan_culling_descriptor_sets(logical_device, images_count, descriptor_set_layout, descriptor_pool, transform_buffers, frame_buffers, mesh_buffers[0], indirect_buffers, instance_buffers, visibility_buffers);
+}
+
+// Destructor.
+Vulkan_GpuCulling::~Vulkan_GpuCulling()
+{
+    if (pipeline == VK_NULL_HANDLE)
+    {
+        return;
+    }
+
+    retire_vulkan_resource
+    (
+        [
+            logical_device = logical_device,
+            descriptor_pool = descriptor_pool,
+            visibility_buffers = visibility_buffers,
+            frame_buffers = frame_buffers,
+            mesh_buffers = mesh_buffers,
+            pipeline = pipeline,
+            pipeline_layout = pipeline_layout,
+            descriptor_set_layout = descriptor_set_layout
+        ]() mutable
+        {
+            destroy_vulkan_descriptor_pool(logical_device, descriptor_pool); // Also frees the descriptor sets.
+            destroy_vulkan_culling_buffers(logical_device, visibility_buffers);
+            destroy_vulkan_culling_buffers(logical_device, frame_buffers);
+            destroy_vulkan_culling_buffers(logical_device, mesh_buffers);
+            destroy_vulkan_compute_pipeline(logical_device, pipeline);
+            destroy_vulkan_pipeline_layout(logical_device, pipeline_layout);
+            destroy_vulkan_descriptor_set_layout(logical_device, descriptor_set_layout);
+        }
+    );
+}
+
+GpuCullingResources Vulkan_GpuCulling::get() const
+{
+    return { pipeline, pipeline_layout, descriptor_sets, frame_buffers, visibility_buffers.empty() ? VK_NULL_HANDLE : visibility_buffers[0].buffer, occlusion };
+}
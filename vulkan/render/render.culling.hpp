@@ -0,0 +1,238 @@
+#include "render.statistics.hpp"
+#include "render.indirect.hpp"
+#include "../shaders/shader.modules.hpp"
+#include "../depth/depth.pyramid.hpp"
+#include "../vertex/models/models.geometry.hpp"
+#include "../uniform/uniform.buffers.hpp"
+#include "../uniform/uniform.camera.hpp"
+
+#include <vulkan/vulkan.h>
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+#ifndef VULKAN_RENDER_CULLING_HPP
+#define VULKAN_RENDER_CULLING_HPP
+
+// Amount of objects culled by each workgroup of the culling shader (see local_size_x in culling.comp).
+constexpr const uint32_t CULLING_WORKGROUP_SIZE = 64;
+
+// Maximum amount of levels of detail per mesh read by the culling shader.
+constexpr const uint32_t CULLING_MAX_LODS = 4;
+
+////////////////////////////////////////////////////
+//////////////////// Structures ////////////////////
+////////////////////////////////////////////////////
+
+// Object to cull on the GPU (see CullObject in culling.comp).
+struct GpuCullObject
+{
+    uint32_t transform;  // Index of the object world matrix in the transform buffer.
+    int32_t texture;
+    uint32_t mesh;
+    uint32_t padding;
+};
+
+// Mesh of the objects culled on the GPU (see CullMesh in culling.comp).
+struct GpuCullMesh
+{
+    glm::vec4 bounds;        // Bounding sphere in model space: center (xyz) and radius (w).
+    glm::vec4 lod_errors;    // Geometric error of each level of detail.
+    uint32_t first_command;  // Indirect draw of the first level of detail, the other levels follow it.
+    uint32_t lods_count;
+    uint32_t padding[2];
+};
+
+// Camera and scene data read by the culling shader (see CullParameters in culling.comp).
+struct GpuCullParameters
+{
+    glm::mat4 view_projection;  // Projects the objects onto the depth pyramid.
+    glm::vec4 planes[6];        // Normalized frustum planes.
+    glm::vec4 camera;           // Camera position (xyz) and pixels per world unit at a distance of 1 (w).
+    glm::vec2 pyramid_size;     // Size of the first level of the depth pyramid.
+    float near_plane;
+    float pixel_threshold;
+    uint32_t objects_count;
+    uint32_t late_commands;     // Offset of the second phase draws, after the first phase ones.
+    uint32_t pyramid_levels;
+    uint32_t padding;
+};
+
+// Header of the frame buffer read by the culling shader, the objects to cull follow it (see FrameBuffer in culling.comp).
+struct GpuCullFrame
+{
+    GpuCullParameters parameters;
+    uint32_t occluded_objects;   // Counted by the culling shader.
+    uint32_t padding[3];
+};
+
+// Vulkan objects used to record the culling of a frame.
+struct GpuCullingResources
+{
+    VkPipeline pipeline;                          // VK_NULL_HANDLE when the culling runs on the CPU.
+    VkPipelineLayout pipeline_layout;
+    std::vector<VkDescriptorSet> descriptor_sets; // One per frame.
+    std::vector<UniformBufferInfo> frame_buffers;
+    VkBuffer visibility_buffer;                   // Visibility of the previous frame, VK_NULL_HANDLE without the occlusion culling.
+    bool occlusion;                               // Two phases culling against the depth pyramid.
+};
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+bool is_gpu_culling_supported
+(
+    const IndirectDrawSupport &indirect_support,
+    const VkQueueFamilyProperties &graphics_family
+);
+
+uint32_t get_gpu_culling_lods_count
+(
+    const MeshRange &mesh
+);
+
+std::vector<GpuCullMesh> build_gpu_culling_meshes
+(
+    const std::vector<MeshRange> &meshes,
+    const bool &two_phases
+);
+
+uint32_t write_gpu_culling_objects
+(
+    const std::vector<RenderObject> &objects,
+    const std::vector<MeshRange> &meshes,
+    const size_t &textures_count,
+    const bool &two_phases,
+    GpuCullObject* records,
+    std::vector<VkDrawIndexedIndirectCommand> &commands,
+    std::vector<IndirectDrawRun> &runs,
+    DrawStatistics &statistics
+);
+
+GpuCullParameters get_gpu_culling_parameters
+(
+    const CameraData &camera,
+    const VkExtent2D &extent,
+    const uint32_t &objects_count,
+    const uint32_t &late_commands,
+    const DepthPyramid &depth_pyramid
+);
+
+void record_gpu_culling
+(
+    const VkCommandBuffer &command_buffer,
+    const GpuCullingResources &culling,
+    const size_t &frame,
+    const uint32_t &phase,
+    const uint32_t &objects_count
+);
+
+void read_gpu_culling_statistics
+(
+    const void* frame_data,
+    const void* indirect_data,
+    DrawStatistics &statistics
+);
+
+bool validate_gpu_culling
+(
+    const std::vector<RenderObject> &objects,
+    const std::vector<MeshRange> &meshes,
+    const std::vector<uint32_t> &visible_objects,
+    const std::vector<VkDrawIndexedIndirectCommand> &commands,
+    const bool &occlusion,
+    const void* indirect_data,
+    const void* instance_data
+);
+
+std::vector<VkDescriptorType> get_culling_bindings_types
+(
+    const bool &occlusion
+);
+
+std::vector<VkDescriptorSet> create_vulkan_culling_descriptor_sets
+(
+    const VkDevice &logical_device,
+    const uint32_t &images_count,
+    const VkDescriptorSetLayout &descriptor_set_layout,
+    const VkDescriptorPool &descriptor_pool,
+    const std::vector<UniformBufferInfo> &transform_buffers,
+    const std::vector<UniformBufferInfo> &frame_buffers,
+    const UniformBufferInfo &mesh_buffer,
+    const std::vector<UniformBufferInfo> &indirect_buffers,
+    const std::vector<UniformBufferInfo> &instance_buffers,
+    const std::vector<UniformBufferInfo> &visibility_buffers
+);
+
+void bind_vulkan_culling_depth_pyramid
+(
+    const VkDevice &logical_device,
+    const std::vector<VkDescriptorSet> &descriptor_sets,
+    const DepthPyramid &depth_pyramid
+);
+
+std::vector<UniformBufferInfo> create_vulkan_culling_buffers
+(
+    const VkDevice &logical_device,
+    const VkPhysicalDevice &physical_device,
+    const VkDeviceSize &buffer_size,
+    const uint32_t &buffers_count
+);
+
+void destroy_vulkan_culling_buffers
+(
+    const VkDevice &logical_device,
+    std::vector<UniformBufferInfo> &culling_buffers
+);
+
+///////////////////////////////////////////////
+//////////////////// Class ////////////////////
+///////////////////////////////////////////////
+
+class Vulkan_GpuCulling
+{
+
+public:
+    // Constructor.
+    Vulkan_GpuCulling
+    (
+        const bool &enabled,
+        const bool &occlusion,
+        const VkDevice &logical_device,
+        const PipelineCache &pipeline_cache,
+        const VkPhysicalDevice &physical_device,
+        const std::vector<ShaderInfo> &shaders_modules,
+        const std::vector<MeshRange> &meshes,
+        const std::vector<UniformBufferInfo> &transform_buffers,
+        const std::vector<UniformBufferInfo> &indirect_buffers,
+        const std::vector<UniformBufferInfo> &instance_buffers,
+        const uint32_t &images_count
+    );
+
+    // Destructor.
+    ~Vulkan_GpuCulling();
+
+    GpuCullingResources get() const;
+
+    // Prevent data duplication.
+    Vulkan_GpuCulling(const Vulkan_GpuCulling&) = delete;
+    Vulkan_GpuCulling &operator = (const Vulkan_GpuCulling&) = delete;
+
+private:
+    // We declare the members of the class to store.
+    VkDevice logical_device = VK_NULL_HANDLE;
+    bool occlusion = false;
+    VkDescriptorSetLayout descriptor_set_layout = VK_NULL_HANDLE;
+    VkPipelineLayout pipeline_layout = VK_NULL_HANDLE;
+    VkPipeline pipeline = VK_NULL_HANDLE;
+    VkDescriptorPool descriptor_pool = VK_NULL_HANDLE;
+    std::vector<VkDescriptorSet> descriptor_sets;
+    std::vector<UniformBufferInfo> frame_buffers;
+    std::vector<UniformBufferInfo> mesh_buffers;
+    std::vector<UniformBufferInfo> visibility_buffers;
+
+};
+
+#endif
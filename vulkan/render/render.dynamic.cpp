@@ -0,0 +1,185 @@
+#include "render.dynamic.hpp"
+
+#include "../depth/depth.formats.hpp"
+#include "../../config/engine.config.hpp"
+#include "../../logs/logs.handler.hpp"
+#include "../../utils/tool.text.format.hpp"
+
+#include <vulkan/vulkan.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+// Determine if the device can draw without render pass nor framebuffer, which needs Vulkan 1.3.
+bool get_dynamic_rendering_support
+(
+    const VkPhysicalDevice &physical_device
+)
+{
+    if (physical_device == VK_NULL_HANDLE)
+    {
+        error_log("Failed to determine the dynamic rendering support! The physical device provided (" + force_string(physical_device) + ") is not valid!");
+        return false;
+    }
+
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(physical_device, &properties);
+
+    if (properties.apiVersion < VK_API_VERSION_1_3)
+    {
+        log("Dynamic rendering support: no, the device doesn't support Vulkan 1.3.");
+        return false;
+    }
+
+    VkPhysicalDeviceVulkan13Features vulkan13_features { .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES };
+    VkPhysicalDeviceFeatures2 features
+    {
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2,
+        .pNext = &vulkan13_features
+    };
+
+    vkGetPhysicalDeviceFeatures2(physical_device, &features);
+
+    const bool supported = vulkan13_features.dynamicRendering == VK_TRUE;
+    log("Dynamic rendering support: " + std::string(supported ? "yes" : "no") + ".");
+
+    return supported;
+}
+
+// Describe the attachments a graphics pipeline draws into, in place of its render pass.
+// The stencil is never used, so the depth image is only given as the depth attachment, even when its format has a stencil.
+// Note: the info points to the color format, which must outlive the pipeline creation.
+VkPipelineRenderingCreateInfo create_vulkan_pipeline_rendering_info
+(
+    const VkFormat &color_format,
+    const VkFormat &depth_format
+)
+{
+    const VkPipelineRenderingCreateInfo rendering_info
+    {
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO,
+        .colorAttachmentCount = 1,
+        .pColorAttachmentFormats = &color_format,
+        .depthAttachmentFormat = depth_format,
+        .stencilAttachmentFormat = VK_FORMAT_UNDEFINED // No stencil attachment is given to the dynamic rendering.
+    };
+
+    return rendering_info;
+}
+
+// Gather the attachments drawn with the dynamic rendering, no images are gathered when the render passes are used.
+// They must be gathered again when the swap chain or the depth resources are recreated.
+DynamicRenderingAttachments get_dynamic_rendering_attachments
+(
+    const bool &enabled,
+    const std::vector<VkImage> &images,
+    const std::vector<VkImageView> &images_views,
+    const VkFormat &color_format,
+    const VkImage &depth_image,
+    const VkImageView &depth_image_view,
+    const VkFormat &depth_format,
+    const VkSampleCountFlagBits &samples_count,
+    const VkImageLayout &final_layout
+)
+{
+    DynamicRenderingAttachments attachments {};
+
+    if (!enabled)
+    {
+        return attachments;
+    }
+
+    if (images.size() != images_views.size())
+    {
+        fatal_error_log("Failed to gather the dynamic rendering attachments! The images count doesn't match their views count: " + std::to_string(images.size()) + " != " + std::to_string(images_views.size()) + ".");
+    }
+
+    attachments.images = images;
+    attachments.images_views = images_views;
+    attachments.color_format = color_format;
+    attachments.depth_image = depth_image;
+    attachments.depth_image_view = depth_image_view;
+    attachments.depth_format = depth_format;
+    attachments.depth_aspect = has_stencil_component(depth_format) ? VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT : VK_IMAGE_ASPECT_DEPTH_BIT;
+    attachments.samples_count = samples_count;
+    attachments.final_layout = final_layout;
+
+    return attachments;
+}
+
+// Begin drawing into the attachments of an image, clearing them or loading the content of the previous rendering.
+// The attachments must already be in their attachment layouts, the render graph recording the barriers the render pass did.
+// The multisampled color view comes from the transient images of that graph.
+void begin_dynamic_rendering
+(
+    const VkCommandBuffer &command_buffer,
+    const DynamicRenderingAttachments &attachments,
+    const VkImageView &color_image_view,
+    const uint32_t &image_index,
+    const VkExtent2D &extent,
+    const bool &load,
+    const VkRenderingFlags &flags
+)
+{
+    if (image_index >= attachments.images.size())
+    {
+        error_log("Failed to begin the dynamic rendering! The image index provided is out of bounds for the images: " + std::to_string(image_index) + " >= " + std::to_string(attachments.images.size()) + ".");
+        return;
+    }
+
+    VkRenderingAttachmentInfo color_attachment
+    {
+        .sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO,
+        .imageView = color_image_view,
+        .imageLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+        .resolveMode = VK_RESOLVE_MODE_AVERAGE_BIT,                                 // Resolve the samples into the image, like the resolve attachment.
+        .resolveImageView = attachments.images_views[image_index],
+        .resolveImageLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+        .loadOp = load ? VK_ATTACHMENT_LOAD_OP_LOAD : VK_ATTACHMENT_LOAD_OP_CLEAR,  // Keep the content of the previous rendering, or clear it.
+        .storeOp = VK_ATTACHMENT_STORE_OP_STORE
+    };
+
+    color_attachment.clearValue.color = {{ 0.0f, 0.0f, 0.0f, 1.0f }};
+
+    VkRenderingAttachmentInfo depth_attachment
+    {
+        .sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO,
+        .imageView = attachments.depth_image_view,
+        .imageLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
+        .loadOp = load ? VK_ATTACHMENT_LOAD_OP_LOAD : VK_ATTACHMENT_LOAD_OP_CLEAR,
+        .storeOp = EngineConfig::USE_OCCLUSION_CULLING ? VK_ATTACHMENT_STORE_OP_STORE : VK_ATTACHMENT_STORE_OP_DONT_CARE // Only store the depth for the occlusion culling.
+    };
+
+    depth_attachment.clearValue.depthStencil = { 1.0f, 0 };
+
+    const VkRenderingInfo rendering_info
+    {
+        .sType = VK_STRUCTURE_TYPE_RENDERING_INFO,
+        .flags = flags,                                  // Tell if the draws come from secondary command buffers.
+        .renderArea =
+        {
+            .offset = { 0, 0 },
+            .extent = extent
+        },
+        .layerCount = 1,
+        .colorAttachmentCount = 1,
+        .pColorAttachments = &color_attachment,
+        .pDepthAttachment = &depth_attachment,
+        .pStencilAttachment = nullptr                    // The stencil is never used.
+    };
+
+    vkCmdBeginRendering(command_buffer, &rendering_info);
+}
+
+// End drawing into the attachments of an image, the render graph then leaves that image ready to be presented or copied from.
+void end_dynamic_rendering
+(
+    const VkCommandBuffer &command_buffer
+)
+{
+    vkCmdEndRendering(command_buffer);
+}
@@ -0,0 +1,72 @@
+#include <vulkan/vulkan.h>
+#include <cstdint>
+#include <vector>
+
+#ifndef VULKAN_RENDER_DYNAMIC_HPP
+#define VULKAN_RENDER_DYNAMIC_HPP
+
+////////////////////////////////////////////////////
+//////////////////// Structures ////////////////////
+////////////////////////////////////////////////////
+
+// Attachments drawn with the dynamic rendering, which replaces the render passes and their framebuffers.
+// The layouts are changed by the render graph recording the frame, as no render pass changes them anymore.
+// The multisampled color is a transient image of that graph, only its format is gathered here.
+struct DynamicRenderingAttachments
+{
+    std::vector<VkImage> images;             // Swap chain or offscreen images, the multisampled color is resolved into them. Empty with the render passes.
+    std::vector<VkImageView> images_views;
+    VkFormat color_format;
+    VkImage depth_image;
+    VkImageView depth_image_view;
+    VkFormat depth_format;
+    VkImageAspectFlags depth_aspect;         // Aspects of the depth format, the stencil one included.
+    VkSampleCountFlagBits samples_count;
+    VkImageLayout final_layout;              // Layout the images are left in, to be presented or copied from.
+};
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+bool get_dynamic_rendering_support
+(
+    const VkPhysicalDevice &physical_device
+);
+
+VkPipelineRenderingCreateInfo create_vulkan_pipeline_rendering_info
+(
+    const VkFormat &color_format,
+    const VkFormat &depth_format
+);
+
+DynamicRenderingAttachments get_dynamic_rendering_attachments
+(
+    const bool &enabled,
+    const std::vector<VkImage> &images,
+    const std::vector<VkImageView> &images_views,
+    const VkFormat &color_format,
+    const VkImage &depth_image,
+    const VkImageView &depth_image_view,
+    const VkFormat &depth_format,
+    const VkSampleCountFlagBits &samples_count,
+    const VkImageLayout &final_layout
+);
+
+void begin_dynamic_rendering
+(
+    const VkCommandBuffer &command_buffer,
+    const DynamicRenderingAttachments &attachments,
+    const VkImageView &color_image_view,
+    const uint32_t &image_index,
+    const VkExtent2D &extent,
+    const bool &load,
+    const VkRenderingFlags &flags
+);
+
+void end_dynamic_rendering
+(
+    const VkCommandBuffer &command_buffer
+);
+
+#endif
@@ -1,5 +1,6 @@
 #include "render.framebuffers.hpp"
 
+#include "sync/render.sync.deletion.hpp"
 #include "../../logs/logs.handler.hpp"
 #include "../../utils/tool.text.format.hpp"
 
@@ -155,7 +156,10 @@ Vulkan_Framebuffers::Vulkan_Framebuffers
 // Destructor.
 Vulkan_Framebuffers::~Vulkan_Framebuffers()
 {
-    destroy_vulkan_framebuffers(logical_device, framebuffers);
+    retire_vulkan_resource([logical_device = logical_device, framebuffers = framebuffers]() mutable
+    {
+        destroy_vulkan_framebuffers(logical_device, framebuffers);
+    });
 }
 
 std::vector<VkFramebuffer> Vulkan_Framebuffers::get() const
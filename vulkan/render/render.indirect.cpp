@@ -0,0 +1,438 @@
+#include "render.indirect.hpp"
+
+#include "render.statistics.hpp"
+#include "render.batches.hpp"
+#include "../vertex/models/models.geometry.hpp"
+#include "../uniform/uniform.buffers.hpp"
+#include "../uniform/uniform.camera.hpp"
+#include "../uniform/uniform.frustum.hpp"
+#include "../buffers/buffers.handler.hpp"
+#include "sync/render.sync.deletion.hpp"
+#include "../../config/engine.config.hpp"
+#include "../../logs/logs.handler.hpp"
+#include "../../utils/tool.text.format.hpp"
+
+#include <vulkan/vulkan.h>
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+// Return the indirect drawing capabilities of a physical device.
+IndirectDrawSupport get_indirect_draw_support
+(
+    const VkPhysicalDevice &physical_device
+)
+{
+    if (physical_device == VK_NULL_HANDLE)
+    {
+        error_log("Failed to determine the indirect draw support! The physical device provided (" + force_string(physical_device) + ") is not valid!");
+        return { false, false, false, 1 };
+    }
+
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(physical_device, &properties);
+
+    // The draw count comes with Vulkan 1.2, its features can only be queried on the devices supporting that version.
+    const bool vulkan12 = properties.apiVersion >= VK_API_VERSION_1_2;
+    VkPhysicalDeviceVulkan12Features vulkan12_features { .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES };
+    VkPhysicalDeviceFeatures2 features
+    {
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2,
+        .pNext = vulkan12 ? &vulkan12_features : nullptr
+    };
+
+    vkGetPhysicalDeviceFeatures2(physical_device, &features);
+
+    const IndirectDrawSupport support
+    {
+        .multi_draw = features.features.multiDrawIndirect == VK_TRUE,
+        .first_instance = features.features.drawIndirectFirstInstance == VK_TRUE,
+        .draw_count = vulkan12 && vulkan12_features.drawIndirectCount == VK_TRUE,
+        .max_draw_count = std::max(properties.limits.maxDrawIndirectCount, 1u)
+    };
+
+    log("Indirect draws support: multi draw " + std::string(support.multi_draw ? "yes" : "no")
+        + ", first instance " + std::string(support.first_instance ? "yes" : "no")
+        + ", draw count " + std::string(support.draw_count ? "yes" : "no")
+        + ", " + std::to_string(support.max_draw_count) + " draws per call.");
+
+    return support;
+}
+
+// Turn the batches of the frame into a flat list of indexed draws, ready to be read by the indirect draw calls.
+// - The instanced batches give a single draw each.
+// - The objects whose clusters are culled give a draw per range of consecutive visible clusters.
+// The batches are sorted by index type first, so the draws are split in a run per index type.
+void write_indirect_draws
+(
+    const std::vector<DrawBatch> &batches,
+    const std::vector<RenderObject> &objects,
+    const std::vector<MeshRange> &meshes,
+    const CameraData &camera,
+    const VkExtent2D &extent,
+    std::vector<VkDrawIndexedIndirectCommand> &commands,
+    std::vector<IndirectDrawRun> &runs,
+    DrawStatistics &statistics
+)
+{
+    commands.clear();
+    runs.clear();
+
+    const Frustum frustum = extract_frustum(get_camera_projection_matrix(camera, extent) * get_camera_view_matrix(camera));
+    size_t skipped_draws = 0;
+
+    // Add a draw of a range of indices, for some consecutive instances.
+    const auto add_draw = [&](const VkIndexType &index_type, const uint32_t &first_index, const uint32_t &index_count, const uint32_t &vertex_offset, const uint32_t &first_instance, const uint32_t &instance_count)
+    {
+        if (commands.size() >= EngineConfig::MAX_INDIRECT_DRAWS)
+        {
+            skipped_draws++;
+            return;
+        }
+
+        if (runs.empty() || runs.back().index_type != index_type)
+        {
+            if (runs.size() >= MAX_INDIRECT_RUNS)
+            {
+                skipped_draws++;
+                return;
+            }
+
+            runs.push_back({ index_type, static_cast<uint32_t>(commands.size()), 0 });
+        }
+
+        const VkDrawIndexedIndirectCommand command
+        {
+            .indexCount = index_count,                           // Amount of indices to draw.
+            .instanceCount = instance_count,                     // Amount of instances to draw.
+            .firstIndex = first_index,                           // First index in the index buffer.
+            .vertexOffset = static_cast<int32_t>(vertex_offset), // Offset added to the indices, to reach the vertices of the mesh.
+            .firstInstance = first_instance                      // First instance in the instance buffer.
+        };
+
+        commands.push_back(command);
+        runs.back().commands_count++;
+
+        statistics.draw_calls++;
+        statistics.submitted_triangles += static_cast<uint64_t>(index_count / 3) * instance_count;
+    };
+
+    for (const DrawBatch &batch : batches)
+    {
+        if (batch.mesh >= meshes.size() || batch.lod >= meshes[batch.mesh].lods.size() || batch.instance_count < 1)
+        {
+            continue;
+        }
+
+        const MeshRange &mesh = meshes[batch.mesh];
+        const MeshLod &lod = mesh.lods[batch.lod];
+
+        // The instanced batches, and the objects without any cluster to cull, are drawn whole.
+        if (batch.object == INSTANCED_BATCH_OBJECT || batch.object >= objects.size() || !EngineConfig::USE_CLUSTER_CULLING || batch.lod != 0 || mesh.clusters.size() < 1)
+        {
+            add_draw(mesh.index_type, lod.first_index, lod.index_count, mesh.vertex_offset, batch.first_instance, batch.instance_count);
+            continue;
+        }
+
+        const RenderObject &object = objects[batch.object];
+        const glm::mat3 normal_matrix(object.model);
+        const float model_scale = std::max({ glm::length(normal_matrix[0]), glm::length(normal_matrix[1]), glm::length(normal_matrix[2]) });
+
+        // Cull the clusters outside the view or facing away from the camera.
+        // The clusters are contiguous in the index buffer, so the consecutive visible ones are merged into a single draw.
+        uint32_t first_index = 0;
+        uint32_t index_count = 0;
+
+        for (const MeshCluster &cluster : mesh.clusters)
+        {
+            const glm::vec3 center = glm::vec3(object.model * glm::vec4(cluster.center, 1.0f));
+            const float radius = cluster.radius * model_scale;
+
+            bool visible = is_sphere_in_frustum(frustum, center, radius);
+
+            if (visible && cluster.cone_cutoff < 1.0f)
+            {
+                visible = !is_cone_backfacing(camera.position, center, radius, glm::normalize(normal_matrix * cluster.cone_axis), cluster.cone_cutoff);
+            }
+
+            if (!visible)
+            {
+                statistics.culled_clusters++;
+                continue;
+            }
+
+            statistics.visible_clusters++;
+
+            if (index_count > 0 && first_index + index_count == cluster.first_index)
+            {
+                index_count += cluster.index_count;
+                continue;
+            }
+
+            if (index_count > 0)
+            {
+                add_draw(mesh.index_type, first_index, index_count, mesh.vertex_offset, batch.first_instance, 1);
+            }
+
+            first_index = cluster.first_index;
+            index_count = cluster.index_count;
+        }
+
+        if (index_count > 0)
+        {
+            add_draw(mesh.index_type, first_index, index_count, mesh.vertex_offset, batch.first_instance, 1);
+        }
+    }
+
+    if (skipped_draws > 0)
+    {
+        error_log(std::to_string(skipped_draws) + " draws don't fit in the indirect buffer (" + std::to_string(EngineConfig::MAX_INDIRECT_DRAWS) + " draws)!");
+    }
+}
+
+// Copy the draws of the frame, and the amount of draws of each run, into a mapped indirect buffer.
+void upload_indirect_draws
+(
+    const std::vector<VkDrawIndexedIndirectCommand> &commands,
+    const std::vector<IndirectDrawRun> &runs,
+    void* data
+)
+{
+    if (data == nullptr)
+    {
+        error_log("Failed to upload the indirect draws! The indirect buffer isn't mapped.");
+        return;
+    }
+
+    // The draws are written in one go, as the mapped memory is usually uncached.
+    std::memcpy(data, commands.data(), sizeof(VkDrawIndexedIndirectCommand) * std::min(commands.size(), static_cast<size_t>(EngineConfig::MAX_INDIRECT_DRAWS)));
+
+    uint32_t draw_counts[MAX_INDIRECT_RUNS] {};
+
+    for (size_t i = 0; i < runs.size() && i < MAX_INDIRECT_RUNS; i++)
+    {
+        draw_counts[i] = runs[i].commands_count;
+    }
+
+    std::memcpy(static_cast<char*>(data) + get_indirect_count_offset(0), draw_counts, sizeof(draw_counts));
+}
+
+// Return the offset of the amount of draws of a run in an indirect buffer, stored after the draws.
+VkDeviceSize get_indirect_count_offset
+(
+    const size_t &run_index
+)
+{
+    return sizeof(VkDrawIndexedIndirectCommand) * EngineConfig::MAX_INDIRECT_DRAWS + sizeof(uint32_t) * run_index;
+}
+
+// Record some runs of draws into a render pass, the index buffer is only rebound when the index type changes between two runs.
+// The draws are read from the indirect buffer when indirect_draws is set, otherwise they are recorded one by one.
+void record_indirect_draws
+(
+    const VkCommandBuffer &command_buffer,
+    const VkBuffer &index_buffer,
+    const VkBuffer &indirect_buffer,
+    const std::vector<VkDrawIndexedIndirectCommand> &commands,
+    const std::vector<IndirectDrawRun> &runs,
+    const size_t &first_run,
+    const size_t &runs_count,
+    const bool &indirect_draws,
+    const IndirectDrawSupport &indirect_support,
+    DrawStatistics &statistics
+)
+{
+    const uint32_t command_size = sizeof(VkDrawIndexedIndirectCommand);
+    VkIndexType bound_index_type = VK_INDEX_TYPE_MAX_ENUM;
+
+    for (size_t i = first_run; i < first_run + runs_count && i < runs.size(); i++)
+    {
+        const IndirectDrawRun &run = runs[i];
+
+        if (run.commands_count < 1 || run.first_command + run.commands_count > commands.size())
+        {
+            continue;
+        }
+
+        if (run.index_type != bound_index_type)
+        {
+            vkCmdBindIndexBuffer(command_buffer, index_buffer, 0, run.index_type);
+            bound_index_type = run.index_type;
+        }
+
+        if (!indirect_draws)
+        {
+            for (uint32_t j = run.first_command; j < run.first_command + run.commands_count; j++)
+            {
+                const VkDrawIndexedIndirectCommand &command = commands[j];
+                vkCmdDrawIndexed(command_buffer, command.indexCount, command.instanceCount, command.firstIndex, command.vertexOffset, command.firstInstance); // Make the draw call.
+            }
+
+            continue;
+        }
+
+        const VkDeviceSize run_offset = static_cast<VkDeviceSize>(run.first_command) * command_size;
+
+        // The amount of draws is read from the buffer when possible, so it can later be written by the GPU.
+        if (indirect_support.draw_count && run.commands_count <= indirect_support.max_draw_count)
+        {
+            vkCmdDrawIndexedIndirectCount(command_buffer, indirect_buffer, run_offset, indirect_buffer, get_indirect_count_offset(i), run.commands_count, command_size);
+            statistics.indirect_calls++;
+            continue;
+        }
+
+        for (uint32_t first = 0; first < run.commands_count; first += indirect_support.max_draw_count)
+        {
+            const uint32_t draws_count = std::min(run.commands_count - first, indirect_support.max_draw_count);
+
+            vkCmdDrawIndexedIndirect(command_buffer, indirect_buffer, run_offset + static_cast<VkDeviceSize>(first) * command_size, draws_count, command_size);
+            statistics.indirect_calls++;
+        }
+    }
+}
+
+// Create an indirect buffer for each frame in flight.
+// The buffers stay mapped, so the draws of each frame are copied straight into them.
+// They are storage buffers too, as the GPU culling counts the instances of each draw itself.
+std::vector<UniformBufferInfo> create_vulkan_indirect_buffers
+(
+    const VkDevice &logical_device,
+    const VkPhysicalDevice &physical_device,
+    const uint32_t &images_count
+)
+{
+    log("Creating " + std::to_string(images_count) + " indirect buffers..");
+
+    if (logical_device == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Indirect buffers creation failed! The logical device provided (" + force_string(logical_device) + ") is not valid!");
+    }
+
+    if (physical_device == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Indirect buffers creation failed! The physical device provided (" + force_string(physical_device) + ") is not valid!");
+    }
+
+    if (images_count < 1)
+    {
+        fatal_error_log("Indirect buffers creation failed! The images count provided (" + std::to_string(images_count) + ") is not valid!");
+    }
+
+    std::vector<UniformBufferInfo> output;
+    output.reserve(images_count);
+    const VkDeviceSize buffer_size = get_indirect_count_offset(MAX_INDIRECT_RUNS);
+
+    for (int i = 0; i < images_count; i++)
+    {
+        VkBuffer buffer = VK_NULL_HANDLE;
+        VkDeviceMemory buffer_memory = VK_NULL_HANDLE;
+        void* data;
+
+        create_vulkan_buffer(logical_device, physical_device, buffer_size, VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, buffer, buffer_memory);
+        vkMapMemory(logical_device, buffer_memory, 0, buffer_size, 0, &data); // Map the buffer memory in the app address space.
+        std::memset(data, 0, buffer_size);                                    // No draw until the first frame is written.
+
+        const UniformBufferInfo info =
+        {
+            buffer,
+            buffer_memory,
+            data
+        };
+
+        output.emplace_back(info);
+        log("- Indirect buffer #" + std::to_string(i + 1) + "/" + std::to_string(images_count) + " (" + force_string(buffer) + ") created successfully!");
+    }
+
+    log(std::to_string(output.size()) + " indirect buffers created successfully!");
+    return output;
+}
+
+// Destroy some indirect buffers.
+void destroy_vulkan_indirect_buffers
+(
+    const VkDevice &logical_device,
+    std::vector<UniformBufferInfo> &indirect_buffers
+)
+{
+    log("Destroying " + std::to_string(indirect_buffers.size()) + " indirect buffers..");
+
+    if (logical_device == VK_NULL_HANDLE)
+    {
+        error_log("Indirect buffers destruction failed! The logical device provided (" + force_string(logical_device) + ") is not valid!");
+        return;
+    }
+
+    if (indirect_buffers.size() < 1)
+    {
+        error_log("Indirect buffers destruction failed! No indirect buffers were provided!");
+        return;
+    }
+
+    int failed = 0;
+    int i = 0;
+
+    for (UniformBufferInfo &indirect_buffer : indirect_buffers)
+    {
+        i++;
+
+        if (indirect_buffer.buffer == VK_NULL_HANDLE || indirect_buffer.buffer_memory == VK_NULL_HANDLE)
+        {
+            error_log("- Failed to destroy the indirect buffer #" + std::to_string(i) + "/" + std::to_string(indirect_buffers.size()) + "! The buffer (" + force_string(indirect_buffer.buffer) + ") or its memory (" + force_string(indirect_buffer.buffer_memory) + ") is not valid!");
+            failed++;
+            continue;
+        }
+
+        vkDestroyBuffer(logical_device, indirect_buffer.buffer, nullptr);
+        vkFreeMemory(logical_device, indirect_buffer.buffer_memory, nullptr);
+
+        indirect_buffer.buffer = VK_NULL_HANDLE;
+        indirect_buffer.buffer_memory = VK_NULL_HANDLE;
+        indirect_buffer.data = nullptr;
+
+        log("- Indirect buffer #" + std::to_string(i) + "/" + std::to_string(indirect_buffers.size()) + " destroyed successfully!");
+    }
+
+    if (failed > 0)
+    {
+        error_log("Warning: " + std::to_string(failed) + " indirect buffers failed to destroy! This might lead to some memory leaks or memory overload.");
+    }
+
+    log(std::to_string(indirect_buffers.size() - failed) + "/" + std::to_string(indirect_buffers.size()) + " indirect buffers destroyed successfully!");
+    indirect_buffers.clear();
+}
+
+///////////////////////////////////////////////
+//////////////////// Class ////////////////////
+///////////////////////////////////////////////
+
+// Constructor.
+Vulkan_IndirectBuffers::Vulkan_IndirectBuffers
+(
+    const VkDevice &logical_device,
+    const VkPhysicalDevice &physical_device,
+    const uint32_t &images_count
+) : logical_device(logical_device)
+{
+    indirect_buffers = create_vulkan_indirect_buffers(logical_device, physical_device, images_count);
+}
+
+// Destructor.
+Vulkan_IndirectBuffers::~Vulkan_IndirectBuffers()
+{
+    retire_vulkan_resource([logical_device = logical_device, indirect_buffers = indirect_buffers]() mutable
+    {
+        destroy_vulkan_indirect_buffers(logical_device, indirect_buffers);
+    });
+}
+
+std::vector<UniformBufferInfo> Vulkan_IndirectBuffers::get() const
+{
+    return indirect_buffers;
+}
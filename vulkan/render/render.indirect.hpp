@@ -0,0 +1,131 @@
+#include "render.statistics.hpp"
+#include "render.batches.hpp"
+#include "../vertex/models/models.geometry.hpp"
+#include "../uniform/uniform.buffers.hpp"
+#include "../uniform/uniform.camera.hpp"
+
+#include <vulkan/vulkan.h>
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+#ifndef VULKAN_RENDER_INDIRECT_HPP
+#define VULKAN_RENDER_INDIRECT_HPP
+
+// Maximum amount of indirect draw runs per frame, the draws of a run share the index type of their meshes.
+constexpr const uint32_t MAX_INDIRECT_RUNS = 4;
+
+////////////////////////////////////////////////////
+//////////////////// Structures ////////////////////
+////////////////////////////////////////////////////
+
+// Indirect drawing capabilities of a physical device.
+struct IndirectDrawSupport
+{
+    bool multi_draw;          // Several draws can be read by a single indirect draw call.
+    bool first_instance;      // The indirect draws can start after the first instance.
+    bool draw_count;          // The amount of draws can be read from a buffer.
+    uint32_t max_draw_count;  // Maximum amount of draws per indirect draw call.
+};
+
+// Consecutive indirect draws sharing the index type of their meshes, submitted together.
+struct IndirectDrawRun
+{
+    VkIndexType index_type;
+    uint32_t first_command;   // First draw of the run in the indirect buffer.
+    uint32_t commands_count;
+};
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+IndirectDrawSupport get_indirect_draw_support
+(
+    const VkPhysicalDevice &physical_device
+);
+
+void write_indirect_draws
+(
+    const std::vector<DrawBatch> &batches,
+    const std::vector<RenderObject> &objects,
+    const std::vector<MeshRange> &meshes,
+    const CameraData &camera,
+    const VkExtent2D &extent,
+    std::vector<VkDrawIndexedIndirectCommand> &commands,
+    std::vector<IndirectDrawRun> &runs,
+    DrawStatistics &statistics
+);
+
+void upload_indirect_draws
+(
+    const std::vector<VkDrawIndexedIndirectCommand> &commands,
+    const std::vector<IndirectDrawRun> &runs,
+    void* data
+);
+
+VkDeviceSize get_indirect_count_offset
+(
+    const size_t &run_index
+);
+
+void record_indirect_draws
+(
+    const VkCommandBuffer &command_buffer,
+    const VkBuffer &index_buffer,
+    const VkBuffer &indirect_buffer,
+    const std::vector<VkDrawIndexedIndirectCommand> &commands,
+    const std::vector<IndirectDrawRun> &runs,
+    const size_t &first_run,
+    const size_t &runs_count,
+    const bool &indirect_draws,
+    const IndirectDrawSupport &indirect_support,
+    DrawStatistics &statistics
+);
+
+std::vector<UniformBufferInfo> create_vulkan_indirect_buffers
+(
+    const VkDevice &logical_device,
+    const VkPhysicalDevice &physical_device,
+    const uint32_t &images_count
+);
+
+void destroy_vulkan_indirect_buffers
+(
+    const VkDevice &logical_device,
+    std::vector<UniformBufferInfo> &indirect_buffers
+);
+
+///////////////////////////////////////////////
+//////////////////// Class ////////////////////
+///////////////////////////////////////////////
+
+class Vulkan_IndirectBuffers
+{
+
+public:
+    // Constructor.
+    Vulkan_IndirectBuffers
+    (
+        const VkDevice &logical_device,
+        const VkPhysicalDevice &physical_device,
+        const uint32_t &images_count
+    );
+
+    // Destructor.
+    ~Vulkan_IndirectBuffers();
+
+    std::vector<UniformBufferInfo> get() const;
+
+    // Prevent data duplication.
+    Vulkan_IndirectBuffers(const Vulkan_IndirectBuffers&) = delete;
+    Vulkan_IndirectBuffers &operator = (const Vulkan_IndirectBuffers&) = delete;
+
+private:
+    // We declare the members of the class to store.
+    VkDevice logical_device = VK_NULL_HANDLE;
+    std::vector<UniformBufferInfo> indirect_buffers;
+
+};
+
+#endif
@@ -0,0 +1,211 @@
+#include "render.latency.hpp"
+
+#include "sync/render.sync.timeline.hpp"
+#include "../core/vulkan.extensions.hpp"
+#include "../../config/engine.config.hpp"
+#include "../../logs/logs.handler.hpp"
+#include "../../utils/tool.text.format.hpp"
+
+#include <vulkan/vulkan.h>
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+// Return true if a physical device can wait for the presentation of a given frame.
+bool get_present_wait_support
+(
+    const VkPhysicalDevice &physical_device
+)
+{
+    if (physical_device == VK_NULL_HANDLE)
+    {
+        error_log("Failed to determine the present wait support! The physical device provided (" + force_string(physical_device) + ") is not valid!");
+        return false;
+    }
+
+    if (!is_vulkan_extension_supported(physical_device, VK_KHR_PRESENT_ID_EXTENSION_NAME) || !is_vulkan_extension_supported(physical_device, VK_KHR_PRESENT_WAIT_EXTENSION_NAME))
+    {
+        log("Present wait support: no, the frames are timed from the GPU.");
+        return false;
+    }
+
+    VkPhysicalDevicePresentWaitFeaturesKHR present_wait_features { .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR };
+    VkPhysicalDevicePresentIdFeaturesKHR present_id_features
+    {
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR,
+        .pNext = &present_wait_features
+    };
+
+    VkPhysicalDeviceFeatures2 features
+    {
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2,
+        .pNext = &present_id_features
+    };
+
+    vkGetPhysicalDeviceFeatures2(physical_device, &features);
+
+    const bool supported = present_id_features.presentId == VK_TRUE && present_wait_features.presentWait == VK_TRUE;
+    log("Present wait support: " + std::string(supported ? "yes." : "no, the frames are timed from the GPU."));
+
+    return supported;
+}
+
+// Create the governor of the low latency frame loop, it does nothing when it isn't enabled.
+LatencyGovernor create_latency_governor
+(
+    const bool &enabled,
+    const VkDevice &logical_device,
+    const bool &present_wait
+)
+{
+    LatencyGovernor governor {};
+    governor.enabled = enabled;
+    governor.previous_report = std::chrono::steady_clock::now();
+
+    if (!enabled)
+    {
+        return governor;
+    }
+
+    // The extension functions aren't exported by the Vulkan loader.
+    if (present_wait)
+    {
+        governor.wait_for_present = reinterpret_cast<PFN_vkWaitForPresentKHR>(vkGetDeviceProcAddr(logical_device, "vkWaitForPresentKHR"));
+    }
+
+    log("Low latency mode enabled, the frames are timed from " + std::string(governor.wait_for_present != nullptr ? "their presentation." : "the GPU."));
+    return governor;
+}
+
+// Smooth a timing over the last frames, so a single slow frame doesn't move the frame start much.
+void smooth_latency_timing
+(
+    double &timing,
+    const double &sample
+)
+{
+    timing = timing > 0.0 ? timing + (sample - timing) * 0.1 : sample;
+}
+
+// Wait for the previous frame to be rendered (and presented when we can know it), then delay the new frame.
+// The delay lets the CPU work start as late as the frame can still be ready for the next refresh, instead of running frames ahead.
+void begin_low_latency_frame
+(
+    const VkDevice &logical_device,
+    const VkSwapchainKHR &swapchain,
+    const VkSemaphore &timeline_semaphore,
+    LatencyGovernor &governor
+)
+{
+    if (!governor.enabled)
+    {
+        return;
+    }
+
+    if (governor.submitted_value > 0)
+    {
+        wait_vulkan_timeline_value(logical_device, timeline_semaphore, governor.submitted_value);
+
+        std::chrono::steady_clock::time_point done = std::chrono::steady_clock::now();
+        smooth_latency_timing(governor.gpu_time, std::chrono::duration<double, std::micro>(done - governor.submit_time).count());
+
+        // A timeout or an outdated swap chain leaves the frame timed from the GPU.
+        if (governor.wait_for_present != nullptr && governor.present_id > 0)
+        {
+            if (governor.wait_for_present(logical_device, swapchain, governor.present_id, PRESENT_WAIT_TIMEOUT) == VK_SUCCESS)
+            {
+                done = std::chrono::steady_clock::now();
+            }
+        }
+
+        if (governor.previous_done.time_since_epoch().count() > 0 && done - governor.previous_done < std::chrono::nanoseconds(PRESENT_WAIT_TIMEOUT))
+        {
+            smooth_latency_timing(governor.frame_interval, std::chrono::duration<double, std::micro>(done - governor.previous_done).count());
+        }
+
+        governor.previous_done = done;
+
+        // The interval shrinks with the delay until the display becomes the limit, so the delay settles right below it.
+        const double delay = std::min(governor.frame_interval - governor.cpu_time - governor.gpu_time - static_cast<double>(EngineConfig::LOW_LATENCY_MARGIN), governor.frame_interval);
+
+        if (delay > 0.0)
+        {
+            std::this_thread::sleep_until(done + std::chrono::microseconds(static_cast<int64_t>(delay)));
+            governor.delay_sum += delay;
+        }
+    }
+
+    governor.frame_start = std::chrono::steady_clock::now();
+}
+
+// Sample the inputs as late as possible, right before they move the camera of the frame.
+// The input to submit latency is measured from that sample, so it covers the culling, the batches and the recording.
+void sample_late_input
+(
+    LatencyGovernor &governor
+)
+{
+    if (!governor.enabled)
+    {
+        return;
+    }
+
+    SDL_PumpEvents(); // Update the keyboard and mouse states read by the game.
+    governor.input_time = std::chrono::steady_clock::now();
+}
+
+// Measure the frame once submitted, then log the average timings once per second.
+void end_low_latency_frame
+(
+    LatencyGovernor &governor,
+    const uint64_t &submitted_value
+)
+{
+    if (!governor.enabled)
+    {
+        return;
+    }
+
+    const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+    governor.submitted_value = submitted_value;
+    governor.submit_time = now;
+    smooth_latency_timing(governor.cpu_time, std::chrono::duration<double, std::micro>(now - governor.frame_start).count());
+
+    governor.input_latency_sum += std::chrono::duration<double, std::micro>(now - governor.input_time).count();
+    governor.frames_count++;
+
+    // If one second passed, we log the averages and reset the sums.
+    if (now - governor.previous_report >= std::chrono::seconds(1))
+    {
+        const double frames = static_cast<double>(governor.frames_count);
+
+        log("Latency statistics (average of " + std::to_string(governor.frames_count) + " frames): "
+            + std::to_string(static_cast<int64_t>(governor.input_latency_sum / frames)) + " us from input to submit, "
+            + std::to_string(static_cast<int64_t>(governor.delay_sum / frames)) + " us of delay, "
+            + std::to_string(static_cast<int64_t>(governor.cpu_time)) + " us of CPU, "
+            + std::to_string(static_cast<int64_t>(governor.gpu_time)) + " us of GPU, "
+            + std::to_string(static_cast<int64_t>(governor.frame_interval)) + " us between frames.");
+
+        governor.frames_count = 0;
+        governor.input_latency_sum = 0.0;
+        governor.delay_sum = 0.0;
+        governor.previous_report = now;
+    }
+}
+
+// Forget the presented frames, as the ids start again with a new swap chain.
+void reset_low_latency_presents
+(
+    LatencyGovernor &governor
+)
+{
+    governor.present_id = 0;
+}
@@ -0,0 +1,77 @@
+#include <vulkan/vulkan.h>
+#include <chrono>
+#include <cstdint>
+
+#ifndef VULKAN_RENDER_LATENCY_HPP
+#define VULKAN_RENDER_LATENCY_HPP
+
+// Longest wait for the presentation of a frame (in nanoseconds), also the longest interval between two frames taken into account.
+// Longer intervals come from a minimized or moved window, they would delay the next frames for nothing.
+constexpr const uint64_t PRESENT_WAIT_TIMEOUT = 100000000;
+
+////////////////////////////////////////////////////
+//////////////////// Structures ////////////////////
+////////////////////////////////////////////////////
+
+// Timings of the low latency frame loop, which starts each frame as late as it can still be displayed on time.
+// The times are smoothed over the last frames, in microseconds.
+struct LatencyGovernor
+{
+    bool enabled;
+    PFN_vkWaitForPresentKHR wait_for_present;      // Null when the device doesn't support the present wait, the frames are then timed from the GPU.
+    uint64_t present_id;                           // Id of the last frame presented to the current swap chain, 0 when none was.
+    uint64_t submitted_value;                      // Timeline value of the last frame submitted.
+    std::chrono::steady_clock::time_point frame_start;
+    std::chrono::steady_clock::time_point input_time;
+    std::chrono::steady_clock::time_point submit_time;
+    std::chrono::steady_clock::time_point previous_done;
+    double cpu_time;                               // From the start of a frame to its submit.
+    double gpu_time;                               // From the submit of a frame to the end of its rendering.
+    double frame_interval;                         // Between the ends of two frames, the refresh interval when the display is the limit.
+    std::chrono::steady_clock::time_point previous_report;
+    uint64_t frames_count;
+    double input_latency_sum;                      // Sum of the input to submit latencies since the last report.
+    double delay_sum;                              // Sum of the delays added before the frames since the last report.
+};
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+bool get_present_wait_support
+(
+    const VkPhysicalDevice &physical_device
+);
+
+LatencyGovernor create_latency_governor
+(
+    const bool &enabled,
+    const VkDevice &logical_device,
+    const bool &present_wait
+);
+
+void begin_low_latency_frame
+(
+    const VkDevice &logical_device,
+    const VkSwapchainKHR &swapchain,
+    const VkSemaphore &timeline_semaphore,
+    LatencyGovernor &governor
+);
+
+void sample_late_input
+(
+    LatencyGovernor &governor
+);
+
+void end_low_latency_frame
+(
+    LatencyGovernor &governor,
+    const uint64_t &submitted_value
+);
+
+void reset_low_latency_presents
+(
+    LatencyGovernor &governor
+);
+
+#endif
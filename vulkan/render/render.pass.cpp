@@ -1,5 +1,6 @@
 #include "render.pass.hpp"
 
+#include "sync/render.sync.deletion.hpp"
 #include "../../logs/logs.handler.hpp"
 #include "../../utils/tool.text.format.hpp"
 
@@ -11,13 +12,15 @@
 ///////////////////////////////////////////////////
 
 // Create a render pass.
+// The final layout is the one of the resolved image once rendered, presentable for a swap chain image.
 VkRenderPass create_vulkan_render_pass
 (
     const VkDevice &logical_device,
     const VkAttachmentDescription &color_attachment,
     const VkAttachmentDescription &depth_attachment,
     const VkAttachmentReference &depth_attachment_reference,
-    const VkSurfaceFormatKHR &surface_format
+    const VkSurfaceFormatKHR &surface_format,
+    const VkImageLayout &final_layout
 )
 {
     log("Creating a render pass..");
@@ -36,7 +39,7 @@ VkRenderPass create_vulkan_render_pass
         .stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE,
         .stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE,
         .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED,
-        .finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR
+        .finalLayout = final_layout
     };
 
     const VkAttachmentReference resolve_attachment_reference
@@ -66,8 +69,8 @@ VkRenderPass create_vulkan_render_pass
         .dstSubpass = 0,
         .srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT,
         .dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT,
-        .srcAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT,
-        .dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT
+        .srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT,                                                                                     // A render pass loading its attachments..
+        .dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT // ..reads what the previous one wrote.
     };
 
     const std::array<VkAttachmentDescription, 3> attachments = { color_attachment, depth_attachment, resolve };
@@ -100,6 +103,19 @@ VkRenderPass create_vulkan_render_pass
     return render_pass;
 }
 
+// Describe an attachment drawn again by a second render pass: its content is loaded instead of cleared.
+VkAttachmentDescription get_vulkan_loaded_attachment
+(
+    const VkAttachmentDescription &attachment
+)
+{
+    VkAttachmentDescription loaded_attachment = attachment;
+    loaded_attachment.loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;    // Keep the content of the previous render pass.
+    loaded_attachment.initialLayout = attachment.finalLayout; // The previous render pass left the attachment in its final layout.
+
+    return loaded_attachment;
+}
+
 // Destroy a render pass.
 void destroy_vulkan_render_pass
 (
@@ -137,16 +153,20 @@ Vulkan_RenderPass::Vulkan_RenderPass
     const VkAttachmentDescription &color_attachment,
     const VkAttachmentDescription &depth_attachment,
     const VkAttachmentReference &depth_attachment_reference,
-    const VkSurfaceFormatKHR &surface_format
+    const VkSurfaceFormatKHR &surface_format,
+    const VkImageLayout &final_layout
 ) : logical_device(logical_device)
 {
-    render_pass = create_vulkan_render_pass(logical_device, color_attachment, depth_attachment, depth_attachment_reference, surface_format);
+    render_pass = create_vulkan_render_pass(logical_device, color_attachment, depth_attachment, depth_attachment_reference, surface_format, final_layout);
 }
 
 // Destructor.
 Vulkan_RenderPass::~Vulkan_RenderPass()
 {
-    destroy_vulkan_render_pass(logical_device, render_pass);
+    retire_vulkan_resource([logical_device = logical_device, render_pass = render_pass]() mutable
+    {
+        destroy_vulkan_render_pass(logical_device, render_pass);
+    });
 }
 
 VkRenderPass Vulkan_RenderPass::get() const
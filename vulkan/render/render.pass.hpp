@@ -13,7 +13,13 @@ VkRenderPass create_vulkan_render_pass
     const VkAttachmentDescription &color_attachment,
     const VkAttachmentDescription &depth_attachment,
     const VkAttachmentReference &depth_attachment_reference,
-    const VkSurfaceFormatKHR &surface_format
+    const VkSurfaceFormatKHR &surface_format,
+    const VkImageLayout &final_layout
+);
+
+VkAttachmentDescription get_vulkan_loaded_attachment
+(
+    const VkAttachmentDescription &attachment
 );
 
 void destroy_vulkan_render_pass
@@ -37,7 +43,8 @@ public:
         const VkAttachmentDescription &color_attachment,
         const VkAttachmentDescription &depth_attachment,
         const VkAttachmentReference &depth_attachment_reference,
-        const VkSurfaceFormatKHR &surface_format
+        const VkSurfaceFormatKHR &surface_format,
+        const VkImageLayout &final_layout
     );
 
     // Destructor.
@@ -0,0 +1,142 @@
+#include "render.statistics.hpp"
+
+#include "../../logs/logs.handler.hpp"
+
+#include <vulkan/vulkan.h>
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+auto statistics_previous_time = SDL_GetTicks();
+DrawStatistics statistics_sum {};
+uint64_t statistics_frames_count = 0;
+
+// Accumulate the statistics of a frame and log their average once per second.
+void report_draw_statistics
+(
+    const DrawStatistics &statistics
+)
+{
+    const auto current_time = SDL_GetTicks();
+
+    statistics_sum.draw_calls += statistics.draw_calls;
+    statistics_sum.indirect_calls += statistics.indirect_calls;
+    statistics_sum.submitted_triangles += statistics.submitted_triangles;
+    statistics_sum.total_triangles += statistics.total_triangles;
+    statistics_sum.visible_objects += statistics.visible_objects;
+    statistics_sum.culled_objects += statistics.culled_objects;
+    statistics_sum.occluded_objects += statistics.occluded_objects;
+    statistics_sum.visible_clusters += statistics.visible_clusters;
+    statistics_sum.culled_clusters += statistics.culled_clusters;
+    statistics_sum.recording_time += statistics.recording_time;
+    statistics_sum.gpu_time += statistics.gpu_time;
+    statistics_frames_count++;
+
+    // If one second passed, we log the average of the frames and reset the sums.
+    if (current_time - statistics_previous_time >= 1000)
+    {
+        const uint64_t frames = statistics_frames_count;
+
+        log("Draw statistics (average of " + std::to_string(frames) + " frames): "
+            + std::to_string(statistics_sum.draw_calls / frames) + " draws, "
+            + std::to_string(statistics_sum.indirect_calls / frames) + " indirect draw calls, "
+            + std::to_string(statistics_sum.submitted_triangles / frames) + "/" + std::to_string(statistics_sum.total_triangles / frames) + " triangles, "
+            + std::to_string(statistics_sum.visible_objects / frames) + " visible objects, "
+            + std::to_string(statistics_sum.culled_objects / frames) + " culled objects, "
+            + std::to_string(statistics_sum.occluded_objects / frames) + " occluded objects, "
+            + std::to_string(statistics_sum.visible_clusters / frames) + " visible clusters, "
+            + std::to_string(statistics_sum.culled_clusters / frames) + " culled clusters, "
+            + std::to_string(statistics_sum.recording_time / frames) + " us of commands recording, "
+            + std::to_string(statistics_sum.gpu_time / frames) + " us of GPU.");
+
+        statistics_sum = {};
+        statistics_frames_count = 0;
+        statistics_previous_time = current_time;
+    }
+}
+
+// Prepare the timings of the frames drawn in headless mode.
+FrameTimings create_frame_timings
+(
+    const uint32_t &frames_in_flight
+)
+{
+    FrameTimings timings;
+    timings.frames_drawn.assign(frames_in_flight, -1);
+    return timings;
+}
+
+// Store the CPU time of a frame, and the GPU time of the last frame drawn with the same frame in flight.
+void record_frame_timings
+(
+    FrameTimings &timings,
+    const size_t &frame,
+    const uint64_t &cpu_time,
+    const DrawStatistics &statistics
+)
+{
+    if (frame >= timings.frames_drawn.size())
+    {
+        error_log("Failed to record the frame timings! The frame index is out of bounds: " + std::to_string(frame) + " >= " + std::to_string(timings.frames_drawn.size()) + ".");
+        return;
+    }
+
+    if (timings.frames_drawn[frame] >= 0)
+    {
+        timings.gpu_times[timings.frames_drawn[frame]] = statistics.gpu_time;
+    }
+
+    timings.frames_drawn[frame] = static_cast<int64_t>(timings.cpu_times.size());
+    timings.cpu_times.emplace_back(cpu_time);
+    timings.gpu_times.emplace_back(0);
+}
+
+// Log the CPU and GPU times of every frame drawn in headless mode, then their average, minimum and maximum.
+// The device must be idle, so the GPU times of the last frames can be read.
+void report_frame_timings
+(
+    FrameTimings &timings,
+    const VkDevice &logical_device,
+    const GpuTimestamps &timestamps
+)
+{
+    for (size_t frame = 0; frame < timings.frames_drawn.size(); frame++)
+    {
+        if (timings.frames_drawn[frame] >= 0)
+        {
+            timings.gpu_times[timings.frames_drawn[frame]] = read_gpu_frame_time(logical_device, timestamps, frame);
+            timings.frames_drawn[frame] = -1;
+        }
+    }
+
+    const size_t frames = timings.cpu_times.size();
+
+    if (frames < 1)
+    {
+        error_log("No frame timings to report, no frame was drawn!");
+        return;
+    }
+
+    for (size_t i = 0; i < frames; i++)
+    {
+        log("Frame #" + std::to_string(i + 1) + ": " + std::to_string(timings.cpu_times[i]) + " us of CPU, " + std::to_string(timings.gpu_times[i]) + " us of GPU.");
+    }
+
+    uint64_t cpu_sum = 0, gpu_sum = 0;
+
+    for (size_t i = 0; i < frames; i++)
+    {
+        cpu_sum += timings.cpu_times[i];
+        gpu_sum += timings.gpu_times[i];
+    }
+
+    log("Frame timings (" + std::to_string(frames) + " frames): "
+        + std::to_string(cpu_sum / frames) + " us average, "
+        + std::to_string(*std::min_element(timings.cpu_times.begin(), timings.cpu_times.end())) + " us min, "
+        + std::to_string(*std::max_element(timings.cpu_times.begin(), timings.cpu_times.end())) + " us max of CPU, "
+        + std::to_string(gpu_sum / frames) + " us average, "
+        + std::to_string(*std::min_element(timings.gpu_times.begin(), timings.gpu_times.end())) + " us min, "
+        + std::to_string(*std::max_element(timings.gpu_times.begin(), timings.gpu_times.end())) + " us max of GPU.");
+}
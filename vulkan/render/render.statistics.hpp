@@ -0,0 +1,68 @@
+#include "render.timestamps.hpp"
+
+#include <vulkan/vulkan.h>
+#include <cstdint>
+#include <vector>
+
+#ifndef VULKAN_RENDER_STATISTICS_HPP
+#define VULKAN_RENDER_STATISTICS_HPP
+
+////////////////////////////////////////////////////
+//////////////////// Structures ////////////////////
+////////////////////////////////////////////////////
+
+// Amount of work submitted to the GPU for one frame.
+struct DrawStatistics
+{
+    uint32_t draw_calls;           // Draws submitted, directly or through the indirect buffer.
+    uint32_t indirect_calls;       // Indirect draw calls recorded, each one submitting several draws.
+    uint64_t submitted_triangles;  // Triangles actually drawn, after the culling and the levels of detail.
+    uint64_t total_triangles;      // Triangles of the full resolution meshes of the visible objects.
+    uint32_t visible_objects;
+    uint32_t culled_objects;
+    uint32_t occluded_objects;     // Culled against the depth pyramid, only counted by the GPU culling.
+    uint32_t visible_clusters;
+    uint32_t culled_clusters;
+    uint64_t recording_time;       // Microseconds spent recording the command buffers of the frame.
+    uint64_t gpu_time;             // Microseconds spent by the GPU on the last frame drawn with the same frame in flight, 0 when unknown.
+};
+
+// CPU and GPU times of each frame drawn in headless mode, in microseconds.
+// The GPU time of a frame is only read once its frame in flight is drawn again, or once the rendering is over.
+struct FrameTimings
+{
+    std::vector<uint64_t> cpu_times;
+    std::vector<uint64_t> gpu_times;
+    std::vector<int64_t> frames_drawn; // Last frame drawn with each frame in flight, -1 when none was.
+};
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+void report_draw_statistics
+(
+    const DrawStatistics &statistics
+);
+
+FrameTimings create_frame_timings
+(
+    const uint32_t &frames_in_flight
+);
+
+void record_frame_timings
+(
+    FrameTimings &timings,
+    const size_t &frame,
+    const uint64_t &cpu_time,
+    const DrawStatistics &statistics
+);
+
+void report_frame_timings
+(
+    FrameTimings &timings,
+    const VkDevice &logical_device,
+    const GpuTimestamps &timestamps
+);
+
+#endif
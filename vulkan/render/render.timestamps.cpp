@@ -0,0 +1,200 @@
+#include "render.timestamps.hpp"
+
+#include "sync/render.sync.deletion.hpp"
+#include "../../logs/logs.handler.hpp"
+#include "../../utils/tool.text.format.hpp"
+
+#include <vulkan/vulkan.h>
+#include <cstdint>
+#include <string>
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+// Create the timestamp queries of the frames in flight.
+// Without timestamps on the graphics queue, or without the host reset of the queries, the GPU time of the frames stays unknown (0).
+GpuTimestamps create_vulkan_gpu_timestamps
+(
+    const VkPhysicalDevice &physical_device,
+    const VkDevice &logical_device,
+    const VkQueueFamilyProperties &graphics_family,
+    const uint32_t &frames_in_flight
+)
+{
+    log("Creating the GPU timestamps..");
+
+    if (physical_device == VK_NULL_HANDLE)
+    {
+        fatal_error_log("GPU timestamps creation failed! The physical device provided (" + force_string(physical_device) + ") is not valid!");
+    }
+
+    if (logical_device == VK_NULL_HANDLE)
+    {
+        fatal_error_log("GPU timestamps creation failed! The logical device provided (" + force_string(logical_device) + ") is not valid!");
+    }
+
+    GpuTimestamps timestamps {};
+
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(physical_device, &properties);
+
+    // The host reset of the queries comes with Vulkan 1.2, its features can only be queried on the devices supporting that version.
+    const bool vulkan12 = properties.apiVersion >= VK_API_VERSION_1_2;
+    VkPhysicalDeviceVulkan12Features vulkan12_features { .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES };
+    VkPhysicalDeviceFeatures2 features
+    {
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2,
+        .pNext = vulkan12 ? &vulkan12_features : nullptr
+    };
+
+    vkGetPhysicalDeviceFeatures2(physical_device, &features);
+
+    if (graphics_family.timestampValidBits < 1 || properties.limits.timestampPeriod <= 0.0f || !vulkan12 || vulkan12_features.hostQueryReset != VK_TRUE)
+    {
+        error_log("The selected GPU can't time its frames, their GPU time will be unknown.");
+        return timestamps;
+    }
+
+    const VkQueryPoolCreateInfo create_info
+    {
+        .sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+        .queryType = VK_QUERY_TYPE_TIMESTAMP, // Store the time at which the GPU reaches a command.
+        .queryCount = frames_in_flight * 2    // Start and end of each frame in flight.
+    };
+
+    const VkResult pool_creation = vkCreateQueryPool(logical_device, &create_info, nullptr, &timestamps.query_pool);
+
+    if (pool_creation != VK_SUCCESS)
+    {
+        fatal_error_log("GPU timestamps query pool creation returned error code " + std::to_string(pool_creation) + ".");
+    }
+
+    // The queries must be reset before their first use, they are then unavailable until a frame writes them.
+    vkResetQueryPool(logical_device, timestamps.query_pool, 0, create_info.queryCount);
+
+    timestamps.period = static_cast<double>(properties.limits.timestampPeriod);
+    timestamps.mask = graphics_family.timestampValidBits >= 64 ? UINT64_MAX : (uint64_t(1) << graphics_family.timestampValidBits) - 1;
+
+    log("GPU timestamps " + force_string(timestamps.query_pool) + " created successfully!");
+    return timestamps;
+}
+
+// Destroy the timestamp queries.
+void destroy_vulkan_gpu_timestamps
+(
+    const VkDevice &logical_device,
+    GpuTimestamps &timestamps
+)
+{
+    // Nothing was created when the GPU can't time its frames.
+    if (timestamps.query_pool == VK_NULL_HANDLE)
+    {
+        return;
+    }
+
+    log("Destroying the " + force_string(timestamps.query_pool) + " GPU timestamps..");
+
+    if (logical_device == VK_NULL_HANDLE)
+    {
+        error_log("GPU timestamps destruction failed! The logical device provided (" + force_string(logical_device) + ") is not valid!");
+        return;
+    }
+
+    vkDestroyQueryPool(logical_device, timestamps.query_pool, nullptr);
+    timestamps = {};
+
+    log("GPU timestamps destroyed successfully!");
+}
+
+// Reset the queries of a frame and write its start time, before its first command.
+void record_gpu_frame_start
+(
+    const VkCommandBuffer &command_buffer,
+    const GpuTimestamps &timestamps,
+    const size_t &frame
+)
+{
+    if (timestamps.query_pool == VK_NULL_HANDLE)
+    {
+        return;
+    }
+
+    const uint32_t first_query = static_cast<uint32_t>(frame * 2);
+
+    vkCmdResetQueryPool(command_buffer, timestamps.query_pool, first_query, 2);
+    vkCmdWriteTimestamp(command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, timestamps.query_pool, first_query);
+}
+
+// Write the end time of a frame, once all its commands are done.
+void record_gpu_frame_end
+(
+    const VkCommandBuffer &command_buffer,
+    const GpuTimestamps &timestamps,
+    const size_t &frame
+)
+{
+    if (timestamps.query_pool == VK_NULL_HANDLE)
+    {
+        return;
+    }
+
+    vkCmdWriteTimestamp(command_buffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, timestamps.query_pool, static_cast<uint32_t>(frame * 2 + 1));
+}
+
+// Return the GPU time of the last frame drawn with a frame in flight (in microseconds), 0 when it isn't known.
+// The frame must be done, the CPU never waits for the queries.
+uint64_t read_gpu_frame_time
+(
+    const VkDevice &logical_device,
+    const GpuTimestamps &timestamps,
+    const size_t &frame
+)
+{
+    if (timestamps.query_pool == VK_NULL_HANDLE)
+    {
+        return 0;
+    }
+
+    // Each query is followed by its availability, 0 when no frame wrote it yet.
+    uint64_t results[4] = {};
+    const VkResult results_query = vkGetQueryPoolResults(logical_device, timestamps.query_pool, static_cast<uint32_t>(frame * 2), 2, sizeof(results), results, sizeof(uint64_t) * 2, VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT);
+
+    if (results_query != VK_SUCCESS || results[1] == 0 || results[3] == 0)
+    {
+        return 0;
+    }
+
+    const uint64_t ticks = (results[2] - results[0]) & timestamps.mask;
+    return static_cast<uint64_t>(static_cast<double>(ticks) * timestamps.period / 1000.0);
+}
+
+///////////////////////////////////////////////
+//////////////////// Class ////////////////////
+///////////////////////////////////////////////
+
+// Constructor.
+Vulkan_GpuTimestamps::Vulkan_GpuTimestamps
+(
+    const VkPhysicalDevice &physical_device,
+    const VkDevice &logical_device,
+    const VkQueueFamilyProperties &graphics_family,
+    const uint32_t &frames_in_flight
+) : logical_device(logical_device)
+{
+    timestamps = create_vulkan_gpu_timestamps(physical_device, logical_device, graphics_family, frames_in_flight);
+}
+
+// Destructor.
+Vulkan_GpuTimestamps::~Vulkan_GpuTimestamps()
+{
+    retire_vulkan_resource([logical_device = logical_device, timestamps = timestamps]() mutable
+    {
+        destroy_vulkan_gpu_timestamps(logical_device, timestamps);
+    });
+}
+
+GpuTimestamps Vulkan_GpuTimestamps::get() const
+{
+    return timestamps;
+}
@@ -0,0 +1,92 @@
+#include <vulkan/vulkan.h>
+#include <cstdint>
+#include <vector>
+
+#ifndef VULKAN_RENDER_TIMESTAMPS_HPP
+#define VULKAN_RENDER_TIMESTAMPS_HPP
+
+////////////////////////////////////////////////////
+//////////////////// Structures ////////////////////
+////////////////////////////////////////////////////
+
+// Timestamps written by the GPU at the start and the end of each frame in flight, to measure the GPU time of the frames.
+struct GpuTimestamps
+{
+    VkQueryPool query_pool; // Two queries per frame in flight, null when the graphics queue can't write timestamps.
+    double period;          // Nanoseconds between two ticks of the timestamps.
+    uint64_t mask;          // Bits of the timestamps written by the queue.
+};
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+GpuTimestamps create_vulkan_gpu_timestamps
+(
+    const VkPhysicalDevice &physical_device,
+    const VkDevice &logical_device,
+    const VkQueueFamilyProperties &graphics_family,
+    const uint32_t &frames_in_flight
+);
+
+void destroy_vulkan_gpu_timestamps
+(
+    const VkDevice &logical_device,
+    GpuTimestamps &timestamps
+);
+
+void record_gpu_frame_start
+(
+    const VkCommandBuffer &command_buffer,
+    const GpuTimestamps &timestamps,
+    const size_t &frame
+);
+
+void record_gpu_frame_end
+(
+    const VkCommandBuffer &command_buffer,
+    const GpuTimestamps &timestamps,
+    const size_t &frame
+);
+
+uint64_t read_gpu_frame_time
+(
+    const VkDevice &logical_device,
+    const GpuTimestamps &timestamps,
+    const size_t &frame
+);
+
+///////////////////////////////////////////////
+//////////////////// Class ////////////////////
+///////////////////////////////////////////////
+
+class Vulkan_GpuTimestamps
+{
+
+public:
+    // Constructor.
+    Vulkan_GpuTimestamps
+    (
+        const VkPhysicalDevice &physical_device,
+        const VkDevice &logical_device,
+        const VkQueueFamilyProperties &graphics_family,
+        const uint32_t &frames_in_flight
+    );
+
+    // Destructor.
+    ~Vulkan_GpuTimestamps();
+
+    GpuTimestamps get() const;
+
+    // Prevent data duplication.
+    Vulkan_GpuTimestamps(const Vulkan_GpuTimestamps&) = delete;
+    Vulkan_GpuTimestamps &operator = (const Vulkan_GpuTimestamps&) = delete;
+
+private:
+    // We declare the members of the class to store.
+    GpuTimestamps timestamps {};
+    VkDevice logical_device = VK_NULL_HANDLE;
+
+};
+
+#endif
@@ -0,0 +1,280 @@
+#include "render.visibility.hpp"
+
+#include "../vertex/models/models.geometry.hpp"
+#include "../uniform/uniform.frustum.hpp"
+#include "../uniform/uniform.camera.hpp"
+#include "../../config/engine.config.hpp"
+#include "../../scene/scene.bvh.hpp"
+#include "../../jobs/jobs.system.hpp"
+
+#include <vulkan/vulkan.h>
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+#include <cfloat>
+
+#if defined(__AVX__)
+    #include <immintrin.h>
+#elif defined(__SSE__) || defined(_M_X64)
+    #include <xmmintrin.h>
+#endif
+
+// Compute the world space bounding sphere of each render object.
+// The objects with an unknown mesh get a sphere that is never visible.
+void update_visibility_bounds
+(
+    const std::vector<RenderObject> &objects,
+    const std::vector<MeshRange> &meshes,
+    VisibilityBounds &bounds
+)
+{
+    const size_t padded_count = (objects.size() + VISIBILITY_BATCH_SIZE - 1) / VISIBILITY_BATCH_SIZE * VISIBILITY_BATCH_SIZE;
+
+    bounds.count = objects.size();
+    bounds.centers_x.resize(padded_count);
+    bounds.centers_y.resize(padded_count);
+    bounds.centers_z.resize(padded_count);
+    bounds.radii.resize(padded_count);
+
+    for (size_t i = 0; i < padded_count; i++)
+    {
+        if (i >= objects.size() || objects[i].mesh >= meshes.size())
+        {
+            bounds.centers_x[i] = 0.0f;
+            bounds.centers_y[i] = 0.0f;
+            bounds.centers_z[i] = 0.0f;
+            bounds.radii[i] = -FLT_MAX;
+            continue;
+        }
+
+        const RenderObject &object = objects[i];
+        const MeshRange &mesh = meshes[object.mesh];
+
+        const glm::vec3 center = glm::vec3(object.model * glm::vec4(mesh.bounds_center, 1.0f));
+        const float scale = std::max({ glm::length(glm::vec3(object.model[0])), glm::length(glm::vec3(object.model[1])), glm::length(glm::vec3(object.model[2])) });
+
+        bounds.centers_x[i] = center.x;
+        bounds.centers_y[i] = center.y;
+        bounds.centers_z[i] = center.z;
+        bounds.radii[i] = mesh.bounds_radius * scale;
+    }
+}
+
+// Append the indices of the spheres inside the frustum, one sphere at a time.
+void cull_spheres_scalar
+(
+    const Frustum &frustum,
+    const VisibilityBounds &bounds,
+    const size_t &first,
+    const size_t &last,
+    std::vector<uint32_t> &visible
+)
+{
+    for (size_t i = first; i < last && i < bounds.count; i++)
+    {
+        if (is_sphere_in_frustum(frustum, glm::vec3(bounds.centers_x[i], bounds.centers_y[i], bounds.centers_z[i]), bounds.radii[i]))
+        {
+            visible.push_back(static_cast<uint32_t>(i));
+        }
+    }
+}
+
+// Append the indices of the spheres inside the frustum, testing 8 spheres at once with AVX (4 with SSE).
+// The range must start on a multiple of VISIBILITY_BATCH_SIZE, the padding spheres are never visible.
+void cull_spheres_simd
+(
+    const Frustum &frustum,
+    const VisibilityBounds &bounds,
+    const size_t &first,
+    const size_t &last,
+    std::vector<uint32_t> &visible
+)
+{
+    const size_t end = std::min((last + VISIBILITY_BATCH_SIZE - 1) / VISIBILITY_BATCH_SIZE * VISIBILITY_BATCH_SIZE, bounds.radii.size());
+
+    // The indices are written for every lane and only the visible ones are kept, so the output has no branch.
+    size_t written = visible.size();
+    visible.resize(written + (end > first ? end - first : 0));
+
+    #if defined(__AVX__)
+        for (size_t i = first; i < end; i += 8)
+        {
+            const __m256 x = _mm256_loadu_ps(&bounds.centers_x[i]);
+            const __m256 y = _mm256_loadu_ps(&bounds.centers_y[i]);
+            const __m256 z = _mm256_loadu_ps(&bounds.centers_z[i]);
+            const __m256 negative_radius = _mm256_sub_ps(_mm256_setzero_ps(), _mm256_loadu_ps(&bounds.radii[i]));
+
+            __m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+
+            for (const glm::vec4 &plane : frustum.planes)
+            {
+                __m256 distance = _mm256_add_ps(_mm256_mul_ps(x, _mm256_set1_ps(plane.x)), _mm256_set1_ps(plane.w));
+                distance = _mm256_add_ps(distance, _mm256_mul_ps(y, _mm256_set1_ps(plane.y)));
+                distance = _mm256_add_ps(distance, _mm256_mul_ps(z, _mm256_set1_ps(plane.z)));
+
+                inside = _mm256_and_ps(inside, _mm256_cmp_ps(distance, negative_radius, _CMP_GE_OQ));
+            }
+
+            const int mask = _mm256_movemask_ps(inside);
+
+            for (int lane = 0; lane < 8; lane++)
+            {
+                visible[written] = static_cast<uint32_t>(i + lane);
+                written += (mask >> lane) & 1;
+            }
+        }
+    #elif defined(__SSE__) || defined(_M_X64)
+        for (size_t i = first; i < end; i += 4)
+        {
+            const __m128 x = _mm_loadu_ps(&bounds.centers_x[i]);
+            const __m128 y = _mm_loadu_ps(&bounds.centers_y[i]);
+            const __m128 z = _mm_loadu_ps(&bounds.centers_z[i]);
+            const __m128 negative_radius = _mm_sub_ps(_mm_setzero_ps(), _mm_loadu_ps(&bounds.radii[i]));
+
+            __m128 inside = _mm_cmpeq_ps(x, x); // All lanes set (the centers are never NaN).
+
+            for (const glm::vec4 &plane : frustum.planes)
+            {
+                __m128 distance = _mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(plane.x)), _mm_set1_ps(plane.w));
+                distance = _mm_add_ps(distance, _mm_mul_ps(y, _mm_set1_ps(plane.y)));
+                distance = _mm_add_ps(distance, _mm_mul_ps(z, _mm_set1_ps(plane.z)));
+
+                inside = _mm_and_ps(inside, _mm_cmpge_ps(distance, negative_radius));
+            }
+
+            const int mask = _mm_movemask_ps(inside);
+
+            for (int lane = 0; lane < 4; lane++)
+            {
+                visible[written] = static_cast<uint32_t>(i + lane);
+                written += (mask >> lane) & 1;
+            }
+        }
+    #else
+        visible.resize(written);
+        cull_spheres_scalar(frustum, bounds, first, end, visible);
+        written = visible.size();
+    #endif
+
+    visible.resize(written);
+}
+
+// Synchronize the scene hierarchy with the bounding spheres: one proxy per object, holding the box around its sphere.
+// Only the objects that moved are refitted, a change in the amount of objects triggers a rebuild.
+void update_visibility_bvh
+(
+    VisibilityBounds &bounds
+)
+{
+    while (bounds.bvh_proxies.size() > bounds.count)
+    {
+        bounds.bvh.remove_object(bounds.bvh_proxies.back());
+        bounds.bvh_proxies.pop_back();
+    }
+
+    for (size_t i = 0; i < bounds.count; i++)
+    {
+        const glm::vec3 center = glm::vec3(bounds.centers_x[i], bounds.centers_y[i], bounds.centers_z[i]);
+        const float radius = bounds.radii[i];
+
+        // The objects with an unknown mesh get an inverted box, which is never visible.
+        const BoundingBox box { center - glm::vec3(radius), center + glm::vec3(radius) };
+
+        if (i < bounds.bvh_proxies.size())
+        {
+            bounds.bvh.move_object(bounds.bvh_proxies[i], box);
+        }
+        else bounds.bvh_proxies.push_back(bounds.bvh.insert_object(box, static_cast<uint32_t>(i)));
+    }
+
+    bounds.bvh.update();
+}
+
+// Output the compact list of the objects inside the frustum, in increasing order.
+// Large scenes are split in contiguous ranges of batches, culled by the job system threads.
+void cull_visibility_bounds
+(
+    const Frustum &frustum,
+    const VisibilityBounds &bounds,
+    std::vector<uint32_t> &visible
+)
+{
+    visible.clear();
+
+    const size_t batches_count = bounds.radii.size() / VISIBILITY_BATCH_SIZE;
+    const size_t ranges_count = std::min(get_job_threads_count(), bounds.count / std::max<size_t>(1, EngineConfig::VISIBILITY_OBJECTS_PER_THREAD));
+
+    if (ranges_count < 2)
+    {
+        cull_spheres_simd(frustum, bounds, 0, bounds.radii.size(), visible);
+        return;
+    }
+
+    // Each range writes its own output, merged in order afterwards.
+    std::vector<std::vector<uint32_t>> thread_outputs(ranges_count);
+
+    parallel_for(ranges_count, 1, [&frustum, &bounds, &thread_outputs, batches_count, ranges_count](const size_t &first_range, const size_t &last_range)
+    {
+        for (size_t t = first_range; t < last_range; t++)
+        {
+            const size_t first = batches_count * t / ranges_count * VISIBILITY_BATCH_SIZE;
+            const size_t last = batches_count * (t + 1) / ranges_count * VISIBILITY_BATCH_SIZE;
+
+            cull_spheres_simd(frustum, bounds, first, last, thread_outputs[t]);
+        }
+    });
+
+    size_t visible_count = 0;
+
+    for (const std::vector<uint32_t> &output : thread_outputs)
+    {
+        visible_count += output.size();
+    }
+
+    visible.reserve(visible_count);
+
+    for (const std::vector<uint32_t> &output : thread_outputs)
+    {
+        visible.insert(visible.end(), output.begin(), output.end());
+    }
+}
+
+// Visibility stage between the scene update and the command buffer recording.
+// Output the indices of the objects to draw this frame.
+void select_visible_objects
+(
+    const std::vector<RenderObject> &objects,
+    const std::vector<MeshRange> &meshes,
+    const CameraData &camera,
+    const VkExtent2D &extent,
+    VisibilityBounds &bounds,
+    std::vector<uint32_t> &visible
+)
+{
+    if (!EngineConfig::USE_FRUSTUM_CULLING)
+    {
+        visible.resize(objects.size());
+        std::iota(visible.begin(), visible.end(), 0);
+        return;
+    }
+
+    const Frustum frustum = extract_frustum(get_camera_projection_matrix(camera, extent) * get_camera_view_matrix(camera));
+
+    update_visibility_bounds(objects, meshes, bounds);
+
+    if (EngineConfig::USE_BVH_CULLING)
+    {
+        visible.clear();
+        update_visibility_bvh(bounds);
+        bounds.bvh.query_frustum(frustum, visible);
+
+        // Keep the order of the linear culling, so the draws follow the order the objects were collected in.
+        std::sort(visible.begin(), visible.end());
+        return;
+    }
+
+    cull_visibility_bounds(frustum, bounds, visible);
+}
@@ -0,0 +1,86 @@
+#include "../vertex/models/models.geometry.hpp"
+#include "../uniform/uniform.frustum.hpp"
+#include "../uniform/uniform.camera.hpp"
+#include "../../scene/scene.bvh.hpp"
+
+#include <vulkan/vulkan.h>
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+#ifndef VULKAN_RENDER_VISIBILITY_HPP
+#define VULKAN_RENDER_VISIBILITY_HPP
+
+// Amount of spheres tested at once by the SIMD culling (padding of the bounds arrays).
+constexpr const size_t VISIBILITY_BATCH_SIZE = 8;
+
+////////////////////////////////////////////////////
+//////////////////// Structures ////////////////////
+////////////////////////////////////////////////////
+
+// World space bounding spheres of the render objects, stored as structure of arrays.
+// The arrays are padded to a multiple of VISIBILITY_BATCH_SIZE with spheres that are never visible.
+// The hierarchy holds the boxes around the same spheres, one proxy per object, for the BVH culling.
+struct VisibilityBounds
+{
+    std::vector<float> centers_x;
+    std::vector<float> centers_y;
+    std::vector<float> centers_z;
+    std::vector<float> radii;
+    size_t count;  // Amount of real spheres, without the padding.
+    SceneBvh bvh;
+    std::vector<uint32_t> bvh_proxies;
+};
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+void update_visibility_bounds
+(
+    const std::vector<RenderObject> &objects,
+    const std::vector<MeshRange> &meshes,
+    VisibilityBounds &bounds
+);
+
+void cull_spheres_scalar
+(
+    const Frustum &frustum,
+    const VisibilityBounds &bounds,
+    const size_t &first,
+    const size_t &last,
+    std::vector<uint32_t> &visible
+);
+
+void cull_spheres_simd
+(
+    const Frustum &frustum,
+    const VisibilityBounds &bounds,
+    const size_t &first,
+    const size_t &last,
+    std::vector<uint32_t> &visible
+);
+
+void update_visibility_bvh
+(
+    VisibilityBounds &bounds
+);
+
+void cull_visibility_bounds
+(
+    const Frustum &frustum,
+    const VisibilityBounds &bounds,
+    std::vector<uint32_t> &visible
+);
+
+void select_visible_objects
+(
+    const std::vector<RenderObject> &objects,
+    const std::vector<MeshRange> &meshes,
+    const CameraData &camera,
+    const VkExtent2D &extent,
+    VisibilityBounds &bounds,
+    std::vector<uint32_t> &visible
+);
+
+#endif
@@ -0,0 +1,162 @@
+#include "render.sync.deletion.hpp"
+
+#include "../../../logs/logs.handler.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// The resources can be retired from any thread, like the ones streaming the assets.
+std::mutex deletion_mutex;
+std::deque<RetiredBatch> deletion_batches;
+uint64_t deletion_frame = 0;
+size_t deletion_count = 0;
+bool deletion_running = false;
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+// Start deferring the destruction of the retired resources.
+void start_vulkan_deletion_queue()
+{
+    std::lock_guard<std::mutex> lock(deletion_mutex);
+
+    if (deletion_running)
+    {
+        error_log("Failed to start the deletion queue! It is already running.");
+        return;
+    }
+
+    deletion_frame = 0;
+    deletion_running = true;
+}
+
+// Destroy all the retired resources, then destroy the next ones right away.
+void stop_vulkan_deletion_queue()
+{
+    {
+        std::lock_guard<std::mutex> lock(deletion_mutex);
+
+        if (!deletion_running)
+        {
+            return;
+        }
+
+        deletion_running = false;
+    }
+
+    log("Destroying the " + std::to_string(get_vulkan_retired_count()) + " resources left in the deletion queue..");
+    collect_vulkan_retired_resources(UINT64_MAX);
+}
+
+bool is_vulkan_deletion_queue_running()
+{
+    std::lock_guard<std::mutex> lock(deletion_mutex);
+    return deletion_running;
+}
+
+// Set the frame, or the GPU timeline value, the next retired resources are stamped with, before the frame is recorded.
+// The frames must be given in increasing order.
+void begin_vulkan_deletion_frame
+(
+    const uint64_t &frame
+)
+{
+    std::lock_guard<std::mutex> lock(deletion_mutex);
+
+    if (frame < deletion_frame)
+    {
+        error_log("Failed to begin a deletion frame! The frame provided (" + std::to_string(frame) + ") is older than the current one (" + std::to_string(deletion_frame) + ").");
+        return;
+    }
+
+    deletion_frame = frame;
+}
+
+// Destroy a resource once the GPU is done with the current frame, or right away when the deletion queue isn't running.
+void retire_vulkan_resource
+(
+    const std::function<void()> &destroy
+)
+{
+    if (!destroy)
+    {
+        error_log("Failed to retire a resource! No destroy function was provided.");
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(deletion_mutex);
+
+        if (deletion_running)
+        {
+            if (deletion_batches.empty() || deletion_batches.back().frame != deletion_frame)
+            {
+                deletion_batches.push_back({ deletion_frame, {} });
+            }
+
+            deletion_batches.back().destroys.push_back(destroy);
+            deletion_count++;
+            return;
+        }
+    }
+
+    destroy();
+}
+
+// Destroy the batches of the frames the GPU is done with, in the order they were retired.
+// The batches are destroyed outside of the lock, so their destroy functions can retire other resources.
+void collect_vulkan_retired_resources
+(
+    const uint64_t &completed_frame
+)
+{
+    std::vector<RetiredBatch> batches;
+
+    {
+        std::lock_guard<std::mutex> lock(deletion_mutex);
+
+        while (!deletion_batches.empty() && deletion_batches.front().frame <= completed_frame)
+        {
+            deletion_count -= deletion_batches.front().destroys.size();
+            batches.push_back(std::move(deletion_batches.front()));
+            deletion_batches.pop_front();
+        }
+    }
+
+    for (const RetiredBatch &batch : batches)
+    {
+        for (const std::function<void()> &destroy : batch.destroys)
+        {
+            destroy();
+        }
+    }
+}
+
+// Return the amount of resources waiting for the GPU.
+size_t get_vulkan_retired_count()
+{
+    std::lock_guard<std::mutex> lock(deletion_mutex);
+    return deletion_count;
+}
+
+///////////////////////////////////////////////
+//////////////////// Class ////////////////////
+///////////////////////////////////////////////
+
+// Constructor.
+Vulkan_DeletionQueue::Vulkan_DeletionQueue()
+{
+    start_vulkan_deletion_queue();
+}
+
+// Destructor.
+Vulkan_DeletionQueue::~Vulkan_DeletionQueue()
+{
+    stop_vulkan_deletion_queue();
+}
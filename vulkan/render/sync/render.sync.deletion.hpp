@@ -0,0 +1,67 @@
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#ifndef VULKAN_RENDER_SYNC_DELETION_HPP
+#define VULKAN_RENDER_SYNC_DELETION_HPP
+
+////////////////////////////////////////////////////
+//////////////////// Structures ////////////////////
+////////////////////////////////////////////////////
+
+// Resources retired during the same frame, destroyed together once the GPU is done with that frame.
+struct RetiredBatch
+{
+    uint64_t frame;                              // Last frame which may use the resources, or the GPU timeline value of that frame.
+    std::vector<std::function<void()>> destroys; // In the order the resources were retired.
+};
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+void start_vulkan_deletion_queue();
+void stop_vulkan_deletion_queue();
+bool is_vulkan_deletion_queue_running();
+
+void begin_vulkan_deletion_frame
+(
+    const uint64_t &frame
+);
+
+void retire_vulkan_resource
+(
+    const std::function<void()> &destroy
+);
+
+void collect_vulkan_retired_resources
+(
+    const uint64_t &completed_frame
+);
+
+size_t get_vulkan_retired_count();
+
+///////////////////////////////////////////////
+//////////////////// Class ////////////////////
+///////////////////////////////////////////////
+
+// Run the deletion queue while it exists, the resources still retired are destroyed with it.
+// Note: the device must be idle when it is destroyed, and it must outlive the objects retiring their resources.
+class Vulkan_DeletionQueue
+{
+
+public:
+    // Constructor.
+    Vulkan_DeletionQueue();
+
+    // Destructor.
+    ~Vulkan_DeletionQueue();
+
+    // Prevent data duplication.
+    Vulkan_DeletionQueue(const Vulkan_DeletionQueue&) = delete;
+    Vulkan_DeletionQueue &operator = (const Vulkan_DeletionQueue&) = delete;
+
+};
+
+#endif
@@ -0,0 +1,250 @@
+#include "render.sync.present.hpp"
+
+#include "../../core/vulkan.extensions.hpp"
+#include "../../../logs/logs.handler.hpp"
+#include "../../../utils/tool.text.format.hpp"
+
+#include <vulkan/vulkan.h>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+// The presents and the swap chain recreations only happen on the main thread.
+std::vector<VkFence> present_fences;            // One per frame in flight, none when the device can't signal the end of a present.
+std::deque<RetiredPresent> retired_presents;
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+// Return true if a physical device can signal a fence once a present is done, which tells when a swap chain can be destroyed.
+// The device extension also needs the surface one on the instance, enabled whenever it is available.
+bool get_present_fence_support
+(
+    const VkPhysicalDevice &physical_device
+)
+{
+    if (physical_device == VK_NULL_HANDLE)
+    {
+        error_log("Failed to determine the present fence support! The physical device provided (" + force_string(physical_device) + ") is not valid!");
+        return false;
+    }
+
+    const bool instance_support = is_vulkan_instance_extension_supported(VK_EXT_SURFACE_MAINTENANCE_1_EXTENSION_NAME) && is_vulkan_instance_extension_supported(VK_KHR_GET_SURFACE_CAPABILITIES_2_EXTENSION_NAME);
+
+    if (!instance_support || !is_vulkan_extension_supported(physical_device, VK_EXT_SWAPCHAIN_MAINTENANCE_1_EXTENSION_NAME))
+    {
+        log("Present fence support: no, the present queue idles before a swap chain is destroyed.");
+        return false;
+    }
+
+    VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT swapchain_maintenance_features { .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SWAPCHAIN_MAINTENANCE_1_FEATURES_EXT };
+    VkPhysicalDeviceFeatures2 features
+    {
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2,
+        .pNext = &swapchain_maintenance_features
+    };
+
+    vkGetPhysicalDeviceFeatures2(physical_device, &features);
+
+    const bool supported = swapchain_maintenance_features.swapchainMaintenance1 == VK_TRUE;
+    log("Present fence support: " + std::string(supported ? "yes." : "no, the present queue idles before a swap chain is destroyed."));
+
+    return supported;
+}
+
+// Create the fences signaled by the presents, already signaled as no present uses them yet.
+std::vector<VkFence> create_vulkan_present_fences
+(
+    const VkDevice &logical_device,
+    const uint32_t &count
+)
+{
+    if (logical_device == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Present fences creation failed! The logical device provided (" + force_string(logical_device) + ") is not valid!");
+    }
+
+    const VkFenceCreateInfo create_info
+    {
+        .sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,
+        .flags = VK_FENCE_CREATE_SIGNALED_BIT // The first wait for each fence doesn't block.
+    };
+
+    std::vector<VkFence> fences(count, VK_NULL_HANDLE);
+
+    for (VkFence &fence : fences)
+    {
+        const VkResult fence_creation = vkCreateFence(logical_device, &create_info, nullptr, &fence);
+
+        if (fence_creation != VK_SUCCESS)
+        {
+            fatal_error_log("Present fence creation returned error code " + std::to_string(fence_creation) + ".");
+        }
+    }
+
+    return fences;
+}
+
+// Wait for the presents using the fences, then destroy them.
+void destroy_vulkan_present_fences
+(
+    const VkDevice &logical_device,
+    std::vector<VkFence> &fences
+)
+{
+    if (fences.empty())
+    {
+        return;
+    }
+
+    if (logical_device == VK_NULL_HANDLE)
+    {
+        error_log("Present fences destruction failed! The logical device provided (" + force_string(logical_device) + ") is not valid!");
+        return;
+    }
+
+    if (vkWaitForFences(logical_device, static_cast<uint32_t>(fences.size()), fences.data(), VK_TRUE, PRESENT_FENCE_TIMEOUT) != VK_SUCCESS)
+    {
+        error_log("Some presents weren't done before their fences destruction!");
+    }
+
+    for (const VkFence &fence : fences)
+    {
+        vkDestroyFence(logical_device, fence, nullptr);
+    }
+
+    fences.clear();
+}
+
+// Create the fences of the frames in flight, none when the present fences aren't enabled.
+void start_vulkan_present_fences
+(
+    const VkDevice &logical_device,
+    const uint32_t &frames_in_flight,
+    const bool &enabled
+)
+{
+    if (!present_fences.empty())
+    {
+        error_log("Failed to start the present fences! They are already started.");
+        return;
+    }
+
+    if (enabled)
+    {
+        present_fences = create_vulkan_present_fences(logical_device, frames_in_flight);
+    }
+}
+
+// Destroy the resources still retired once their presents are done, then the fences of the frames in flight.
+void stop_vulkan_present_fences
+(
+    const VkDevice &logical_device
+)
+{
+    while (!retired_presents.empty())
+    {
+        RetiredPresent retired = std::move(retired_presents.front());
+        retired_presents.pop_front();
+
+        destroy_vulkan_present_fences(logical_device, retired.fences);
+        retired.destroy();
+    }
+
+    destroy_vulkan_present_fences(logical_device, present_fences);
+}
+
+// Give the fence the next present of a frame in flight signals, once the last present of that frame is done.
+// Return VK_NULL_HANDLE when the present fences aren't enabled.
+VkFence acquire_vulkan_present_fence
+(
+    const VkDevice &logical_device,
+    const size_t &frame
+)
+{
+    if (frame >= present_fences.size())
+    {
+        return VK_NULL_HANDLE;
+    }
+
+    // The frame in flight was drawn again since that present, so it is almost always done already.
+    if (vkWaitForFences(logical_device, 1, &present_fences[frame], VK_TRUE, PRESENT_FENCE_TIMEOUT) != VK_SUCCESS)
+    {
+        error_log("The last present of the frame #" + std::to_string(frame) + " isn't done, its fence is reused anyway.");
+    }
+
+    vkResetFences(logical_device, 1, &present_fences[frame]);
+    return present_fences[frame];
+}
+
+// Destroy the resources of a replaced swap chain, like its semaphores, once the presents already queued are done.
+// The resources are released by their own destructors, so the frames still drawing with them keep them until they are done.
+void retire_vulkan_present_resources
+(
+    const VkDevice &logical_device,
+    const VkQueue &present_queue,
+    const std::function<void()> &destroy
+)
+{
+    // Without present fences, the present queue idling is the only sign its presents waited for their semaphores.
+    if (present_fences.empty())
+    {
+        vkQueueWaitIdle(present_queue);
+        destroy();
+        return;
+    }
+
+    // The fences now follow the presents of the replaced swap chain, the new one gets its own.
+    retired_presents.push_back({ present_fences, destroy });
+    present_fences = create_vulkan_present_fences(logical_device, static_cast<uint32_t>(present_fences.size()));
+}
+
+// Destroy the resources of the replaced swap chains whose presents are done, in the order they were retired.
+void collect_vulkan_retired_presents
+(
+    const VkDevice &logical_device
+)
+{
+    while (!retired_presents.empty())
+    {
+        for (const VkFence &fence : retired_presents.front().fences)
+        {
+            if (vkGetFenceStatus(logical_device, fence) != VK_SUCCESS)
+            {
+                return;
+            }
+        }
+
+        RetiredPresent retired = std::move(retired_presents.front());
+        retired_presents.pop_front();
+
+        destroy_vulkan_present_fences(logical_device, retired.fences);
+        retired.destroy();
+    }
+}
+
+///////////////////////////////////////////////
+//////////////////// Class ////////////////////
+///////////////////////////////////////////////
+
+// Constructor.
+Vulkan_PresentFences::Vulkan_PresentFences
+(
+    const VkDevice &logical_device,
+    const uint32_t &frames_in_flight,
+    const bool &enabled
+) : logical_device(logical_device)
+{
+    start_vulkan_present_fences(logical_device, frames_in_flight, enabled);
+}
+
+// Destructor.
+Vulkan_PresentFences::~Vulkan_PresentFences()
+{
+    stop_vulkan_present_fences(logical_device);
+}
@@ -0,0 +1,106 @@
+#include <vulkan/vulkan.h>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#ifndef VULKAN_RENDER_SYNC_PRESENT_HPP
+#define VULKAN_RENDER_SYNC_PRESENT_HPP
+
+// Longest wait for a present fence (in nanoseconds), a present which failed may never signal its fence.
+constexpr const uint64_t PRESENT_FENCE_TIMEOUT = 1000000000;
+
+////////////////////////////////////////////////////
+//////////////////// Structures ////////////////////
+////////////////////////////////////////////////////
+
+// Resources used by the presents of a replaced swap chain, destroyed once all those presents are done.
+struct RetiredPresent
+{
+    std::vector<VkFence> fences;   // Signaled by the last present of each frame in flight.
+    std::function<void()> destroy;
+};
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+bool get_present_fence_support
+(
+    const VkPhysicalDevice &physical_device
+);
+
+std::vector<VkFence> create_vulkan_present_fences
+(
+    const VkDevice &logical_device,
+    const uint32_t &count
+);
+
+void destroy_vulkan_present_fences
+(
+    const VkDevice &logical_device,
+    std::vector<VkFence> &fences
+);
+
+void start_vulkan_present_fences
+(
+    const VkDevice &logical_device,
+    const uint32_t &frames_in_flight,
+    const bool &enabled
+);
+
+void stop_vulkan_present_fences
+(
+    const VkDevice &logical_device
+);
+
+VkFence acquire_vulkan_present_fence
+(
+    const VkDevice &logical_device,
+    const size_t &frame
+);
+
+void retire_vulkan_present_resources
+(
+    const VkDevice &logical_device,
+    const VkQueue &present_queue,
+    const std::function<void()> &destroy
+);
+
+void collect_vulkan_retired_presents
+(
+    const VkDevice &logical_device
+);
+
+///////////////////////////////////////////////
+//////////////////// Class ////////////////////
+///////////////////////////////////////////////
+
+// Give a fence to each present while it exists, the resources still retired are destroyed with it.
+// Note: it must be destroyed before the deletion queue, as the retired resources are then handed to that queue.
+class Vulkan_PresentFences
+{
+
+public:
+    // Constructor.
+    Vulkan_PresentFences
+    (
+        const VkDevice &logical_device,
+        const uint32_t &frames_in_flight,
+        const bool &enabled
+    );
+
+    // Destructor.
+    ~Vulkan_PresentFences();
+
+    // Prevent data duplication.
+    Vulkan_PresentFences(const Vulkan_PresentFences&) = delete;
+    Vulkan_PresentFences &operator = (const Vulkan_PresentFences&) = delete;
+
+private:
+    // We declare the members of the class to store.
+    VkDevice logical_device = VK_NULL_HANDLE;
+
+};
+
+#endif
@@ -1,5 +1,6 @@
 #include "render.sync.semaphores.hpp"
 
+#include "render.sync.deletion.hpp"
 #include "../../../logs/logs.handler.hpp"
 #include "../../../utils/tool.text.format.hpp"
 
@@ -11,7 +12,7 @@
 //////////////////// Functions ////////////////////
 ///////////////////////////////////////////////////
 
-// Create a semaphore for each swap chain image.
+// Create some semaphores, for the swap chain images and the frames in flight.
 std::vector<VkSemaphore> create_vulkan_semaphores
 (
     const VkDevice &logical_device,
@@ -128,7 +129,10 @@ Vulkan_Semaphores::Vulkan_Semaphores
 // Destructor.
 Vulkan_Semaphores::~Vulkan_Semaphores()
 {
-    destroy_semaphores(logical_device, semaphores);
+    retire_vulkan_resource([logical_device = logical_device, semaphores = semaphores]() mutable
+    {
+        destroy_semaphores(logical_device, semaphores);
+    });
 }
 
 std::vector<VkSemaphore> Vulkan_Semaphores::get() const
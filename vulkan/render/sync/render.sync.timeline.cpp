@@ -0,0 +1,165 @@
+#include "render.sync.timeline.hpp"
+
+#include "render.sync.deletion.hpp"
+#include "../../../logs/logs.handler.hpp"
+#include "../../../utils/tool.text.format.hpp"
+
+#include <vulkan/vulkan.h>
+#include <cstdint>
+#include <string>
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+// Create a timeline semaphore, a GPU counter which only goes up.
+// The submits signal and wait for its values, and the CPU waits for the value of a specific submit.
+VkSemaphore create_vulkan_timeline_semaphore
+(
+    const VkDevice &logical_device,
+    const uint64_t &initial_value
+)
+{
+    log("Creating a timeline semaphore..");
+
+    if (logical_device == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Timeline semaphore creation failed! The logical device provided (" + force_string(logical_device) + ") is not valid!");
+    }
+
+    const VkSemaphoreTypeCreateInfo type_create_info
+    {
+        .sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO,
+        .semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE, // Hold a 64 bits value instead of a signaled state.
+        .initialValue = initial_value                // Value before the first signal.
+    };
+
+    const VkSemaphoreCreateInfo create_info
+    {
+        .sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
+        .pNext = &type_create_info // Pass the semaphore type.
+    };
+
+    VkSemaphore timeline_semaphore = VK_NULL_HANDLE;
+    const VkResult semaphore_creation = vkCreateSemaphore(logical_device, &create_info, nullptr, &timeline_semaphore);
+
+    if (semaphore_creation != VK_SUCCESS)
+    {
+        fatal_error_log("Timeline semaphore creation returned error code " + std::to_string(semaphore_creation) + ".");
+    }
+
+    if (timeline_semaphore == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Timeline semaphore creation output (" + force_string(timeline_semaphore) + ") is not valid!");
+    }
+
+    log("Timeline semaphore " + force_string(timeline_semaphore) + " created successfully!");
+    return timeline_semaphore;
+}
+
+// Destroy a timeline semaphore.
+void destroy_vulkan_timeline_semaphore
+(
+    const VkDevice &logical_device,
+    VkSemaphore &timeline_semaphore
+)
+{
+    log("Destroying the " + force_string(timeline_semaphore) + " timeline semaphore..");
+
+    if (logical_device == VK_NULL_HANDLE)
+    {
+        error_log("Timeline semaphore destruction failed! The logical device provided (" + force_string(logical_device) + ") is not valid!");
+        return;
+    }
+
+    if (timeline_semaphore == VK_NULL_HANDLE)
+    {
+        error_log("Timeline semaphore destruction failed! The timeline semaphore provided (" + force_string(timeline_semaphore) + ") is not valid!");
+        return;
+    }
+
+    vkDestroySemaphore(logical_device, timeline_semaphore, nullptr);
+    timeline_semaphore = VK_NULL_HANDLE;
+
+    log("Timeline semaphore destroyed successfully!");
+}
+
+// Return the last value reached by the GPU, every submit signaling up to it is done.
+uint64_t get_vulkan_timeline_value
+(
+    const VkDevice &logical_device,
+    const VkSemaphore &timeline_semaphore
+)
+{
+    uint64_t value = 0;
+    const VkResult value_query = vkGetSemaphoreCounterValue(logical_device, timeline_semaphore, &value);
+
+    if (value_query != VK_SUCCESS)
+    {
+        error_log("Failed to get the timeline semaphore value! The query returned error code " + std::to_string(value_query) + ".");
+        return 0;
+    }
+
+    return value;
+}
+
+// Block the CPU until the GPU reaches a value of the timeline.
+bool wait_vulkan_timeline_value
+(
+    const VkDevice &logical_device,
+    const VkSemaphore &timeline_semaphore,
+    const uint64_t &value
+)
+{
+    // The initial value is always reached.
+    if (value < 1)
+    {
+        return true;
+    }
+
+    const VkSemaphoreWaitInfo wait_info
+    {
+        .sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO,
+        .semaphoreCount = 1,                // Amount of semaphores to wait for.
+        .pSemaphores = &timeline_semaphore, // Pass the timeline semaphore.
+        .pValues = &value                   // Pass the value to reach.
+    };
+
+    const VkResult wait_result = vkWaitSemaphores(logical_device, &wait_info, UINT64_MAX);
+
+    if (wait_result != VK_SUCCESS)
+    {
+        error_log("Failed to wait for the timeline value " + std::to_string(value) + "! The wait returned error code " + std::to_string(wait_result) + ".");
+        return false;
+    }
+
+    return true;
+}
+
+///////////////////////////////////////////////
+//////////////////// Class ////////////////////
+///////////////////////////////////////////////
+
+// Constructor.
+Vulkan_TimelineSemaphore::Vulkan_TimelineSemaphore
+(
+    const VkDevice &logical_device,
+    const uint64_t &initial_value
+) : logical_device(logical_device)
+{
+    timeline_semaphore = create_vulkan_timeline_semaphore(logical_device, initial_value);
+}
+
+// Destructor.
+Vulkan_TimelineSemaphore::~Vulkan_TimelineSemaphore()
+{
+    retire_vulkan_resource([logical_device = logical_device, timeline_semaphore = timeline_semaphore]() mutable
+    {
+        destroy_vulkan_timeline_semaphore(logical_device, timeline_semaphore);
+    });
+}
+
+VkSemaphore Vulkan_TimelineSemaphore::get() const
+{
+    return timeline_semaphore;
+}
@@ -0,0 +1,67 @@
+#include <vulkan/vulkan.h>
+#include <cstdint>
+
+#ifndef VULKAN_RENDER_SYNC_TIMELINE_HPP
+#define VULKAN_RENDER_SYNC_TIMELINE_HPP
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+VkSemaphore create_vulkan_timeline_semaphore
+(
+    const VkDevice &logical_device,
+    const uint64_t &initial_value
+);
+
+void destroy_vulkan_timeline_semaphore
+(
+    const VkDevice &logical_device,
+    VkSemaphore &timeline_semaphore
+);
+
+uint64_t get_vulkan_timeline_value
+(
+    const VkDevice &logical_device,
+    const VkSemaphore &timeline_semaphore
+);
+
+bool wait_vulkan_timeline_value
+(
+    const VkDevice &logical_device,
+    const VkSemaphore &timeline_semaphore,
+    const uint64_t &value
+);
+
+///////////////////////////////////////////////
+//////////////////// Class ////////////////////
+///////////////////////////////////////////////
+
+class Vulkan_TimelineSemaphore
+{
+
+public:
+    // Constructor.
+    Vulkan_TimelineSemaphore
+    (
+        const VkDevice &logical_device,
+        const uint64_t &initial_value
+    );
+
+    // Destructor.
+    ~Vulkan_TimelineSemaphore();
+
+    VkSemaphore get() const;
+
+    // Prevent data duplication.
+    Vulkan_TimelineSemaphore(const Vulkan_TimelineSemaphore&) = delete;
+    Vulkan_TimelineSemaphore &operator = (const Vulkan_TimelineSemaphore&) = delete;
+
+private:
+    // We declare the members of the class to store.
+    VkSemaphore timeline_semaphore = VK_NULL_HANDLE;
+    VkDevice logical_device = VK_NULL_HANDLE;
+
+};
+
+#endif
@@ -1,5 +1,6 @@
 #include "shader.modules.hpp"
 
+#include "../render/sync/render.sync.deletion.hpp"
 #include "../../logs/logs.handler.hpp"
 #include "../../utils/tool.files.hpp"
 #include "../../utils/tool.text.format.hpp"
@@ -96,20 +97,21 @@ std::vector<ShaderInfo> create_all_vulkan_shader_modules
             continue;
         }
 
-        if (file_extension != ".frag" && file_extension != ".vert")
+        if (file_extension != ".frag" && file_extension != ".vert" && file_extension != ".comp")
         {
-            error_log("- The creation of the shader module \"" + file_name + "\" failed! It's neither a vertex nor a fragment shader!");
+            error_log("- The creation of the shader module \"" + file_name + "\" failed! It's neither a vertex, a fragment nor a compute shader!");
             continue;
         }
 
-        const std::string type = file_extension == ".vert" ? "vert" : "frag";
+        const std::string type = file_extension.substr(1); // "vert", "frag" or "comp".
         const std::vector<char> shader_binaries = read_binary_file("./shaders/" + file_name);
         const VkShaderModule shader_module = create_vulkan_shader_module(logical_device, shader_binaries, file_name);
 
         const ShaderInfo shader_info
         {
             type,
-            shader_module
+            shader_module,
+            file_name
         };
 
         shaders_modules.emplace_back(shader_info);
@@ -192,7 +194,10 @@ Vulkan_ShadersModules::Vulkan_ShadersModules
 // Destructor.
 Vulkan_ShadersModules::~Vulkan_ShadersModules()
 {
-    destroy_vulkan_shader_modules(logical_device, shaders_modules);
+    retire_vulkan_resource([logical_device = logical_device, shaders_modules = shaders_modules]() mutable
+    {
+        destroy_vulkan_shader_modules(logical_device, shaders_modules);
+    });
 }
 
 std::vector<ShaderInfo> Vulkan_ShadersModules::get() const
@@ -13,6 +13,7 @@ struct ShaderInfo
 {
     std::string shader_type;
     VkShaderModule shader_module;
+    std::string file_name;
 };
 
 ///////////////////////////////////////////////////
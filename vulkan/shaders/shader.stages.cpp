@@ -6,10 +6,12 @@
 
 #include <vulkan/vulkan.h>
 #include <vector>
+#include <string>
 #include <map>
 
 // Create a shader stage for each shader module for a graphics pipeline.
 // Note: Any invalid shader module won't have a shader stage and so won't be loaded into the graphics pipeline!
+// The compute shaders are skipped, they have their own pipelines.
 std::vector<VkPipelineShaderStageCreateInfo> create_vulkan_shader_stages
 (
     const std::vector<ShaderInfo> &shaders_modules
@@ -33,6 +35,11 @@ std::vector<VkPipelineShaderStageCreateInfo> create_vulkan_shader_stages
         const std::string shader_type = shader.shader_type; // Fragment or Vertex.
         const VkShaderModule shader_module = shader.shader_module;
 
+        if (shader_type == "comp")
+        {
+            continue;
+        }
+
         if (shader_module == VK_NULL_HANDLE)
         {
             error_log("- Failed to create the shader stage #" + std::to_string(i) + "/" + std::to_string(shaders_modules.size()) + "! The shader module provided (" + force_string(shader_module) + ") is not valid!");
@@ -54,3 +61,33 @@ std::vector<VkPipelineShaderStageCreateInfo> create_vulkan_shader_stages
     log(std::to_string(shaders_stages.size()) + "/" + std::to_string(shaders_modules.size()) + " shaders stages created successfully!");
     return shaders_stages;
 }
+
+// Create the shader stage of a compute pipeline, from the compute shader module loaded from a given file.
+VkPipelineShaderStageCreateInfo create_vulkan_compute_shader_stage
+(
+    const std::vector<ShaderInfo> &shaders_modules,
+    const std::string &file_name
+)
+{
+    for (const ShaderInfo &shader : shaders_modules)
+    {
+        if (shader.shader_type != "comp" || shader.file_name != file_name || shader.shader_module == VK_NULL_HANDLE)
+        {
+            continue;
+        }
+
+        const VkPipelineShaderStageCreateInfo create_info
+        {
+            .sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
+            .stage = VK_SHADER_STAGE_COMPUTE_BIT,
+            .module = shader.shader_module,
+            .pName = "main"
+        };
+
+        log("Compute shader stage \"" + file_name + "\" created successfully!");
+        return create_info;
+    }
+
+    fatal_error_log("Compute shader stage creation failed! No compute shader module was loaded from \"" + file_name + "\"!");
+    return {};
+}
@@ -1,6 +1,7 @@
 #include "shader.modules.hpp"
 
 #include <vector>
+#include <string>
 #include <vulkan/vulkan.h>
 
 #ifndef VULKAN_SHADER_STAGES_HPP
@@ -11,4 +12,10 @@ std::vector<VkPipelineShaderStageCreateInfo> create_vulkan_shader_stages
     const std::vector<ShaderInfo> &shaders_modules
 );
 
+VkPipelineShaderStageCreateInfo create_vulkan_compute_shader_stage
+(
+    const std::vector<ShaderInfo> &shaders_modules,
+    const std::string &file_name
+);
+
 #endif
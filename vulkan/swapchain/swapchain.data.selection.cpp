@@ -33,25 +33,52 @@ VkSurfaceFormatKHR select_best_vulkan_swapchain_surface_format
     return available_formats[0]; // We return the first format available if we didn't find any format meeting our requirements.
 }
 
-// Select the best swap chain present mode available, according to our requirements.
+// Select the swap chain present mode of the v-sync mode configured, or the closest one available.
+// V-sync modes: 0 = v-sync (FIFO), 1 = relaxed v-sync (FIFO relaxed), 2 = mailbox, 3 = immediate.
 VkPresentModeKHR select_best_vulkan_swapchain_present_mode
 (
-    const std::vector<VkPresentModeKHR> &available_present_modes
+    const std::vector<VkPresentModeKHR> &available_present_modes,
+    const int &vsync_mode
 )
 {
     log("Selecting the best swap chain present mode..");
 
-    for (const VkPresentModeKHR present_mode : available_present_modes)
+    // Modes to try in order, the mailbox and immediate modes falling back on each other as both don't wait for the screen.
+    std::vector<VkPresentModeKHR> preferred_modes;
+
+    switch (vsync_mode)
+    {
+        case 1:
+            preferred_modes = { VK_PRESENT_MODE_FIFO_RELAXED_KHR };
+            break;
+
+        case 2:
+            preferred_modes = { VK_PRESENT_MODE_MAILBOX_KHR, VK_PRESENT_MODE_IMMEDIATE_KHR };
+            break;
+
+        case 3:
+            preferred_modes = { VK_PRESENT_MODE_IMMEDIATE_KHR, VK_PRESENT_MODE_MAILBOX_KHR };
+            break;
+
+        default:
+            break;
+    }
+
+    for (const VkPresentModeKHR preferred_mode : preferred_modes)
     {
-        // Try to find a mode with the "VK_PRESENT_MODE_MAILBOX_KHR" or "VK_PRESENT_MODE_IMMEDIATE_KHR" flag.
-        if (present_mode == VK_PRESENT_MODE_MAILBOX_KHR || present_mode == VK_PRESENT_MODE_IMMEDIATE_KHR)
+        if (std::find(available_present_modes.begin(), available_present_modes.end(), preferred_mode) != available_present_modes.end())
         {
-            log("Best swap chain present mode selected successfully!");
-            return present_mode;
+            log("Swap chain present mode " + std::to_string(preferred_mode) + " selected successfully!");
+            return preferred_mode;
         }
     }
 
-    log("Warning: We had to select the \"VK_PRESENT_MODE_FIFO_KHR\" present mode because not any better mode was found! That means the vsync is forced to be turned on!");
+    if (!preferred_modes.empty())
+    {
+        log("Warning: We had to select the \"VK_PRESENT_MODE_FIFO_KHR\" present mode because the v-sync mode configured (" + std::to_string(vsync_mode) + ") isn't supported! That means the vsync is forced to be turned on!");
+    }
+    else log("Swap chain present mode with v-sync selected successfully!");
+
     return VK_PRESENT_MODE_FIFO_KHR; // Return this flag (which always exists), if we didn't find any usable mode with our requirements.
 }
 
@@ -12,7 +12,8 @@ VkSurfaceFormatKHR select_best_vulkan_swapchain_surface_format
 
 VkPresentModeKHR select_best_vulkan_swapchain_present_mode
 (
-    const std::vector<VkPresentModeKHR> &available_present_modes
+    const std::vector<VkPresentModeKHR> &available_present_modes,
+    const int &vsync_mode
 );
 
 VkExtent2D select_vulkan_swapchain_extent_resolution
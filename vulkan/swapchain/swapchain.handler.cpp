@@ -1,5 +1,6 @@
 #include "swapchain.handler.hpp"
 
+#include "../render/sync/render.sync.deletion.hpp"
 #include "../../logs/logs.handler.hpp"
 #include "../../utils/tool.text.format.hpp"
 
@@ -12,6 +13,7 @@
 ///////////////////////////////////////////////////
 
 // Create a swap chain.
+// The old swap chain is retired, but it must still be destroyed once its presented images are done with.
 VkSwapchainKHR create_vulkan_swapchain
 (
     const VkDevice &logical_device,
@@ -22,7 +24,8 @@ VkSwapchainKHR create_vulkan_swapchain
     const VkExtent2D &extent,
     const uint32_t &graphics_family_index,
     const uint32_t &present_family_index,
-    const uint32_t &images_count
+    const uint32_t &images_count,
+    const VkSwapchainKHR &old_swapchain
 )
 {
     log("Creating a swap chain..");
@@ -71,7 +74,8 @@ VkSwapchainKHR create_vulkan_swapchain
         .preTransform = swapchain_capabilities.currentTransform,
         .compositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR, // Ignore the alpha channel.
         .presentMode = present_mode,                         // Pass the present mode.
-        .clipped = VK_TRUE                                   // Disallow the render of any pixel out of bounds.
+        .clipped = VK_TRUE,                                  // Disallow the render of any pixel out of bounds.
+        .oldSwapchain = old_swapchain                        // Swap chain being replaced, if any, so its resources can be reused.
     };
 
     // Set up the sharing mode depending on the queue family indexes.
@@ -147,16 +151,20 @@ Vulkan_Swapchain::Vulkan_Swapchain
     const VkExtent2D &extent,
     const uint32_t &graphics_family_index,
     const uint32_t &present_family_index,
-    const uint32_t &images_count
+    const uint32_t &images_count,
+    const VkSwapchainKHR &old_swapchain
 ) : logical_device(logical_device)
 {
-    swapchain = create_vulkan_swapchain(logical_device, swapchain_capabilities, present_mode, vulkan_surface, surface_format, extent, graphics_family_index, present_family_index, images_count);
+    swapchain = create_vulkan_swapchain(logical_device, swapchain_capabilities, present_mode, vulkan_surface, surface_format, extent, graphics_family_index, present_family_index, images_count, old_swapchain);
 }
 
 // Destructor.
 Vulkan_Swapchain::~Vulkan_Swapchain()
 {
-    destroy_vulkan_swapchain(logical_device, swapchain);
+    retire_vulkan_resource([logical_device = logical_device, swapchain = swapchain]() mutable
+    {
+        destroy_vulkan_swapchain(logical_device, swapchain);
+    });
 }
 
 VkSwapchainKHR Vulkan_Swapchain::get() const
@@ -18,7 +18,8 @@ VkSwapchainKHR create_vulkan_swapchain
     const VkExtent2D &extent,
     const uint32_t &graphics_family_index,
     const uint32_t &present_family_index,
-    const uint32_t &images_count
+    const uint32_t &images_count,
+    const VkSwapchainKHR &old_swapchain
 );
 
 void destroy_vulkan_swapchain
@@ -46,7 +47,8 @@ public:
         const VkExtent2D &extent,
         const uint32_t &graphics_family_index,
         const uint32_t &present_family_index,
-        const uint32_t &images_count
+        const uint32_t &images_count,
+        const VkSwapchainKHR &old_swapchain
     );
 
     // Destructor.
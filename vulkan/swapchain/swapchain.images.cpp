@@ -1,6 +1,7 @@
 #include "swapchain.images.hpp"
 
 #include "../images/image.views.handler.hpp"
+#include "../render/sync/render.sync.deletion.hpp"
 #include "../../logs/logs.handler.hpp"
 #include "../../utils/tool.text.format.hpp"
 
@@ -163,7 +164,10 @@ Vulkan_SwapchainImageViews::Vulkan_SwapchainImageViews
 // Destructor.
 Vulkan_SwapchainImageViews::~Vulkan_SwapchainImageViews()
 {
-    destroy_vulkan_swapchain_image_views(logical_device, swapchain_image_views);
+    retire_vulkan_resource([logical_device = logical_device, swapchain_image_views = swapchain_image_views]() mutable
+    {
+        destroy_vulkan_swapchain_image_views(logical_device, swapchain_image_views);
+    });
 }
 
 std::vector<VkImageView> Vulkan_SwapchainImageViews::get() const
@@ -0,0 +1,128 @@
+#include "swapchain.offscreen.hpp"
+
+#include "../images/images.handler.hpp"
+#include "../render/sync/render.sync.deletion.hpp"
+#include "../../logs/logs.handler.hpp"
+#include "../../utils/tool.text.format.hpp"
+
+#include <vulkan/vulkan.h>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+// Create the images rendered in headless mode, they replace the swap chain images when there is no window to present to.
+// The render pass resolves into them, then they can be copied to a buffer to read the frame back.
+OffscreenImages create_vulkan_offscreen_images
+(
+    const VkPhysicalDevice &physical_device,
+    const VkDevice &logical_device,
+    const VkExtent2D &extent,
+    const VkFormat &format,
+    const uint32_t &images_count
+)
+{
+    log("Creating " + std::to_string(images_count) + " offscreen images..");
+
+    if (physical_device == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Offscreen images creation failed! The physical device provided (" + force_string(physical_device) + ") is not valid!");
+    }
+
+    if (logical_device == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Offscreen images creation failed! The logical device provided (" + force_string(logical_device) + ") is not valid!");
+    }
+
+    if (images_count < 1)
+    {
+        fatal_error_log("Offscreen images creation failed! No images were requested!");
+    }
+
+    OffscreenImages offscreen_images;
+    offscreen_images.images.reserve(images_count);
+    offscreen_images.memories.reserve(images_count);
+
+    for (uint32_t i = 0; i < images_count; i++)
+    {
+        const std::pair<VkImage, VkDeviceMemory> image_data = create_image(physical_device, logical_device, extent.width, extent.height, 1, VK_SAMPLE_COUNT_1_BIT, format, VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT);
+
+        offscreen_images.images.emplace_back(image_data.first);
+        offscreen_images.memories.emplace_back(image_data.second);
+    }
+
+    log(std::to_string(images_count) + " offscreen images created successfully!");
+    return offscreen_images;
+}
+
+// Destroy the offscreen images.
+void destroy_vulkan_offscreen_images
+(
+    const VkDevice &logical_device,
+    OffscreenImages &offscreen_images
+)
+{
+    log("Destroying " + std::to_string(offscreen_images.images.size()) + " offscreen images..");
+
+    if (logical_device == VK_NULL_HANDLE)
+    {
+        error_log("Offscreen images destruction failed! The logical device provided (" + force_string(logical_device) + ") is not valid!");
+        return;
+    }
+
+    for (VkImage &image : offscreen_images.images)
+    {
+        if (image == VK_NULL_HANDLE)
+        {
+            error_log("Warning: Offscreen image destruction failed! The image provided (" + force_string(image) + ") is not valid!");
+        }
+        else vkDestroyImage(logical_device, image, VK_NULL_HANDLE);
+    }
+
+    for (VkDeviceMemory &memory : offscreen_images.memories)
+    {
+        if (memory == VK_NULL_HANDLE)
+        {
+            error_log("Warning: Offscreen image memory destruction failed! The image memory provided (" + force_string(memory) + ") is not valid!");
+        }
+        else vkFreeMemory(logical_device, memory, VK_NULL_HANDLE);
+    }
+
+    offscreen_images = {};
+
+    log("Offscreen images destroyed successfully!");
+}
+
+///////////////////////////////////////////////
+//////////////////// Class ////////////////////
+///////////////////////////////////////////////
+
+// Constructor.
+Vulkan_OffscreenImages::Vulkan_OffscreenImages
+(
+    const VkPhysicalDevice &physical_device,
+    const VkDevice &logical_device,
+    const VkExtent2D &extent,
+    const VkFormat &format,
+    const uint32_t &images_count
+) : logical_device(logical_device)
+{
+    offscreen_images = create_vulkan_offscreen_images(physical_device, logical_device, extent, format, images_count);
+}
+
+// Destructor.
+Vulkan_OffscreenImages::~Vulkan_OffscreenImages()
+{
+    retire_vulkan_resource([logical_device = logical_device, offscreen_images = offscreen_images]() mutable
+    {
+        destroy_vulkan_offscreen_images(logical_device, offscreen_images);
+    });
+}
+
+OffscreenImages Vulkan_OffscreenImages::get() const
+{
+    return offscreen_images;
+}
@@ -0,0 +1,72 @@
+#include <vulkan/vulkan.h>
+#include <cstdint>
+#include <vector>
+
+#ifndef VULKAN_SWAPCHAIN_OFFSCREEN_HPP
+#define VULKAN_SWAPCHAIN_OFFSCREEN_HPP
+
+////////////////////////////////////////////////////
+//////////////////// Structures ////////////////////
+////////////////////////////////////////////////////
+
+// Images rendered in place of the swap chain ones in headless mode, one per frame in flight.
+struct OffscreenImages
+{
+    std::vector<VkImage> images;
+    std::vector<VkDeviceMemory> memories;
+};
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+OffscreenImages create_vulkan_offscreen_images
+(
+    const VkPhysicalDevice &physical_device,
+    const VkDevice &logical_device,
+    const VkExtent2D &extent,
+    const VkFormat &format,
+    const uint32_t &images_count
+);
+
+void destroy_vulkan_offscreen_images
+(
+    const VkDevice &logical_device,
+    OffscreenImages &offscreen_images
+);
+
+///////////////////////////////////////////////
+//////////////////// Class ////////////////////
+///////////////////////////////////////////////
+
+class Vulkan_OffscreenImages
+{
+
+public:
+    // Constructor.
+    Vulkan_OffscreenImages
+    (
+        const VkPhysicalDevice &physical_device,
+        const VkDevice &logical_device,
+        const VkExtent2D &extent,
+        const VkFormat &format,
+        const uint32_t &images_count
+    );
+
+    // Destructor.
+    ~Vulkan_OffscreenImages();
+
+    OffscreenImages get() const;
+
+    // Prevent data duplication.
+    Vulkan_OffscreenImages(const Vulkan_OffscreenImages&) = delete;
+    Vulkan_OffscreenImages &operator = (const Vulkan_OffscreenImages&) = delete;
+
+private:
+    // We declare the members of the class to store.
+    OffscreenImages offscreen_images;
+    VkDevice logical_device = VK_NULL_HANDLE;
+
+};
+
+#endif
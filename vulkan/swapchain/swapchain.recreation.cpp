@@ -8,6 +8,7 @@
 #include "../depth/depth.resources.hpp"
 #include "../render/render.framebuffers.hpp"
 #include "../render/sync/render.sync.semaphores.hpp"
+#include "../render/sync/render.sync.present.hpp"
 #include "../../logs/logs.handler.hpp"
 #include "../../utils/tool.text.format.hpp"
 
@@ -15,9 +16,14 @@
 #include <cstdint>
 #include <SDL3/SDL.h>
 #include <SDL3/SDL_vulkan.h>
+#include <memory>
 #include <string>
+#include <utility>
 
-// Recreate a swap chain.
+// Recreate a swap chain without waiting for the device to idle.
+// The old objects are retired by their destructors, the frames in flight may still use them.
+// The old swap chain and semaphores are also used by the presents already queued, so they are only released once those presents are done.
+// Without render pass, the frames are drawn with the dynamic rendering and no framebuffers are recreated.
 // Note: If the user requested to close the app, we return an "exit" message.
 std::string recreate_vulkan_swapchain
 (
@@ -28,18 +34,19 @@ std::string recreate_vulkan_swapchain
     const VkPresentModeKHR &present_mode,
     const uint32_t &graphics_family_index,
     const uint32_t &present_family_index,
+    const VkQueue &present_queue,
     const VkRenderPass &render_pass,
-    const VkCommandPool &command_pool,
-    const VkQueue &graphics_queue,
     const VkSampleCountFlagBits &samples_count,
+    const uint32_t &frames_in_flight,
     SDL_Window* window,
-    Vulkan_Swapchain &swapchain,
-    Vulkan_SwapchainImageViews &image_views,
-    Vulkan_Framebuffers &framebuffers,
-    Vulkan_DepthResources &depth_resources,
-    Vulkan_ColorResources &color_resources,
+    std::unique_ptr<Vulkan_Swapchain> &swapchain,
+    std::vector<VkImage> &images,
+    std::unique_ptr<Vulkan_SwapchainImageViews> &image_views,
+    std::unique_ptr<Vulkan_Framebuffers> &framebuffers,
+    std::unique_ptr<Vulkan_DepthResources> &depth_resources,
+    std::unique_ptr<Vulkan_ColorResources> &color_resources,
     VkExtent2D &extent,
-    Vulkan_Semaphores &semaphores,
+    std::unique_ptr<Vulkan_Semaphores> &semaphores,
     std::vector<VkSemaphore> &image_available_semaphores,
     std::vector<VkSemaphore> &render_finished_semaphores
 )
@@ -71,19 +78,9 @@ std::string recreate_vulkan_swapchain
         fatal_error_log("Swap chain recreation failed! The present family index provided (" + std::to_string(present_family_index) + ") is not valid!");
     }
 
-    if (render_pass == VK_NULL_HANDLE)
+    if (present_queue == VK_NULL_HANDLE)
     {
-        fatal_error_log("Swap chain recreation failed! The render pass provided (" + force_string(render_pass) + ") is not valid!");
-    }
-
-    if (command_pool == VK_NULL_HANDLE)
-    {
-        fatal_error_log("Swap chain recreation failed! The command pool provided (" + force_string(command_pool) + ") is not valid!");
-    }
-
-    if (graphics_queue == VK_NULL_HANDLE)
-    {
-        fatal_error_log("Swap chain recreation failed! The graphics queue provided (" + force_string(graphics_queue) + ") is not valid!");
+        fatal_error_log("Swap chain recreation failed! The present queue provided (" + force_string(present_queue) + ") is not valid!");
     }
 
     if (!window)
@@ -111,18 +108,6 @@ std::string recreate_vulkan_swapchain
         }
     }
 
-    vkDeviceWaitIdle(logical_device);
-
-    // Destroy all old objects.
-    framebuffers.~Vulkan_Framebuffers();
-    image_views.~Vulkan_SwapchainImageViews();
-    swapchain.~Vulkan_Swapchain();
-    semaphores.~Vulkan_Semaphores();
-    depth_resources.~Vulkan_DepthResources();
-
-    image_available_semaphores.clear();
-    render_finished_semaphores.clear();
-
     // Redo the swap chain creation's verification process.
     const VkSurfaceCapabilitiesKHR swapchain_capabilities = get_vulkan_swapchain_capabilities(physical_device, vulkan_surface);
     extent = select_vulkan_swapchain_extent_resolution(swapchain_capabilities, window);
@@ -135,8 +120,8 @@ std::string recreate_vulkan_swapchain
         error_log("Fixed the images count which was higher than the swapchain capabilities: " + std::to_string(images_count) + " > " + std::to_string(swapchain_capabilities.maxImageCount) + ".");
     }
 
-    // Create a new swap chain.
-    new (&swapchain) Vulkan_Swapchain
+    // Create the new swap chain from the old one, which keeps presenting its last images meanwhile.
+    std::unique_ptr<Vulkan_Swapchain> new_swapchain = std::make_unique<Vulkan_Swapchain>
     (
         logical_device,
         swapchain_capabilities,
@@ -146,25 +131,50 @@ std::string recreate_vulkan_swapchain
         extent,
         graphics_family_index,
         present_family_index,
-        images_count
+        images_count,
+        swapchain->get()
     );
 
+    // Release the old objects, the ones using the others first.
+    framebuffers.reset();
+    image_views.reset();
+    depth_resources.reset();
+    color_resources.reset();
+
+    std::shared_ptr<Vulkan_Swapchain> old_swapchain = std::move(swapchain);
+    std::shared_ptr<Vulkan_Semaphores> old_semaphores = std::move(semaphores);
+
+    retire_vulkan_present_resources(logical_device, present_queue, [old_swapchain, old_semaphores]() mutable
+    {
+        old_semaphores.reset();
+        old_swapchain.reset();
+    });
+
+    image_available_semaphores.clear();
+    render_finished_semaphores.clear();
+
     // Create again the new rendering objects.
-    const std::vector<VkImage> new_images = get_vulkan_swapchain_images(logical_device, swapchain.get());
-    new (&image_views) Vulkan_SwapchainImageViews(logical_device, new_images, surface_format.format);
-    new (&depth_resources) Vulkan_DepthResources(physical_device, logical_device, command_pool, graphics_queue, extent, samples_count);
-    new (&semaphores) Vulkan_Semaphores(logical_device, images_count * 2);
-    new (&color_resources) Vulkan_ColorResources(physical_device, logical_device, extent, surface_format.format, samples_count);
-    new (&framebuffers) Vulkan_Framebuffers(logical_device, image_views.get(), color_resources.get().color_image_view, depth_resources.get().image_view, extent, render_pass);
+    swapchain = std::move(new_swapchain);
+    images = get_vulkan_swapchain_images(logical_device, swapchain->get());
+    image_views = std::make_unique<Vulkan_SwapchainImageViews>(logical_device, images, surface_format.format);
+    depth_resources = std::make_unique<Vulkan_DepthResources>(physical_device, logical_device, extent, samples_count);
+    semaphores = std::make_unique<Vulkan_Semaphores>(logical_device, images_count + frames_in_flight);
+
+    // The dynamic rendering draws into a transient image of the render graph instead of the color resources.
+    if (render_pass != VK_NULL_HANDLE)
+    {
+        color_resources = std::make_unique<Vulkan_ColorResources>(physical_device, logical_device, extent, surface_format.format, samples_count);
+        framebuffers = std::make_unique<Vulkan_Framebuffers>(logical_device, image_views->get(), color_resources->get().color_image_view, depth_resources->get().image_view, extent, render_pass);
+    }
 
     int i = 0;
 
-    for (const VkSemaphore &semaphore : semaphores.get())
+    for (const VkSemaphore &semaphore : semaphores->get())
     {
         i++;
 
-        // If we passed the middle of the original list, we add the next semaphores in the image available list.
-        if (semaphores.get().size() / 2 < i)
+        // Once the swap chain images have their render finished semaphore, we add the next semaphores in the image available list.
+        if (images_count < i)
         {
             image_available_semaphores.emplace_back(semaphore);
             continue;
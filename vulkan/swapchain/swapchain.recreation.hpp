@@ -8,6 +8,7 @@
 #include <vulkan/vulkan.h>
 #include <cstdint>
 #include <SDL3/SDL.h>
+#include <memory>
 #include <vector>
 #include <string>
 
@@ -23,18 +24,19 @@ std::string recreate_vulkan_swapchain
     const VkPresentModeKHR &present_mode,
     const uint32_t &graphics_family_index,
     const uint32_t &present_family_index,
+    const VkQueue &present_queue,
     const VkRenderPass &render_pass,
-    const VkCommandPool &command_pool,
-    const VkQueue &graphics_queue,
     const VkSampleCountFlagBits &samples_count,
+    const uint32_t &frames_in_flight,
     SDL_Window* window,
-    Vulkan_Swapchain &swapchain,
-    Vulkan_SwapchainImageViews &image_views,
-    Vulkan_Framebuffers &framebuffers,
-    Vulkan_DepthResources &depth_resources,
-    Vulkan_ColorResources &color_resources,
+    std::unique_ptr<Vulkan_Swapchain> &swapchain,
+    std::vector<VkImage> &images,
+    std::unique_ptr<Vulkan_SwapchainImageViews> &image_views,
+    std::unique_ptr<Vulkan_Framebuffers> &framebuffers,
+    std::unique_ptr<Vulkan_DepthResources> &depth_resources,
+    std::unique_ptr<Vulkan_ColorResources> &color_resources,
     VkExtent2D &extent,
-    Vulkan_Semaphores &semaphores,
+    std::unique_ptr<Vulkan_Semaphores> &semaphores,
     std::vector<VkSemaphore> &image_available_semaphores,
     std::vector<VkSemaphore> &render_finished_semaphores
 );
@@ -2,6 +2,7 @@
 
 #include "texture.images.loader.hpp"
 #include "../buffers/buffers.handler.hpp"
+#include "../render/sync/render.sync.deletion.hpp"
 #include "../../logs/logs.handler.hpp"
 #include "../../utils/tool.text.format.hpp"
 
@@ -172,7 +173,10 @@ Vulkan_TextureImageBuffers::Vulkan_TextureImageBuffers
 // Destructor.
 Vulkan_TextureImageBuffers::~Vulkan_TextureImageBuffers()
 {
-    destroy_vulkan_texture_image_buffers(logical_device, texture_image_buffers);
+    retire_vulkan_resource([logical_device = logical_device, texture_image_buffers = texture_image_buffers]() mutable
+    {
+        destroy_vulkan_texture_image_buffers(logical_device, texture_image_buffers);
+    });
 }
 
 std::vector<Buffer> Vulkan_TextureImageBuffers::get() const
@@ -2,6 +2,7 @@
 
 #include "texture.images.handler.hpp"
 #include "../images/image.views.handler.hpp"
+#include "../render/sync/render.sync.deletion.hpp"
 #include "../../logs/logs.handler.hpp"
 #include "../../utils/tool.text.format.hpp"
 
@@ -114,7 +115,10 @@ Vulkan_TextureImageViews::Vulkan_TextureImageViews
 // Destructor.
 Vulkan_TextureImageViews::~Vulkan_TextureImageViews()
 {
-    destroy_vulkan_texture_image_views(logical_device, texture_image_views);
+    retire_vulkan_resource([logical_device = logical_device, texture_image_views = texture_image_views]() mutable
+    {
+        destroy_vulkan_texture_image_views(logical_device, texture_image_views);
+    });
 }
 
 std::vector<VkImageView> Vulkan_TextureImageViews::get() const
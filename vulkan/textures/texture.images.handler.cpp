@@ -6,6 +6,7 @@
 #include "../buffers/buffer.copy.hpp"
 #include "../images/image.transitions.hpp"
 #include "../images/images.handler.hpp"
+#include "../render/sync/render.sync.deletion.hpp"
 #include "../../logs/logs.handler.hpp"
 #include "../../utils/tool.text.format.hpp"
 
@@ -207,7 +208,10 @@ Vulkan_TextureImages::Vulkan_TextureImages
 // Destructor.
 Vulkan_TextureImages::~Vulkan_TextureImages()
 {
-    destroy_vulkan_texture_images(logical_device, texture_images);
+    retire_vulkan_resource([logical_device = logical_device, texture_images = texture_images]() mutable
+    {
+        destroy_vulkan_texture_images(logical_device, texture_images);
+    });
 }
 
 std::vector<TextureImage> Vulkan_TextureImages::get() const
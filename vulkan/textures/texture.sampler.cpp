@@ -1,5 +1,6 @@
 #include "texture.sampler.hpp"
 
+#include "../render/sync/render.sync.deletion.hpp"
 #include "../../logs/logs.handler.hpp"
 #include "../../utils/tool.text.format.hpp"
 
@@ -126,7 +127,10 @@ Vulkan_TextureSampler::Vulkan_TextureSampler
 // Destructor.
 Vulkan_TextureSampler::~Vulkan_TextureSampler()
 {
-    destroy_vulkan_texture_sampler(logical_device, texture_sampler);
+    retire_vulkan_resource([logical_device = logical_device, texture_sampler = texture_sampler]() mutable
+    {
+        destroy_vulkan_texture_sampler(logical_device, texture_sampler);
+    });
 }
 
 VkSampler Vulkan_TextureSampler::get() const
@@ -1,34 +1,56 @@
 #include "uniform.buffer.update.hpp"
 
 #include "uniform.buffers.hpp"
+#include "uniform.camera.hpp"
+#include "../../scene/scene.hierarchy.hpp"
+#include "../../config/engine.config.hpp"
+#include "../../logs/logs.handler.hpp"
 
 #include <vulkan/vulkan.h>
 #include <glm/glm.hpp>
-#include <glm/gtc/matrix_transform.hpp>
-#include <chrono>
 #include <cstring>
+#include <string>
 
 // Update the data of a uniform buffer.
 void update_uniform_buffer
 (
     const uint32_t &frame,
     const VkExtent2D extent,
+    const CameraData &camera,
     const void* buffer_data
 )
 {
-    const static auto start_time = std::chrono::high_resolution_clock::now();
+    UniformBufferObject object {};
+    object.view = get_camera_view_matrix(camera);
+    object.projection = get_camera_projection_matrix(camera, extent);
 
-    const auto current_time = std::chrono::high_resolution_clock::now();
-    const float time = std::chrono::duration<float, std::chrono::seconds::period>(current_time - start_time).count();
+    memcpy((void*) buffer_data, &object, sizeof(object));
+}
 
-    const glm::vec3 camera_position = glm::vec3(4.0f, 1.0f, 3.0f); // (x, y, z)
-    const glm::vec3 camera_angle = glm::vec3(0.0f, 0.0f, 0.0f);    // (x, y, z)
+// Write the world matrices changed since the last use of a frame transform buffer.
+// Note: The static nodes are written once per frame in flight, then never again.
+void update_transform_buffer
+(
+    const uint32_t &frame,
+    TransformHierarchy &hierarchy,
+    const void* buffer_data
+)
+{
+    glm::mat4* matrices = static_cast<glm::mat4*>(const_cast<void*>(buffer_data));
 
-    UniformBufferObject object {};
-    object.model = glm::rotate(glm::mat4(1.0f), time * glm::radians(90.0f), glm::vec3(0.0f, 0.0f, 1.0f));
-    object.view = glm::lookAt(camera_position, camera_angle, glm::vec3(0.0f, 0.0f, 1.0f));
-    object.projection = glm::perspective(glm::radians(45.0f), extent.width / (float) extent.height, 0.1f, 10.0f);
-    object.projection[1][1] *= -1.0f;
+    for (const uint32_t &node : hierarchy.get_frame_changes(frame))
+    {
+        if (node >= EngineConfig::MAX_SCENE_TRANSFORMS)
+        {
+            error_log("The node #" + std::to_string(node) + " doesn't fit in the transform buffer (" + std::to_string(EngineConfig::MAX_SCENE_TRANSFORMS) + " matrices)!");
+            continue;
+        }
 
-    memcpy((void*) buffer_data, &object, sizeof(object));
+        if (hierarchy.is_node_alive(node))
+        {
+            memcpy(&matrices[node], &hierarchy.get_world_transform(node), sizeof(glm::mat4));
+        }
+    }
+
+    hierarchy.clear_frame_changes(frame);
 }
@@ -1,3 +1,6 @@
+#include "uniform.camera.hpp"
+#include "../../scene/scene.hierarchy.hpp"
+
 #include <vulkan/vulkan.h>
 #include <cstdint>
 
@@ -8,6 +11,14 @@ void update_uniform_buffer
 (
     const uint32_t &frame,
     const VkExtent2D extent,
+    const CameraData &camera,
+    const void* buffer_data
+);
+
+void update_transform_buffer
+(
+    const uint32_t &frame,
+    TransformHierarchy &hierarchy,
     const void* buffer_data
 );
 
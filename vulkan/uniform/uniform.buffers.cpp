@@ -1,6 +1,7 @@
 #include "uniform.buffers.hpp"
 
 #include "../buffers/buffers.handler.hpp"
+#include "../render/sync/render.sync.deletion.hpp"
 #include "../../logs/logs.handler.hpp"
 #include "../../utils/tool.text.format.hpp"
 
@@ -14,7 +15,7 @@
 //////////////////// Functions ////////////////////
 ///////////////////////////////////////////////////
 
-// Create a uniform buffer for each swap chain image.
+// Create a uniform buffer for each frame in flight.
 std::vector<UniformBufferInfo> create_vulkan_uniform_buffers
 (
     const VkDevice &logical_device,
@@ -169,7 +170,10 @@ Vulkan_UniformBuffers::Vulkan_UniformBuffers
 // Destructor.
 Vulkan_UniformBuffers::~Vulkan_UniformBuffers()
 {
-    destroy_vulkan_uniform_buffers(logical_device, uniform_buffers);
+    retire_vulkan_resource([logical_device = logical_device, uniform_buffers = uniform_buffers]() mutable
+    {
+        destroy_vulkan_uniform_buffers(logical_device, uniform_buffers);
+    });
 }
 
 std::vector<UniformBufferInfo> Vulkan_UniformBuffers::get() const
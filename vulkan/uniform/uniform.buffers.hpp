@@ -10,9 +10,10 @@
 //////////////////// Structures ////////////////////
 ////////////////////////////////////////////////////
 
+// Data shared by every object drawn during a frame.
+// Note: The world matrix of each object comes from the transform buffer.
 struct UniformBufferObject
 {
-    alignas(16) glm::mat4 model;
     alignas(16) glm::mat4 view;
     alignas(16) glm::mat4 projection;
 };
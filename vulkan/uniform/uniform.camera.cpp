@@ -0,0 +1,43 @@
+#include "uniform.camera.hpp"
+
+#include <vulkan/vulkan.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+// Return the camera used to render the scene.
+CameraData get_default_camera()
+{
+    const CameraData camera
+    {
+        .position = glm::vec3(4.0f, 1.0f, 3.0f),
+        .target = glm::vec3(0.0f, 0.0f, 0.0f),
+        .up = glm::vec3(0.0f, 0.0f, 1.0f),
+        .field_of_view = 45.0f,
+        .near_plane = 0.1f,
+        .far_plane = 10.0f
+    };
+
+    return camera;
+}
+
+// Return the view matrix of a camera.
+glm::mat4 get_camera_view_matrix
+(
+    const CameraData &camera
+)
+{
+    return glm::lookAt(camera.position, camera.target, camera.up);
+}
+
+// Return the projection matrix of a camera for the given render extent.
+glm::mat4 get_camera_projection_matrix
+(
+    const CameraData &camera,
+    const VkExtent2D &extent
+)
+{
+    glm::mat4 projection = glm::perspective(glm::radians(camera.field_of_view), extent.width / (float) extent.height, camera.near_plane, camera.far_plane);
+    projection[1][1] *= -1.0f; // Vulkan clip space has an inverted Y axis compared to OpenGL.
+
+    return projection;
+}
@@ -0,0 +1,38 @@
+#include <vulkan/vulkan.h>
+#include <glm/glm.hpp>
+
+#ifndef VULKAN_UNIFORM_CAMERA_HPP
+#define VULKAN_UNIFORM_CAMERA_HPP
+
+////////////////////////////////////////////////////
+//////////////////// Structures ////////////////////
+////////////////////////////////////////////////////
+
+struct CameraData
+{
+    glm::vec3 position;  // (x, y, z)
+    glm::vec3 target;    // Point the camera looks at.
+    glm::vec3 up;        // Up direction of the world.
+    float field_of_view; // Vertical field of view in degrees.
+    float near_plane;
+    float far_plane;
+};
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+CameraData get_default_camera();
+
+glm::mat4 get_camera_view_matrix
+(
+    const CameraData &camera
+);
+
+glm::mat4 get_camera_projection_matrix
+(
+    const CameraData &camera,
+    const VkExtent2D &extent
+);
+
+#endif
@@ -0,0 +1,66 @@
+#include "uniform.frustum.hpp"
+
+#include <glm/glm.hpp>
+
+// Extract the frustum planes from a view projection matrix (Gribb-Hartmann method).
+// The projection uses the Vulkan depth range (0 to 1), so the near plane is the third row alone.
+Frustum extract_frustum
+(
+    const glm::mat4 &view_projection
+)
+{
+    const glm::vec4 row_x(view_projection[0][0], view_projection[1][0], view_projection[2][0], view_projection[3][0]);
+    const glm::vec4 row_y(view_projection[0][1], view_projection[1][1], view_projection[2][1], view_projection[3][1]);
+    const glm::vec4 row_z(view_projection[0][2], view_projection[1][2], view_projection[2][2], view_projection[3][2]);
+    const glm::vec4 row_w(view_projection[0][3], view_projection[1][3], view_projection[2][3], view_projection[3][3]);
+
+    Frustum frustum {};
+    frustum.planes[0] = row_w + row_x; // Left.
+    frustum.planes[1] = row_w - row_x; // Right.
+    frustum.planes[2] = row_w + row_y; // Bottom.
+    frustum.planes[3] = row_w - row_y; // Top.
+    frustum.planes[4] = row_z;         // Near.
+    frustum.planes[5] = row_w - row_z; // Far.
+
+    // Normalize the planes so that the distances are in world units.
+    for (glm::vec4 &plane : frustum.planes)
+    {
+        plane /= glm::length(glm::vec3(plane));
+    }
+
+    return frustum;
+}
+
+// Check if a sphere is at least partially inside a frustum.
+bool is_sphere_in_frustum
+(
+    const Frustum &frustum,
+    const glm::vec3 &center,
+    const float &radius
+)
+{
+    for (const glm::vec4 &plane : frustum.planes)
+    {
+        if (glm::dot(glm::vec3(plane), center) + plane.w < -radius)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Check if every triangle inside a normal cone faces away from the camera.
+// The test is conservative for the whole bounding sphere, so it doesn't need the cone apex.
+bool is_cone_backfacing
+(
+    const glm::vec3 &camera_position,
+    const glm::vec3 &center,
+    const float &radius,
+    const glm::vec3 &cone_axis,
+    const float &cone_cutoff
+)
+{
+    const glm::vec3 direction = center - camera_position;
+    return glm::dot(direction, cone_axis) >= cone_cutoff * glm::length(direction) + radius;
+}
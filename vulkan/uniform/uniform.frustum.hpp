@@ -0,0 +1,41 @@
+#include <glm/glm.hpp>
+
+#ifndef VULKAN_UNIFORM_FRUSTUM_HPP
+#define VULKAN_UNIFORM_FRUSTUM_HPP
+
+////////////////////////////////////////////////////
+//////////////////// Structures ////////////////////
+////////////////////////////////////////////////////
+
+// Planes of the camera view volume, pointing inward (xyz = normal, w = distance).
+struct Frustum
+{
+    glm::vec4 planes[6]; // Left, right, bottom, top, near, far.
+};
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+Frustum extract_frustum
+(
+    const glm::mat4 &view_projection
+);
+
+bool is_sphere_in_frustum
+(
+    const Frustum &frustum,
+    const glm::vec3 &center,
+    const float &radius
+);
+
+bool is_cone_backfacing
+(
+    const glm::vec3 &camera_position,
+    const glm::vec3 &center,
+    const float &radius,
+    const glm::vec3 &cone_axis,
+    const float &cone_cutoff
+);
+
+#endif
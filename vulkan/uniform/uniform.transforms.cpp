@@ -0,0 +1,155 @@
+#include "uniform.transforms.hpp"
+
+#include "uniform.buffers.hpp"
+#include "../buffers/buffers.handler.hpp"
+#include "../render/sync/render.sync.deletion.hpp"
+#include "../../config/engine.config.hpp"
+#include "../../logs/logs.handler.hpp"
+#include "../../utils/tool.text.format.hpp"
+
+#include <vulkan/vulkan.h>
+#include <glm/glm.hpp>
+#include <vector>
+#include <cstdint>
+#include <string>
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+// Create a storage buffer of world matrices for each frame in flight.
+// The buffers stay mapped, so the changed matrices are written straight into them.
+std::vector<UniformBufferInfo> create_vulkan_transform_buffers
+(
+    const VkDevice &logical_device,
+    const VkPhysicalDevice &physical_device,
+    const uint32_t &images_count
+)
+{
+    log("Creating " + std::to_string(images_count) + " transform buffers..");
+
+    if (logical_device == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Transform buffers creation failed! The logical device provided (" + force_string(logical_device) + ") is not valid!");
+    }
+
+    if (physical_device == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Transform buffers creation failed! The physical device provided (" + force_string(physical_device) + ") is not valid!");
+    }
+
+    if (images_count < 1)
+    {
+        fatal_error_log("Transform buffers creation failed! The images count provided (" + std::to_string(images_count) + ") is not valid!");
+    }
+
+    std::vector<UniformBufferInfo> output;
+    output.reserve(images_count);
+    const VkDeviceSize buffer_size = sizeof(glm::mat4) * EngineConfig::MAX_SCENE_TRANSFORMS;
+
+    for (int i = 0; i < images_count; i++)
+    {
+        VkBuffer buffer = VK_NULL_HANDLE;
+        VkDeviceMemory buffer_memory = VK_NULL_HANDLE;
+        void* data;
+
+        create_vulkan_buffer(logical_device, physical_device, buffer_size, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, buffer, buffer_memory);
+        vkMapMemory(logical_device, buffer_memory, 0, buffer_size, 0, &data); // Map the buffer memory in the app address space.
+
+        const UniformBufferInfo info =
+        {
+            buffer,
+            buffer_memory,
+            data
+        };
+
+        output.emplace_back(info);
+        log("- Transform buffer #" + std::to_string(i + 1) + "/" + std::to_string(images_count) + " (" + force_string(buffer) + ") created successfully!");
+    }
+
+    log(std::to_string(output.size()) + " transform buffers created successfully!");
+    return output;
+}
+
+// Destroy some transform buffers.
+void destroy_vulkan_transform_buffers
+(
+    const VkDevice &logical_device,
+    std::vector<UniformBufferInfo> &transform_buffers
+)
+{
+    log("Destroying " + std::to_string(transform_buffers.size()) + " transform buffers..");
+
+    if (logical_device == VK_NULL_HANDLE)
+    {
+        error_log("Transform buffers destruction failed! The logical device provided (" + force_string(logical_device) + ") is not valid!");
+        return;
+    }
+
+    if (transform_buffers.size() < 1)
+    {
+        error_log("Transform buffers destruction failed! No transform buffers were provided!");
+        return;
+    }
+
+    int failed = 0;
+    int i = 0;
+
+    for (UniformBufferInfo &transform_buffer : transform_buffers)
+    {
+        i++;
+
+        if (transform_buffer.buffer == VK_NULL_HANDLE || transform_buffer.buffer_memory == VK_NULL_HANDLE)
+        {
+            error_log("- Failed to destroy the transform buffer #" + std::to_string(i) + "/" + std::to_string(transform_buffers.size()) + "! The buffer (" + force_string(transform_buffer.buffer) + ") or its memory (" + force_string(transform_buffer.buffer_memory) + ") is not valid!");
+            failed++;
+            continue;
+        }
+
+        vkDestroyBuffer(logical_device, transform_buffer.buffer, nullptr);
+        vkFreeMemory(logical_device, transform_buffer.buffer_memory, nullptr);
+
+        transform_buffer.buffer = VK_NULL_HANDLE;
+        transform_buffer.buffer_memory = VK_NULL_HANDLE;
+        transform_buffer.data = nullptr;
+
+        log("- Transform buffer #" + std::to_string(i) + "/" + std::to_string(transform_buffers.size()) + " destroyed successfully!");
+    }
+
+    if (failed > 0)
+    {
+        error_log("Warning: " + std::to_string(failed) + " transform buffers failed to destroy! This might lead to some memory leaks or memory overload.");
+    }
+
+    log(std::to_string(transform_buffers.size() - failed) + "/" + std::to_string(transform_buffers.size()) + " transform buffers destroyed successfully!");
+    transform_buffers.clear();
+}
+
+///////////////////////////////////////////////
+//////////////////// Class ////////////////////
+///////////////////////////////////////////////
+
+// Constructor.
+Vulkan_TransformBuffers::Vulkan_TransformBuffers
+(
+    const VkDevice &logical_device,
+    const VkPhysicalDevice &physical_device,
+    const uint32_t &images_count
+) : logical_device(logical_device)
+{
+    transform_buffers = create_vulkan_transform_buffers(logical_device, physical_device, images_count);
+}
+
+// Destructor.
+Vulkan_TransformBuffers::~Vulkan_TransformBuffers()
+{
+    retire_vulkan_resource([logical_device = logical_device, transform_buffers = transform_buffers]() mutable
+    {
+        destroy_vulkan_transform_buffers(logical_device, transform_buffers);
+    });
+}
+
+std::vector<UniformBufferInfo> Vulkan_TransformBuffers::get() const
+{
+    return transform_buffers;
+}
@@ -0,0 +1,59 @@
+#include "uniform.buffers.hpp"
+
+#include <vulkan/vulkan.h>
+#include <vector>
+#include <cstdint>
+
+#ifndef VULKAN_UNIFORM_TRANSFORMS_HPP
+#define VULKAN_UNIFORM_TRANSFORMS_HPP
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+std::vector<UniformBufferInfo> create_vulkan_transform_buffers
+(
+    const VkDevice &logical_device,
+    const VkPhysicalDevice &physical_device,
+    const uint32_t &images_count
+);
+
+void destroy_vulkan_transform_buffers
+(
+    const VkDevice &logical_device,
+    std::vector<UniformBufferInfo> &transform_buffers
+);
+
+///////////////////////////////////////////////
+//////////////////// Class ////////////////////
+///////////////////////////////////////////////
+
+class Vulkan_TransformBuffers
+{
+
+public:
+    // Constructor.
+    Vulkan_TransformBuffers
+    (
+        const VkDevice &logical_device,
+        const VkPhysicalDevice &physical_device,
+        const uint32_t &images_count
+    );
+
+    // Destructor.
+    ~Vulkan_TransformBuffers();
+
+    std::vector<UniformBufferInfo> get() const;
+
+    // Prevent data duplication.
+    Vulkan_TransformBuffers(const Vulkan_TransformBuffers&) = delete;
+    Vulkan_TransformBuffers &operator = (const Vulkan_TransformBuffers&) = delete;
+
+private:
+    // We declare the members of the class to store.
+    VkDevice logical_device = VK_NULL_HANDLE;
+    std::vector<UniformBufferInfo> transform_buffers;
+
+};
+
+#endif
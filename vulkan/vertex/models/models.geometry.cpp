@@ -0,0 +1,159 @@
+#include "models.geometry.hpp"
+
+#include "../vertex.handler.hpp"
+#include "../vertex.layout.hpp"
+#include "../../../logs/logs.handler.hpp"
+
+#include <vulkan/vulkan.h>
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Select the smallest index type able to address all the vertices of a mesh.
+VkIndexType select_mesh_index_type
+(
+    const size_t &vertices_count
+)
+{
+    // 0xFFFF is kept out of the 16 bits range as it is the primitive restart value.
+    if (vertices_count <= UINT16_MAX)
+    {
+        return VK_INDEX_TYPE_UINT16;
+    }
+
+    return VK_INDEX_TYPE_UINT32;
+}
+
+// Compute a bounding sphere of the vertices (centered on their bounding box).
+void compute_mesh_bounds
+(
+    const std::vector<Vertex> &vertices,
+    glm::vec3 &center,
+    float &radius
+)
+{
+    center = glm::vec3(0.0f);
+    radius = 0.0f;
+
+    if (vertices.size() < 1)
+    {
+        return;
+    }
+
+    glm::vec3 minimum = vertices[0].position;
+    glm::vec3 maximum = vertices[0].position;
+
+    for (const Vertex &vertex : vertices)
+    {
+        minimum = glm::min(minimum, vertex.position);
+        maximum = glm::max(maximum, vertex.position);
+    }
+
+    center = (minimum + maximum) * 0.5f;
+
+    for (const Vertex &vertex : vertices)
+    {
+        radius = std::max(radius, glm::length(vertex.position - center));
+    }
+}
+
+// Pack the meshes vertices and indices into the shared vertex and index buffers data.
+GeometryData build_geometry_data
+(
+    const std::vector<Mesh> &meshes,
+    const VertexLayout &vertex_layout
+)
+{
+    log("Building the geometry data of " + std::to_string(meshes.size()) + " meshes..");
+
+    GeometryData geometry {};
+    uint32_t vertex_offset = 0;
+
+    size_t i = 0;
+    size_t unpacked_size = 0;
+
+    for (const Mesh &mesh : meshes)
+    {
+        i++;
+
+        if (mesh.vertices.size() < 1 || mesh.indices.size() < 1)
+        {
+            error_log("- Mesh #" + std::to_string(i) + "/" + std::to_string(meshes.size()) + " (\"" + mesh.name + "\") is empty! Skipping it..");
+            continue;
+        }
+
+        const VkIndexType index_type = select_mesh_index_type(mesh.vertices.size());
+        const size_t index_size = index_type == VK_INDEX_TYPE_UINT16 ? sizeof(uint16_t) : sizeof(uint32_t);
+
+        MeshRange range
+        {
+            .vertex_offset = vertex_offset,
+            .index_type = index_type,
+            .bounds_center = glm::vec3(0.0f),
+            .bounds_radius = 0.0f,
+            .lods = {},
+            .clusters = mesh.clusters
+        };
+
+        compute_mesh_bounds(mesh.vertices, range.bounds_center, range.bounds_radius);
+
+        // Keep every mesh indices 4 bytes aligned so that both index types can follow each other.
+        // The levels of detail of a mesh follow its full resolution indices.
+        size_t index_offset = (geometry.index_data.size() + 3) & ~static_cast<size_t>(3);
+        size_t lod_indices_count = 0;
+
+        for (size_t level = 0; level <= mesh.lods.size(); level++)
+        {
+            const std::vector<uint32_t> &indices = level == 0 ? mesh.indices : mesh.lods[level - 1].indices;
+            geometry.index_data.resize(index_offset + index_size * indices.size(), 0);
+
+            uint8_t* index_data = geometry.index_data.data() + index_offset;
+
+            if (index_type == VK_INDEX_TYPE_UINT16)
+            {
+                for (size_t j = 0; j < indices.size(); j++)
+                {
+                    const uint16_t index = static_cast<uint16_t>(indices[j]);
+                    memcpy(index_data + j * sizeof(uint16_t), &index, sizeof(uint16_t));
+                }
+            }
+            else memcpy(index_data, indices.data(), indices.size() * sizeof(uint32_t));
+
+            const MeshLod lod
+            {
+                .first_index = static_cast<uint32_t>(index_offset / index_size),
+                .index_count = static_cast<uint32_t>(indices.size()),
+                .error = level == 0 ? 0.0f : mesh.lods[level - 1].error
+            };
+
+            range.lods.push_back(lod);
+            index_offset += index_size * indices.size();
+
+            if (level > 0)
+            {
+                lod_indices_count += indices.size();
+            }
+        }
+
+        for (MeshCluster &cluster : range.clusters)
+        {
+            cluster.first_index += range.lods[0].first_index;
+        }
+
+        pack_vertices(vertex_layout, mesh.vertices, geometry.vertex_data);
+
+        geometry.meshes.push_back(range);
+        vertex_offset += static_cast<uint32_t>(mesh.vertices.size());
+        unpacked_size += mesh.vertices.size() * sizeof(Vertex) + (mesh.indices.size() + lod_indices_count) * sizeof(uint32_t);
+
+        log("- Mesh #" + std::to_string(i) + "/" + std::to_string(meshes.size()) + " (\"" + mesh.name + "\"): " + std::to_string(mesh.vertices.size()) + " vertices, " + std::to_string(mesh.indices.size()) + (index_type == VK_INDEX_TYPE_UINT16 ? " 16" : " 32") + " bits indices, " + std::to_string(range.lods.size()) + " levels of detail.");
+    }
+
+    const size_t packed_size = geometry.vertex_data.size() + geometry.index_data.size();
+    log("Geometry data built successfully! " + std::to_string(packed_size) + " bytes uploaded instead of " + std::to_string(unpacked_size) + " bytes.");
+
+    return geometry;
+}
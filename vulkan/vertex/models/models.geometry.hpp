@@ -0,0 +1,74 @@
+#include "../vertex.handler.hpp"
+#include "../vertex.layout.hpp"
+
+#include <vulkan/vulkan.h>
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+#ifndef VULKAN_MODELS_GEOMETRY_HPP
+#define VULKAN_MODELS_GEOMETRY_HPP
+
+////////////////////////////////////////////////////
+//////////////////// Structures ////////////////////
+////////////////////////////////////////////////////
+
+// Location of one level of detail of a mesh inside the shared index buffer.
+struct MeshLod
+{
+    uint32_t first_index;  // First index of the level, counted in elements of the mesh index type.
+    uint32_t index_count;  // Amount of indices to draw.
+    float error;           // Geometric error of the level, in model units (0 at full resolution).
+};
+
+// Location of a mesh inside the shared vertex and index buffers.
+struct MeshRange
+{
+    uint32_t vertex_offset;     // First vertex of the mesh in the vertex buffer.
+    VkIndexType index_type;     // 16 bits indices when the mesh vertices allow it, 32 bits otherwise.
+    glm::vec3 bounds_center;    // Bounding sphere of the mesh, in model space.
+    float bounds_radius;
+    std::vector<MeshLod> lods;  // Levels of detail, the first one is the full resolution mesh.
+    std::vector<MeshCluster> clusters;  // Clusters of the full resolution mesh, indexed in the shared index buffer.
+};
+
+// Mesh to draw during a frame.
+struct RenderObject
+{
+    uint32_t mesh;       // Index of the mesh range.
+    int32_t texture;     // Index of the texture to apply.
+    uint32_t transform;  // Index of the world matrix in the transform buffers.
+    glm::mat4 model;     // Copy of the world matrix, for the culling and the levels of detail.
+};
+
+// Packed geometry ready to be uploaded to the GPU.
+struct GeometryData
+{
+    std::vector<uint8_t> vertex_data;
+    std::vector<uint8_t> index_data;
+    std::vector<MeshRange> meshes;
+};
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+VkIndexType select_mesh_index_type
+(
+    const size_t &vertices_count
+);
+
+void compute_mesh_bounds
+(
+    const std::vector<Vertex> &vertices,
+    glm::vec3 &center,
+    float &radius
+);
+
+GeometryData build_geometry_data
+(
+    const std::vector<Mesh> &meshes,
+    const VertexLayout &vertex_layout
+);
+
+#endif
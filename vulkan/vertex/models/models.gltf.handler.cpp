@@ -0,0 +1,778 @@
+#include "models.gltf.handler.hpp"
+
+#include "models.scene.hpp"
+#include "models.obj.handler.hpp"
+#include "../vertex.handler.hpp"
+#include "../../../utils/tool.json.hpp"
+#include "../../../utils/tool.mapped.file.hpp"
+#include "../../../crypto/base64.hpp"
+#include "../../../logs/logs.handler.hpp"
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <filesystem>
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Component types defined by the glTF 2.0 specification.
+constexpr const uint32_t GLTF_BYTE = 5120;
+constexpr const uint32_t GLTF_UNSIGNED_BYTE = 5121;
+constexpr const uint32_t GLTF_SHORT = 5122;
+constexpr const uint32_t GLTF_UNSIGNED_SHORT = 5123;
+constexpr const uint32_t GLTF_UNSIGNED_INT = 5125;
+constexpr const uint32_t GLTF_FLOAT = 5126;
+
+// Binary glTF (GLB) header and chunks identifiers.
+constexpr const uint32_t GLB_MAGIC = 0x46546C67;      // "glTF"
+constexpr const uint32_t GLB_JSON_CHUNK = 0x4E4F534A; // "JSON"
+constexpr const uint32_t GLB_BINARY_CHUNK = 0x004E4942; // "BIN\0"
+
+// Return an integer member of a glTF object, or the fallback value if it doesn't exist.
+// Note: -1 is returned when the member isn't a valid integer: negative, fractional, NaN, infinite or too large for 64 bits.
+int64_t get_gltf_integer
+(
+    const JsonValue &object,
+    const std::string &key,
+    const int64_t &fallback
+)
+{
+    if (find_json_member(object, key) == nullptr)
+    {
+        return fallback;
+    }
+
+    const double value = get_json_number(object, key, -1.0);
+
+    // 2^63 is the first double which doesn't fit in an int64_t, the NaN fails every comparison.
+    if (!(value >= 0.0) || value >= 9223372036854775808.0 || std::floor(value) != value)
+    {
+        return -1;
+    }
+
+    return static_cast<int64_t>(value);
+}
+
+// Locate the elements of an accessor inside the buffers.
+// Output: false with an error message if the accessor is unsupported or out of the buffers bounds.
+bool get_gltf_accessor
+(
+    const JsonValue &document,
+    const std::vector<GltfBuffer> &buffers,
+    const size_t &accessor_index,
+    GltfAccessor &accessor,
+    std::string &error
+)
+{
+    const JsonValue* accessors = find_json_member(document, "accessors");
+    const JsonValue* buffer_views = find_json_member(document, "bufferViews");
+
+    if (accessors == nullptr || accessor_index >= accessors->array.size())
+    {
+        error = "accessor #" + std::to_string(accessor_index) + " doesn't exist";
+        return false;
+    }
+
+    const JsonValue &accessor_data = accessors->array[accessor_index];
+
+    if (find_json_member(accessor_data, "sparse") != nullptr)
+    {
+        error = "sparse accessors are not supported";
+        return false;
+    }
+
+    const int64_t view_index = get_gltf_integer(accessor_data, "bufferView", -1);
+
+    if (buffer_views == nullptr || view_index < 0 || static_cast<size_t>(view_index) >= buffer_views->array.size())
+    {
+        error = "accessor #" + std::to_string(accessor_index) + " has no valid buffer view";
+        return false;
+    }
+
+    const std::string type = get_json_string(accessor_data, "type", "");
+
+    if (type == "SCALAR") accessor.components = 1;
+    else if (type == "VEC2") accessor.components = 2;
+    else if (type == "VEC3") accessor.components = 3;
+    else if (type == "VEC4") accessor.components = 4;
+    else if (type == "MAT4") accessor.components = 16;
+    else
+    {
+        error = "accessor #" + std::to_string(accessor_index) + " has an unsupported type (\"" + type + "\")";
+        return false;
+    }
+
+    accessor.component_type = static_cast<uint32_t>(get_gltf_integer(accessor_data, "componentType", 0));
+    size_t component_size = 0;
+
+    switch (accessor.component_type)
+    {
+        case GLTF_BYTE: case GLTF_UNSIGNED_BYTE: component_size = 1; break;
+        case GLTF_SHORT: case GLTF_UNSIGNED_SHORT: component_size = 2; break;
+        case GLTF_UNSIGNED_INT: case GLTF_FLOAT: component_size = 4; break;
+        default:
+            error = "accessor #" + std::to_string(accessor_index) + " has an unknown component type (" + std::to_string(accessor.component_type) + ")";
+            return false;
+    }
+
+    const JsonValue* normalized = find_json_member(accessor_data, "normalized");
+    accessor.normalized = normalized != nullptr && normalized->type == JsonType::Boolean && normalized->boolean;
+    const int64_t count = get_gltf_integer(accessor_data, "count", 0);
+
+    const JsonValue &buffer_view = buffer_views->array[view_index];
+    const int64_t buffer_index = get_gltf_integer(buffer_view, "buffer", -1);
+
+    if (buffer_index < 0 || static_cast<size_t>(buffer_index) >= buffers.size())
+    {
+        error = "buffer view #" + std::to_string(view_index) + " has no valid buffer";
+        return false;
+    }
+
+    const GltfBuffer &buffer = buffers[buffer_index];
+    const size_t element_size = component_size * accessor.components;
+    const int64_t view_offset = get_gltf_integer(buffer_view, "byteOffset", 0);
+    const int64_t view_length = get_gltf_integer(buffer_view, "byteLength", 0);
+    const int64_t accessor_offset = get_gltf_integer(accessor_data, "byteOffset", 0);
+    const int64_t stride = get_gltf_integer(buffer_view, "byteStride", static_cast<int64_t>(element_size));
+
+    if (count < 0 || view_offset < 0 || view_length < 0 || accessor_offset < 0 || stride < 0)
+    {
+        error = "accessor #" + std::to_string(accessor_index) + " or its buffer view has an invalid count, offset, length or stride";
+        return false;
+    }
+
+    accessor.count = static_cast<size_t>(count);
+    accessor.stride = static_cast<size_t>(stride);
+
+    // Every element must stay inside the buffer view, and the buffer view inside the buffer.
+    // The last element is checked by division, so a huge count or offset can't overflow the end of the accessor.
+    const size_t view_start = static_cast<size_t>(view_offset);
+    const size_t view_size = static_cast<size_t>(view_length);
+    const size_t accessor_start = static_cast<size_t>(accessor_offset);
+
+    const bool view_inside = view_start <= buffer.size && view_size <= buffer.size - view_start;
+    const bool first_element_inside = accessor_start <= view_size && element_size <= view_size - accessor_start;
+    const bool elements_inside = accessor.count < 1 || (first_element_inside && accessor.count - 1 <= (view_size - accessor_start - element_size) / std::max(accessor.stride, static_cast<size_t>(1)));
+
+    if (!view_inside || !elements_inside || accessor.stride < element_size)
+    {
+        error = "accessor #" + std::to_string(accessor_index) + " is out of its buffer bounds";
+        return false;
+    }
+
+    accessor.data = buffer.data + view_offset + accessor_offset;
+    return true;
+}
+
+// Read one component of an accessor element as a float, applying the normalization if needed.
+float read_gltf_component
+(
+    const GltfAccessor &accessor,
+    const size_t &element,
+    const uint32_t &component
+)
+{
+    const uint8_t* data = accessor.data + element * accessor.stride;
+
+    switch (accessor.component_type)
+    {
+        case GLTF_FLOAT:
+        {
+            float value;
+            memcpy(&value, data + component * sizeof(float), sizeof(float));
+            return value;
+        }
+        case GLTF_UNSIGNED_BYTE:
+        {
+            const uint8_t value = data[component];
+            return accessor.normalized ? value / 255.0f : static_cast<float>(value);
+        }
+        case GLTF_BYTE:
+        {
+            const int8_t value = static_cast<int8_t>(data[component]);
+            return accessor.normalized ? std::max(value / 127.0f, -1.0f) : static_cast<float>(value);
+        }
+        case GLTF_UNSIGNED_SHORT:
+        {
+            uint16_t value;
+            memcpy(&value, data + component * sizeof(uint16_t), sizeof(uint16_t));
+            return accessor.normalized ? value / 65535.0f : static_cast<float>(value);
+        }
+        case GLTF_SHORT:
+        {
+            int16_t value;
+            memcpy(&value, data + component * sizeof(int16_t), sizeof(int16_t));
+            return accessor.normalized ? std::max(value / 32767.0f, -1.0f) : static_cast<float>(value);
+        }
+        case GLTF_UNSIGNED_INT:
+        {
+            uint32_t value;
+            memcpy(&value, data + component * sizeof(uint32_t), sizeof(uint32_t));
+            return static_cast<float>(value);
+        }
+    }
+
+    return 0.0f;
+}
+
+// Read an element of an indices accessor.
+uint32_t read_gltf_index
+(
+    const GltfAccessor &accessor,
+    const size_t &element
+)
+{
+    const uint8_t* data = accessor.data + element * accessor.stride;
+
+    if (accessor.component_type == GLTF_UNSIGNED_BYTE)
+    {
+        return data[0];
+    }
+
+    if (accessor.component_type == GLTF_UNSIGNED_SHORT)
+    {
+        uint16_t value;
+        memcpy(&value, data, sizeof(uint16_t));
+        return value;
+    }
+
+    uint32_t value;
+    memcpy(&value, data, sizeof(uint32_t));
+    return value;
+}
+
+// Return the local transform of a node, given as a matrix or as translation, rotation and scale.
+glm::mat4 get_gltf_node_transform
+(
+    const JsonValue &node
+)
+{
+    const JsonValue* matrix = find_json_member(node, "matrix");
+
+    // The matrices are stored in column-major order, like GLM.
+    if (matrix != nullptr && matrix->array.size() == 16)
+    {
+        glm::mat4 transform(1.0f);
+
+        for (int column = 0; column < 4; column++)
+        {
+            for (int row = 0; row < 4; row++)
+            {
+                transform[column][row] = static_cast<float>(matrix->array[column * 4 + row].number);
+            }
+        }
+
+        return transform;
+    }
+
+    glm::vec3 translation(0.0f);
+    glm::quat rotation(1.0f, 0.0f, 0.0f, 0.0f);
+    glm::vec3 scale(1.0f);
+
+    const JsonValue* translation_data = find_json_member(node, "translation");
+    const JsonValue* rotation_data = find_json_member(node, "rotation");
+    const JsonValue* scale_data = find_json_member(node, "scale");
+
+    if (translation_data != nullptr && translation_data->array.size() == 3)
+    {
+        translation = glm::vec3(translation_data->array[0].number, translation_data->array[1].number, translation_data->array[2].number);
+    }
+
+    // The quaternions are stored as (x, y, z, w) while GLM takes (w, x, y, z).
+    if (rotation_data != nullptr && rotation_data->array.size() == 4)
+    {
+        rotation = glm::quat(rotation_data->array[3].number, rotation_data->array[0].number, rotation_data->array[1].number, rotation_data->array[2].number);
+    }
+
+    if (scale_data != nullptr && scale_data->array.size() == 3)
+    {
+        scale = glm::vec3(scale_data->array[0].number, scale_data->array[1].number, scale_data->array[2].number);
+    }
+
+    return glm::translate(glm::mat4(1.0f), translation) * glm::mat4_cast(rotation) * glm::scale(glm::mat4(1.0f), scale);
+}
+
+// Load the vertices and indices of a glTF primitive into a mesh.
+// The float attributes are copied straight from the mapped buffers, the other formats go through the normalization.
+bool load_gltf_primitive
+(
+    const JsonValue &document,
+    const std::vector<GltfBuffer> &buffers,
+    const JsonValue &primitive,
+    Mesh &mesh,
+    std::string &error
+)
+{
+    if (get_gltf_integer(primitive, "mode", 4) != 4)
+    {
+        error = "only triangle lists are supported";
+        return false;
+    }
+
+    const JsonValue* attributes = find_json_member(primitive, "attributes");
+    const int64_t position_index = attributes != nullptr ? get_gltf_integer(*attributes, "POSITION", -1) : -1;
+
+    if (position_index < 0)
+    {
+        error = "the primitive has no positions";
+        return false;
+    }
+
+    GltfAccessor positions {};
+
+    if (!get_gltf_accessor(document, buffers, position_index, positions, error))
+    {
+        return false;
+    }
+
+    if (positions.components != 3 || positions.count < 1)
+    {
+        error = "the positions must be 3 components vectors";
+        return false;
+    }
+
+    Vertex default_vertex {};
+    default_vertex.color = { 1.0f, 1.0f, 1.0f };
+    mesh.vertices.assign(positions.count, default_vertex);
+
+    for (size_t i = 0; i < positions.count; i++)
+    {
+        if (positions.component_type == GLTF_FLOAT)
+        {
+            memcpy(&mesh.vertices[i].position, positions.data + i * positions.stride, sizeof(glm::vec3));
+        }
+        else mesh.vertices[i].position = glm::vec3(read_gltf_component(positions, i, 0), read_gltf_component(positions, i, 1), read_gltf_component(positions, i, 2));
+    }
+
+    GltfAccessor normals {};
+    const int64_t normal_index = get_gltf_integer(*attributes, "NORMAL", -1);
+    const bool has_normals = normal_index >= 0 && get_gltf_accessor(document, buffers, normal_index, normals, error) && normals.components == 3 && normals.count == positions.count;
+
+    if (has_normals)
+    {
+        for (size_t i = 0; i < normals.count; i++)
+        {
+            if (normals.component_type == GLTF_FLOAT)
+            {
+                memcpy(&mesh.vertices[i].normal, normals.data + i * normals.stride, sizeof(glm::vec3));
+            }
+            else mesh.vertices[i].normal = glm::vec3(read_gltf_component(normals, i, 0), read_gltf_component(normals, i, 1), read_gltf_component(normals, i, 2));
+        }
+    }
+
+    GltfAccessor coordinates {};
+    const int64_t coordinates_index = get_gltf_integer(*attributes, "TEXCOORD_0", -1);
+
+    if (coordinates_index >= 0 && get_gltf_accessor(document, buffers, coordinates_index, coordinates, error) && coordinates.components == 2 && coordinates.count == positions.count)
+    {
+        for (size_t i = 0; i < coordinates.count; i++)
+        {
+            if (coordinates.component_type == GLTF_FLOAT)
+            {
+                memcpy(&mesh.vertices[i].texture_coordinates, coordinates.data + i * coordinates.stride, sizeof(glm::vec2));
+            }
+            else mesh.vertices[i].texture_coordinates = glm::vec2(read_gltf_component(coordinates, i, 0), read_gltf_component(coordinates, i, 1));
+        }
+    }
+
+    GltfAccessor colors {};
+    const int64_t color_index = get_gltf_integer(*attributes, "COLOR_0", -1);
+
+    if (color_index >= 0 && get_gltf_accessor(document, buffers, color_index, colors, error) && colors.components >= 3 && colors.count == positions.count)
+    {
+        for (size_t i = 0; i < colors.count; i++)
+        {
+            mesh.vertices[i].color = glm::vec3(read_gltf_component(colors, i, 0), read_gltf_component(colors, i, 1), read_gltf_component(colors, i, 2));
+        }
+    }
+
+    error.clear(); // The optional attributes errors are not fatal.
+    const int64_t indices_index = get_gltf_integer(primitive, "indices", -1);
+
+    if (indices_index >= 0)
+    {
+        GltfAccessor indices {};
+
+        if (!get_gltf_accessor(document, buffers, indices_index, indices, error))
+        {
+            return false;
+        }
+
+        if (indices.components != 1 || (indices.component_type != GLTF_UNSIGNED_BYTE && indices.component_type != GLTF_UNSIGNED_SHORT && indices.component_type != GLTF_UNSIGNED_INT))
+        {
+            error = "the indices must be unsigned integers";
+            return false;
+        }
+
+        mesh.indices.resize(indices.count);
+
+        // Tightly packed 32 bits indices match our format, they are copied in one go.
+        if (indices.component_type == GLTF_UNSIGNED_INT && indices.stride == sizeof(uint32_t))
+        {
+            memcpy(mesh.indices.data(), indices.data, indices.count * sizeof(uint32_t));
+        }
+        else
+        {
+            for (size_t i = 0; i < indices.count; i++)
+            {
+                mesh.indices[i] = read_gltf_index(indices, i);
+            }
+        }
+
+        const uint32_t max_index = mesh.indices.size() > 0 ? *std::max_element(mesh.indices.begin(), mesh.indices.end()) : 0;
+
+        if (max_index >= mesh.vertices.size())
+        {
+            error = "an index is out of the vertices bounds (" + std::to_string(max_index) + " >= " + std::to_string(mesh.vertices.size()) + ")";
+            return false;
+        }
+    }
+    else
+    {
+        // Non-indexed primitives draw their vertices in order.
+        mesh.indices.resize(mesh.vertices.size());
+
+        for (size_t i = 0; i < mesh.indices.size(); i++)
+        {
+            mesh.indices[i] = static_cast<uint32_t>(i);
+        }
+    }
+
+    if (mesh.indices.size() % 3 != 0)
+    {
+        error = "the indices count is not a multiple of 3";
+        return false;
+    }
+
+    mesh.material = static_cast<int32_t>(get_gltf_integer(primitive, "material", -1));
+
+    if (!has_normals)
+    {
+        generate_mesh_normals(mesh);
+    }
+
+    return true;
+}
+
+// Load the meshes, materials, textures and nodes of a glTF 2.0 model (.gltf or .glb).
+// The model file and its external buffers are memory-mapped, so only the JSON part is parsed and the
+// vertex data is read straight from the mapped pages.
+// Note: The loaded elements are appended to the meshes and the scene, their indices are offset accordingly.
+bool load_gltf_model
+(
+    const std::filesystem::path &file_path,
+    std::vector<Mesh> &meshes,
+    ModelScene &scene
+)
+{
+    const std::string file_name = file_path.filename().string();
+    const std::string file_extension = file_path.extension().string();
+
+    if (file_extension != ".gltf" && file_extension != ".glb")
+    {
+        error_log("- The loading of the glTF model \"" + file_name + "\" failed! The file extension is not valid!");
+        return false;
+    }
+
+    const MappedFile file(file_path.string());
+
+    if (!file.is_valid())
+    {
+        error_log("- The loading of the glTF model \"" + file_name + "\" failed! The file can't be mapped!");
+        return false;
+    }
+
+    const char* json_data = reinterpret_cast<const char*>(file.data());
+    size_t json_size = file.size();
+    GltfBuffer binary_chunk { nullptr, 0, "", 0 };
+
+    // GLB files: a 12 bytes header, a JSON chunk then an optional binary chunk.
+    if (file_extension == ".glb")
+    {
+        uint32_t header[5] {};
+
+        if (file.size() < sizeof(header))
+        {
+            error_log("- The loading of the glTF model \"" + file_name + "\" failed! The file is too small!");
+            return false;
+        }
+
+        memcpy(header, file.data(), sizeof(header));
+
+        if (header[0] != GLB_MAGIC || header[1] != 2 || header[2] > file.size() || header[2] < sizeof(header) || header[4] != GLB_JSON_CHUNK || header[3] > header[2] - sizeof(header))
+        {
+            error_log("- The loading of the glTF model \"" + file_name + "\" failed! The GLB header is not valid!");
+            return false;
+        }
+
+        json_data = reinterpret_cast<const char*>(file.data() + sizeof(header));
+        json_size = header[3];
+
+        const size_t binary_offset = sizeof(header) + ((json_size + 3) & ~static_cast<size_t>(3));
+
+        if (binary_offset + 8 <= header[2])
+        {
+            uint32_t chunk_header[2] {};
+            memcpy(chunk_header, file.data() + binary_offset, sizeof(chunk_header));
+
+            if (chunk_header[1] == GLB_BINARY_CHUNK && chunk_header[0] <= header[2] - binary_offset - 8)
+            {
+                binary_chunk = { file.data() + binary_offset + 8, chunk_header[0], file_path.string(), binary_offset + 8 };
+            }
+        }
+    }
+
+    JsonValue document;
+    std::string error;
+
+    if (!parse_json(json_data, json_size, document, error))
+    {
+        error_log("- The loading of the glTF model \"" + file_name + "\" failed! The JSON is not valid: " + error + "!");
+        return false;
+    }
+
+    const JsonValue* asset = find_json_member(document, "asset");
+
+    if (asset == nullptr || get_json_string(*asset, "version", "").rfind("2", 0) != 0)
+    {
+        error_log("- The loading of the glTF model \"" + file_name + "\" failed! Only glTF 2.0 files are supported!");
+        return false;
+    }
+
+    // Resolve the buffers: the GLB binary chunk, external files (mapped too) or base64 data URIs.
+    const std::filesystem::path directory = file_path.parent_path();
+    std::vector<GltfBuffer> buffers;
+    std::vector<std::unique_ptr<MappedFile>> external_files;
+    std::vector<std::unique_ptr<std::string>> decoded_buffers;
+
+    const JsonValue* buffers_data = find_json_member(document, "buffers");
+
+    for (size_t i = 0; buffers_data != nullptr && i < buffers_data->array.size(); i++)
+    {
+        const JsonValue &buffer_data = buffers_data->array[i];
+        const std::string uri = get_json_string(buffer_data, "uri", "");
+        const int64_t byte_length = get_gltf_integer(buffer_data, "byteLength", 0);
+
+        GltfBuffer buffer { nullptr, 0, "", 0 };
+
+        if (uri.size() < 1)
+        {
+            if (i == 0 && binary_chunk.data != nullptr)
+            {
+                buffer = binary_chunk;
+            }
+        }
+        else if (uri.rfind("data:", 0) == 0)
+        {
+            const size_t comma = uri.find(',');
+
+            if (comma != std::string::npos && uri.rfind(";base64", comma) != std::string::npos)
+            {
+                decoded_buffers.push_back(std::make_unique<std::string>(base64_decode(uri.substr(comma + 1))));
+                buffer = { reinterpret_cast<const uint8_t*>(decoded_buffers.back()->data()), decoded_buffers.back()->size(), "", 0 };
+            }
+        }
+        else
+        {
+            const std::string buffer_path = (directory / uri).string();
+            external_files.push_back(std::make_unique<MappedFile>(buffer_path));
+
+            if (external_files.back()->is_valid())
+            {
+                buffer = { external_files.back()->data(), external_files.back()->size(), buffer_path, 0 };
+            }
+        }
+
+        if (buffer.data == nullptr || byte_length < 0 || buffer.size < static_cast<size_t>(byte_length))
+        {
+            error_log("- The loading of the glTF model \"" + file_name + "\" failed! Buffer #" + std::to_string(i) + " is missing, truncated or has an invalid length!");
+            return false;
+        }
+
+        buffer.size = static_cast<size_t>(byte_length);
+        buffers.push_back(buffer);
+    }
+
+    const int32_t material_offset = static_cast<int32_t>(scene.materials.size());
+    const int32_t texture_offset = static_cast<int32_t>(scene.textures.size());
+    const int32_t node_offset = static_cast<int32_t>(scene.nodes.size());
+
+    // Textures, pointing to image files or to byte ranges of the model buffers.
+    const JsonValue* textures_data = find_json_member(document, "textures");
+    const JsonValue* images_data = find_json_member(document, "images");
+    const JsonValue* buffer_views = find_json_member(document, "bufferViews");
+
+    for (size_t i = 0; textures_data != nullptr && i < textures_data->array.size(); i++)
+    {
+        ModelTexture texture { get_json_string(textures_data->array[i], "name", ""), "", "", 0, 0, "" };
+        const int64_t image_index = get_gltf_integer(textures_data->array[i], "source", -1);
+
+        if (images_data != nullptr && image_index >= 0 && static_cast<size_t>(image_index) < images_data->array.size())
+        {
+            const JsonValue &image = images_data->array[image_index];
+            const std::string uri = get_json_string(image, "uri", "");
+            const int64_t view_index = get_gltf_integer(image, "bufferView", -1);
+
+            texture.mime_type = get_json_string(image, "mimeType", "");
+
+            if (uri.size() > 0 && uri.rfind("data:", 0) != 0)
+            {
+                texture.path = (directory / uri).string();
+            }
+            else if (buffer_views != nullptr && view_index >= 0 && static_cast<size_t>(view_index) < buffer_views->array.size())
+            {
+                const JsonValue &view = buffer_views->array[view_index];
+                const int64_t buffer_index = get_gltf_integer(view, "buffer", -1);
+
+                const int64_t view_offset = get_gltf_integer(view, "byteOffset", 0);
+                const int64_t view_length = get_gltf_integer(view, "byteLength", 0);
+                const bool valid_buffer = buffer_index >= 0 && static_cast<size_t>(buffer_index) < buffers.size();
+
+                // The image bytes must stay inside their buffer.
+                if (valid_buffer && view_offset >= 0 && view_length >= 0 && static_cast<size_t>(view_offset) <= buffers[buffer_index].size && static_cast<size_t>(view_length) <= buffers[buffer_index].size - static_cast<size_t>(view_offset))
+                {
+                    texture.source_file = buffers[buffer_index].source_file;
+                    texture.byte_offset = buffers[buffer_index].file_offset + static_cast<size_t>(view_offset);
+                    texture.byte_length = static_cast<size_t>(view_length);
+                }
+                else error_log("Warning: The image of texture #" + std::to_string(i) + " in \"" + file_name + "\" is out of its buffer bounds, it is ignored!");
+            }
+            else error_log("Warning: The image of texture #" + std::to_string(i) + " in \"" + file_name + "\" is embedded as a data URI, which is not supported!");
+        }
+
+        scene.textures.push_back(texture);
+    }
+
+    // Materials, with the glTF defaults for the missing values.
+    const JsonValue* materials_data = find_json_member(document, "materials");
+
+    // Return the scene index of a texture referenced by a material, or -1.
+    const auto get_texture = [&](const JsonValue* parent, const std::string &key)
+    {
+        const JsonValue* texture = parent != nullptr ? find_json_member(*parent, key) : nullptr;
+        const int64_t index = texture != nullptr ? get_gltf_integer(*texture, "index", -1) : -1;
+
+        return index >= 0 && textures_data != nullptr && static_cast<size_t>(index) < textures_data->array.size() ? static_cast<int32_t>(index) + texture_offset : -1;
+    };
+
+    for (size_t i = 0; materials_data != nullptr && i < materials_data->array.size(); i++)
+    {
+        const JsonValue &material_data = materials_data->array[i];
+        const JsonValue* pbr = find_json_member(material_data, "pbrMetallicRoughness");
+        const JsonValue* base_color = pbr != nullptr ? find_json_member(*pbr, "baseColorFactor") : nullptr;
+
+        const ModelMaterial material
+        {
+            .name = get_json_string(material_data, "name", ""),
+            .base_color_factor = base_color != nullptr && base_color->array.size() == 4 ? glm::vec4(base_color->array[0].number, base_color->array[1].number, base_color->array[2].number, base_color->array[3].number) : glm::vec4(1.0f),
+            .metallic_factor = pbr != nullptr ? static_cast<float>(get_json_number(*pbr, "metallicFactor", 1.0)) : 1.0f,
+            .roughness_factor = pbr != nullptr ? static_cast<float>(get_json_number(*pbr, "roughnessFactor", 1.0)) : 1.0f,
+            .base_color_texture = get_texture(pbr, "baseColorTexture"),
+            .metallic_roughness_texture = get_texture(pbr, "metallicRoughnessTexture"),
+            .normal_texture = get_texture(&material_data, "normalTexture")
+        };
+
+        scene.materials.push_back(material);
+    }
+
+    // Meshes: each primitive becomes an engine mesh.
+    const JsonValue* meshes_data = find_json_member(document, "meshes");
+    std::vector<std::vector<uint32_t>> loaded_meshes; // Engine meshes of each glTF mesh.
+    size_t primitives_count = 0;
+
+    for (size_t i = 0; meshes_data != nullptr && i < meshes_data->array.size(); i++)
+    {
+        const JsonValue* primitives = find_json_member(meshes_data->array[i], "primitives");
+        const std::string mesh_name = get_json_string(meshes_data->array[i], "name", "mesh #" + std::to_string(i));
+
+        loaded_meshes.emplace_back();
+
+        for (size_t j = 0; primitives != nullptr && j < primitives->array.size(); j++)
+        {
+            primitives_count++;
+
+            Mesh mesh {};
+            mesh.name = file_name + "/" + mesh_name + (primitives->array.size() > 1 ? "#" + std::to_string(j) : "");
+
+            if (!load_gltf_primitive(document, buffers, primitives->array[j], mesh, error))
+            {
+                error_log("Warning: The primitive \"" + mesh.name + "\" failed to load: " + error + "! Skipping it..");
+                continue;
+            }
+
+            if (mesh.material >= 0)
+            {
+                mesh.material = static_cast<size_t>(mesh.material) < scene.materials.size() - material_offset ? mesh.material + material_offset : -1;
+            }
+
+            loaded_meshes.back().push_back(static_cast<uint32_t>(meshes.size()));
+            meshes.push_back(std::move(mesh));
+        }
+    }
+
+    // Nodes, the parents are given by the children lists.
+    const JsonValue* nodes_data = find_json_member(document, "nodes");
+    const size_t nodes_count = nodes_data != nullptr ? nodes_data->array.size() : 0;
+
+    for (size_t i = 0; i < nodes_count; i++)
+    {
+        const JsonValue &node_data = nodes_data->array[i];
+        const int64_t mesh_index = get_gltf_integer(node_data, "mesh", -1);
+
+        ModelNode node
+        {
+            .name = get_json_string(node_data, "name", ""),
+            .parent = -1,
+            .local_transform = get_gltf_node_transform(node_data),
+            .meshes = {}
+        };
+
+        if (mesh_index >= 0 && static_cast<size_t>(mesh_index) < loaded_meshes.size())
+        {
+            node.meshes = loaded_meshes[mesh_index];
+        }
+
+        scene.nodes.push_back(node);
+    }
+
+    for (size_t i = 0; i < nodes_count; i++)
+    {
+        const JsonValue* children = find_json_member(nodes_data->array[i], "children");
+
+        for (size_t j = 0; children != nullptr && j < children->array.size(); j++)
+        {
+            const double child = children->array[j].number;
+
+            if (child >= 0.0 && child < static_cast<double>(nodes_count))
+            {
+                scene.nodes[node_offset + static_cast<size_t>(child)].parent = node_offset + static_cast<int32_t>(i);
+            }
+        }
+    }
+
+    size_t loaded_count = 0;
+
+    for (const std::vector<uint32_t> &mesh_list : loaded_meshes)
+    {
+        loaded_count += mesh_list.size();
+    }
+
+    if (loaded_count < 1)
+    {
+        error_log("- The loading of the glTF model \"" + file_name + "\" failed! No primitive could be loaded!");
+
+        // Remove what this model added to the scene.
+        scene.nodes.resize(node_offset);
+        scene.materials.resize(material_offset);
+        scene.textures.resize(texture_offset);
+        return false;
+    }
+
+    log(" > " + std::to_string(loaded_count) + "/" + std::to_string(primitives_count) + " primitives, " + std::to_string(nodes_count) + " nodes, " + std::to_string(scene.materials.size() - material_offset) + " materials and " + std::to_string(scene.textures.size() - texture_offset) + " textures loaded.");
+    return true;
+}
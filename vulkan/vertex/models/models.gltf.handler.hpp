@@ -0,0 +1,92 @@
+#include "models.scene.hpp"
+#include "../vertex.handler.hpp"
+#include "../../../utils/tool.json.hpp"
+
+#include <glm/glm.hpp>
+#include <filesystem>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#ifndef VULKAN_MODELS_GLTF_HANDLER_HPP
+#define VULKAN_MODELS_GLTF_HANDLER_HPP
+
+////////////////////////////////////////////////////
+//////////////////// Structures ////////////////////
+////////////////////////////////////////////////////
+
+// Binary data of a glTF buffer, pointing into a mapped file or a decoded data URI.
+struct GltfBuffer
+{
+    const uint8_t* data;
+    size_t size;
+    std::string source_file;  // File containing the buffer, empty for data URIs.
+    size_t file_offset;       // Position of the buffer inside its file.
+};
+
+// Strided view on the elements of a glTF accessor.
+struct GltfAccessor
+{
+    const uint8_t* data;
+    size_t count;
+    size_t stride;
+    uint32_t component_type;
+    uint32_t components;
+    bool normalized;
+};
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+int64_t get_gltf_integer
+(
+    const JsonValue &object,
+    const std::string &key,
+    const int64_t &fallback
+);
+
+bool get_gltf_accessor
+(
+    const JsonValue &document,
+    const std::vector<GltfBuffer> &buffers,
+    const size_t &accessor_index,
+    GltfAccessor &accessor,
+    std::string &error
+);
+
+float read_gltf_component
+(
+    const GltfAccessor &accessor,
+    const size_t &element,
+    const uint32_t &component
+);
+
+uint32_t read_gltf_index
+(
+    const GltfAccessor &accessor,
+    const size_t &element
+);
+
+glm::mat4 get_gltf_node_transform
+(
+    const JsonValue &node
+);
+
+bool load_gltf_primitive
+(
+    const JsonValue &document,
+    const std::vector<GltfBuffer> &buffers,
+    const JsonValue &primitive,
+    Mesh &mesh,
+    std::string &error
+);
+
+bool load_gltf_model
+(
+    const std::filesystem::path &file_path,
+    std::vector<Mesh> &meshes,
+    ModelScene &scene
+);
+
+#endif
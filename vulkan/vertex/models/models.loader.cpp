@@ -1,18 +1,24 @@
 #include "models.loader.hpp"
 
 #include "models.obj.handler.hpp"
+#include "models.gltf.handler.hpp"
+#include "models.scene.hpp"
+#include "models.meshlets.hpp"
+#include "models.simplification.hpp"
 #include "../vertex.handler.hpp"
 #include "../../logs/logs.handler.hpp"
 
 #include <vector>
 #include <string>
 #include <filesystem>
+#include <utility>
 
-// Load all 3D models as vertices and indices into the engine.
+// Load all 3D models as meshes into the engine.
+// The nodes, materials and textures described by the models are added to the scene.
 void load_3d_models
 (
-    std::vector<Vertex> &vertices,
-    std::vector<uint32_t> &indices
+    std::vector<Mesh> &meshes,
+    ModelScene &scene
 )
 {
     log("Loading 3D models..");
@@ -22,6 +28,12 @@ void load_3d_models
 
     for (const auto &file : std::filesystem::directory_iterator("./models"))
     {
+        // The external buffers of the .gltf models are loaded with them.
+        if (file.path().extension() == ".bin")
+        {
+            continue;
+        }
+
         total++;
 
         const std::filesystem::path file_path = file.path();
@@ -34,18 +46,42 @@ void load_3d_models
             continue;
         }
 
+        const size_t first_mesh = meshes.size();
+
         if (file_extension == ".obj")
         {
-            load_obj_model(file_path, vertices, indices);
+            Mesh mesh {};
+            mesh.name = file_name;
+
+            if (!load_obj_model(file_path, mesh))
+            {
+                continue;
+            }
+
+            meshes.push_back(std::move(mesh));
+        }
+        else if (file_extension == ".gltf" || file_extension == ".glb")
+        {
+            if (!load_gltf_model(file_path, meshes, scene))
+            {
+                continue;
+            }
         }
         else
         {
-            error_log("- The loading of the model \"" + file_name + "\" failed! The file extension (\"" + file_extension + "\") is not supported by the engine! Supported extension: .obj.");
+            error_log("- The loading of the model \"" + file_name + "\" failed! The file extension (\"" + file_extension + "\") is not supported by the engine! Supported extensions: .obj, .gltf, .glb.");
             continue;
         }
 
         succeeded++;
         log("- Model \"" + file_name + "\" loaded successfully!");
+
+        // No offline processing step exists yet, so the clusters and the levels of detail are generated at load time.
+        for (size_t i = first_mesh; i < meshes.size(); i++)
+        {
+            build_mesh_clusters(meshes[i]);
+            generate_mesh_lods(meshes[i]);
+        }
     }
 
     if (succeeded < total)
@@ -1,4 +1,5 @@
-#include "../vertex/vertex.handler.hpp"
+#include "../vertex.handler.hpp"
+#include "models.scene.hpp"
 
 #include <vector>
 
@@ -7,8 +8,8 @@
 
 void load_3d_models
 (
-    std::vector<Vertex> &vertices,
-    std::vector<uint32_t> &indices
+    std::vector<Mesh> &meshes,
+    ModelScene &scene
 );
 
 #endif
@@ -0,0 +1,62 @@
+#include "models.lod.hpp"
+
+#include "models.geometry.hpp"
+#include "../../uniform/uniform.camera.hpp"
+#include "../../../config/engine.config.hpp"
+
+#include <vulkan/vulkan.h>
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <cmath>
+
+// Convert a geometric error (in world units) seen at a given distance into pixels on the screen.
+float get_projected_error
+(
+    const float &error,
+    const float &distance,
+    const CameraData &camera,
+    const VkExtent2D &extent
+)
+{
+    const float pixels_per_unit = static_cast<float>(extent.height) / (2.0f * std::tan(glm::radians(camera.field_of_view) * 0.5f));
+    return error * pixels_per_unit / std::max(distance, camera.near_plane);
+}
+
+// Give the largest scale a model matrix applies along its axes, which converts the model units into world units.
+float get_model_scale
+(
+    const glm::mat4 &model
+)
+{
+    return std::max({ glm::length(glm::vec3(model[0])), glm::length(glm::vec3(model[1])), glm::length(glm::vec3(model[2])) });
+}
+
+// Select the coarsest level of detail of a mesh whose error stays under the pixel threshold.
+// The errors and the bounding sphere are in model units, converted into world units by the scale of the object.
+// The distance is measured from the camera to the closest point of the mesh bounding sphere.
+uint32_t select_mesh_lod
+(
+    const MeshRange &mesh,
+    const glm::vec3 &world_center,
+    const float &scale,
+    const CameraData &camera,
+    const VkExtent2D &extent
+)
+{
+    const float distance = glm::length(camera.position - world_center) - mesh.bounds_radius * scale;
+    uint32_t selected_lod = 0;
+
+    // The errors grow with the levels, so we can stop at the first level that is too coarse.
+    for (uint32_t i = 1; i < mesh.lods.size(); i++)
+    {
+        if (get_projected_error(mesh.lods[i].error * scale, distance, camera, extent) > EngineConfig::LOD_PIXEL_ERROR_THRESHOLD)
+        {
+            break;
+        }
+
+        selected_lod = i;
+    }
+
+    return selected_lod;
+}
@@ -0,0 +1,37 @@
+#include "models.geometry.hpp"
+#include "../../uniform/uniform.camera.hpp"
+
+#include <vulkan/vulkan.h>
+#include <glm/glm.hpp>
+#include <cstdint>
+
+#ifndef VULKAN_MODELS_LOD_HPP
+#define VULKAN_MODELS_LOD_HPP
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+float get_projected_error
+(
+    const float &error,
+    const float &distance,
+    const CameraData &camera,
+    const VkExtent2D &extent
+);
+
+float get_model_scale
+(
+    const glm::mat4 &model
+);
+
+uint32_t select_mesh_lod
+(
+    const MeshRange &mesh,
+    const glm::vec3 &world_center,
+    const float &scale,
+    const CameraData &camera,
+    const VkExtent2D &extent
+);
+
+#endif
@@ -0,0 +1,250 @@
+#include "models.meshlets.hpp"
+
+#include "../vertex.handler.hpp"
+#include "../../../config/engine.config.hpp"
+#include "../../../logs/logs.handler.hpp"
+
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <cmath>
+
+// Compute the bounding sphere and the normal cone of a cluster.
+void compute_cluster_bounds
+(
+    const std::vector<Vertex> &vertices,
+    const std::vector<uint32_t> &indices,
+    MeshCluster &cluster
+)
+{
+    const uint32_t end = cluster.first_index + cluster.index_count;
+
+    glm::vec3 minimum = vertices[indices[cluster.first_index]].position;
+    glm::vec3 maximum = minimum;
+
+    for (uint32_t i = cluster.first_index; i < end; i++)
+    {
+        minimum = glm::min(minimum, vertices[indices[i]].position);
+        maximum = glm::max(maximum, vertices[indices[i]].position);
+    }
+
+    cluster.center = (minimum + maximum) * 0.5f;
+    cluster.radius = 0.0f;
+
+    for (uint32_t i = cluster.first_index; i < end; i++)
+    {
+        cluster.radius = std::max(cluster.radius, glm::length(vertices[indices[i]].position - cluster.center));
+    }
+
+    // The cone axis is the average of the triangles normals, the spread is given by the least aligned triangle.
+    std::vector<glm::vec3> normals;
+    glm::vec3 axis(0.0f);
+
+    for (uint32_t i = cluster.first_index; i < end; i += 3)
+    {
+        const glm::vec3 &p0 = vertices[indices[i + 0]].position;
+        const glm::vec3 &p1 = vertices[indices[i + 1]].position;
+        const glm::vec3 &p2 = vertices[indices[i + 2]].position;
+
+        const glm::vec3 normal = glm::cross(p1 - p0, p2 - p0);
+        const float length = glm::length(normal);
+
+        if (length > 0.0f)
+        {
+            normals.push_back(normal / length);
+            axis += normal / length;
+        }
+    }
+
+    const float axis_length = glm::length(axis);
+    float minimum_dot = 1.0f;
+
+    if (axis_length > 0.0f)
+    {
+        axis /= axis_length;
+
+        for (const glm::vec3 &normal : normals)
+        {
+            minimum_dot = std::min(minimum_dot, glm::dot(axis, normal));
+        }
+    }
+
+    // A cone wider than ~85 degrees almost never culls anything, we disable the test for it.
+    if (axis_length <= 0.0f || minimum_dot <= 0.1f)
+    {
+        cluster.cone_axis = glm::vec3(0.0f);
+        cluster.cone_cutoff = 1.0f;
+        return;
+    }
+
+    cluster.cone_axis = axis;
+    cluster.cone_cutoff = std::sqrt(1.0f - minimum_dot * minimum_dot);
+}
+
+// Split the full resolution mesh into clusters of neighboring triangles.
+// The triangles are grown greedily from a seed, preferring the ones that add the least new vertices,
+// until the cluster reaches the vertices or triangles limit.
+// The mesh indices are reordered so that each cluster triangles are contiguous.
+void build_mesh_clusters
+(
+    Mesh &mesh
+)
+{
+    mesh.clusters.clear();
+
+    const size_t triangles_count = mesh.indices.size() / 3;
+    const size_t vertices_count = mesh.vertices.size();
+
+    if (triangles_count < 1)
+    {
+        return;
+    }
+
+    const size_t max_vertices = EngineConfig::MESHLET_MAX_VERTICES;
+    const size_t max_triangles = EngineConfig::MESHLET_MAX_TRIANGLES;
+
+    // List the triangles around each vertex.
+    std::vector<uint32_t> triangle_offsets(vertices_count + 1, 0);
+    std::vector<uint32_t> triangle_list(triangles_count * 3);
+
+    for (const uint32_t &index : mesh.indices)
+    {
+        triangle_offsets[index + 1]++;
+    }
+
+    for (size_t i = 0; i < vertices_count; i++)
+    {
+        triangle_offsets[i + 1] += triangle_offsets[i];
+    }
+
+    std::vector<uint32_t> fill_offsets(triangle_offsets.begin(), triangle_offsets.end() - 1);
+
+    for (size_t i = 0; i < mesh.indices.size(); i++)
+    {
+        triangle_list[fill_offsets[mesh.indices[i]]++] = static_cast<uint32_t>(i / 3);
+    }
+
+    std::vector<uint32_t> reordered_indices;
+    reordered_indices.reserve(mesh.indices.size());
+
+    std::vector<bool> emitted(triangles_count, false);
+    std::vector<uint32_t> vertex_cluster(vertices_count, UINT32_MAX); // Last cluster that used each vertex.
+    std::vector<uint32_t> cluster_vertices;
+
+    size_t seed = 0;
+    size_t cluster_triangles = 0;
+    uint32_t cluster_id = 0;
+
+    // Count the vertices of a triangle that are not in the current cluster yet.
+    const auto count_new_vertices = [&](const uint32_t &triangle)
+    {
+        int count = 0;
+
+        for (int j = 0; j < 3; j++)
+        {
+            if (vertex_cluster[mesh.indices[triangle * 3 + j]] != cluster_id)
+            {
+                count++;
+            }
+        }
+
+        return count;
+    };
+
+    // Close the current cluster and start a new one.
+    const auto flush_cluster = [&]()
+    {
+        if (cluster_triangles < 1)
+        {
+            return;
+        }
+
+        MeshCluster cluster {};
+        cluster.index_count = static_cast<uint32_t>(cluster_triangles * 3);
+        cluster.first_index = static_cast<uint32_t>(reordered_indices.size()) - cluster.index_count;
+        mesh.clusters.push_back(cluster);
+
+        cluster_vertices.clear();
+        cluster_triangles = 0;
+        cluster_id++;
+    };
+
+    for (size_t emitted_count = 0; emitted_count < triangles_count; emitted_count++)
+    {
+        // Search the connected triangle adding the fewest vertices to the cluster.
+        uint32_t best_triangle = UINT32_MAX;
+        int best_score = 4;
+
+        for (const uint32_t &vertex : cluster_vertices)
+        {
+            for (uint32_t i = triangle_offsets[vertex]; i < triangle_offsets[vertex + 1] && best_score > 0; i++)
+            {
+                const uint32_t triangle = triangle_list[i];
+
+                if (emitted[triangle])
+                {
+                    continue;
+                }
+
+                const int score = count_new_vertices(triangle);
+
+                if (score < best_score)
+                {
+                    best_score = score;
+                    best_triangle = triangle;
+                }
+            }
+
+            if (best_score == 0)
+            {
+                break;
+            }
+        }
+
+        // Start from the next free triangle when the cluster can't grow anymore.
+        if (best_triangle == UINT32_MAX)
+        {
+            while (emitted[seed])
+            {
+                seed++;
+            }
+
+            best_triangle = static_cast<uint32_t>(seed);
+            best_score = count_new_vertices(best_triangle);
+        }
+
+        if (cluster_vertices.size() + best_score > max_vertices || cluster_triangles + 1 > max_triangles)
+        {
+            flush_cluster();
+            best_score = count_new_vertices(best_triangle);
+        }
+
+        for (int j = 0; j < 3; j++)
+        {
+            const uint32_t vertex = mesh.indices[best_triangle * 3 + j];
+
+            if (vertex_cluster[vertex] != cluster_id)
+            {
+                vertex_cluster[vertex] = cluster_id;
+                cluster_vertices.push_back(vertex);
+            }
+
+            reordered_indices.push_back(vertex);
+        }
+
+        emitted[best_triangle] = true;
+        cluster_triangles++;
+    }
+
+    flush_cluster();
+    mesh.indices = std::move(reordered_indices);
+
+    for (MeshCluster &cluster : mesh.clusters)
+    {
+        compute_cluster_bounds(mesh.vertices, mesh.indices, cluster);
+    }
+
+    log(" > " + std::to_string(mesh.clusters.size()) + " clusters built (" + std::to_string(triangles_count) + " triangles).");
+}
@@ -0,0 +1,26 @@
+#include "../vertex.handler.hpp"
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+#ifndef VULKAN_MODELS_MESHLETS_HPP
+#define VULKAN_MODELS_MESHLETS_HPP
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+void compute_cluster_bounds
+(
+    const std::vector<Vertex> &vertices,
+    const std::vector<uint32_t> &indices,
+    MeshCluster &cluster
+);
+
+void build_mesh_clusters
+(
+    Mesh &mesh
+);
+
+#endif
@@ -1,20 +1,20 @@
 #include "models.obj.handler.hpp"
 
 #include "../vertex.handler.hpp"
-#include "../../logs/logs.handler.hpp"
+#include "../../../logs/logs.handler.hpp"
 
 #define TINYOBJLOADER_IMPLEMENTATION
 #include <tinyobjloader/tiny_obj_loader.h>
+#include <glm/glm.hpp>
 #include <vector>
 #include <filesystem>
 #include <unordered_map>
 
-// Return vertices and indices from an OBJ model.
-std::pair<std::vector<Vertex>, std::vector<uint32_t>> load_obj_model
+// Load the vertices and indices of an OBJ model into a mesh.
+bool load_obj_model
 (
     const std::filesystem::path &file_path,
-    std::vector<Vertex> &vertices,
-    std::vector<uint32_t> &indices
+    Mesh &mesh
 )
 {
     const bool file_exists = std::filesystem::exists(file_path);
@@ -22,7 +22,7 @@ std::pair<std::vector<Vertex>, std::vector<uint32_t>> load_obj_model
     if (!file_exists)
     {
         error_log("- The loading of the OBJ model \"" + file_path.string() + "\" failed! No such file or directory!");
-        return { vertices, indices };
+        return false;
     }
 
     const std::string file_name = file_path.filename().string();
@@ -31,7 +31,7 @@ std::pair<std::vector<Vertex>, std::vector<uint32_t>> load_obj_model
     if (file_extension != ".obj")
     {
         error_log("- The loading of the OBJ model \"" + file_name + "\" failed ! The file extension is not valid!");
-        return { vertices, indices };
+        return false;
     }
 
     tinyobj::attrib_t attrib;
@@ -44,7 +44,7 @@ std::pair<std::vector<Vertex>, std::vector<uint32_t>> load_obj_model
     if (!loaded)
     {
         error_log("- The loading of the OBJ model \"" + file_name + "\" failed with error: " + error + "!");
-        return { vertices, indices };
+        return false;
     }
 
     if (warning.size() > 0)
@@ -53,6 +53,7 @@ std::pair<std::vector<Vertex>, std::vector<uint32_t>> load_obj_model
     }
 
     std::unordered_map<Vertex, uint32_t> unique_vertices {};
+    bool missing_normals = false;
 
     for (const auto &shape : shapes)
     {
@@ -67,23 +68,76 @@ std::pair<std::vector<Vertex>, std::vector<uint32_t>> load_obj_model
                 attrib.vertices[3 * index.vertex_index + 2]
             };
 
-            vertex.texture_coordinates =
+            if (index.normal_index >= 0)
             {
-                attrib.texcoords[2 * index.texcoord_index + 0],
-                attrib.texcoords[2 * index.texcoord_index + 1]
-            };
+                vertex.normal =
+                {
+                    attrib.normals[3 * index.normal_index + 0],
+                    attrib.normals[3 * index.normal_index + 1],
+                    attrib.normals[3 * index.normal_index + 2]
+                };
+            }
+            else missing_normals = true;
+
+            if (index.texcoord_index >= 0)
+            {
+                vertex.texture_coordinates =
+                {
+                    attrib.texcoords[2 * index.texcoord_index + 0],
+                    attrib.texcoords[2 * index.texcoord_index + 1]
+                };
+            }
 
             vertex.color = { 1.0f, 1.0f, 1.0f };
 
             if (unique_vertices.count(vertex) == 0)
             {
-                unique_vertices[vertex] = static_cast<uint32_t>(vertices.size());
-                vertices.push_back(vertex);
+                unique_vertices[vertex] = static_cast<uint32_t>(mesh.vertices.size());
+                mesh.vertices.push_back(vertex);
             }
 
-            indices.push_back(unique_vertices[vertex]);
+            mesh.indices.push_back(unique_vertices[vertex]);
         }
     }
 
-    return { vertices, indices };
+    // Some exporters don't write the normals, we compute them from the triangles.
+    if (missing_normals)
+    {
+        error_log("Warning: The OBJ model \"" + file_name + "\" has no normals! Generating them..");
+        generate_mesh_normals(mesh);
+    }
+
+    return true;
+}
+
+// Generate smooth normals for a mesh by averaging the normals of the triangles sharing each vertex.
+void generate_mesh_normals
+(
+    Mesh &mesh
+)
+{
+    for (Vertex &vertex : mesh.vertices)
+    {
+        vertex.normal = glm::vec3(0.0f);
+    }
+
+    for (size_t i = 0; i + 2 < mesh.indices.size(); i += 3)
+    {
+        Vertex &a = mesh.vertices[mesh.indices[i + 0]];
+        Vertex &b = mesh.vertices[mesh.indices[i + 1]];
+        Vertex &c = mesh.vertices[mesh.indices[i + 2]];
+
+        // The cross product length is proportional to the triangle area, so bigger triangles weigh more.
+        const glm::vec3 face_normal = glm::cross(b.position - a.position, c.position - a.position);
+
+        a.normal += face_normal;
+        b.normal += face_normal;
+        c.normal += face_normal;
+    }
+
+    for (Vertex &vertex : mesh.vertices)
+    {
+        const float length = glm::length(vertex.normal);
+        vertex.normal = length > 0.0f ? vertex.normal / length : glm::vec3(0.0f, 0.0f, 1.0f);
+    }
 }
@@ -0,0 +1,54 @@
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#ifndef VULKAN_MODELS_SCENE_HPP
+#define VULKAN_MODELS_SCENE_HPP
+
+////////////////////////////////////////////////////
+//////////////////// Structures ////////////////////
+////////////////////////////////////////////////////
+
+// Image used by a material.
+// Embedded images (GLB files, data URIs) have no path, they are located by their file and byte range instead.
+struct ModelTexture
+{
+    std::string name;
+    std::string path;         // Path of the image file, empty for embedded images.
+    std::string source_file;  // Model file containing the embedded image.
+    size_t byte_offset;       // Byte range of the embedded image inside the source file.
+    size_t byte_length;
+    std::string mime_type;
+};
+
+// Metallic-roughness material, the textures are indices in the scene textures (-1 when unused).
+struct ModelMaterial
+{
+    std::string name;
+    glm::vec4 base_color_factor;
+    float metallic_factor;
+    float roughness_factor;
+    int32_t base_color_texture;
+    int32_t metallic_roughness_texture;
+    int32_t normal_texture;
+};
+
+// Node of the models hierarchy.
+struct ModelNode
+{
+    std::string name;
+    int32_t parent;                // Index of the parent node, -1 for the root nodes.
+    glm::mat4 local_transform;     // Transform relative to the parent node.
+    std::vector<uint32_t> meshes;  // Indices of the meshes drawn by the node.
+};
+
+// Everything the models files describe around their meshes.
+struct ModelScene
+{
+    std::vector<ModelNode> nodes;
+    std::vector<ModelMaterial> materials;
+    std::vector<ModelTexture> textures;
+};
+
+#endif
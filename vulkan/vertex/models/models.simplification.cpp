@@ -0,0 +1,421 @@
+#include "models.simplification.hpp"
+
+#include "../vertex.handler.hpp"
+#include "../../../config/engine.config.hpp"
+#include "../../../logs/logs.handler.hpp"
+
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <unordered_map>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <cmath>
+
+// Add the plane (normal, distance) to a quadric with the given weight.
+void add_plane_to_quadric
+(
+    Quadric &quadric,
+    const glm::vec3 &normal,
+    const float &distance,
+    const float &weight
+)
+{
+    quadric.a2 += weight * normal.x * normal.x;
+    quadric.b2 += weight * normal.y * normal.y;
+    quadric.c2 += weight * normal.z * normal.z;
+    quadric.d2 += weight * distance * distance;
+    quadric.ab += weight * normal.x * normal.y;
+    quadric.ac += weight * normal.x * normal.z;
+    quadric.ad += weight * normal.x * distance;
+    quadric.bc += weight * normal.y * normal.z;
+    quadric.bd += weight * normal.y * distance;
+    quadric.cd += weight * normal.z * distance;
+}
+
+// Accumulate a quadric into another one.
+void add_quadric
+(
+    Quadric &destination,
+    const Quadric &source
+)
+{
+    destination.a2 += source.a2;
+    destination.b2 += source.b2;
+    destination.c2 += source.c2;
+    destination.d2 += source.d2;
+    destination.ab += source.ab;
+    destination.ac += source.ac;
+    destination.ad += source.ad;
+    destination.bc += source.bc;
+    destination.bd += source.bd;
+    destination.cd += source.cd;
+}
+
+// Return the weighted sum of the squared distances between a point and the planes of a quadric.
+double evaluate_quadric
+(
+    const Quadric &quadric,
+    const glm::vec3 &point
+)
+{
+    const double x = point.x;
+    const double y = point.y;
+    const double z = point.z;
+
+    const double error = quadric.a2 * x * x + quadric.b2 * y * y + quadric.c2 * z * z + quadric.d2
+        + 2.0 * (quadric.ab * x * y + quadric.ac * x * z + quadric.ad * x + quadric.bc * y * z + quadric.bd * y + quadric.cd * z);
+
+    return std::max(error, 0.0); // Rounding can make the error slightly negative.
+}
+
+// Check if moving a vertex onto another one would flip one of its triangles.
+bool collapse_flips_triangles
+(
+    const std::vector<glm::vec3> &positions,
+    const std::vector<uint32_t> &indices,
+    const std::vector<uint32_t> &triangle_offsets,
+    const std::vector<uint32_t> &triangle_list,
+    const EdgeCollapse &collapse
+)
+{
+    for (uint32_t i = triangle_offsets[collapse.from]; i < triangle_offsets[collapse.from + 1]; i++)
+    {
+        const uint32_t triangle = triangle_list[i];
+        const uint32_t a = indices[triangle * 3 + 0];
+        const uint32_t b = indices[triangle * 3 + 1];
+        const uint32_t c = indices[triangle * 3 + 2];
+
+        // Triangles using the collapsed edge disappear, they can't flip.
+        if (a == collapse.to || b == collapse.to || c == collapse.to)
+        {
+            continue;
+        }
+
+        const glm::vec3 before = glm::cross(positions[b] - positions[a], positions[c] - positions[a]);
+
+        const glm::vec3 new_a = a == collapse.from ? positions[collapse.to] : positions[a];
+        const glm::vec3 new_b = b == collapse.from ? positions[collapse.to] : positions[b];
+        const glm::vec3 new_c = c == collapse.from ? positions[collapse.to] : positions[c];
+        const glm::vec3 after = glm::cross(new_b - new_a, new_c - new_a);
+
+        if (glm::dot(before, after) <= 0.0f)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Simplify a mesh with edge collapses ordered by their quadric error until the target index count is reached.
+// The vertices are never moved or created, the simplified indices keep using the original vertex buffer.
+// Attribute seams and open borders are locked so that texture coordinates and silhouettes are preserved.
+// Output: the simplified indices and the geometric error (in model units): a bound of the distance between the simplified surface and the original one.
+std::vector<uint32_t> simplify_mesh
+(
+    const std::vector<Vertex> &vertices,
+    const std::vector<uint32_t> &indices,
+    const size_t &target_index_count,
+    float &error
+)
+{
+    error = 0.0f;
+    std::vector<uint32_t> result = indices;
+
+    if (vertices.size() < 1 || indices.size() < 3 || indices.size() % 3 != 0 || target_index_count >= indices.size())
+    {
+        return result;
+    }
+
+    const size_t vertices_count = vertices.size();
+
+    // Work on positions normalized by the mesh size so that the errors and the attribute weight don't depend on the model scale.
+    glm::vec3 minimum = vertices[0].position;
+    glm::vec3 maximum = vertices[0].position;
+
+    for (const Vertex &vertex : vertices)
+    {
+        minimum = glm::min(minimum, vertex.position);
+        maximum = glm::max(maximum, vertex.position);
+    }
+
+    const float scale = std::max(glm::length(maximum - minimum) * 0.5f, 1e-6f);
+    std::vector<glm::vec3> positions(vertices_count);
+
+    for (size_t i = 0; i < vertices_count; i++)
+    {
+        positions[i] = vertices[i].position / scale;
+    }
+
+    // Vertices sharing the same position with different attributes are attribute seams.
+    // Collapsing one of them would tear the surface, so we lock them.
+    std::unordered_map<glm::vec3, uint32_t> position_owners;
+    std::vector<uint32_t> position_ids(vertices_count);
+    std::vector<uint32_t> shared_count(vertices_count, 0);
+
+    for (size_t i = 0; i < vertices_count; i++)
+    {
+        const auto owner = position_owners.emplace(vertices[i].position, static_cast<uint32_t>(i));
+        position_ids[i] = owner.first->second;
+        shared_count[owner.first->second]++;
+    }
+
+    std::vector<bool> locked(vertices_count, false);
+
+    for (size_t i = 0; i < vertices_count; i++)
+    {
+        if (shared_count[position_ids[i]] > 1)
+        {
+            locked[i] = true;
+        }
+    }
+
+    // Edges used by a single triangle are open borders, we lock them to keep the mesh outline.
+    std::unordered_map<uint64_t, uint32_t> edges_usage;
+
+    for (size_t i = 0; i < result.size(); i += 3)
+    {
+        for (int j = 0; j < 3; j++)
+        {
+            const uint64_t a = position_ids[result[i + j]];
+            const uint64_t b = position_ids[result[i + (j + 1) % 3]];
+            edges_usage[(std::min(a, b) << 32) | std::max(a, b)]++;
+        }
+    }
+
+    for (const auto &edge : edges_usage)
+    {
+        if (edge.second == 1)
+        {
+            locked[static_cast<uint32_t>(edge.first >> 32)] = true;
+            locked[static_cast<uint32_t>(edge.first & 0xFFFFFFFF)] = true;
+        }
+    }
+
+    // Accumulate the planes of the triangles around each vertex, weighted by the triangles area.
+    std::vector<Quadric> quadrics(vertices_count, Quadric {});
+
+    for (size_t i = 0; i < result.size(); i += 3)
+    {
+        const glm::vec3 &p0 = positions[result[i + 0]];
+        const glm::vec3 &p1 = positions[result[i + 1]];
+        const glm::vec3 &p2 = positions[result[i + 2]];
+
+        const glm::vec3 normal = glm::cross(p1 - p0, p2 - p0);
+        const float length = glm::length(normal);
+
+        if (length <= 0.0f)
+        {
+            continue;
+        }
+
+        const glm::vec3 unit_normal = normal / length;
+        const float distance = -glm::dot(unit_normal, p0);
+
+        for (int j = 0; j < 3; j++)
+        {
+            add_plane_to_quadric(quadrics[result[i + j]], unit_normal, distance, length * 0.5f);
+        }
+    }
+
+    // The quadric costs order the collapses, but they are weighted by the areas and the attributes, so they aren't distances.
+    // Each vertex keeps instead a bound of the distance between the surface around it and the original one.
+    std::vector<float> vertices_errors(vertices_count, 0.0f);
+    float worst_error = 0.0f;
+
+    for (int pass = 0; pass < 100 && result.size() > target_index_count; pass++)
+    {
+        // List the triangles around each vertex.
+        std::vector<uint32_t> triangle_offsets(vertices_count + 1, 0);
+        std::vector<uint32_t> triangle_list(result.size());
+
+        for (const uint32_t &index : result)
+        {
+            triangle_offsets[index + 1]++;
+        }
+
+        for (size_t i = 0; i < vertices_count; i++)
+        {
+            triangle_offsets[i + 1] += triangle_offsets[i];
+        }
+
+        std::vector<uint32_t> fill_offsets(triangle_offsets.begin(), triangle_offsets.end() - 1);
+
+        for (size_t i = 0; i < result.size(); i++)
+        {
+            triangle_list[fill_offsets[result[i]]++] = static_cast<uint32_t>(i / 3);
+        }
+
+        // Each directed edge gives one collapse candidate, so both directions of a manifold edge are evaluated.
+        std::vector<EdgeCollapse> collapses;
+        collapses.reserve(result.size());
+
+        for (size_t i = 0; i < result.size(); i += 3)
+        {
+            for (int j = 0; j < 3; j++)
+            {
+                const uint32_t from = result[i + j];
+                const uint32_t to = result[i + (j + 1) % 3];
+
+                if (locked[from])
+                {
+                    continue;
+                }
+
+                Quadric quadric = quadrics[from];
+                add_quadric(quadric, quadrics[to]);
+
+                // Penalize collapses between vertices with different attributes to preserve shading and texturing.
+                const glm::vec3 normal_delta = vertices[from].normal - vertices[to].normal;
+                const glm::vec3 color_delta = vertices[from].color - vertices[to].color;
+                const glm::vec2 coordinates_delta = vertices[from].texture_coordinates - vertices[to].texture_coordinates;
+                const float attributes_error = glm::dot(normal_delta, normal_delta) + glm::dot(color_delta, color_delta) + glm::dot(coordinates_delta, coordinates_delta);
+
+                const float cost = static_cast<float>(evaluate_quadric(quadric, positions[to])) + EngineConfig::LOD_ATTRIBUTE_WEIGHT * attributes_error;
+                collapses.push_back({ from, to, cost });
+            }
+        }
+
+        std::sort(collapses.begin(), collapses.end(), [](const EdgeCollapse &a, const EdgeCollapse &b) { return a.cost < b.cost; });
+
+        // Each collapse removes about two triangles.
+        const size_t triangles_to_remove = (result.size() - target_index_count) / 3;
+        const size_t collapses_limit = std::max<size_t>(1, (triangles_to_remove + 1) / 2);
+
+        std::vector<uint32_t> remap(vertices_count);
+        std::vector<bool> touched(vertices_count, false);
+
+        for (size_t i = 0; i < vertices_count; i++)
+        {
+            remap[i] = static_cast<uint32_t>(i);
+        }
+
+        size_t collapsed = 0;
+
+        for (const EdgeCollapse &collapse : collapses)
+        {
+            if (collapsed >= collapses_limit)
+            {
+                break;
+            }
+
+            // Only one collapse per neighborhood and per pass, so that the flip checks stay valid.
+            if (touched[collapse.from] || touched[collapse.to])
+            {
+                continue;
+            }
+
+            if (collapse_flips_triangles(positions, result, triangle_offsets, triangle_list, collapse))
+            {
+                continue;
+            }
+
+            remap[collapse.from] = collapse.to;
+            add_quadric(quadrics[collapse.to], quadrics[collapse.from]);
+
+            // The triangles around the collapsed vertex only move by the distance of its new position to their planes.
+            float collapse_error = 0.0f;
+
+            for (uint32_t i = triangle_offsets[collapse.from]; i < triangle_offsets[collapse.from + 1]; i++)
+            {
+                const uint32_t triangle = triangle_list[i];
+                const glm::vec3 &p0 = positions[result[triangle * 3 + 0]];
+                const glm::vec3 normal = glm::cross(positions[result[triangle * 3 + 1]] - p0, positions[result[triangle * 3 + 2]] - p0);
+                const float length = glm::length(normal);
+
+                if (length > 0.0f)
+                {
+                    collapse_error = std::max(collapse_error, std::abs(glm::dot(normal / length, positions[collapse.to] - p0)));
+                }
+            }
+
+            vertices_errors[collapse.to] = std::max(vertices_errors[collapse.to], vertices_errors[collapse.from] + collapse_error);
+            worst_error = std::max(worst_error, vertices_errors[collapse.to]);
+
+            for (uint32_t i = triangle_offsets[collapse.from]; i < triangle_offsets[collapse.from + 1]; i++)
+            {
+                const uint32_t triangle = triangle_list[i];
+
+                touched[result[triangle * 3 + 0]] = true;
+                touched[result[triangle * 3 + 1]] = true;
+                touched[result[triangle * 3 + 2]] = true;
+            }
+
+            collapsed++;
+        }
+
+        if (collapsed == 0)
+        {
+            break; // Every remaining collapse is locked or would flip a triangle.
+        }
+
+        // Apply the collapses and remove the triangles that became degenerate.
+        size_t write = 0;
+
+        for (size_t i = 0; i < result.size(); i += 3)
+        {
+            const uint32_t a = remap[result[i + 0]];
+            const uint32_t b = remap[result[i + 1]];
+            const uint32_t c = remap[result[i + 2]];
+
+            if (a == b || b == c || a == c)
+            {
+                continue;
+            }
+
+            result[write + 0] = a;
+            result[write + 1] = b;
+            result[write + 2] = c;
+            write += 3;
+        }
+
+        result.resize(write);
+    }
+
+    error = worst_error * scale;
+    return result;
+}
+
+// Generate the levels of detail of a mesh.
+// Each level targets a fraction of the previous level indices and keeps the geometric error of its simplification.
+void generate_mesh_lods
+(
+    Mesh &mesh
+)
+{
+    mesh.lods.clear();
+
+    if (EngineConfig::LOD_LEVELS_COUNT < 2 || mesh.indices.size() < 3)
+    {
+        return;
+    }
+
+    float previous_error = 0.0f;
+
+    for (int level = 1; level < EngineConfig::LOD_LEVELS_COUNT; level++)
+    {
+        const std::vector<uint32_t> &source = level == 1 ? mesh.indices : mesh.lods.back().indices;
+        const size_t target_index_count = static_cast<size_t>(source.size() * EngineConfig::LOD_REDUCTION_RATIO) / 3 * 3;
+
+        if (target_index_count < 3)
+        {
+            break;
+        }
+
+        float error = 0.0f;
+        std::vector<uint32_t> simplified = simplify_mesh(mesh.vertices, source, target_index_count, error);
+
+        // Stop the chain when the mesh can't be reduced anymore (locked seams and borders).
+        if (simplified.size() > source.size() * 9 / 10)
+        {
+            break;
+        }
+
+        // The errors of a level include the errors of the previous ones.
+        previous_error = std::max(previous_error, error);
+
+        log(" > LOD #" + std::to_string(level) + ": " + std::to_string(simplified.size() / 3) + " triangles (" + std::to_string(mesh.indices.size() / 3) + " at full resolution), error " + std::to_string(previous_error) + ".");
+        mesh.lods.push_back({ std::move(simplified), previous_error });
+    }
+}
@@ -0,0 +1,77 @@
+#include "../vertex.handler.hpp"
+
+#include <cstdint>
+#include <vector>
+
+#ifndef VULKAN_MODELS_SIMPLIFICATION_HPP
+#define VULKAN_MODELS_SIMPLIFICATION_HPP
+
+////////////////////////////////////////////////////
+//////////////////// Structures ////////////////////
+////////////////////////////////////////////////////
+
+// Symmetric 4x4 matrix of a quadric error metric (Garland & Heckbert).
+// It measures the sum of the squared distances from a point to a set of planes.
+struct Quadric
+{
+    double a2, b2, c2, d2;
+    double ab, ac, ad;
+    double bc, bd;
+    double cd;
+};
+
+// One possible edge collapse: the "from" vertex is merged into the "to" vertex.
+struct EdgeCollapse
+{
+    uint32_t from;
+    uint32_t to;
+    float cost;
+};
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+void add_plane_to_quadric
+(
+    Quadric &quadric,
+    const glm::vec3 &normal,
+    const float &distance,
+    const float &weight
+);
+
+void add_quadric
+(
+    Quadric &destination,
+    const Quadric &source
+);
+
+double evaluate_quadric
+(
+    const Quadric &quadric,
+    const glm::vec3 &point
+);
+
+bool collapse_flips_triangles
+(
+    const std::vector<glm::vec3> &positions,
+    const std::vector<uint32_t> &indices,
+    const std::vector<uint32_t> &triangle_offsets,
+    const std::vector<uint32_t> &triangle_list,
+    const EdgeCollapse &collapse
+);
+
+std::vector<uint32_t> simplify_mesh
+(
+    const std::vector<Vertex> &vertices,
+    const std::vector<uint32_t> &indices,
+    const size_t &target_index_count,
+    float &error
+);
+
+void generate_mesh_lods
+(
+    Mesh &mesh
+);
+
+#endif
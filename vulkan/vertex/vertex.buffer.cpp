@@ -1,10 +1,8 @@
 #include "vertex.buffer.hpp"
 
-#include "vertex.handler.hpp"
-#include "models/models.loader.hpp"
 #include "../buffers/buffers.handler.hpp"
 #include "../buffers/buffer.copy.hpp"
-#include "../buffers/buffer.index.hpp"
+#include "../render/sync/render.sync.deletion.hpp"
 #include "../../logs/logs.handler.hpp"
 #include "../../utils/tool.text.format.hpp"
 
@@ -24,7 +22,7 @@ std::pair<VkBuffer, VkDeviceMemory> create_vulkan_vertex_buffer
     const VkPhysicalDevice &physical_device,
     const VkCommandPool &command_pool,
     const VkQueue &graphics_queue,
-    std::vector<Vertex> &vertices
+    const std::vector<uint8_t> &vertex_data
 )
 {
     log("Creating a vertex buffer..");
@@ -49,15 +47,20 @@ std::pair<VkBuffer, VkDeviceMemory> create_vulkan_vertex_buffer
         fatal_error_log("Vertex buffer creation failed! The graphics queue provided (" + force_string(graphics_queue) + ") is not valid!");
     }
 
+    if (vertex_data.size() < 1)
+    {
+        fatal_error_log("Vertex buffer creation failed! No vertex data was provided!");
+    }
+
     VkBuffer staging_vertex_buffer = VK_NULL_HANDLE;
     VkDeviceMemory staging_buffer_memory = VK_NULL_HANDLE;
-    const VkDeviceSize buffer_size = sizeof(vertices[0]) * vertices.size(); // Calculate the size needed for the buffer.
+    const VkDeviceSize buffer_size = vertex_data.size(); // The vertices are already packed in their GPU layout.
 
     create_vulkan_buffer(logical_device, physical_device, buffer_size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, staging_vertex_buffer, staging_buffer_memory);
     void* data;
 
     vkMapMemory(logical_device, staging_buffer_memory, 0, buffer_size, 0, &data); // Map the buffer memory in the app address space.
-    memcpy(data, vertices.data(), (size_t) buffer_size); // Copy the data from CPU memory to GPU memory to enhance performances.
+    memcpy(data, vertex_data.data(), (size_t) buffer_size); // Copy the data from CPU memory to GPU memory to enhance performances.
     vkUnmapMemory(logical_device, staging_buffer_memory);
 
     VkBuffer vertex_buffer = VK_NULL_HANDLE;
@@ -118,10 +121,10 @@ Vulkan_VertexBuffer::Vulkan_VertexBuffer
     const VkPhysicalDevice &physical_device,
     const VkCommandPool &command_pool,
     const VkQueue &graphics_queue,
-    std::vector<Vertex> &vertices
+    const std::vector<uint8_t> &vertex_data
 ) : logical_device(logical_device)
 {
-    const std::pair buffer_data = create_vulkan_vertex_buffer(logical_device, physical_device, command_pool, graphics_queue, vertices);
+    const std::pair buffer_data = create_vulkan_vertex_buffer(logical_device, physical_device, command_pool, graphics_queue, vertex_data);
 
     vertex_buffer = buffer_data.first;
     vertex_buffer_memory = buffer_data.second;
@@ -130,7 +133,10 @@ Vulkan_VertexBuffer::Vulkan_VertexBuffer
 // Destructor.
 Vulkan_VertexBuffer::~Vulkan_VertexBuffer()
 {
-    destroy_vulkan_vertex_buffer(logical_device, vertex_buffer, vertex_buffer_memory);
+    retire_vulkan_resource([logical_device = logical_device, vertex_buffer = vertex_buffer, vertex_buffer_memory = vertex_buffer_memory]() mutable
+    {
+        destroy_vulkan_vertex_buffer(logical_device, vertex_buffer, vertex_buffer_memory);
+    });
 }
 
 VkBuffer Vulkan_VertexBuffer::get() const
@@ -1,8 +1,7 @@
-#include "vertex.handler.hpp"
-
 #include <vulkan/vulkan.h>
 #include <cstdint>
 #include <utility>
+#include <vector>
 
 #ifndef VULKAN_VERTEX_BUFFER_HPP
 #define VULKAN_VERTEX_BUFFER_HPP
@@ -24,7 +23,7 @@ std::pair<VkBuffer, VkDeviceMemory> create_vulkan_vertex_buffer
     const VkPhysicalDevice &physical_device,
     const VkCommandPool &command_pool,
     const VkQueue &graphics_queue,
-    std::vector<Vertex> &vertices
+    const std::vector<uint8_t> &vertex_data
 );
 
 void destroy_vulkan_vertex_buffer
@@ -49,7 +48,7 @@ public:
         const VkPhysicalDevice &physical_device,
         const VkCommandPool &command_pool,
         const VkQueue &graphics_queue,
-        std::vector<Vertex> &vertices
+        const std::vector<uint8_t> &vertex_data
     );
 
     // Destructor.
@@ -1,35 +1,73 @@
 #define GLM_ENABLE_EXPERIMENTAL
 #include <vector>
-#include <vulkan/vulkan.h>
+#include <string>
+#include <cstdint>
 #include <glm/glm.hpp>
 #include <glm/gtx/hash.hpp>
-#include <array>
 
 #ifndef VULKAN_VERTEX_HANDLER_HPP
 #define VULKAN_VERTEX_HANDLER_HPP
 
+////////////////////////////////////////////////////
+//////////////////// Structures ////////////////////
+////////////////////////////////////////////////////
+
+// Full precision vertex used on the CPU side.
+// The layout sent to the GPU is generated from a vertex layout (see vertex.layout.hpp).
 struct Vertex
 {
     glm::vec3 position;
+    glm::vec3 normal;
     glm::vec3 color;
     glm::vec2 texture_coordinates;
 
-    static VkVertexInputBindingDescription get_binding_description();
-    static std::array<VkVertexInputAttributeDescription, 3> get_attribute_descriptions();
-
     bool operator==(const Vertex& other) const
     {
-        return position == other.position && color == other.color && texture_coordinates == other.texture_coordinates;
+        return position == other.position && normal == other.normal && color == other.color && texture_coordinates == other.texture_coordinates;
     }
 };
 
+// Simplified version of a mesh, using the vertices of the full resolution mesh.
+struct MeshLevel
+{
+    std::vector<uint32_t> indices;
+    float error;  // Geometric error of the simplification, in model units.
+};
+
+// Group of neighboring triangles of a mesh (meshlet), culled as a whole.
+// Its triangles are stored contiguously in the full resolution indices of the mesh.
+struct MeshCluster
+{
+    uint32_t first_index;  // First index of the cluster in the mesh indices.
+    uint32_t index_count;
+    glm::vec3 center;      // Bounding sphere of the cluster.
+    float radius;
+    glm::vec3 cone_axis;   // Average direction the cluster triangles face.
+    float cone_cutoff;     // Sine of the cone spread, 1 when the cluster can't be backface culled.
+};
+
+// Geometry of one loaded model.
+// The indices are local to the mesh vertices.
+struct Mesh
+{
+    std::string name;
+    std::vector<Vertex> vertices;
+    std::vector<uint32_t> indices;
+    std::vector<MeshLevel> lods;  // Levels of detail after the full resolution one, from the finest to the coarsest.
+    std::vector<MeshCluster> clusters;  // Clusters of the full resolution mesh.
+    int32_t material = -1;              // Index of the mesh material in the scene, -1 for the default material.
+};
+
 namespace std
 {
     template<> struct hash<Vertex>
     {
         size_t operator()(Vertex const& vertex) const
         {
-            return ((hash<glm::vec3>()(vertex.position) ^ (hash<glm::vec3>()(vertex.color) << 1)) >> 1) ^ (hash<glm::vec2>()(vertex.texture_coordinates) << 1);
+            size_t seed = hash<glm::vec3>()(vertex.position);
+            seed = (seed ^ (hash<glm::vec3>()(vertex.normal) << 1)) >> 1;
+            seed = (seed ^ (hash<glm::vec3>()(vertex.color) << 1)) >> 1;
+            return seed ^ (hash<glm::vec2>()(vertex.texture_coordinates) << 1);
         }
     };
 }
@@ -1,25 +1,31 @@
 #include "vertex.input.state.hpp"
 
-#include "vertex.handler.hpp"
+#include "vertex.layout.hpp"
 #include "../../logs/logs.handler.hpp"
 
 #include <vulkan/vulkan.h>
 
 // Create a vertex input state for a graphics pipeline.
-VkPipelineVertexInputStateCreateInfo create_vulkan_vertex_input_state()
+// Note: The create info points to the layout descriptions, so the layout must outlive the pipeline creation.
+VkPipelineVertexInputStateCreateInfo create_vulkan_vertex_input_state
+(
+    const VertexLayout &vertex_layout
+)
 {
     log("Creating a vertex input state..");
 
-    const static auto binding_description = Vertex::get_binding_description();
-    const static auto attribute_descriptions = Vertex::get_attribute_descriptions();
+    if (vertex_layout.attribute_descriptions.size() < 1)
+    {
+        fatal_error_log("Vertex input state creation failed! The vertex layout provided has no attributes!");
+    }
 
     const VkPipelineVertexInputStateCreateInfo create_info
     {
         .sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO,
-        .vertexBindingDescriptionCount = 1,
-        .pVertexBindingDescriptions = &binding_description,
-        .vertexAttributeDescriptionCount = static_cast<uint32_t>(attribute_descriptions.size()), // Amount of attribute descriptions to pass.
-        .pVertexAttributeDescriptions = attribute_descriptions.data()
+        .vertexBindingDescriptionCount = static_cast<uint32_t>(vertex_layout.binding_descriptions.size()), // Amount of binding descriptions to pass.
+        .pVertexBindingDescriptions = vertex_layout.binding_descriptions.data(),
+        .vertexAttributeDescriptionCount = static_cast<uint32_t>(vertex_layout.attribute_descriptions.size()), // Amount of attribute descriptions to pass.
+        .pVertexAttributeDescriptions = vertex_layout.attribute_descriptions.data()
     };
 
     log("Vertex input state created successfully!");
@@ -1,8 +1,13 @@
+#include "vertex.layout.hpp"
+
 #include <vulkan/vulkan.h>
 
 #ifndef VULKAN_VERTEX_INPUT_STATE_HPP
 #define VULKAN_VERTEX_INPUT_STATE_HPP
 
-VkPipelineVertexInputStateCreateInfo create_vulkan_vertex_input_state();
+VkPipelineVertexInputStateCreateInfo create_vulkan_vertex_input_state
+(
+    const VertexLayout &vertex_layout
+);
 
 #endif
@@ -0,0 +1,192 @@
+#include "vertex.instances.hpp"
+
+#include "vertex.layout.hpp"
+#include "../uniform/uniform.buffers.hpp"
+#include "../buffers/buffers.handler.hpp"
+#include "../render/sync/render.sync.deletion.hpp"
+#include "../../config/engine.config.hpp"
+#include "../../logs/logs.handler.hpp"
+#include "../../utils/tool.text.format.hpp"
+
+#include <vulkan/vulkan.h>
+#include <cstddef>
+#include <vector>
+#include <cstdint>
+#include <string>
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+// Add the per-instance binding and attributes to a vertex layout.
+// Shader input locations: 4 = transform index, 5 = texture index.
+void add_instance_attributes
+(
+    VertexLayout &layout
+)
+{
+    const VkVertexInputBindingDescription binding_description
+    {
+        .binding = INSTANCE_BINDING,                // Set the binding index.
+        .stride = sizeof(InstanceData),             // Size of each instance.
+        .inputRate = VK_VERTEX_INPUT_RATE_INSTANCE  // Advance once per instance instead of once per vertex.
+    };
+
+    const VkVertexInputAttributeDescription transform_description
+    {
+        .location = 4,                                      // Set the shader input location.
+        .binding = INSTANCE_BINDING,                        // Set the binding index.
+        .format = VK_FORMAT_R32_UINT,                       // Set the data format.
+        .offset = offsetof(InstanceData, transform_index)   // Set the data offset inside the instance.
+    };
+
+    const VkVertexInputAttributeDescription texture_description
+    {
+        .location = 5,
+        .binding = INSTANCE_BINDING,
+        .format = VK_FORMAT_R32_SINT,
+        .offset = offsetof(InstanceData, texture_index)
+    };
+
+    layout.binding_descriptions.push_back(binding_description);
+    layout.attribute_descriptions.push_back(transform_description);
+    layout.attribute_descriptions.push_back(texture_description);
+}
+
+// Create an instance buffer for each frame in flight.
+// The buffers stay mapped, so the instances are written straight into them while the draws are recorded.
+// They are storage buffers too, as the GPU culling writes the visible instances itself.
+std::vector<UniformBufferInfo> create_vulkan_instance_buffers
+(
+    const VkDevice &logical_device,
+    const VkPhysicalDevice &physical_device,
+    const uint32_t &images_count
+)
+{
+    log("Creating " + std::to_string(images_count) + " instance buffers..");
+
+    if (logical_device == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Instance buffers creation failed! The logical device provided (" + force_string(logical_device) + ") is not valid!");
+    }
+
+    if (physical_device == VK_NULL_HANDLE)
+    {
+        fatal_error_log("Instance buffers creation failed! The physical device provided (" + force_string(physical_device) + ") is not valid!");
+    }
+
+    if (images_count < 1)
+    {
+        fatal_error_log("Instance buffers creation failed! The images count provided (" + std::to_string(images_count) + ") is not valid!");
+    }
+
+    std::vector<UniformBufferInfo> output;
+    output.reserve(images_count);
+    const VkDeviceSize buffer_size = sizeof(InstanceData) * EngineConfig::MAX_SCENE_INSTANCES;
+
+    for (int i = 0; i < images_count; i++)
+    {
+        VkBuffer buffer = VK_NULL_HANDLE;
+        VkDeviceMemory buffer_memory = VK_NULL_HANDLE;
+        void* data;
+
+        create_vulkan_buffer(logical_device, physical_device, buffer_size, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, buffer, buffer_memory);
+        vkMapMemory(logical_device, buffer_memory, 0, buffer_size, 0, &data); // Map the buffer memory in the app address space.
+
+        const UniformBufferInfo info =
+        {
+            buffer,
+            buffer_memory,
+            data
+        };
+
+        output.emplace_back(info);
+        log("- Instance buffer #" + std::to_string(i + 1) + "/" + std::to_string(images_count) + " (" + force_string(buffer) + ") created successfully!");
+    }
+
+    log(std::to_string(output.size()) + " instance buffers created successfully!");
+    return output;
+}
+
+// Destroy some instance buffers.
+void destroy_vulkan_instance_buffers
+(
+    const VkDevice &logical_device,
+    std::vector<UniformBufferInfo> &instance_buffers
+)
+{
+    log("Destroying " + std::to_string(instance_buffers.size()) + " instance buffers..");
+
+    if (logical_device == VK_NULL_HANDLE)
+    {
+        error_log("Instance buffers destruction failed! The logical device provided (" + force_string(logical_device) + ") is not valid!");
+        return;
+    }
+
+    if (instance_buffers.size() < 1)
+    {
+        error_log("Instance buffers destruction failed! No instance buffers were provided!");
+        return;
+    }
+
+    int failed = 0;
+    int i = 0;
+
+    for (UniformBufferInfo &instance_buffer : instance_buffers)
+    {
+        i++;
+
+        if (instance_buffer.buffer == VK_NULL_HANDLE || instance_buffer.buffer_memory == VK_NULL_HANDLE)
+        {
+            error_log("- Failed to destroy the instance buffer #" + std::to_string(i) + "/" + std::to_string(instance_buffers.size()) + "! The buffer (" + force_string(instance_buffer.buffer) + ") or its memory (" + force_string(instance_buffer.buffer_memory) + ") is not valid!");
+            failed++;
+            continue;
+        }
+
+        vkDestroyBuffer(logical_device, instance_buffer.buffer, nullptr);
+        vkFreeMemory(logical_device, instance_buffer.buffer_memory, nullptr);
+
+        instance_buffer.buffer = VK_NULL_HANDLE;
+        instance_buffer.buffer_memory = VK_NULL_HANDLE;
+        instance_buffer.data = nullptr;
+
+        log("- Instance buffer #" + std::to_string(i) + "/" + std::to_string(instance_buffers.size()) + " destroyed successfully!");
+    }
+
+    if (failed > 0)
+    {
+        error_log("Warning: " + std::to_string(failed) + " instance buffers failed to destroy! This might lead to some memory leaks or memory overload.");
+    }
+
+    log(std::to_string(instance_buffers.size() - failed) + "/" + std::to_string(instance_buffers.size()) + " instance buffers destroyed successfully!");
+    instance_buffers.clear();
+}
+
+///////////////////////////////////////////////
+//////////////////// Class ////////////////////
+///////////////////////////////////////////////
+
+// Constructor.
+Vulkan_InstanceBuffers::Vulkan_InstanceBuffers
+(
+    const VkDevice &logical_device,
+    const VkPhysicalDevice &physical_device,
+    const uint32_t &images_count
+) : logical_device(logical_device)
+{
+    instance_buffers = create_vulkan_instance_buffers(logical_device, physical_device, images_count);
+}
+
+// Destructor.
+Vulkan_InstanceBuffers::~Vulkan_InstanceBuffers()
+{
+    retire_vulkan_resource([logical_device = logical_device, instance_buffers = instance_buffers]() mutable
+    {
+        destroy_vulkan_instance_buffers(logical_device, instance_buffers);
+    });
+}
+
+std::vector<UniformBufferInfo> Vulkan_InstanceBuffers::get() const
+{
+    return instance_buffers;
+}
@@ -0,0 +1,79 @@
+#include "vertex.layout.hpp"
+#include "../uniform/uniform.buffers.hpp"
+
+#include <vulkan/vulkan.h>
+#include <vector>
+#include <cstdint>
+
+#ifndef VULKAN_VERTEX_INSTANCES_HPP
+#define VULKAN_VERTEX_INSTANCES_HPP
+
+// Binding of the per-instance attributes, the vertices use the binding 0.
+constexpr const uint32_t INSTANCE_BINDING = 1;
+
+////////////////////////////////////////////////////
+//////////////////// Structures ////////////////////
+////////////////////////////////////////////////////
+
+// Data read once per drawn instance (see the instance inputs of the vertex shader).
+struct InstanceData
+{
+    uint32_t transform_index;  // Index of the instance world matrix in the transform buffer.
+    int32_t texture_index;
+};
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+void add_instance_attributes
+(
+    VertexLayout &layout
+);
+
+std::vector<UniformBufferInfo> create_vulkan_instance_buffers
+(
+    const VkDevice &logical_device,
+    const VkPhysicalDevice &physical_device,
+    const uint32_t &images_count
+);
+
+void destroy_vulkan_instance_buffers
+(
+    const VkDevice &logical_device,
+    std::vector<UniformBufferInfo> &instance_buffers
+);
+
+///////////////////////////////////////////////
+//////////////////// Class ////////////////////
+///////////////////////////////////////////////
+
+class Vulkan_InstanceBuffers
+{
+
+public:
+    // Constructor.
+    Vulkan_InstanceBuffers
+    (
+        const VkDevice &logical_device,
+        const VkPhysicalDevice &physical_device,
+        const uint32_t &images_count
+    );
+
+    // Destructor.
+    ~Vulkan_InstanceBuffers();
+
+    std::vector<UniformBufferInfo> get() const;
+
+    // Prevent data duplication.
+    Vulkan_InstanceBuffers(const Vulkan_InstanceBuffers&) = delete;
+    Vulkan_InstanceBuffers &operator = (const Vulkan_InstanceBuffers&) = delete;
+
+private:
+    // We declare the members of the class to store.
+    VkDevice logical_device = VK_NULL_HANDLE;
+    std::vector<UniformBufferInfo> instance_buffers;
+
+};
+
+#endif
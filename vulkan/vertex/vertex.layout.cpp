@@ -0,0 +1,248 @@
+#include "vertex.layout.hpp"
+
+#include "vertex.handler.hpp"
+#include "vertex.instances.hpp"
+#include "../../config/engine.config.hpp"
+#include "../../logs/logs.handler.hpp"
+#include "../../utils/tool.quantization.hpp"
+
+#include <vulkan/vulkan.h>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Return the size in bytes of a vertex attribute format.
+// Only the formats handled by pack_vertices are listed.
+uint32_t get_vertex_format_size
+(
+    const VkFormat &format
+)
+{
+    switch (format)
+    {
+        case VK_FORMAT_R32G32B32A32_SFLOAT: return 16;
+        case VK_FORMAT_R32G32B32_SFLOAT: return 12;
+        case VK_FORMAT_R32G32_SFLOAT: return 8;
+        case VK_FORMAT_R16G16B16A16_SFLOAT: return 8;
+        case VK_FORMAT_R16G16B16A16_SNORM: return 8;
+        case VK_FORMAT_R16G16_SFLOAT: return 4;
+        case VK_FORMAT_R8G8B8A8_SNORM: return 4;
+        case VK_FORMAT_R8G8B8A8_UNORM: return 4;
+        default: return 0;
+    }
+}
+
+// Compute the offsets, stride and Vulkan descriptions of a vertex layout.
+VertexLayout create_vertex_layout
+(
+    const std::vector<VertexAttributeLayout> &attributes
+)
+{
+    log("Creating a vertex layout..");
+
+    if (attributes.size() < 1)
+    {
+        fatal_error_log("Vertex layout creation failed! No attributes were provided!");
+    }
+
+    VertexLayout layout {};
+    uint32_t offset = 0;
+
+    for (const VertexAttributeLayout &attribute : attributes)
+    {
+        const uint32_t size = get_vertex_format_size(attribute.format);
+
+        if (size == 0)
+        {
+            fatal_error_log("Vertex layout creation failed! The format " + std::to_string(attribute.format) + " of the attribute at location " + std::to_string(attribute.location) + " is not supported!");
+        }
+
+        VertexAttributeLayout attribute_layout = attribute;
+        attribute_layout.offset = offset;
+        layout.attributes.push_back(attribute_layout);
+
+        const VkVertexInputAttributeDescription description
+        {
+            .location = attribute.location, // Set the shader input location.
+            .binding = 0,                   // Set the binding index.
+            .format = attribute.format,     // Set the data format.
+            .offset = offset                // Set the data offset inside the vertex.
+        };
+
+        layout.attribute_descriptions.push_back(description);
+        offset += size;
+    }
+
+    // Keep every vertex 4 bytes aligned as recommended for vertex fetching.
+    layout.stride = (offset + 3) & ~3u;
+
+    const VkVertexInputBindingDescription binding_description
+    {
+        .binding = 0,                  // Set the binding index.
+        .stride = layout.stride,       // Size of each vertex.
+        .inputRate = VK_VERTEX_INPUT_RATE_VERTEX
+    };
+
+    layout.binding_descriptions.push_back(binding_description);
+
+    log("Vertex layout created successfully! " + std::to_string(layout.attributes.size()) + " attributes, " + std::to_string(layout.stride) + " bytes per vertex.");
+    return layout;
+}
+
+// Return the vertex layout selected by the engine configuration, with the per-instance inputs.
+// Shader input locations: 0 = position, 1 = normal, 2 = texture coordinates, 3 = color.
+VertexLayout get_engine_vertex_layout()
+{
+    std::vector<VertexAttributeLayout> attributes;
+
+    if constexpr (EngineConfig::USE_COMPACT_VERTEX_FORMAT)
+    {
+        attributes.push_back({ VertexAttribute::Position, VK_FORMAT_R32G32B32_SFLOAT, 0, 0 });
+        attributes.push_back({ VertexAttribute::Normal, VK_FORMAT_R8G8B8A8_SNORM, 1, 0 });
+        attributes.push_back({ VertexAttribute::TextureCoordinates, VK_FORMAT_R16G16_SFLOAT, 2, 0 });
+
+        if constexpr (EngineConfig::USE_VERTEX_COLORS)
+            attributes.push_back({ VertexAttribute::Color, VK_FORMAT_R8G8B8A8_UNORM, 3, 0 });
+    }
+    else
+    {
+        attributes.push_back({ VertexAttribute::Position, VK_FORMAT_R32G32B32_SFLOAT, 0, 0 });
+        attributes.push_back({ VertexAttribute::Normal, VK_FORMAT_R32G32B32_SFLOAT, 1, 0 });
+        attributes.push_back({ VertexAttribute::TextureCoordinates, VK_FORMAT_R32G32_SFLOAT, 2, 0 });
+
+        if constexpr (EngineConfig::USE_VERTEX_COLORS)
+            attributes.push_back({ VertexAttribute::Color, VK_FORMAT_R32G32B32_SFLOAT, 3, 0 });
+    }
+
+    VertexLayout layout = create_vertex_layout(attributes);
+    add_instance_attributes(layout);
+
+    return layout;
+}
+
+// Write the components of an attribute into the vertex data using the requested format.
+void pack_vertex_attribute
+(
+    const VkFormat &format,
+    const float* components,
+    const uint32_t &components_count,
+    uint8_t* output
+)
+{
+    float values[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+    for (uint32_t i = 0; i < components_count && i < 4; i++)
+    {
+        values[i] = components[i];
+    }
+
+    switch (format)
+    {
+        case VK_FORMAT_R32G32B32A32_SFLOAT:
+        case VK_FORMAT_R32G32B32_SFLOAT:
+        case VK_FORMAT_R32G32_SFLOAT:
+        {
+            memcpy(output, values, get_vertex_format_size(format));
+            break;
+        }
+
+        case VK_FORMAT_R16G16B16A16_SFLOAT:
+        case VK_FORMAT_R16G16_SFLOAT:
+        {
+            const uint32_t count = get_vertex_format_size(format) / sizeof(uint16_t);
+
+            for (uint32_t i = 0; i < count; i++)
+            {
+                const uint16_t half = float_to_half(values[i]);
+                memcpy(output + i * sizeof(uint16_t), &half, sizeof(uint16_t));
+            }
+
+            break;
+        }
+
+        case VK_FORMAT_R16G16B16A16_SNORM:
+        {
+            for (uint32_t i = 0; i < 4; i++)
+            {
+                const int16_t snorm = float_to_snorm16(values[i]);
+                memcpy(output + i * sizeof(int16_t), &snorm, sizeof(int16_t));
+            }
+
+            break;
+        }
+
+        case VK_FORMAT_R8G8B8A8_SNORM:
+        {
+            for (uint32_t i = 0; i < 4; i++)
+            {
+                const int8_t snorm = float_to_snorm8(values[i]);
+                memcpy(output + i, &snorm, sizeof(int8_t));
+            }
+
+            break;
+        }
+
+        case VK_FORMAT_R8G8B8A8_UNORM:
+        {
+            // The alpha channel isn't stored on the CPU side, we make it opaque.
+            if (components_count < 4)
+            {
+                values[3] = 1.0f;
+            }
+
+            for (uint32_t i = 0; i < 4; i++)
+            {
+                output[i] = float_to_unorm8(values[i]);
+            }
+
+            break;
+        }
+
+        default:
+            break;
+    }
+}
+
+// Pack full precision vertices into the layout of the vertex buffer.
+// The output is appended to the existing data.
+void pack_vertices
+(
+    const VertexLayout &layout,
+    const std::vector<Vertex> &vertices,
+    std::vector<uint8_t> &output
+)
+{
+    const size_t start = output.size();
+    output.resize(start + static_cast<size_t>(layout.stride) * vertices.size(), 0);
+
+    for (size_t i = 0; i < vertices.size(); i++)
+    {
+        const Vertex &vertex = vertices[i];
+        uint8_t* vertex_data = output.data() + start + i * layout.stride;
+
+        for (const VertexAttributeLayout &attribute : layout.attributes)
+        {
+            uint8_t* attribute_data = vertex_data + attribute.offset;
+
+            switch (attribute.attribute)
+            {
+                case VertexAttribute::Position:
+                    pack_vertex_attribute(attribute.format, &vertex.position.x, 3, attribute_data);
+                    break;
+
+                case VertexAttribute::Normal:
+                    pack_vertex_attribute(attribute.format, &vertex.normal.x, 3, attribute_data);
+                    break;
+
+                case VertexAttribute::Color:
+                    pack_vertex_attribute(attribute.format, &vertex.color.x, 3, attribute_data);
+                    break;
+
+                case VertexAttribute::TextureCoordinates:
+                    pack_vertex_attribute(attribute.format, &vertex.texture_coordinates.x, 2, attribute_data);
+                    break;
+            }
+        }
+    }
+}
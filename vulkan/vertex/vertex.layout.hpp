@@ -0,0 +1,73 @@
+#include "vertex.handler.hpp"
+
+#include <vulkan/vulkan.h>
+#include <cstdint>
+#include <vector>
+
+#ifndef VULKAN_VERTEX_LAYOUT_HPP
+#define VULKAN_VERTEX_LAYOUT_HPP
+
+////////////////////////////////////////////////////
+//////////////////// Structures ////////////////////
+////////////////////////////////////////////////////
+
+// Vertex data that can be sent to the shaders.
+enum class VertexAttribute
+{
+    Position,
+    Normal,
+    Color,
+    TextureCoordinates
+};
+
+// Describe how one vertex attribute is stored in the vertex buffer.
+struct VertexAttributeLayout
+{
+    VertexAttribute attribute; // What data the attribute holds.
+    VkFormat format;           // How the data is packed.
+    uint32_t location;         // Shader input location.
+    uint32_t offset;           // Offset inside a vertex (computed by create_vertex_layout).
+};
+
+// Describe a full vertex as it is stored in the vertex buffer.
+// The descriptions also hold the per-instance inputs read from the instance buffer (see vertex.instances.hpp).
+struct VertexLayout
+{
+    std::vector<VertexAttributeLayout> attributes;
+    uint32_t stride;
+    std::vector<VkVertexInputBindingDescription> binding_descriptions;
+    std::vector<VkVertexInputAttributeDescription> attribute_descriptions;
+};
+
+///////////////////////////////////////////////////
+//////////////////// Functions ////////////////////
+///////////////////////////////////////////////////
+
+uint32_t get_vertex_format_size
+(
+    const VkFormat &format
+);
+
+VertexLayout create_vertex_layout
+(
+    const std::vector<VertexAttributeLayout> &attributes
+);
+
+VertexLayout get_engine_vertex_layout();
+
+void pack_vertex_attribute
+(
+    const VkFormat &format,
+    const float* components,
+    const uint32_t &components_count,
+    uint8_t* output
+);
+
+void pack_vertices
+(
+    const VertexLayout &layout,
+    const std::vector<Vertex> &vertices,
+    std::vector<uint8_t> &output
+);
+
+#endif
@@ -3,17 +3,25 @@
 #include "../config/engine.config.hpp"
 #include "../logs/logs.handler.hpp"
 #include "../game/game.main.hpp"
+#include "../game/engine/engine.frame.pacer.hpp"
+#include "../game/engine/engine.camera.hpp"
+#include "../jobs/jobs.system.hpp"
+#include "../scene/scene.world.hpp"
+#include "../scene/scene.hierarchy.hpp"
+#include "../scene/scene.systems.hpp"
 #include "buffers/buffer.index.hpp"
 #include "colors/color.attachment.hpp"
 #include "colors/color.resources.hpp"
 #include "commands/command.buffers.hpp"
 #include "commands/command.pool.hpp"
+#include "commands/command.buffer.secondary.hpp"
 #include "core/vulkan.instance.hpp"
 #include "core/vulkan.surface.hpp"
 #include "core/validation.layers.hpp"
 #include "core/vulkan.extensions.hpp"
 #include "depth/depth.attachments.hpp"
 #include "depth/depth.resources.hpp"
+#include "depth/depth.pyramid.hpp"
 #include "descriptors/descriptor.set.layout.hpp"
 #include "descriptors/descriptor.pool.hpp"
 #include "descriptors/descriptor.sets.hpp"
@@ -22,6 +30,7 @@
 #include "pipeline/pipeline.input.assembly.state.hpp"
 #include "pipeline/pipeline.dynamic.states.hpp"
 #include "pipeline/graphics.pipeline.hpp"
+#include "pipeline/pipeline.cache.hpp"
 #include "pipeline/pipeline.multisampling.hpp"
 #include "pipeline/pipeline.layout.hpp"
 #include "pipeline/pipeline.rasterization.hpp"
@@ -31,11 +40,23 @@
 #include "queues/present.queue.hpp"
 #include "queues/queues.handler.hpp"
 #include "render/draw.frames.hpp"
+#include "render/render.statistics.hpp"
+#include "render/render.visibility.hpp"
+#include "render/render.batches.hpp"
+#include "render/render.indirect.hpp"
+#include "render/render.culling.hpp"
+#include "render/render.latency.hpp"
+#include "render/render.timestamps.hpp"
+#include "render/render.capture.hpp"
+#include "render/render.dynamic.hpp"
 #include "render/multisampling.hpp"
 #include "render/render.framebuffers.hpp"
 #include "render/render.pass.hpp"
-#include "render/sync/render.sync.fences.hpp"
+#include "render/sync/render.sync.timeline.hpp"
 #include "render/sync/render.sync.semaphores.hpp"
+#include "render/sync/render.sync.deletion.hpp"
+#include "render/sync/render.sync.present.hpp"
+#include "render/graph/render.graph.cache.hpp"
 #include "shaders/shader.modules.hpp"
 #include "shaders/shader.stages.hpp"
 #include "swapchain/swapchain.data.queries.hpp"
@@ -43,28 +64,47 @@
 #include "swapchain/swapchain.data.selection.hpp"
 #include "swapchain/swapchain.recreation.hpp"
 #include "swapchain/swapchain.handler.hpp"
+#include "swapchain/swapchain.offscreen.hpp"
 #include "textures/texture.image.buffers.hpp"
 #include "textures/texture.image.views.hpp"
 #include "textures/texture.images.handler.hpp"
 #include "textures/texture.images.loader.hpp"
 #include "textures/texture.sampler.hpp"
 #include "uniform/uniform.buffers.hpp"
+#include "uniform/uniform.camera.hpp"
+#include "uniform/uniform.transforms.hpp"
+#include "vertex/vertex.instances.hpp"
 #include "vertex/vertex.buffer.hpp"
 #include "vertex/vertex.input.state.hpp"
+#include "vertex/vertex.layout.hpp"
+#include "vertex/models/models.geometry.hpp"
 #include "vertex/models/models.loader.hpp"
 
 #include <vulkan/vulkan.h>
 #include <SDL3/SDL.h>
 #include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 #include <map>
 
 // Run the game using Vulkan as the graphics API.
-void run_using_vulkan
+// Without a window (headless mode), the frames are rendered into offscreen images and timed, then the rendering stops after the frames count (0 never stops).
+// A headless run can also capture its last frame into a PPM image (no capture with an empty path).
+// A resize stress run resizes the window every few frames, then checks the longest frame against the limit of the engine config.
+// Output: false when fewer frames than requested were drawn, when the capture requested wasn't written, or when a resize stress frame was above the limit.
+bool run_using_vulkan
 (
     SDL_Window* window,
-    int &gpu_index
+    int &gpu_index,
+    const int &vsync_mode,
+    const int &fps_cap,
+    const uint64_t &frames_count,
+    const std::string &capture_path,
+    const bool &resize_stress
 )
 {
     std::vector<const char*> layers;
@@ -76,42 +116,89 @@ void run_using_vulkan
     // Verify that this device handles the required layers.
     check_vulkan_validation_layers_compatibility(layers);
 
-    const Vulkan_Instance vulkan_instance(layers);                       // Start Vulkan.
-    const Vulkan_Surface vulkan_surface (vulkan_instance.get(), window); // Create the surface that we are going to use for rendering.
+    // Without a window, nothing is presented: no surface nor swap chain is created.
+    const bool headless = window == nullptr;
+
+    if (headless)
+    {
+        log("Running in headless mode, the frames are rendered into offscreen images.");
+    }
+
+    const Vulkan_Instance vulkan_instance(layers, headless); // Start Vulkan.
+    std::unique_ptr<Vulkan_Surface> vulkan_surface;          // Surface that we are going to use for rendering, none in headless mode.
+
+    if (!headless)
+    {
+        vulkan_surface = std::make_unique<Vulkan_Surface>(vulkan_instance.get(), window);
+    }
 
     const VkPhysicalDevice physical_device = select_physical_device(vulkan_instance.get(), gpu_index); // Select a compatible device with rendering capabilities.
     const VkSampleCountFlagBits samples_count = get_max_sample_count(physical_device);
 
-    // Retrieve the swap chain capabilities of our selected physical device.
-    const VkSurfaceCapabilitiesKHR swapchain_capabilities = get_vulkan_swapchain_capabilities(physical_device, vulkan_surface.get());
-    VkExtent2D extent = select_vulkan_swapchain_extent_resolution(swapchain_capabilities, window); // Select the swap chain resolution.
-
-    // Query and select the best surface format and present mode of the selected physical device.
-    const std::vector<VkSurfaceFormatKHR> swapchain_surface_formats = get_vulkan_swapchain_surface_formats(physical_device, vulkan_surface.get());
-    const std::vector<VkPresentModeKHR> swapchain_present_modes = get_vulkan_swapchain_present_modes(physical_device, vulkan_surface.get());
-    const VkSurfaceFormatKHR surface_format = select_best_vulkan_swapchain_surface_format(swapchain_surface_formats);
-    const VkPresentModeKHR present_mode = select_best_vulkan_swapchain_present_mode(swapchain_present_modes);
+    // The frames rendered at once don't depend on the swap chain images count, only the render finished semaphores follow the swap chain images.
+    const uint32_t frames_in_flight = std::max(1u, EngineConfig::MAX_FRAMES_IN_FLIGHT);
 
-    // Determine the amount of images that we can produce at once with our swap chain.
-    uint32_t images_count = swapchain_capabilities.minImageCount + 1;
+    // In headless mode, the offscreen images have a fixed resolution and the format preferred for the swap chain, one image per frame in flight.
+    VkSurfaceCapabilitiesKHR swapchain_capabilities {};
+    VkExtent2D extent { EngineConfig::HEADLESS_WIDTH, EngineConfig::HEADLESS_HEIGHT };
+    VkSurfaceFormatKHR surface_format { VK_FORMAT_B8G8R8A8_SRGB, VK_COLOR_SPACE_SRGB_NONLINEAR_KHR };
+    VkPresentModeKHR present_mode = VK_PRESENT_MODE_FIFO_KHR;
+    uint32_t images_count = frames_in_flight;
 
-    if (swapchain_capabilities.maxImageCount > 0 && images_count > swapchain_capabilities.maxImageCount)
+    if (!headless)
     {
-        images_count = swapchain_capabilities.maxImageCount; // Select the maximum images count instead.
-        error_log("Fixed the images count which was higher than the swapchain capabilities: " + std::to_string(images_count) + " > " + std::to_string(swapchain_capabilities.maxImageCount) + ".");
+        // Retrieve the swap chain capabilities of our selected physical device.
+        swapchain_capabilities = get_vulkan_swapchain_capabilities(physical_device, vulkan_surface->get());
+        extent = select_vulkan_swapchain_extent_resolution(swapchain_capabilities, window); // Select the swap chain resolution.
+
+        // Query and select the best surface format and present mode of the selected physical device.
+        const std::vector<VkSurfaceFormatKHR> swapchain_surface_formats = get_vulkan_swapchain_surface_formats(physical_device, vulkan_surface->get());
+        const std::vector<VkPresentModeKHR> swapchain_present_modes = get_vulkan_swapchain_present_modes(physical_device, vulkan_surface->get());
+        surface_format = select_best_vulkan_swapchain_surface_format(swapchain_surface_formats);
+        present_mode = select_best_vulkan_swapchain_present_mode(swapchain_present_modes, vsync_mode);
+
+        // Determine the amount of images that we can produce at once with our swap chain.
+        images_count = swapchain_capabilities.minImageCount + 1;
+
+        if (swapchain_capabilities.maxImageCount > 0 && images_count > swapchain_capabilities.maxImageCount)
+        {
+            images_count = swapchain_capabilities.maxImageCount; // Select the maximum images count instead.
+            error_log("Fixed the images count which was higher than the swapchain capabilities: " + std::to_string(images_count) + " > " + std::to_string(swapchain_capabilities.maxImageCount) + ".");
+        }
     }
 
     // Retrieve all queues available on the physical device.
-    // Then retrieve the graphics and present queue families.
+    // Then retrieve the graphics and present queue families, the graphics queue "presents" in headless mode.
     const std::vector<VkQueueFamilyProperties> queue_families_list = get_queue_families(physical_device);
     const uint32_t graphics_family_index = get_graphics_family_index(queue_families_list);
-    const uint32_t present_family_index = get_present_family_index(queue_families_list, physical_device, vulkan_surface.get());
+    const uint32_t present_family_index = headless ? graphics_family_index : get_present_family_index(queue_families_list, physical_device, vulkan_surface->get());
 
     // Set their indexes as required.
     std::vector<uint32_t> required_queue_indexes = { graphics_family_index, present_family_index };
 
-    // List the Vulkan extensions that we are going to use.
-    const std::vector<const char*> required_extensions = { VK_KHR_SWAPCHAIN_EXTENSION_NAME };
+    // List the Vulkan extensions that we are going to use, the present wait ones only serve the low latency mode.
+    const bool present_wait = !headless && EngineConfig::USE_LOW_LATENCY_MODE && get_present_wait_support(physical_device);
+    std::vector<const char*> required_extensions;
+
+    if (!headless)
+    {
+        required_extensions.push_back(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
+    }
+
+    if (present_wait)
+    {
+        required_extensions.push_back(VK_KHR_PRESENT_ID_EXTENSION_NAME);
+        required_extensions.push_back(VK_KHR_PRESENT_WAIT_EXTENSION_NAME);
+    }
+
+    // The present fences tell when a replaced swap chain is done presenting, the present queue idles otherwise.
+    const bool present_fences = !headless && get_present_fence_support(physical_device);
+
+    if (present_fences)
+    {
+        required_extensions.push_back(VK_EXT_SWAPCHAIN_MAINTENANCE_1_EXTENSION_NAME);
+    }
+
     check_vulkan_extensions_support(physical_device, required_extensions);
 
     // Make the queues' create info for the logical device.
@@ -120,95 +207,196 @@ void run_using_vulkan
     // Create the logical device which handles rendering, queues and extensions.
     const Vulkan_LogicalDevice logical_device(physical_device, queues_create_info, required_extensions);
 
-    // Create the color resources for multisampling.
-    Vulkan_ColorResources color_resources(physical_device, logical_device.get(), extent, surface_format.format, samples_count);
+    // Objects replaced during the rendering, like the swap chain on a resize, destroyed once the frames using them are done.
+    Vulkan_DeletionQueue deletion_queue;
+
+    // The replaced swap chains and semaphores wait for their presents as well.
+    const Vulkan_PresentFences present_fences_handler(logical_device.get(), frames_in_flight, present_fences);
+
+    // Render graphs compiled per frame shape, with their transient images, retired before the deletion queue stops.
+    const Vulkan_RenderGraphCache render_graph_cache(physical_device, logical_device.get());
+
+    // Pipelines compiled by the previous launches, saved again once the rendering stops.
+    const Vulkan_PipelineCache pipeline_cache(physical_device, logical_device.get(), EngineConfig::PIPELINE_CACHE_FILE_NAME, EngineConfig::USE_PIPELINE_CACHE);
 
     // Retrieve the queues that have been created alongside the logical device.
     VkQueue graphics_queue, present_queue;
     vkGetDeviceQueue(logical_device.get(), graphics_family_index, 0, &graphics_queue);
     vkGetDeviceQueue(logical_device.get(), present_family_index, 0, &present_queue);
 
-    // Create the swap chain which handles the chain of images during rendering.
-    Vulkan_Swapchain swapchain
-    (
-        logical_device.get(),
-        swapchain_capabilities,
-        present_mode,
-        vulkan_surface.get(),
-        surface_format,
-        extent,
-        graphics_family_index,
-        present_family_index,
-        images_count
-    );
+    // Create the swap chain which handles the chain of images during rendering, or the offscreen images replacing it in headless mode.
+    std::unique_ptr<Vulkan_Swapchain> swapchain;
+    std::unique_ptr<Vulkan_OffscreenImages> offscreen_images;
+    std::vector<VkImage> swapchain_images;
 
-    // Retrieve all swap chain images and create their views.
-    const std::vector<VkImage> swapchain_images = get_vulkan_swapchain_images(logical_device.get(), swapchain.get());
-    Vulkan_SwapchainImageViews swapchain_images_views(logical_device.get(), swapchain_images, surface_format.format);
+    if (headless)
+    {
+        offscreen_images = std::make_unique<Vulkan_OffscreenImages>(physical_device, logical_device.get(), extent, surface_format.format, images_count);
+        swapchain_images = offscreen_images->get().images;
+    }
+    else
+    {
+        swapchain = std::make_unique<Vulkan_Swapchain>
+        (
+            logical_device.get(),
+            swapchain_capabilities,
+            present_mode,
+            vulkan_surface->get(),
+            surface_format,
+            extent,
+            graphics_family_index,
+            present_family_index,
+            images_count,
+            VK_NULL_HANDLE
+        );
+
+        swapchain_images = get_vulkan_swapchain_images(logical_device.get(), swapchain->get()); // Retrieve all swap chain images.
+    }
+
+    // Create the views of the images we render into.
+    std::unique_ptr<Vulkan_SwapchainImageViews> swapchain_images_views = std::make_unique<Vulkan_SwapchainImageViews>(logical_device.get(), swapchain_images, surface_format.format);
 
     // Load and create modules and stages for the shaders.
     const Vulkan_ShadersModules shaders_modules(logical_device.get());
     const std::vector<VkPipelineShaderStageCreateInfo> shaders_stages = create_vulkan_shader_stages(shaders_modules.get());
 
+    // Describe how the vertices are packed in the vertex buffer.
+    const VertexLayout vertex_layout = get_engine_vertex_layout();
+
     // Prepare create info for graphics pipeline's components.
     const VkPipelineDynamicStateCreateInfo dynamic_states = create_vulkan_dynamic_states(); // Allow to modify states without having to recreate the graphics pipeline.
-    const VkPipelineVertexInputStateCreateInfo vertex_input_state = create_vulkan_vertex_input_state(); // Handle inputs in the vertex shader files.
+    const VkPipelineVertexInputStateCreateInfo vertex_input_state = create_vulkan_vertex_input_state(vertex_layout); // Handle inputs in the vertex shader files.
     const VkPipelineInputAssemblyStateCreateInfo assembly_input_state = create_vulkan_assembly_input_state(); // Define how we assemble objects.
     const VkPipelineRasterizationStateCreateInfo rasterization_state = create_vulkan_rasterization_state(); // Handle the conversion from geometry to pixels.
     const VkPipelineMultisampleStateCreateInfo multisampling_state = create_vulkan_multisampling_state(samples_count); // Anti-aliasing.
 
     // Define the region of the Vulkan surface that will be affected by the rendering.
     const VkPipelineViewportStateCreateInfo viewport_state = create_viewport_state();
-    const VkViewport viewport = create_vulkan_viewport(extent);
-    const VkRect2D scissor = create_vulkan_scissor(extent);
+    VkViewport viewport = create_vulkan_viewport(extent);
+    VkRect2D scissor = create_vulkan_scissor(extent);
+
+    std::vector<Mesh> meshes;
+    ModelScene scene;
+    load_3d_models(meshes, scene);
+
+    // Pack the meshes with the vertex layout and the smallest index type each mesh allows.
+    const GeometryData geometry = build_geometry_data(meshes, vertex_layout);
+    CameraController camera_controller = create_camera_controller(get_default_camera()); // Point of view used for the rendering and the levels of detail selection.
+    const CameraData &camera = camera_controller.camera;
+    DrawStatistics statistics {};                   // Work submitted to the GPU during the last frame.
+
+    EntityWorld world;                               // Objects of the scene.
+    TransformHierarchy hierarchy(frames_in_flight);  // World transforms of the objects, uploaded to each frame transform buffer.
+    std::vector<RenderObject> render_objects;        // Objects to draw, collected from the scene at each frame.
+    VisibilityBounds visibility_bounds {};           // World bounding spheres of the objects, tested against the camera frustum.
+    std::vector<uint32_t> visible_objects;           // Objects inside the camera view this frame.
+    std::vector<DrawBatch> draw_batches;             // Batches of the visible objects, rebuilt at each frame.
+    std::vector<VkDrawIndexedIndirectCommand> draw_commands; // Draws of the batches, copied to the indirect buffer of each frame.
+    std::vector<IndirectDrawRun> draw_runs;                  // Draws sharing an index type, submitted together.
+    create_game_scene(world, hierarchy, scene, geometry.meshes.size());
 
-    std::vector<Vertex> vertices;
-    std::vector<uint32_t> indices;
+    const Vulkan_CommandPool command_pool(logical_device.get(), graphics_family_index); // Handle command buffers memory.
+    const std::vector<VkCommandBuffer> command_buffers = create_vulkan_command_buffers(logical_device.get(), command_pool.get(), frames_in_flight); // Store sent commands.
+    const Vulkan_SecondaryCommandBuffers secondary_command_buffers(EngineConfig::USE_SECONDARY_COMMAND_BUFFERS, logical_device.get(), graphics_family_index, frames_in_flight, get_job_threads_count()); // Draws recorded by the job threads.
+    const SecondaryCommandBuffers secondary = secondary_command_buffers.get(); // No slices when the draws are recorded by the main thread only.
+    const Vulkan_VertexBuffer vertex_buffer(logical_device.get(), physical_device, command_pool.get(), graphics_queue, geometry.vertex_data); // Handle the vertex shader data.
+    const Vulkan_IndexBuffer index_buffer(logical_device.get(), physical_device, command_pool.get(), graphics_queue, geometry.index_data); // Handle the shader data indexes.
+    const Vulkan_UniformBuffers uniform_buffers(logical_device.get(), physical_device, command_pool.get(), graphics_queue, frames_in_flight); // Handle data passed to shaders.
+    const Vulkan_TransformBuffers transform_buffers(logical_device.get(), physical_device, frames_in_flight); // World matrices of the scene nodes.
+    const Vulkan_InstanceBuffers instance_buffers(logical_device.get(), physical_device, frames_in_flight); // Transform and texture of each drawn instance.
+    const Vulkan_IndirectBuffers indirect_buffers(logical_device.get(), physical_device, frames_in_flight); // Draws read by the indirect draw calls.
+    const IndirectDrawSupport indirect_support = get_indirect_draw_support(physical_device);
+
+    // Cull the objects with a compute shader when the device can draw the instances it writes.
+    const bool gpu_culling = EngineConfig::USE_GPU_CULLING && is_gpu_culling_supported(indirect_support, queue_families_list[graphics_family_index]);
+
+    if (EngineConfig::USE_GPU_CULLING && !gpu_culling)
+    {
+        error_log("The selected GPU can't cull the objects itself, they will be culled on the CPU.");
+    }
 
-    load_3d_models(vertices, indices);
+    // The occlusion culling tests the objects against a depth pyramid built by the GPU culling between its two phases.
+    const bool occlusion_culling = gpu_culling && EngineConfig::USE_OCCLUSION_CULLING;
 
-    const Vulkan_CommandPool command_pool(logical_device.get(), graphics_family_index); // Handle command buffers memory.
-    const std::vector<VkCommandBuffer> command_buffers = create_vulkan_command_buffers(logical_device.get(), command_pool.get(), images_count); // Store sent commands.
-    const Vulkan_VertexBuffer vertex_buffer(logical_device.get(), physical_device, command_pool.get(), graphics_queue, vertices); // Handle the vertex shader data.
-    const Vulkan_IndexBuffer index_buffer(logical_device.get(), physical_device, command_pool.get(), graphics_queue, vertices, indices); // Handle the shader data indexes.
-    const Vulkan_UniformBuffers uniform_buffers(logical_device.get(), physical_device, command_pool.get(), graphics_queue, images_count); // Handle data passed to shaders.
+    if (EngineConfig::USE_OCCLUSION_CULLING && !gpu_culling)
+    {
+        error_log("The occlusion culling needs the GPU culling, the objects will only be culled against the camera frustum.");
+    }
+
+    const Vulkan_GpuCulling gpu_culling_resources(gpu_culling, occlusion_culling, logical_device.get(), pipeline_cache.get(), physical_device, shaders_modules.get(), geometry.meshes, transform_buffers.get(), indirect_buffers.get(), instance_buffers.get(), frames_in_flight);
+    const GpuCullingResources culling = gpu_culling_resources.get(); // Null pipeline when the objects are culled on the CPU.
 
     // Depth management.
-    Vulkan_DepthResources depth_resources(physical_device, logical_device.get(), command_pool.get(), graphics_queue, extent, samples_count);
+    std::unique_ptr<Vulkan_DepthResources> depth_resources = std::make_unique<Vulkan_DepthResources>(physical_device, logical_device.get(), extent, samples_count);
     const VkAttachmentDescription depth_attachment = create_depth_attachment(physical_device, samples_count);
     const VkAttachmentReference depth_attachment_reference = create_depth_attachment_reference();
 
-    const VkAttachmentDescription color_attachment = create_vulkan_color_attachment(surface_format.format, samples_count);
-    const Vulkan_RenderPass render_pass(logical_device.get(), color_attachment, depth_attachment, depth_attachment_reference, surface_format); // Define the way we use color attachments for rendering.
-    Vulkan_Framebuffers framebuffers(logical_device.get(), swapchain_images_views.get(), color_resources.get().color_image_view, depth_resources.get().image_view, extent, render_pass.get()); // Store the image views in buffers.
+    // The rendered images are presented, or copied from in headless mode.
+    const VkImageLayout final_layout = headless ? VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL : VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
 
-    const Vulkan_Fence fences(logical_device.get(), images_count); // Handle CPU/GPU synchronisation.
-    Vulkan_Semaphores semaphores(logical_device.get(), (images_count * 2)); // Image retrieve and rendering synchronisation.
+    // Draw without render passes nor framebuffers when the device can, so nothing has to be recreated with the attachments but their views.
+    const bool dynamic_rendering = EngineConfig::USE_DYNAMIC_RENDERING && get_dynamic_rendering_support(physical_device);
 
-    const int fences_count = fences.get().size();
-    const int semaphores_count = semaphores.get().size();
+    if (EngineConfig::USE_DYNAMIC_RENDERING && !dynamic_rendering)
+    {
+        error_log("The selected GPU doesn't support the dynamic rendering, the frames will be drawn with render passes.");
+    }
+
+    std::unique_ptr<Vulkan_RenderPass> render_pass;      // Define the way we use color attachments for rendering.
+    std::unique_ptr<Vulkan_RenderPass> late_render_pass; // Draw over the first render pass, for the second culling phase.
+    std::unique_ptr<Vulkan_Framebuffers> framebuffers;   // Store the image views in buffers.
+    std::unique_ptr<Vulkan_ColorResources> color_resources; // Multisampled color of the render passes, a transient image of the render graph with the dynamic rendering.
 
-    if (fences_count != semaphores_count / 2)
+    if (!dynamic_rendering)
     {
-        fatal_error_log("The amount of semaphores doesn't match the amount of fences: " + std::to_string(fences.get().size()) + " != " + std::to_string(semaphores_count / 2) + ".");
+        color_resources = std::make_unique<Vulkan_ColorResources>(physical_device, logical_device.get(), extent, surface_format.format, samples_count);
+
+        const VkAttachmentDescription color_attachment = create_vulkan_color_attachment(surface_format.format, samples_count);
+        render_pass = std::make_unique<Vulkan_RenderPass>(logical_device.get(), color_attachment, depth_attachment, depth_attachment_reference, surface_format, final_layout);
+        late_render_pass = std::make_unique<Vulkan_RenderPass>(logical_device.get(), get_vulkan_loaded_attachment(color_attachment), get_vulkan_loaded_attachment(depth_attachment), depth_attachment_reference, surface_format, final_layout);
+        framebuffers = std::make_unique<Vulkan_Framebuffers>(logical_device.get(), swapchain_images_views->get(), color_resources->get().color_image_view, depth_resources->get().image_view, extent, render_pass->get());
     }
 
-    if (semaphores_count % 2 != 0)
+    // Attachments drawn with the dynamic rendering, gathered again when they are recreated.
+    const VkPipelineRenderingCreateInfo pipeline_rendering_info = create_vulkan_pipeline_rendering_info(surface_format.format, depth_attachment.format);
+    DynamicRenderingAttachments dynamic_attachments = get_dynamic_rendering_attachments(dynamic_rendering, swapchain_images, swapchain_images_views->get(), surface_format.format, depth_resources->get().depth_image, depth_resources->get().image_view, depth_attachment.format, samples_count, final_layout);
+
+    // Farthest depth of the first culling phase, at a decreasing resolution.
+    std::unique_ptr<Vulkan_DepthPyramid> depth_pyramid = std::make_unique<Vulkan_DepthPyramid>(occlusion_culling, physical_device, logical_device.get(), pipeline_cache.get(), shaders_modules.get(), depth_resources->get().image_view, extent, samples_count);
+
+    if (occlusion_culling)
     {
-        fatal_error_log("The amount of semaphores (" + std::to_string(semaphores_count) + ") isn't even!");
+        bind_vulkan_culling_depth_pyramid(logical_device.get(), culling.descriptor_sets, depth_pyramid->get());
     }
 
-    // Control when an image is ready to be drawn.
+    const Vulkan_TimelineSemaphore timeline_semaphore(logical_device.get(), 0); // Handle CPU/GPU synchronisation, each submitted frame signals its own value.
+    const Vulkan_GpuTimestamps gpu_timestamps(physical_device, logical_device.get(), queue_families_list[graphics_family_index], frames_in_flight); // Measure the GPU time of the frames.
+
+    // Copy the last frame back to the CPU when a capture is requested, only the offscreen images can be copied from.
+    const bool capture_requested = headless && !capture_path.empty() && frames_count > 0;
+    const Vulkan_FrameCapture frame_capture(logical_device.get(), physical_device, extent, capture_requested);
+    bool frame_captured = false;
+    std::unique_ptr<Vulkan_Semaphores> semaphores = std::make_unique<Vulkan_Semaphores>(logical_device.get(), images_count + frames_in_flight); // Image retrieve and rendering synchronisation.
+
+    const int semaphores_count = semaphores->get().size();
+
+    if (semaphores_count != images_count + frames_in_flight)
+    {
+        fatal_error_log("The amount of semaphores doesn't match the swap chain images and the frames in flight: " + std::to_string(semaphores_count) + " != " + std::to_string(images_count + frames_in_flight) + ".");
+    }
+
+    // Control when an image is ready to be drawn, one per frame in flight.
     std::vector<VkSemaphore> image_available_semaphores;
-    image_available_semaphores.reserve(semaphores_count / 2);
+    image_available_semaphores.reserve(frames_in_flight);
 
     // Control when an image rendering is done and ready to be shown.
+    // One per swap chain image, as an image can only signal it again once it has been presented.
     std::vector<VkSemaphore> render_finished_semaphores;
-    render_finished_semaphores.reserve(semaphores_count / 2);
+    render_finished_semaphores.reserve(images_count);
 
     int i = 0;
 
-    for (const VkSemaphore &semaphore : semaphores.get())
+    for (const VkSemaphore &semaphore : semaphores->get())
     {
         i++;
 
@@ -217,8 +405,8 @@ void run_using_vulkan
             fatal_error_log("Semaphore #" + std::to_string(i) + "/" + std::to_string(semaphores_count) + " not valid!");
         }
 
-        // Half of the semaphores goes to a list, the other half to another.
-        if (semaphores_count / 2 < i)
+        // The first semaphores go to the swap chain images, the next ones to the frames in flight.
+        if (static_cast<int>(images_count) < i)
         {
             image_available_semaphores.emplace_back(semaphore);
         }
@@ -242,16 +430,17 @@ void run_using_vulkan
     const Vulkan_TextureSampler texture_sampler(physical_device, logical_device.get());
 
     const Vulkan_DescriptorSetLayout descriptor_set_layout(logical_device.get(), texture_image_views.get());      // Describe the shader layouts.
-    const Vulkan_DescriptorPool descriptor_pool(logical_device.get(), images_count, texture_images.get().size()); // Descriptor sets allocator.
+    const Vulkan_DescriptorPool descriptor_pool(logical_device.get(), frames_in_flight, texture_images.get().size()); // Descriptor sets allocator.
 
     // Bind our uniform buffers to the shaders.
     const std::vector<VkDescriptorSet> descriptor_sets = create_vulkan_descriptor_sets
     (
         logical_device.get(),
-        images_count,
+        frames_in_flight,
         descriptor_set_layout.get(),
         descriptor_pool.get(),
         uniform_buffers.get(),
+        transform_buffers.get(),
         texture_image_views.get(),
         texture_sampler.get()
     );
@@ -262,6 +451,7 @@ void run_using_vulkan
     const Vulkan_GraphicsPipeline graphics_pipeline
     (
         logical_device.get(),
+        pipeline_cache.get(),
         shaders_stages,
         vertex_input_state,
         assembly_input_state,
@@ -269,18 +459,61 @@ void run_using_vulkan
         rasterization_state,
         multisampling_state,
         pipeline_layout.get(),
-        render_pass.get(),
+        render_pass ? render_pass->get() : VK_NULL_HANDLE,
+        pipeline_rendering_info,
         dynamic_states
     );
 
     bool running = true;
-    size_t frame = 0; // Targeted frame by the drawing function.
-    SDL_Event event;  // Window events listener.
+    size_t frame = 0;                                                  // Targeted frame by the drawing function.
+    uint64_t frames_drawn = 0;                                         // Frames drawn successfully since the start.
+    uint64_t timeline_value = 0;                                       // Last value signaled by a submitted frame.
+    std::vector<uint64_t> frames_timeline_values(frames_in_flight, 0); // Value signaled by the last submit of each frame.
+    SDL_Event event;                                                   // Window events listener.
+    FramePacer pacer = create_frame_pacer(fps_cap);                    // Hold the frames to the frame rate cap.
+    LatencyGovernor latency = create_latency_governor(EngineConfig::USE_LOW_LATENCY_MODE && !headless, logical_device.get(), present_wait);
+
+    // CPU and GPU times of each frame, reported at the end in headless and resize stress modes.
+    // A frame requesting the swap chain recreation is counted with the next one, so the recreation time isn't hidden.
+    FrameTimings frame_timings = create_frame_timings(frames_in_flight);
+    const bool timed = headless || resize_stress;
+    std::chrono::steady_clock::time_point frame_start;
+    bool frame_recreated = false;
+
+    // The window is resized between the initial size and smaller ones in resize stress mode.
+    int window_width = 0, window_height = 0;
+    uint64_t next_resize = EngineConfig::RESIZE_STRESS_INTERVAL;
+    uint64_t recreations_count = 0;
+
+    if (resize_stress)
+    {
+        SDL_GetWindowSize(window, &window_width, &window_height);
+    }
 
     // Main app loop.
     while (running)
     {
-        while (SDL_PollEvent(&event))
+        // Wait for the frame deadline, and for the previous frame in low latency mode, before reading the inputs.
+        // That way they are as recent as possible when the frame is drawn.
+        pace_frame(pacer);
+        begin_low_latency_frame(logical_device.get(), swapchain ? swapchain->get() : VK_NULL_HANDLE, timeline_semaphore.get(), latency);
+
+        if (!frame_recreated)
+        {
+            frame_start = std::chrono::steady_clock::now();
+        }
+
+        frame_recreated = false;
+
+        // Each resize outdates the swap chain, which is recreated while the frames keep being drawn.
+        if (resize_stress && frames_drawn >= next_resize)
+        {
+            const int scale = 4 - static_cast<int>(next_resize / EngineConfig::RESIZE_STRESS_INTERVAL % 3); // 3/4, 2/4, then 4/4 of the initial size.
+            SDL_SetWindowSize(window, window_width * scale / 4, window_height * scale / 4);
+            next_resize = frames_drawn + EngineConfig::RESIZE_STRESS_INTERVAL;
+        }
+
+        while (!headless && SDL_PollEvent(&event))
         {
             if (event.type == SDL_EVENT_QUIT || event.type == SDL_EVENT_WINDOW_CLOSE_REQUESTED)
             {
@@ -288,17 +521,51 @@ void run_using_vulkan
             }
         }
 
+        run_main_thread_jobs(); // Run the jobs which need the main thread, like the SDL calls.
+
+        // Running the game main code at each frame, then gathering the objects to draw.
+        run_game_loop(world, headless ? EngineConfig::HEADLESS_FRAME_TIME : 0.0f);
+        hierarchy.update_transforms();
+        collect_render_objects(world, hierarchy, render_objects);
+
+        // Read the inputs as late as possible, right before the camera they move is used by the culling, the levels of detail and the batches.
+        sample_late_input(latency);
+
+        if (!headless)
+        {
+            update_camera_controller(camera_controller);
+        }
+
+        // The CPU culling still runs with the GPU culling to check its results.
+        if (!gpu_culling || EngineConfig::VALIDATE_GPU_CULLING)
+        {
+            select_visible_objects(render_objects, geometry.meshes, camera, extent, visibility_bounds, visible_objects);
+        }
+
+        // The objects retired from now on may be used by this frame, until the GPU reaches its timeline value.
+        begin_vulkan_deletion_frame(timeline_value + 1);
+
+        // The last frame is copied from the offscreen image of its frame in flight, the image index in headless mode.
+        const bool capture_frame = capture_requested && frames_drawn + 1 == frames_count;
+        const FrameCaptureTarget capture_target { capture_frame ? swapchain_images[frame] : VK_NULL_HANDLE, capture_frame ? frame_capture.get().buffer.buffer : VK_NULL_HANDLE };
+
         // Try to render and draw the frame onto the window.
         const std::string draw_output = draw_frame
         (
             logical_device.get(),
-            fences.get(),
-            swapchain.get(),
+            timeline_semaphore.get(),
+            timeline_value,
+            frames_timeline_values,
+            swapchain ? swapchain->get() : VK_NULL_HANDLE,
             image_available_semaphores,
             render_finished_semaphores,
-            command_buffers, extent,
-            framebuffers.get(),
-            render_pass.get(),
+            command_buffers,
+            secondary,
+            extent,
+            framebuffers ? framebuffers->get() : std::vector<VkFramebuffer> {},
+            render_pass ? render_pass->get() : VK_NULL_HANDLE,
+            late_render_pass ? late_render_pass->get() : VK_NULL_HANDLE,
+            dynamic_attachments,
             graphics_pipeline.get(),
             viewport,
             scissor,
@@ -308,15 +575,69 @@ void run_using_vulkan
             vertex_buffer.get(),
             index_buffer.get(),
             uniform_buffers.get(),
+            transform_buffers.get(),
+            instance_buffers.get(),
+            indirect_buffers.get(),
+            hierarchy,
             pipeline_layout.get(),
             descriptor_sets,
             texture_image_views.get(),
-            indices
+            geometry.meshes,
+            render_objects,
+            visible_objects,
+            draw_batches,
+            draw_commands,
+            draw_runs,
+            indirect_support,
+            culling,
+            depth_pyramid->get(),
+            depth_resources->get().depth_image,
+            camera,
+            capture_target,
+            gpu_timestamps.get(),
+            statistics,
+            latency
         );
 
+        if (draw_output == "success")
+        {
+            report_draw_statistics(statistics);
+            frames_drawn++;
+            frame_captured = frame_captured || capture_frame;
+
+            if (timed)
+            {
+                record_frame_timings(frame_timings, frame, std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - frame_start).count(), statistics);
+            }
+
+            // Stop once the frames requested are drawn, in headless mode there is no window to close.
+            if (frames_count > 0 && frames_drawn >= frames_count)
+            {
+                running = false;
+            }
+
+            // Wait for the frame to compare the draws written by the GPU with the CPU culling.
+            if (gpu_culling && EngineConfig::VALIDATE_GPU_CULLING)
+            {
+                wait_vulkan_timeline_value(logical_device.get(), timeline_semaphore.get(), timeline_value);
+                validate_gpu_culling(render_objects, geometry.meshes, visible_objects, draw_commands, occlusion_culling, indirect_buffers.get()[frame].data, instance_buffers.get()[frame].data);
+            }
+        }
+
+        // Nothing can stop a headless run which fails its frames, so it stops at the first failure.
+        if (headless && draw_output == "failed")
+        {
+            error_log("Headless rendering stopped after " + std::to_string(frames_drawn) + " frames, as a frame failed to draw.");
+            running = false;
+        }
+
+        // Destroy the objects retired by the frames the GPU is done with, and by the presents done.
+        collect_vulkan_retired_presents(logical_device.get());
+        collect_vulkan_retired_resources(get_vulkan_timeline_value(logical_device.get(), timeline_semaphore.get()));
+
         // Passing to the next frame.
         // Example: 0 -> 1 -> 2 -> 0 -> 1 -> 2 -> 0...
-        frame = (frame + 1) % images_count;
+        frame = (frame + 1) % frames_in_flight;
 
         // Recreate the swap chain as the draw function requested it.
         if (draw_output == "recreate")
@@ -324,18 +645,19 @@ void run_using_vulkan
             const std::string recreate_output = recreate_vulkan_swapchain
             (
                 logical_device.get(),
-                vulkan_surface.get(),
+                vulkan_surface->get(),
                 physical_device,
                 surface_format,
                 present_mode,
                 graphics_family_index,
                 present_family_index,
-                render_pass.get(),
-                command_pool.get(),
-                graphics_queue,
+                present_queue,
+                render_pass ? render_pass->get() : VK_NULL_HANDLE,
                 samples_count,
+                frames_in_flight,
                 window,
                 swapchain,
+                swapchain_images,
                 swapchain_images_views,
                 framebuffers,
                 depth_resources,
@@ -350,10 +672,27 @@ void run_using_vulkan
             {
                 running = false; // User requested to stop the app.
             }
-        }
 
-        // Running the game main code at each frame.
-        run_game_loop();
+            if (recreate_output == "success")
+            {
+                frame_recreated = true;
+                recreations_count++;
+                viewport = create_vulkan_viewport(extent);
+                scissor = create_vulkan_scissor(extent);
+                dynamic_attachments = get_dynamic_rendering_attachments(dynamic_rendering, swapchain_images, swapchain_images_views->get(), surface_format.format, depth_resources->get().depth_image, depth_resources->get().image_view, depth_attachment.format, samples_count, final_layout);
+                reset_low_latency_presents(latency);
+            }
+
+            // The depth pyramid follows the size of the new depth resources.
+            // The culling descriptor sets can't be updated while the frames in flight read them, so we only wait for those frames.
+            if (recreate_output == "success" && occlusion_culling)
+            {
+                wait_vulkan_timeline_value(logical_device.get(), timeline_semaphore.get(), timeline_value);
+
+                depth_pyramid = std::make_unique<Vulkan_DepthPyramid>(occlusion_culling, physical_device, logical_device.get(), pipeline_cache.get(), shaders_modules.get(), depth_resources->get().image_view, extent, samples_count);
+                bind_vulkan_culling_depth_pyramid(logical_device.get(), culling.descriptor_sets, depth_pyramid->get());
+            }
+        }
     }
 
     log("Waiting for the device and queues activities to end before leaving..");
@@ -363,5 +702,48 @@ void run_using_vulkan
     vkQueueWaitIdle(graphics_queue);
     vkQueueWaitIdle(present_queue);
 
+    // All the frames are done, so the GPU times of the last ones can be read too.
+    if (timed)
+    {
+        report_frame_timings(frame_timings, logical_device.get(), gpu_timestamps.get());
+    }
+
+    // A run stopped before its frames count, by a failed frame or by the window being closed, didn't draw what was requested.
+    const bool frames_passed = frames_count == 0 || frames_drawn >= frames_count;
+
+    if (!frames_passed)
+    {
+        error_log("The run failed! Only " + std::to_string(frames_drawn) + " frames of the " + std::to_string(frames_count) + " requested were drawn.");
+    }
+
+    // The swap chain recreations must not stall the rendering, even the frame waiting for one stays under the limit.
+    bool resize_stress_passed = true;
+
+    if (resize_stress)
+    {
+        const uint64_t longest_frame = frame_timings.cpu_times.empty() ? 0 : *std::max_element(frame_timings.cpu_times.begin(), frame_timings.cpu_times.end());
+        resize_stress_passed = !frame_timings.cpu_times.empty() && longest_frame <= EngineConfig::RESIZE_STRESS_MAX_FRAME_TIME;
+
+        log("Resize stress: " + std::to_string(recreations_count) + " swap chain recreations, longest frame of " + std::to_string(longest_frame) + " us for a limit of " + std::to_string(EngineConfig::RESIZE_STRESS_MAX_FRAME_TIME) + " us.");
+
+        if (!resize_stress_passed)
+        {
+            error_log("The resize stress failed! A frame was above the limit, or no frame was drawn.");
+        }
+    }
+
+    // The captured frame is done as well, its copy can be written.
+    bool capture_written = false;
+
+    if (capture_requested)
+    {
+        if (frame_captured)
+        {
+            capture_written = save_frame_capture(frame_capture.get(), capture_path);
+        }
+        else error_log("The frame capture \"" + capture_path + "\" wasn't written, as the last frame wasn't drawn.");
+    }
+
     log("Resources are idling! Exiting..");
+    return frames_passed && (!capture_requested || capture_written) && resize_stress_passed;
 }
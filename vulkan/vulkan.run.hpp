@@ -1,13 +1,19 @@
 #include <SDL3/SDL.h>
+#include <cstdint>
 #include <string>
 
 #ifndef VULKAN_RUN_HPP
 #define VULKAN_RUN_HPP
 
-void run_using_vulkan
+bool run_using_vulkan
 (
     SDL_Window* window,
-    int &gpu_index
+    int &gpu_index,
+    const int &vsync_mode,
+    const int &fps_cap,
+    const uint64_t &frames_count,
+    const std::string &capture_path,
+    const bool &resize_stress
 );
 
 #endif